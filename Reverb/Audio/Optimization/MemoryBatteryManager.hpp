@@ -3,6 +3,8 @@
 #include <memory>
 #include <vector>
 #include <atomic>
+#include <cstdint>
+#include <cstdlib>
 #include <thread>
 #include <chrono>
 #include <cmath>
@@ -34,6 +36,10 @@ namespace Optimization {
 class MemoryBatteryManager {
 public:
     
+    static constexpr size_t NUM_POOL_SIZE_CLASSES = 4;
+    static constexpr size_t POOL_ALIGNMENT = 64;        // Cache line; covers NEON/SSE/AVX requests
+    static constexpr size_t BUFFERS_PER_POOL = 8;
+    
     // Battery and performance modes
     enum class PowerMode {
         HighPerformance,    // Full quality, maximum CPU usage
@@ -67,7 +73,7 @@ private:
     
     // Memory management
     MemoryStrategy memoryStrategy_;
-    size_t totalAllocatedMemory_;
+    std::atomic<size_t> totalAllocatedMemory_;
     size_t maxMemoryBudget_;
     std::atomic<size_t> currentMemoryUsage_{0};
     
@@ -84,33 +90,125 @@ private:
     std::atomic<bool> shouldMonitorBattery_{false};
 #endif
     
-    // Memory pools for frequent allocations
-    struct MemoryPool {
-        std::vector<std::unique_ptr<float[]>> buffers;
-        std::vector<bool> isUsed;
-        size_t bufferSize;
-        size_t alignment;
-        
-        MemoryPool(size_t size, size_t align, size_t count) 
-            : bufferSize(size), alignment(align) {
-            buffers.reserve(count);
-            isUsed.resize(count, false);
-            
-            for (size_t i = 0; i < count; ++i) {
+    /**
+     * @brief Fixed-size buffer pool with a lock-free free list
+     * 
+     * All buffers of one size class live in a single aligned slab. Free buffers
+     * form a Treiber stack of slab indices whose head packs {tag, index} into one
+     * 64-bit word: the tag changes on every push/pop, so a CAS against a stale
+     * head fails instead of corrupting the list (ABA). Allocation and release are
+     * O(1), never lock, and are safe from any thread including the audio thread.
+     */
+    class MemoryPool {
+    public:
+        MemoryPool(size_t size, size_t count)
+            : bufferSize_(size)
+            , stride_(((size * sizeof(float) + POOL_ALIGNMENT - 1) / POOL_ALIGNMENT) * POOL_ALIGNMENT)
+            , capacity_(count)
+            , slab_(nullptr)
+            , next_(new std::atomic<uint32_t>[count])
+            , head_(pack(0, EMPTY)) {
 #ifdef __APPLE__
-                void* ptr = aligned_alloc(align, size * sizeof(float));
+            slab_ = static_cast<uint8_t*>(aligned_alloc(POOL_ALIGNMENT, stride_ * count));
 #else
-                void* ptr = std::aligned_alloc(align, size * sizeof(float));
+            slab_ = static_cast<uint8_t*>(std::aligned_alloc(POOL_ALIGNMENT, stride_ * count));
 #endif
-                buffers.emplace_back(static_cast<float*>(ptr));
+            if (!slab_) {
+                capacity_ = 0;
+                return;
+            }
+            
+            // Chain every buffer: 0 -> 1 -> ... -> count-1
+            for (size_t i = 0; i < count; ++i) {
+                next_[i].store(i + 1 < count ? static_cast<uint32_t>(i + 1) : EMPTY, std::memory_order_relaxed);
             }
+            head_.store(pack(0, count > 0 ? 0 : EMPTY), std::memory_order_release);
         }
         
         ~MemoryPool() {
-            for (auto& buffer : buffers) {
-                free(buffer.release());
+            free(slab_);
+        }
+        
+        MemoryPool(const MemoryPool&) = delete;
+        MemoryPool& operator=(const MemoryPool&) = delete;
+        
+        /// Pop a free buffer, nullptr if the pool is exhausted
+        float* allocate() {
+            uint64_t head = head_.load(std::memory_order_acquire);
+            for (;;) {
+                const uint32_t index = indexOf(head);
+                if (index == EMPTY) {
+                    exhaustedCount_.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+                
+                // next_ may be stale if another thread popped this node meanwhile;
+                // the tag makes the CAS below fail in that case
+                const uint32_t next = next_[index].load(std::memory_order_relaxed);
+                if (head_.compare_exchange_weak(head, pack(tagOf(head) + 1, next),
+                                                std::memory_order_acquire, std::memory_order_acquire)) {
+                    updateHighWater(inUse_.fetch_add(1, std::memory_order_relaxed) + 1);
+                    return reinterpret_cast<float*>(slab_ + index * stride_);
+                }
             }
         }
+        
+        /// Push a buffer obtained from allocate() back onto the free list
+        void release(float* buffer) {
+            const uint32_t index = static_cast<uint32_t>((reinterpret_cast<uint8_t*>(buffer) - slab_) / stride_);
+            
+            uint64_t head = head_.load(std::memory_order_relaxed);
+            for (;;) {
+                next_[index].store(indexOf(head), std::memory_order_relaxed);
+                if (head_.compare_exchange_weak(head, pack(tagOf(head) + 1, index),
+                                                std::memory_order_release, std::memory_order_relaxed)) {
+                    inUse_.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+        
+        /// Address-range ownership check (O(1), no per-buffer bookkeeping)
+        bool owns(const float* buffer) const {
+            const uint8_t* address = reinterpret_cast<const uint8_t*>(buffer);
+            return slab_ && address >= slab_ && address < slab_ + stride_ * capacity_;
+        }
+        
+        size_t getBufferSize() const { return bufferSize_; }
+        size_t getBufferBytes() const { return bufferSize_ * sizeof(float); }
+        size_t getCapacity() const { return capacity_; }
+        size_t getInUse() const { return inUse_.load(std::memory_order_relaxed); }
+        size_t getHighWater() const { return highWater_.load(std::memory_order_relaxed); }
+        uint64_t getExhaustedCount() const { return exhaustedCount_.load(std::memory_order_relaxed); }
+        
+    private:
+        static constexpr uint32_t EMPTY = 0xFFFFFFFFu;
+        
+        static uint64_t pack(uint32_t tag, uint32_t index) {
+            return (static_cast<uint64_t>(tag) << 32) | index;
+        }
+        static uint32_t tagOf(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+        static uint32_t indexOf(uint64_t head) { return static_cast<uint32_t>(head); }
+        
+        void updateHighWater(size_t inUse) {
+            size_t highWater = highWater_.load(std::memory_order_relaxed);
+            while (inUse > highWater &&
+                   !highWater_.compare_exchange_weak(highWater, inUse, std::memory_order_relaxed)) {
+                // Retry until successful
+            }
+        }
+        
+        const size_t bufferSize_;       // Floats per buffer
+        const size_t stride_;           // Bytes between buffers (multiple of POOL_ALIGNMENT)
+        size_t capacity_;
+        uint8_t* slab_;
+        std::unique_ptr<std::atomic<uint32_t>[]> next_;
+        
+        // Contended by every allocate/release: keep it off the read-mostly fields
+        alignas(POOL_ALIGNMENT) std::atomic<uint64_t> head_;
+        alignas(POOL_ALIGNMENT) std::atomic<size_t> inUse_{0};
+        std::atomic<size_t> highWater_{0};
+        std::atomic<uint64_t> exhaustedCount_{0};
     };
     
     std::vector<std::unique_ptr<MemoryPool>> memoryPools_;
@@ -171,26 +269,25 @@ public:
             }
         }
         
-        float* buffer = nullptr;
-        
         if (memoryStrategy_ == MemoryStrategy::Pooled) {
-            buffer = allocateFromPool(numElements, alignment);
+            // Pool buffers are accounted by their size class in allocateFromPool
+            if (float* pooled = allocateFromPool(numElements, alignment)) {
+                return pooled;
+            }
         }
         
-        if (!buffer) {
-            // Fallback to direct allocation
+        // Fallback to direct allocation
 #ifdef __APPLE__
-            buffer = static_cast<float*>(aligned_alloc(alignment, 
-                                        ((sizeBytes + alignment - 1) / alignment) * alignment));
+        float* buffer = static_cast<float*>(aligned_alloc(alignment, 
+                                            ((sizeBytes + alignment - 1) / alignment) * alignment));
 #else
-            buffer = static_cast<float*>(std::aligned_alloc(alignment, 
-                                        ((sizeBytes + alignment - 1) / alignment) * alignment));
+        float* buffer = static_cast<float*>(std::aligned_alloc(alignment, 
+                                            ((sizeBytes + alignment - 1) / alignment) * alignment));
 #endif
-        }
         
         if (buffer) {
             currentMemoryUsage_.fetch_add(sizeBytes);
-            totalAllocatedMemory_ += sizeBytes;
+            totalAllocatedMemory_.fetch_add(sizeBytes, std::memory_order_relaxed);
         }
         
         return buffer;
@@ -199,19 +296,20 @@ public:
     /**
      * @brief Free aligned memory buffer
      * 
+     * Pool buffers are recognized by address, so numElements is only needed
+     * to account for buffers that came from the heap fallback.
+     * 
      * @param buffer Pointer to buffer
-     * @param numElements Number of elements (for pool management)
+     * @param numElements Number of elements requested at allocation
      */
     void freeAlignedBuffer(float* buffer, size_t numElements = 0) {
         if (!buffer) return;
         
         const size_t sizeBytes = numElements * sizeof(float);
         
-        if (memoryStrategy_ == MemoryStrategy::Pooled && numElements > 0) {
-            if (returnToPool(buffer, numElements)) {
-                // Successfully returned to pool, don't actually free
-                return;
-            }
+        if (returnToPool(buffer)) {
+            // Successfully returned to pool, don't actually free
+            return;
         }
         
         // Direct deallocation
@@ -413,10 +511,23 @@ public:
         bool isThermalThrottling;
         float batteryLevel;
         bool isCharging;
+        
+        // Buffer pools (one entry per size class, ascending)
+        struct PoolStats {
+            size_t bufferSize;          // Floats per buffer
+            size_t capacity;
+            size_t inUse;
+            size_t highWater;
+            uint64_t exhaustedCount;    // Allocations that found this class empty
+        };
+        size_t numPools;
+        PoolStats pools[NUM_POOL_SIZE_CLASSES];
+        size_t poolBuffersInUse;
+        size_t poolHighWater;           // Sum of per-class high-water marks
     };
     
     PerformanceStats getPerformanceStats() const {
-        return {
+        PerformanceStats stats = {
             .averageCPULoad = averageCPULoad_.load(),
             .peakCPULoad = peakCPULoad_.load(),
             .currentMemoryUsage = currentMemoryUsage_.load(),
@@ -428,12 +539,30 @@ public:
             .isThermalThrottling = isThermalThrottling_.load(),
 #ifdef __APPLE__
             .batteryLevel = batteryLevel_.load(),
-            .isCharging = isCharging_.load()
+            .isCharging = isCharging_.load(),
 #else
             .batteryLevel = 1.0f,
-            .isCharging = false
+            .isCharging = false,
 #endif
+            .numPools = memoryPools_.size(),
+            .pools = {},
+            .poolBuffersInUse = 0,
+            .poolHighWater = 0
         };
+        
+        for (size_t i = 0; i < memoryPools_.size(); ++i) {
+            const MemoryPool& pool = *memoryPools_[i];
+            stats.pools[i] = {
+                .bufferSize = pool.getBufferSize(),
+                .capacity = pool.getCapacity(),
+                .inUse = pool.getInUse(),
+                .highWater = pool.getHighWater(),
+                .exhaustedCount = pool.getExhaustedCount()
+            };
+            stats.poolBuffersInUse += stats.pools[i].inUse;
+            stats.poolHighWater += stats.pools[i].highWater;
+        }
+        return stats;
     }
     
     /**
@@ -449,35 +578,30 @@ private:
     
     void initializeMemoryPools() {
         // Common buffer sizes for audio processing
-        const std::vector<size_t> poolSizes = {
+        static constexpr size_t poolSizes[NUM_POOL_SIZE_CLASSES] = {
             64,    // Small buffers for parameters
             256,   // Medium buffers for processing
             1024,  // Large buffers for delay lines
             4096   // Very large buffers for impulse responses
         };
         
-        const size_t alignment = 16; // NEON alignment
-        const size_t buffersPerPool = 8;
-        
         for (size_t size : poolSizes) {
-            memoryPools_.emplace_back(
-                std::make_unique<MemoryPool>(size, alignment, buffersPerPool)
-            );
+            memoryPools_.emplace_back(std::make_unique<MemoryPool>(size, BUFFERS_PER_POOL));
         }
     }
     
     float* allocateFromPool(size_t numElements, size_t alignment) {
-        // Find appropriate pool
+        if (alignment > POOL_ALIGNMENT) {
+            return nullptr;
+        }
+        
+        // Smallest fitting size class first, larger classes if it is exhausted
         for (auto& pool : memoryPools_) {
-            if (pool->bufferSize >= numElements && 
-                pool->alignment >= alignment) {
-                
-                // Find available buffer in pool
-                for (size_t i = 0; i < pool->isUsed.size(); ++i) {
-                    if (!pool->isUsed[i]) {
-                        pool->isUsed[i] = true;
-                        return pool->buffers[i].get();
-                    }
+            if (pool->getBufferSize() >= numElements) {
+                if (float* buffer = pool->allocate()) {
+                    currentMemoryUsage_.fetch_add(pool->getBufferBytes());
+                    totalAllocatedMemory_.fetch_add(pool->getBufferBytes(), std::memory_order_relaxed);
+                    return buffer;
                 }
             }
         }
@@ -485,15 +609,12 @@ private:
         return nullptr; // No available buffer in pools
     }
     
-    bool returnToPool(float* buffer, size_t numElements) {
+    bool returnToPool(float* buffer) {
         for (auto& pool : memoryPools_) {
-            if (pool->bufferSize >= numElements) {
-                for (size_t i = 0; i < pool->buffers.size(); ++i) {
-                    if (pool->buffers[i].get() == buffer) {
-                        pool->isUsed[i] = false;
-                        return true;
-                    }
-                }
+            if (pool->owns(buffer)) {
+                pool->release(buffer);
+                currentMemoryUsage_.fetch_sub(pool->getBufferBytes());
+                return true;
             }
         }
         
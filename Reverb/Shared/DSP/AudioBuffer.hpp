@@ -4,121 +4,222 @@
 #include <atomic>
 #include <algorithm>
 #include <cstring>
+#include <cmath>
+#include <type_traits>
 
 namespace VoiceMonitor {
 
-/// Thread-safe circular audio buffer for real-time processing
-/// Supports lock-free reading/writing for audio threads
+/// Wait-free single-producer/single-consumer ring for real-time audio
+///
+/// Capacity is rounded up to a power of two so wrapping is a mask, and every slot
+/// is usable (indices run freely and are only masked on access). Each side owns
+/// its index on a separate cache line and keeps a cached copy of the other side's
+/// index, so the shared line is only touched when the cached view runs out.
+/// Bulk transfers are at most two memcpy segments; acquireWrite/commitWrite and
+/// acquireRead/commitRead expose the ring memory directly for in-place access.
+///
+/// write*/acquireWrite/commitWrite: producer thread only
+/// read*/peek/acquireRead/commitRead: consumer thread only
 template<typename T = float>
 class AudioBuffer {
+    static_assert(std::is_trivially_copyable<T>::value, "AudioBuffer copies elements with memcpy");
+
 public:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /// Up to two contiguous regions of the ring (the second one after wrap-around)
+    template<typename Pointer>
+    struct Span {
+        Pointer first = nullptr;
+        size_t firstSize = 0;
+        Pointer second = nullptr;
+        size_t secondSize = 0;
+
+        size_t size() const { return firstSize + secondSize; }
+    };
+    using WriteSpan = Span<T*>;
+    using ReadSpan = Span<const T*>;
+
     explicit AudioBuffer(size_t capacity = 0) 
-        : capacity_(0), writeIndex_(0), readIndex_(0) {
+        : capacity_(0), mask_(0), writeIndex_(0), cachedReadIndex_(0), readIndex_(0), cachedWriteIndex_(0) {
         if (capacity > 0) {
             resize(capacity);
         }
     }
     
-    /// Resize buffer (not thread-safe, call before audio processing)
-    void resize(size_t newCapacity) {
-        if (newCapacity == capacity_) return;
+    /// Resize buffer to hold at least minCapacity elements (not thread-safe, call before audio processing)
+    void resize(size_t minCapacity) {
+        size_t newCapacity = minCapacity > 0 ? 1 : 0;
+        while (newCapacity < minCapacity) {
+            newCapacity <<= 1;
+        }
+        if (newCapacity == capacity_) {
+            clear();
+            return;
+        }
         
         capacity_ = newCapacity;
+        mask_ = newCapacity > 0 ? newCapacity - 1 : 0;
         buffer_.resize(capacity_);
         clear();
     }
     
-    /// Clear all data and reset pointers
+    /// Clear all data and reset indices (not thread-safe)
     void clear() {
-        std::fill(buffer_.begin(), buffer_.end(), T(0));
-        writeIndex_.store(0);
-        readIndex_.store(0);
+        std::fill(buffer_.begin(), buffer_.end(), T());
+        writeIndex_.store(0, std::memory_order_relaxed);
+        readIndex_.store(0, std::memory_order_relaxed);
+        cachedReadIndex_ = 0;
+        cachedWriteIndex_ = 0;
     }
     
-    /// Write a single sample (thread-safe)
+    // ========================================================================
+    // Producer
+    // ========================================================================
+    
+    /// Write a single sample
     bool write(const T& sample) {
-        size_t currentWrite = writeIndex_.load();
-        size_t nextWrite = (currentWrite + 1) % capacity_;
-        
-        if (nextWrite == readIndex_.load()) {
-            return false; // Buffer full
+        const size_t write = writeIndex_.load(std::memory_order_relaxed);
+        if (write - cachedReadIndex_ == capacity_) {
+            cachedReadIndex_ = readIndex_.load(std::memory_order_acquire);
+            if (write - cachedReadIndex_ == capacity_) {
+                return false; // Buffer full
+            }
         }
         
-        buffer_[currentWrite] = sample;
-        writeIndex_.store(nextWrite);
+        buffer_[write & mask_] = sample;
+        writeIndex_.store(write + 1, std::memory_order_release);
         return true;
     }
     
-    /// Write multiple samples (thread-safe)
+    /// Write up to numSamples samples, returns the number written
     size_t write(const T* samples, size_t numSamples) {
-        size_t written = 0;
-        for (size_t i = 0; i < numSamples; ++i) {
-            if (!write(samples[i])) {
-                break;
-            }
-            ++written;
+        const WriteSpan span = acquireWrite(numSamples);
+        if (span.firstSize > 0) {
+            std::memcpy(span.first, samples, span.firstSize * sizeof(T));
+        }
+        if (span.secondSize > 0) {
+            std::memcpy(span.second, samples + span.firstSize, span.secondSize * sizeof(T));
+        }
+        commitWrite(span.size());
+        return span.size();
+    }
+    
+    /// Reserve up to maxSamples writable slots without publishing them
+    /// Fill the span in place, then commitWrite() the number of samples written
+    WriteSpan acquireWrite(size_t maxSamples) {
+        const size_t write = writeIndex_.load(std::memory_order_relaxed);
+        size_t space = capacity_ - (write - cachedReadIndex_);
+        if (space < maxSamples) {
+            cachedReadIndex_ = readIndex_.load(std::memory_order_acquire);
+            space = capacity_ - (write - cachedReadIndex_);
+        }
+        
+        WriteSpan span;
+        const size_t count = std::min(space, maxSamples);
+        const size_t offset = write & mask_;
+        span.first = buffer_.data() + offset;
+        span.firstSize = std::min(count, capacity_ - offset);
+        span.second = buffer_.data();
+        span.secondSize = count - span.firstSize;
+        return span;
+    }
+    
+    /// Publish samples written into the span returned by acquireWrite()
+    void commitWrite(size_t numSamples) {
+        if (numSamples > 0) {
+            writeIndex_.store(writeIndex_.load(std::memory_order_relaxed) + numSamples, std::memory_order_release);
         }
-        return written;
     }
     
-    /// Read a single sample (thread-safe)
+    // ========================================================================
+    // Consumer
+    // ========================================================================
+    
+    /// Read a single sample
     bool read(T& sample) {
-        size_t currentRead = readIndex_.load();
-        
-        if (currentRead == writeIndex_.load()) {
-            return false; // Buffer empty
+        const size_t read = readIndex_.load(std::memory_order_relaxed);
+        if (read == cachedWriteIndex_) {
+            cachedWriteIndex_ = writeIndex_.load(std::memory_order_acquire);
+            if (read == cachedWriteIndex_) {
+                return false; // Buffer empty
+            }
         }
         
-        sample = buffer_[currentRead];
-        readIndex_.store((currentRead + 1) % capacity_);
+        sample = buffer_[read & mask_];
+        readIndex_.store(read + 1, std::memory_order_release);
         return true;
     }
     
-    /// Read multiple samples (thread-safe)
+    /// Read up to numSamples samples, returns the number read
     size_t read(T* samples, size_t numSamples) {
-        size_t read = 0;
-        for (size_t i = 0; i < numSamples; ++i) {
-            if (!this->read(samples[i])) {
-                break;
-            }
-            ++read;
+        const ReadSpan span = acquireRead(numSamples);
+        if (span.firstSize > 0) {
+            std::memcpy(samples, span.first, span.firstSize * sizeof(T));
+        }
+        if (span.secondSize > 0) {
+            std::memcpy(samples + span.firstSize, span.second, span.secondSize * sizeof(T));
+        }
+        commitRead(span.size());
+        return span.size();
+    }
+    
+    /// Expose up to maxSamples readable samples without consuming them
+    ReadSpan acquireRead(size_t maxSamples) {
+        const size_t read = readIndex_.load(std::memory_order_relaxed);
+        size_t count = cachedWriteIndex_ - read;
+        if (count < maxSamples) {
+            cachedWriteIndex_ = writeIndex_.load(std::memory_order_acquire);
+            count = cachedWriteIndex_ - read;
+        }
+        
+        ReadSpan span;
+        count = std::min(count, maxSamples);
+        const size_t offset = read & mask_;
+        span.first = buffer_.data() + offset;
+        span.firstSize = std::min(count, capacity_ - offset);
+        span.second = buffer_.data();
+        span.secondSize = count - span.firstSize;
+        return span;
+    }
+    
+    /// Release samples obtained from acquireRead() back to the producer
+    void commitRead(size_t numSamples) {
+        if (numSamples > 0) {
+            readIndex_.store(readIndex_.load(std::memory_order_relaxed) + numSamples, std::memory_order_release);
         }
-        return read;
     }
     
     /// Peek at data without consuming it
     bool peek(T& sample, size_t offset = 0) const {
-        size_t currentRead = readIndex_.load();
-        size_t peekIndex = (currentRead + offset) % capacity_;
-        
-        if (peekIndex == writeIndex_.load()) {
+        const size_t read = readIndex_.load(std::memory_order_relaxed);
+        if (offset >= writeIndex_.load(std::memory_order_acquire) - read) {
             return false;
         }
         
-        sample = buffer_[peekIndex];
+        sample = buffer_[(read + offset) & mask_];
         return true;
     }
     
+    // ========================================================================
+    // Either side
+    // ========================================================================
+    
     /// Get number of samples available for reading
     size_t available() const {
-        size_t write = writeIndex_.load();
-        size_t read = readIndex_.load();
-        
-        if (write >= read) {
-            return write - read;
-        } else {
-            return capacity_ - read + write;
-        }
+        const size_t read = readIndex_.load(std::memory_order_acquire);
+        const size_t write = writeIndex_.load(std::memory_order_acquire);
+        return write - read;
     }
     
     /// Get free space available for writing
     size_t freeSpace() const {
-        return capacity_ - available() - 1; // -1 to distinguish full from empty
+        return capacity_ - available();
     }
     
     /// Check if buffer is empty
     bool empty() const {
-        return readIndex_.load() == writeIndex_.load();
+        return available() == 0;
     }
     
     /// Check if buffer is full
@@ -126,7 +227,7 @@ public:
         return freeSpace() == 0;
     }
     
-    /// Get buffer capacity
+    /// Get buffer capacity (power of two, all slots usable)
     size_t capacity() const {
         return capacity_;
     }
@@ -134,8 +235,15 @@ public:
 private:
     std::vector<T> buffer_;
     size_t capacity_;
-    std::atomic<size_t> writeIndex_;
-    std::atomic<size_t> readIndex_;
+    size_t mask_;
+    
+    // Producer line: own index + cached consumer index
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> writeIndex_;
+    size_t cachedReadIndex_;
+    
+    // Consumer line: own index + cached producer index
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> readIndex_;
+    size_t cachedWriteIndex_;   // sizeof rounds up to the alignment, padding this line too
 };
 
 /// Multi-channel audio buffer for interleaved or planar processing
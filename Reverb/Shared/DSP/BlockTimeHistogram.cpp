@@ -0,0 +1,77 @@
+#include "BlockTimeHistogram.hpp"
+
+namespace VoiceMonitor {
+
+uint64_t BlockTimeHistogram::getBucketUpperBound(int bucket) {
+    if (bucket < SUB_BUCKET_COUNT) {
+        return static_cast<uint64_t>(bucket);
+    }
+    const int shift = (bucket - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF + 1;
+    const uint64_t subBucket = static_cast<uint64_t>((bucket - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF + SUB_BUCKET_HALF);
+    return ((subBucket + 1) << shift) - 1;
+}
+
+BlockTimeHistogram::Snapshot BlockTimeHistogram::snapshot() const {
+    Snapshot result;
+    for (int bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+        result.counts[bucket] = counts_[bucket].load(std::memory_order_relaxed);
+    }
+    result.totalCount = totalCount_.load(std::memory_order_relaxed);
+    result.totalNanoseconds = totalNanoseconds_.load(std::memory_order_relaxed);
+    result.maxNanoseconds = maxNanoseconds_.load(std::memory_order_relaxed);
+    for (int threshold = 0; threshold < NUM_THRESHOLDS; ++threshold) {
+        result.overThreshold[threshold] = overThreshold_[threshold].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+BlockTimeHistogram::Snapshot BlockTimeHistogram::Snapshot::operator-(const Snapshot& earlier) const {
+    Snapshot difference;
+    int topBucket = -1;
+    for (int bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+        difference.counts[bucket] = counts[bucket] - earlier.counts[bucket];
+        if (difference.counts[bucket] > 0) {
+            topBucket = bucket;
+        }
+    }
+    difference.totalCount = totalCount - earlier.totalCount;
+    difference.totalNanoseconds = totalNanoseconds - earlier.totalNanoseconds;
+    for (int threshold = 0; threshold < NUM_THRESHOLDS; ++threshold) {
+        difference.overThreshold[threshold] = overThreshold[threshold] - earlier.overThreshold[threshold];
+    }
+
+    // The exact maximum is only kept for the whole run
+    if (topBucket >= 0) {
+        const uint64_t bound = getBucketUpperBound(topBucket);
+        difference.maxNanoseconds = bound < maxNanoseconds ? bound : maxNanoseconds;
+    }
+    return difference;
+}
+
+uint64_t BlockTimeHistogram::Snapshot::getPercentile(double percentile) const {
+    // Counts are read bucket by bucket while the audio thread records, so the
+    // buckets rather than totalCount decide the rank
+    uint64_t count = 0;
+    for (int bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+        count += counts[bucket];
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    const double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+    uint64_t rank = static_cast<uint64_t>(clamped * 0.01 * static_cast<double>(count) + 0.5);
+    rank = rank < 1 ? 1 : (rank > count ? count : rank);
+
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            const uint64_t bound = getBucketUpperBound(bucket);
+            return maxNanoseconds > 0 && bound > maxNanoseconds ? maxNanoseconds : bound;
+        }
+    }
+    return maxNanoseconds;
+}
+
+} // namespace VoiceMonitor
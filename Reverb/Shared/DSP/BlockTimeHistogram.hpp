@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace VoiceMonitor {
+
+/// Distribution of audio callback times, for tail latency rather than averages
+///
+/// An HDR-style log-linear histogram: exact below 64 ns, then 32 buckets per
+/// power of two (at most ~3% relative error) up to ~18 minutes, in a fixed
+/// array - recording never allocates, locks or loops. Alongside it, counters
+/// of blocks that took at least 50%, 80% and 100% of their period (the last
+/// being deadline misses).
+///
+/// record() is audio-thread only: one writer, so counts are bumped with a
+/// relaxed load and store. snapshot() may be called from any thread; counts
+/// only grow, so subtract two snapshots for an interval.
+class BlockTimeHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 6;
+    static constexpr int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;      // Exact range, ns
+    static constexpr int SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;       // Buckets per octave above it
+    static constexpr int MAX_VALUE_BITS = 40;                          // ~1100 s
+    static constexpr int NUM_BUCKETS = SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_HALF;
+
+    enum Threshold { Over50Percent, Over80Percent, Over100Percent, NUM_THRESHOLDS };
+
+    struct Snapshot {
+        uint64_t counts[NUM_BUCKETS] = {};
+        uint64_t totalCount = 0;
+        uint64_t totalNanoseconds = 0;
+        uint64_t maxNanoseconds = 0;            // Whole run, or the interval's top bucket after operator-
+        uint64_t overThreshold[NUM_THRESHOLDS] = {};
+
+        Snapshot operator-(const Snapshot& earlier) const;
+
+        /// Block time not exceeded by `percentile` % of blocks (99.9 -> p99.9),
+        /// as the top of its bucket; 0 when empty
+        uint64_t getPercentile(double percentile) const;
+        double getMeanNanoseconds() const { return totalCount ? static_cast<double>(totalNanoseconds) / totalCount : 0.0; }
+        uint64_t getDeadlineMisses() const { return overThreshold[Over100Percent]; }
+    };
+
+    /// Audio thread: one block that took blockNanoseconds of a periodNanoseconds budget
+    void record(uint64_t blockNanoseconds, uint64_t periodNanoseconds) {
+        bump(counts_[getBucket(blockNanoseconds)], 1);
+        bump(totalCount_, 1);
+        bump(totalNanoseconds_, blockNanoseconds);
+        if (blockNanoseconds > maxNanoseconds_.load(std::memory_order_relaxed)) {
+            maxNanoseconds_.store(blockNanoseconds, std::memory_order_relaxed);
+        }
+
+        // Integer compares: >= 50%, >= 80%, >= 100% of the period
+        if (blockNanoseconds * 2 >= periodNanoseconds) {
+            bump(overThreshold_[Over50Percent], 1);
+            if (blockNanoseconds * 5 >= periodNanoseconds * 4) {
+                bump(overThreshold_[Over80Percent], 1);
+                if (blockNanoseconds >= periodNanoseconds) {
+                    bump(overThreshold_[Over100Percent], 1);
+                }
+            }
+        }
+    }
+
+    /// Any thread
+    Snapshot snapshot() const;
+
+    static int getBucket(uint64_t nanoseconds) {
+        constexpr uint64_t maxValue = (uint64_t(1) << MAX_VALUE_BITS) - 1;
+        if (nanoseconds < SUB_BUCKET_COUNT) {
+            return static_cast<int>(nanoseconds);
+        }
+        if (nanoseconds > maxValue) {
+            nanoseconds = maxValue;
+        }
+        // Shift the value into [SUB_BUCKET_HALF, SUB_BUCKET_COUNT); each shift is an octave
+        const int shift = (63 - __builtin_clzll(nanoseconds)) - SUB_BUCKET_BITS + 1;
+        return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF +
+               static_cast<int>(nanoseconds >> shift) - SUB_BUCKET_HALF;
+    }
+    static uint64_t getBucketUpperBound(int bucket);    // Largest value the bucket holds
+
+private:
+    static void bump(std::atomic<uint64_t>& counter, uint64_t amount) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> counts_[NUM_BUCKETS] = {};
+    std::atomic<uint64_t> totalCount_{0};
+    std::atomic<uint64_t> totalNanoseconds_{0};
+    std::atomic<uint64_t> maxNanoseconds_{0};
+    std::atomic<uint64_t> overThreshold_[NUM_THRESHOLDS] = {};
+};
+
+} // namespace VoiceMonitor
@@ -406,13 +406,12 @@ StereoEnhancer::StereoEnhancer()
     , midSideEnabled_(false) {
 }
 
-void StereoEnhancer::initialize(double sampleRate) {
+void StereoEnhancer::initialize(double sampleRate, int maxBlockSize) {
     crossFeed_.initialize(sampleRate);
     chorus_.initialize(sampleRate);
     haas_.initialize(sampleRate);
     
     // Initialize temp buffers
-    int maxBlockSize = 512;
     tempBufferLeft_.resize(maxBlockSize);
     tempBufferRight_.resize(maxBlockSize);
 }
@@ -3,6 +3,8 @@
 #include "AudioMath.hpp"
 #include "Parameters.hpp"
 #include <cmath>
+#include <vector>
+#include <functional>
 
 namespace VoiceMonitor {
 
@@ -213,7 +215,7 @@ public:
     ~StereoEnhancer() = default;
     
     /// Initialize all processors
-    void initialize(double sampleRate);
+    void initialize(double sampleRate, int maxBlockSize = 512);
     
     /// Process complete stereo enhancement
     void processBlock(float* leftChannel, float* rightChannel, int numSamples);
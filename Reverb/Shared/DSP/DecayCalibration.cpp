@@ -0,0 +1,57 @@
+#include "DecayCalibration.hpp"
+#include <algorithm>
+
+namespace VoiceMonitor {
+
+namespace {
+    struct AxisPosition {
+        int index;      // Lower grid point
+        float fraction; // Towards index + 1
+    };
+
+    template <int N>
+    AxisPosition locate(const float (&axis)[N], float value) {
+        value = std::clamp(value, axis[0], axis[N - 1]);
+        int index = 0;
+        while (index < N - 2 && value > axis[index + 1]) {
+            ++index;
+        }
+        return { index, (value - axis[index]) / (axis[index + 1] - axis[index]) };
+    }
+}
+
+float DecayCalibration::getCorrection(float decaySeconds, float roomSize, float hfDamping, float lfDamping,
+                                      double sampleRate) {
+    const AxisPosition decay = locate(DECAYS, decaySeconds);
+    const AxisPosition size = locate(SIZES, roomSize);
+    const AxisPosition hf = locate(HF_DAMPINGS, hfDamping);
+    const AxisPosition lf = locate(LF_DAMPINGS, lfDamping);
+    const AxisPosition rate = locate(RATES, static_cast<float>(sampleRate));
+
+    // Gather the 32 surrounding points, then collapse one axis at a time
+    float corners[32];
+    int corner = 0;
+    for (int r = 0; r < 2; ++r) {
+        for (int l = 0; l < 2; ++l) {
+            for (int h = 0; h < 2; ++h) {
+                for (int s = 0; s < 2; ++s) {
+                    const float* row = &TABLE[getIndex(rate.index + r, lf.index + l, hf.index + h, size.index + s,
+                                                       decay.index)];
+                    corners[corner++] = row[0];
+                    corners[corner++] = row[1];
+                }
+            }
+        }
+    }
+
+    const float fractions[5] = { decay.fraction, size.fraction, hf.fraction, lf.fraction, rate.fraction };
+    for (int axis = 0, count = 32; axis < 5; ++axis) {
+        count /= 2;
+        for (int i = 0; i < count; ++i) {
+            corners[i] = corners[2 * i] + fractions[axis] * (corners[2 * i + 1] - corners[2 * i]);
+        }
+    }
+    return corners[0];
+}
+
+} // namespace VoiceMonitor
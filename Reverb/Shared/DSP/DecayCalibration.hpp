@@ -0,0 +1,53 @@
+#pragma once
+
+namespace VoiceMonitor {
+
+/// Measured RT60 calibration for the FDN loop gain
+///
+/// The classic loop gain 10^(-3 * dt / RT60) (dt = mean loop delay; the matrix
+/// already makes up the damping filters' passband gain) ignores what else the
+/// network does to the tail: the filters' spectral shape, the diffusers'
+/// smear, the modulated reads. For each point
+/// of a decay x size x HF damping x LF damping x sample rate grid, the table
+/// holds the factor dt is scaled by so that the broadband RT60 (Schroeder T30)
+/// measured on the FDN's impulse response equals the requested decay:
+///
+///     gain = 10^(-3 * dt * getCorrection(...) / RT60)
+///
+/// The table is generated by Tools/RT60Calibration.cpp (DecayCalibrationTable.cpp,
+/// do not edit by hand) for the full 8-line network at full loop rate; other
+/// tiers and decimated tails reuse it. The lookup is a multilinear
+/// interpolation (31 lerps) and never allocates: it runs on the audio thread
+/// whenever decay, size or damping is automated.
+class DecayCalibration {
+public:
+    static constexpr int NUM_DECAYS = 14;
+    static constexpr int NUM_SIZES = 5;
+    static constexpr int NUM_HF_DAMPINGS = 7;
+    static constexpr int NUM_LF_DAMPINGS = 5;
+    static constexpr int NUM_RATES = 4;
+    static constexpr int NUM_POINTS = NUM_DECAYS * NUM_SIZES * NUM_HF_DAMPINGS * NUM_LF_DAMPINGS * NUM_RATES;
+
+    // Grid axes; the table is laid out [rate][lf][hf][size][decay], decay fastest
+    static constexpr float DECAYS[NUM_DECAYS] = { 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.75f, 1.0f, 1.5f, 2.0f, 3.0f, 4.0f,
+                                                  6.0f, 8.0f };
+    static constexpr float SIZES[NUM_SIZES] = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
+    static constexpr float HF_DAMPINGS[NUM_HF_DAMPINGS] = { 0.0f, 0.25f, 0.5f, 0.625f, 0.75f, 0.875f, 1.0f };
+    static constexpr float LF_DAMPINGS[NUM_LF_DAMPINGS] = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
+    static constexpr float RATES[NUM_RATES] = { 44100.0f, 48000.0f, 88200.0f, 96000.0f };
+
+    /// Factor for the mean loop delay (1 = the uncalibrated formula); arguments
+    /// are clamped to the grid. Damping values are 0-1, decay in seconds.
+    static float getCorrection(float decaySeconds, float roomSize, float hfDamping, float lfDamping,
+                               double sampleRate);
+
+    /// Flat index of a grid point
+    static int getIndex(int rate, int lf, int hf, int size, int decay) {
+        return (((rate * NUM_LF_DAMPINGS + lf) * NUM_HF_DAMPINGS + hf) * NUM_SIZES + size) * NUM_DECAYS + decay;
+    }
+
+private:
+    static const float TABLE[NUM_POINTS];     // DecayCalibrationTable.cpp
+};
+
+} // namespace VoiceMonitor
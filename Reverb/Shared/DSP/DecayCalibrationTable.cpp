@@ -0,0 +1,1410 @@
+// Generated by Tools/RT60Calibration.cpp - do not edit by hand
+
+#include "DecayCalibration.hpp"
+
+namespace VoiceMonitor {
+
+const float DecayCalibration::TABLE[DecayCalibration::NUM_POINTS] = {
+    // 44100 Hz, LF 0, HF 0, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1424f, 1.3709f, 1.0680f, 0.9942f, 0.9564f, 0.9564f, 0.9564f, 0.9564f, 0.9564f, 0.9564f,
+    // 44100 Hz, LF 0, HF 0, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1308f, 1.3570f, 1.0507f, 0.9762f, 0.9516f, 0.9516f, 0.9516f, 0.9516f, 0.9516f, 0.9516f,
+    // 44100 Hz, LF 0, HF 0, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0064f, 1.2580f, 1.5096f, 1.0738f, 0.9824f, 0.9472f, 0.9472f, 0.9590f, 0.9590f, 0.9485f, 0.9485f,
+    // 44100 Hz, LF 0, HF 0, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1220f, 0.9939f, 0.9446f, 0.9446f, 0.9446f, 0.9446f, 0.9446f, 0.9446f,
+    // 44100 Hz, LF 0, HF 0, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1230f, 1.0009f, 0.9552f, 0.9552f, 0.9552f, 0.9447f, 0.9447f, 0.9447f,
+    // 44100 Hz, LF 0, HF 0.25, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0142f, 1.2677f, 1.5212f, 1.1232f, 1.0210f, 0.9777f, 0.9777f, 0.9777f, 0.9777f, 0.9645f, 0.9645f,
+    // 44100 Hz, LF 0, HF 0.25, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1166f, 1.0039f, 0.9776f, 0.9776f, 0.9776f, 0.9776f, 0.9609f, 0.9609f,
+    // 44100 Hz, LF 0, HF 0.25, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1756f, 1.0182f, 0.9802f, 0.9802f, 0.9802f, 0.9802f, 0.9662f, 0.9662f,
+    // 44100 Hz, LF 0, HF 0.25, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0056f, 1.2570f, 1.0469f, 0.9791f, 0.9791f, 0.9791f, 0.9686f, 0.9686f, 0.9686f,
+    // 44100 Hz, LF 0, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0650f, 1.3313f, 1.0628f, 0.9925f, 0.9803f, 0.9803f, 0.9803f, 0.9688f, 0.9688f,
+    // 44100 Hz, LF 0, HF 0.5, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1012f, 1.3766f, 1.6519f, 1.1612f, 1.0414f, 0.9947f, 0.9947f, 0.9947f, 0.9947f, 0.9792f, 0.9792f,
+    // 44100 Hz, LF 0, HF 0.5, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1693f, 1.0192f, 0.9835f, 0.9942f, 0.9942f, 0.9942f, 0.9773f, 0.9773f,
+    // 44100 Hz, LF 0, HF 0.5, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2485f, 1.0483f, 0.9856f, 0.9856f, 0.9970f, 0.9970f, 0.9835f, 0.9835f,
+    // 44100 Hz, LF 0, HF 0.5, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1056f, 1.3819f, 1.0698f, 0.9862f, 0.9862f, 0.9862f, 0.9862f, 0.9862f, 0.9862f,
+    // 44100 Hz, LF 0, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1899f, 1.4874f, 1.0890f, 1.0073f, 0.9835f, 0.9835f, 0.9835f, 0.9835f, 0.9835f,
+    // 44100 Hz, LF 0, HF 0.625, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1919f, 1.0660f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.625, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2180f, 1.0341f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.625, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0651f, 1.3314f, 1.0651f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.625, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1946f, 1.4932f, 1.0877f, 0.9992f, 0.9992f, 0.9992f, 0.9883f, 0.9883f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1066f, 1.0180f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.75, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2404f, 1.0840f, 1.0162f, 1.0162f, 1.0162f, 1.0162f, 1.0162f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.75, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0350f, 1.2938f, 1.0529f, 1.0132f, 1.0132f, 1.0132f, 1.0132f, 1.0000f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.75, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1630f, 1.4538f, 1.0896f, 1.0132f, 1.0132f, 1.0132f, 1.0132f, 1.0132f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.75, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1249f, 1.0141f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1402f, 1.0287f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 44100 Hz, LF 0, HF 0.875, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0201f, 1.2751f, 1.1038f, 1.0382f, 1.0260f, 1.0260f, 1.0260f, 1.0260f, 1.0260f,
+    // 44100 Hz, LF 0, HF 0.875, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1198f, 1.3997f, 1.0886f, 1.0267f, 1.0267f, 1.0267f, 1.0267f, 1.0158f, 1.0158f,
+    // 44100 Hz, LF 0, HF 0.875, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1294f, 1.0243f, 1.0243f, 1.0243f, 1.0243f, 1.0243f, 1.0243f,
+    // 44100 Hz, LF 0, HF 0.875, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1653f, 1.0310f, 1.0205f, 1.0205f, 1.0075f, 1.0075f, 1.0190f,
+    // 44100 Hz, LF 0, HF 0.875, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2092f, 1.0436f, 1.0108f, 1.0108f, 1.0108f, 1.0108f, 1.0108f,
+    // 44100 Hz, LF 0, HF 1, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0114f, 1.2642f, 1.1202f, 1.0662f, 1.0662f, 1.0528f, 1.0528f, 1.0528f, 1.0528f,
+    // 44100 Hz, LF 0, HF 1, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0006f, 1.2007f, 1.5009f, 1.1377f, 1.0621f, 1.0621f, 1.0512f, 1.0512f, 1.0368f, 1.0368f,
+    // 44100 Hz, LF 0, HF 1, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2013f, 1.0527f, 1.0527f, 1.0527f, 1.0351f, 1.0351f, 1.0351f,
+    // 44100 Hz, LF 0, HF 1, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2711f, 1.0527f, 1.0338f, 1.0338f, 1.0338f, 1.0198f, 1.0385f,
+    // 44100 Hz, LF 0, HF 1, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0691f, 1.4254f, 1.0688f, 1.0278f, 1.0278f, 1.0278f, 1.0278f, 1.0278f,
+    // 44100 Hz, LF 0.25, HF 0, size 0
+    1.0000f, 1.1603f, 1.0284f, 0.9864f, 0.9677f, 0.9484f, 0.9212f, 0.9212f, 0.8909f, 0.8909f, 0.8789f, 0.8789f, 0.8386f, 0.8020f,
+    // 44100 Hz, LF 0.25, HF 0, size 0.25
+    1.0000f, 1.1486f, 1.0170f, 0.9839f, 0.9839f, 0.9643f, 0.9450f, 0.9244f, 0.9014f, 0.9014f, 0.9014f, 0.9014f, 0.8793f, 0.8637f,
+    // 44100 Hz, LF 0.25, HF 0, size 0.5
+    1.0000f, 1.0479f, 1.0479f, 1.0280f, 1.0117f, 0.9875f, 0.9649f, 0.9405f, 0.9158f, 0.9158f, 0.9158f, 0.9158f, 0.8962f, 0.8831f,
+    // 44100 Hz, LF 0.25, HF 0, size 0.75
+    1.0000f, 1.1417f, 1.0467f, 1.0467f, 1.0315f, 1.0059f, 0.9835f, 0.9541f, 0.9305f, 0.9194f, 0.9194f, 0.9194f, 0.9039f, 0.8861f,
+    // 44100 Hz, LF 0.25, HF 0, size 1
+    1.0000f, 1.5443f, 1.0752f, 1.0752f, 1.0467f, 1.0165f, 0.9882f, 0.9633f, 0.9362f, 0.9257f, 0.9257f, 0.9257f, 0.9121f, 0.8952f,
+    // 44100 Hz, LF 0.25, HF 0.25, size 0
+    1.0000f, 1.1752f, 1.0449f, 1.0101f, 0.9939f, 0.9815f, 0.9630f, 0.9465f, 0.9096f, 0.9096f, 0.8895f, 0.8895f, 0.8557f, 0.8204f,
+    // 44100 Hz, LF 0.25, HF 0.25, size 0.25
+    1.0000f, 1.2226f, 1.0612f, 1.0386f, 1.0276f, 1.0033f, 0.9760f, 0.9502f, 0.9225f, 0.9225f, 0.9225f, 0.9225f, 0.8947f, 0.8656f,
+    // 44100 Hz, LF 0.25, HF 0.25, size 0.5
+    1.0000f, 1.1088f, 1.0919f, 1.0715f, 1.0556f, 1.0312f, 1.0039f, 0.9701f, 0.9381f, 0.9381f, 0.9381f, 0.9381f, 0.9152f, 0.8945f,
+    // 44100 Hz, LF 0.25, HF 0.25, size 0.75
+    1.0000f, 1.1805f, 1.0906f, 1.0747f, 1.0747f, 1.0474f, 1.0220f, 0.9862f, 0.9534f, 0.9411f, 0.9411f, 0.9411f, 0.9223f, 0.9054f,
+    // 44100 Hz, LF 0.25, HF 0.25, size 1
+    1.0000f, 1.4932f, 1.0878f, 1.0878f, 1.0878f, 1.0649f, 1.0344f, 1.0014f, 0.9650f, 0.9505f, 0.9505f, 0.9505f, 0.9338f, 0.9198f,
+    // 44100 Hz, LF 0.25, HF 0.5, size 0
+    1.0000f, 1.1128f, 1.0396f, 1.0124f, 0.9923f, 0.9923f, 0.9783f, 0.9599f, 0.9207f, 0.9207f, 0.9040f, 0.8925f, 0.8642f, 0.8222f,
+    // 44100 Hz, LF 0.25, HF 0.5, size 0.25
+    1.0000f, 1.2394f, 1.0637f, 1.0362f, 1.0362f, 1.0137f, 0.9853f, 0.9579f, 0.9332f, 0.9332f, 0.9332f, 0.9332f, 0.9036f, 0.8752f,
+    // 44100 Hz, LF 0.25, HF 0.5, size 0.5
+    1.0000f, 1.1143f, 1.0941f, 1.0757f, 1.0627f, 1.0405f, 1.0137f, 0.9806f, 0.9499f, 0.9499f, 0.9499f, 0.9499f, 0.9274f, 0.9065f,
+    // 44100 Hz, LF 0.25, HF 0.5, size 0.75
+    1.0000f, 1.1553f, 1.0816f, 1.0816f, 1.0816f, 1.0566f, 1.0321f, 0.9962f, 0.9612f, 0.9492f, 0.9492f, 0.9492f, 0.9341f, 0.9198f,
+    // 44100 Hz, LF 0.25, HF 0.5, size 1
+    1.0000f, 1.4477f, 1.0899f, 1.0899f, 1.0899f, 1.0713f, 1.0437f, 1.0139f, 0.9753f, 0.9574f, 0.9574f, 0.9574f, 0.9424f, 0.9309f,
+    // 44100 Hz, LF 0.25, HF 0.625, size 0
+    1.0000f, 1.0803f, 1.0348f, 1.0154f, 1.0011f, 1.0011f, 0.9874f, 0.9657f, 0.9248f, 0.9248f, 0.8997f, 0.8850f, 0.8542f, 0.8080f,
+    // 44100 Hz, LF 0.25, HF 0.625, size 0.25
+    1.0000f, 1.2200f, 1.0583f, 1.0335f, 1.0335f, 1.0178f, 0.9917f, 0.9636f, 0.9334f, 0.9334f, 0.9334f, 0.9334f, 0.9056f, 0.8766f,
+    // 44100 Hz, LF 0.25, HF 0.625, size 0.5
+    1.0000f, 1.1130f, 1.0943f, 1.0776f, 1.0646f, 1.0423f, 1.0173f, 0.9871f, 0.9561f, 0.9561f, 0.9561f, 0.9561f, 0.9301f, 0.9058f,
+    // 44100 Hz, LF 0.25, HF 0.625, size 0.75
+    1.0000f, 1.1341f, 1.0826f, 1.0826f, 1.0826f, 1.0586f, 1.0365f, 1.0013f, 0.9660f, 0.9513f, 0.9513f, 0.9513f, 0.9368f, 0.9227f,
+    // 44100 Hz, LF 0.25, HF 0.625, size 1
+    1.0000f, 1.4196f, 1.0893f, 1.0893f, 1.0893f, 1.0695f, 1.0449f, 1.0188f, 0.9808f, 0.9686f, 0.9584f, 0.9584f, 0.9443f, 0.9329f,
+    // 44100 Hz, LF 0.25, HF 0.75, size 0
+    1.0000f, 1.0454f, 1.0347f, 1.0189f, 1.0077f, 1.0077f, 0.9918f, 0.9646f, 0.9293f, 0.9176f, 0.8888f, 0.8681f, 0.8186f, 0.7863f,
+    // 44100 Hz, LF 0.25, HF 0.75, size 0.25
+    1.0000f, 1.1378f, 1.0479f, 1.0218f, 1.0329f, 1.0227f, 0.9983f, 0.9666f, 0.9360f, 0.9360f, 0.9360f, 0.9258f, 0.8935f, 0.8593f,
+    // 44100 Hz, LF 0.25, HF 0.75, size 0.5
+    1.0000f, 1.1094f, 1.0932f, 1.0796f, 1.0650f, 1.0449f, 1.0232f, 0.9941f, 0.9538f, 0.9538f, 0.9538f, 0.9538f, 0.9223f, 0.8923f,
+    // 44100 Hz, LF 0.25, HF 0.75, size 0.75
+    1.0000f, 1.0951f, 1.0675f, 1.0837f, 1.0837f, 1.0597f, 1.0403f, 1.0074f, 0.9707f, 0.9581f, 0.9473f, 0.9473f, 0.9296f, 0.9124f,
+    // 44100 Hz, LF 0.25, HF 0.75, size 1
+    1.0000f, 1.3635f, 1.1016f, 1.1016f, 1.0913f, 1.0657f, 1.0436f, 1.0193f, 0.9845f, 0.9585f, 0.9585f, 0.9585f, 0.9452f, 0.9312f,
+    // 44100 Hz, LF 0.25, HF 0.875, size 0
+    1.0000f, 1.0414f, 1.0231f, 1.0080f, 0.9954f, 0.9954f, 0.9725f, 0.9427f, 0.9070f, 0.8771f, 0.8376f, 0.8013f, 0.7245f, 0.6450f,
+    // 44100 Hz, LF 0.25, HF 0.875, size 0.25
+    1.0000f, 1.1030f, 1.0471f, 1.0105f, 1.0105f, 1.0105f, 0.9931f, 0.9590f, 0.9175f, 0.9008f, 0.9008f, 0.8754f, 0.8303f, 0.7745f,
+    // 44100 Hz, LF 0.25, HF 0.875, size 0.5
+    1.0000f, 1.0998f, 1.0998f, 1.0768f, 1.0580f, 1.0414f, 1.0245f, 0.9896f, 0.9430f, 0.9251f, 0.9403f, 0.9209f, 0.8731f, 0.8331f,
+    // 44100 Hz, LF 0.25, HF 0.875, size 0.75
+    1.0000f, 1.0774f, 1.0774f, 1.0774f, 1.0774f, 1.0512f, 1.0325f, 1.0026f, 0.9661f, 0.9493f, 0.9383f, 0.9226f, 0.8882f, 0.8555f,
+    // 44100 Hz, LF 0.25, HF 0.875, size 1
+    1.0000f, 1.2307f, 1.1040f, 1.1307f, 1.1025f, 1.0672f, 1.0413f, 1.0129f, 0.9839f, 0.9585f, 0.9433f, 0.9433f, 0.9187f, 0.8943f,
+    // 44100 Hz, LF 0.25, HF 1, size 0
+    1.0000f, 1.0355f, 1.0157f, 0.9547f, 0.9251f, 0.8872f, 0.8528f, 0.7872f, 0.6856f, 0.6056f, 0.4306f, 0.2453f, 0.2238f, 0.2985f,
+    // 44100 Hz, LF 0.25, HF 1, size 0.25
+    1.0000f, 1.0618f, 0.9454f, 0.9454f, 0.9454f, 0.9454f, 0.9454f, 0.8667f, 0.7975f, 0.7666f, 0.6444f, 0.5270f, 0.3192f, 0.1705f,
+    // 44100 Hz, LF 0.25, HF 1, size 0.5
+    1.0000f, 1.0298f, 1.0635f, 1.0073f, 0.9827f, 0.9827f, 0.9695f, 0.9103f, 0.8468f, 0.8065f, 0.7353f, 0.6785f, 0.5248f, 0.3586f,
+    // 44100 Hz, LF 0.25, HF 1, size 0.75
+    1.0000f, 1.0050f, 1.0651f, 1.0208f, 1.0077f, 0.9675f, 0.9675f, 0.9567f, 0.8884f, 0.8415f, 0.7986f, 0.7422f, 0.6140f, 0.4873f,
+    // 44100 Hz, LF 0.25, HF 1, size 1
+    1.0000f, 1.0855f, 1.0357f, 1.1288f, 1.1288f, 1.0544f, 0.9924f, 0.9679f, 0.9309f, 0.8941f, 0.8409f, 0.7800f, 0.6756f, 0.5919f,
+    // 44100 Hz, LF 0.5, HF 0, size 0
+    1.0000f, 1.1629f, 1.0238f, 0.9784f, 0.9578f, 0.9357f, 0.9021f, 0.9021f, 0.8695f, 0.8427f, 0.8427f, 0.8233f, 0.7574f, 0.6737f,
+    // 44100 Hz, LF 0.5, HF 0, size 0.25
+    1.0000f, 1.1478f, 1.0149f, 0.9880f, 0.9777f, 0.9559f, 0.9344f, 0.9108f, 0.8846f, 0.8846f, 0.8653f, 0.8653f, 0.8256f, 0.7882f,
+    // 44100 Hz, LF 0.5, HF 0, size 0.5
+    1.0000f, 1.0456f, 1.0456f, 1.0260f, 1.0087f, 0.9819f, 0.9558f, 0.9301f, 0.9126f, 0.9018f, 0.8833f, 0.8833f, 0.8568f, 0.8320f,
+    // 44100 Hz, LF 0.5, HF 0, size 0.75
+    1.0000f, 1.1414f, 1.0452f, 1.0452f, 1.0296f, 1.0033f, 0.9783f, 0.9455f, 0.9189f, 0.9086f, 0.9086f, 0.8973f, 0.8730f, 0.8541f,
+    // 44100 Hz, LF 0.5, HF 0, size 1
+    1.0000f, 1.5482f, 1.0721f, 1.0721f, 1.0436f, 1.0131f, 0.9839f, 0.9562f, 0.9219f, 0.9219f, 0.9082f, 0.9082f, 0.8845f, 0.8692f,
+    // 44100 Hz, LF 0.5, HF 0.25, size 0
+    1.0000f, 1.1805f, 1.0398f, 1.0006f, 0.9829f, 0.9692f, 0.9456f, 0.9268f, 0.8871f, 0.8719f, 0.8519f, 0.8322f, 0.7644f, 0.6940f,
+    // 44100 Hz, LF 0.5, HF 0.25, size 0.25
+    1.0000f, 1.2224f, 1.0580f, 1.0343f, 1.0213f, 0.9942f, 0.9645f, 0.9361f, 0.9078f, 0.8936f, 0.8936f, 0.8830f, 0.8391f, 0.8014f,
+    // 44100 Hz, LF 0.5, HF 0.25, size 0.5
+    1.0000f, 1.1071f, 1.0891f, 1.0693f, 1.0529f, 1.0253f, 0.9937f, 0.9588f, 0.9338f, 0.9214f, 0.9065f, 0.9065f, 0.8737f, 0.8477f,
+    // 44100 Hz, LF 0.5, HF 0.25, size 0.75
+    1.0000f, 1.1813f, 1.0875f, 1.0735f, 1.0735f, 1.0453f, 1.0167f, 0.9763f, 0.9405f, 0.9304f, 0.9304f, 0.9197f, 0.8910f, 0.8631f,
+    // 44100 Hz, LF 0.5, HF 0.25, size 1
+    1.0000f, 1.5007f, 1.0841f, 1.0841f, 1.0841f, 1.0615f, 1.0299f, 0.9933f, 0.9522f, 0.9420f, 0.9420f, 0.9308f, 0.9056f, 0.8801f,
+    // 44100 Hz, LF 0.5, HF 0.5, size 0
+    1.0000f, 1.1136f, 1.0321f, 0.9999f, 0.9776f, 0.9776f, 0.9576f, 0.9369f, 0.8936f, 0.8771f, 0.8542f, 0.8301f, 0.7620f, 0.6824f,
+    // 44100 Hz, LF 0.5, HF 0.5, size 0.25
+    1.0000f, 1.2397f, 1.0595f, 1.0290f, 1.0290f, 1.0027f, 0.9709f, 0.9413f, 0.9105f, 0.8995f, 0.8995f, 0.8875f, 0.8377f, 0.7971f,
+    // 44100 Hz, LF 0.5, HF 0.5, size 0.5
+    1.0000f, 1.1119f, 1.0902f, 1.0727f, 1.0596f, 1.0332f, 1.0011f, 0.9665f, 0.9400f, 0.9274f, 0.9122f, 0.9122f, 0.8783f, 0.8406f,
+    // 44100 Hz, LF 0.5, HF 0.5, size 0.75
+    1.0000f, 1.1551f, 1.0806f, 1.0806f, 1.0806f, 1.0545f, 1.0257f, 0.9839f, 0.9449f, 0.9331f, 0.9331f, 0.9228f, 0.8957f, 0.8688f,
+    // 44100 Hz, LF 0.5, HF 0.5, size 1
+    1.0000f, 1.4563f, 1.0850f, 1.0850f, 1.0850f, 1.0671f, 1.0382f, 1.0039f, 0.9590f, 0.9455f, 0.9455f, 0.9322f, 0.9084f, 0.8854f,
+    // 44100 Hz, LF 0.5, HF 0.625, size 0
+    1.0000f, 1.0767f, 1.0237f, 1.0005f, 0.9830f, 0.9830f, 0.9626f, 0.9385f, 0.8898f, 0.8706f, 0.8417f, 0.8132f, 0.7349f, 0.6463f,
+    // 44100 Hz, LF 0.5, HF 0.625, size 0.25
+    1.0000f, 1.2202f, 1.0527f, 1.0245f, 1.0245f, 1.0046f, 0.9739f, 0.9442f, 0.9039f, 0.9039f, 0.8924f, 0.8783f, 0.8212f, 0.7792f,
+    // 44100 Hz, LF 0.5, HF 0.625, size 0.5
+    1.0000f, 1.1099f, 1.0893f, 1.0740f, 1.0607f, 1.0333f, 1.0019f, 0.9700f, 0.9407f, 0.9237f, 0.9237f, 0.9110f, 0.8708f, 0.8300f,
+    // 44100 Hz, LF 0.5, HF 0.625, size 0.75
+    1.0000f, 1.1330f, 1.0814f, 1.0814f, 1.0814f, 1.0561f, 1.0288f, 0.9863f, 0.9461f, 0.9299f, 0.9299f, 0.9192f, 0.8904f, 0.8607f,
+    // 44100 Hz, LF 0.5, HF 0.625, size 1
+    1.0000f, 1.4319f, 1.0831f, 1.0831f, 1.0831f, 1.0643f, 1.0384f, 1.0070f, 0.9617f, 0.9429f, 0.9429f, 0.9260f, 0.9020f, 0.8776f,
+    // 44100 Hz, LF 0.5, HF 0.75, size 0
+    1.0000f, 1.0340f, 1.0186f, 0.9942f, 0.9942f, 0.9829f, 0.9584f, 0.9256f, 0.8665f, 0.8438f, 0.7877f, 0.7529f, 0.6463f, 0.5200f,
+    // 44100 Hz, LF 0.5, HF 0.75, size 0.25
+    1.0000f, 1.1333f, 1.0421f, 1.0209f, 1.0209f, 1.0053f, 0.9733f, 0.9389f, 0.8954f, 0.8841f, 0.8719f, 0.8501f, 0.7786f, 0.7048f,
+    // 44100 Hz, LF 0.5, HF 0.75, size 0.5
+    1.0000f, 1.1054f, 1.0864f, 1.0746f, 1.0596f, 1.0326f, 1.0031f, 0.9727f, 0.9348f, 0.9126f, 0.9126f, 0.8919f, 0.8364f, 0.7943f,
+    // 44100 Hz, LF 0.5, HF 0.75, size 0.75
+    1.0000f, 1.0892f, 1.0563f, 1.0822f, 1.0822f, 1.0567f, 1.0299f, 0.9873f, 0.9434f, 0.9181f, 0.9181f, 0.9039f, 0.8668f, 0.8269f,
+    // 44100 Hz, LF 0.5, HF 0.75, size 1
+    1.0000f, 1.3758f, 1.0830f, 1.0830f, 1.0830f, 1.0581f, 1.0348f, 1.0032f, 0.9576f, 0.9432f, 0.9312f, 0.9140f, 0.8832f, 0.8505f,
+    // 44100 Hz, LF 0.5, HF 0.875, size 0
+    1.0000f, 1.0226f, 0.9840f, 0.9663f, 0.9663f, 0.9460f, 0.9113f, 0.8571f, 0.7842f, 0.7332f, 0.6135f, 0.4959f, 0.2859f, 0.2985f,
+    // 44100 Hz, LF 0.5, HF 0.875, size 0.25
+    1.0000f, 1.0924f, 1.0372f, 0.9981f, 0.9981f, 0.9787f, 0.9472f, 0.9020f, 0.8384f, 0.8196f, 0.7741f, 0.7154f, 0.5865f, 0.4503f,
+    // 44100 Hz, LF 0.5, HF 0.875, size 0.5
+    1.0000f, 1.1039f, 1.0894f, 1.0680f, 1.0477f, 1.0206f, 0.9927f, 0.9532f, 0.8926f, 0.8661f, 0.8448f, 0.8067f, 0.7033f, 0.6004f,
+    // 44100 Hz, LF 0.5, HF 0.875, size 0.75
+    1.0000f, 1.0549f, 1.0549f, 1.0747f, 1.0747f, 1.0479f, 1.0240f, 0.9659f, 0.9171f, 0.8963f, 0.8713f, 0.8410f, 0.7710f, 0.6940f,
+    // 44100 Hz, LF 0.5, HF 0.875, size 1
+    1.0000f, 1.2368f, 1.0962f, 1.1178f, 1.0898f, 1.0550f, 1.0266f, 0.9849f, 0.9397f, 0.9095f, 0.8844f, 0.8614f, 0.8094f, 0.7459f,
+    // 44100 Hz, LF 0.5, HF 1, size 0
+    1.0000f, 0.9265f, 0.9021f, 0.8282f, 0.7327f, 0.6680f, 0.5834f, 0.4174f, 0.1280f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 44100 Hz, LF 0.5, HF 1, size 0.25
+    1.0000f, 1.0119f, 0.8702f, 0.8527f, 0.8527f, 0.8153f, 0.7747f, 0.6472f, 0.4753f, 0.3009f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 44100 Hz, LF 0.5, HF 1, size 0.5
+    1.0000f, 1.0140f, 1.0140f, 0.9558f, 0.9302f, 0.9027f, 0.8716f, 0.7846f, 0.5944f, 0.4779f, 0.3073f, 0.0757f, 0.0895f, 0.1194f,
+    // 44100 Hz, LF 0.5, HF 1, size 0.75
+    1.0000f, 0.9665f, 1.0243f, 0.9914f, 0.9598f, 0.9065f, 0.8775f, 0.8347f, 0.7307f, 0.6103f, 0.4331f, 0.2502f, 0.0689f, 0.0918f,
+    // 44100 Hz, LF 0.5, HF 1, size 1
+    1.0000f, 1.0619f, 1.0020f, 1.1020f, 1.1020f, 1.0191f, 0.9341f, 0.8576f, 0.7857f, 0.6933f, 0.5576f, 0.4080f, 0.1144f, 0.0746f,
+    // 44100 Hz, LF 0.75, HF 0, size 0
+    1.0000f, 1.1653f, 1.0198f, 0.9702f, 0.9469f, 0.9224f, 0.8945f, 0.8819f, 0.8447f, 0.8183f, 0.7891f, 0.7547f, 0.6568f, 0.5547f,
+    // 44100 Hz, LF 0.75, HF 0, size 0.25
+    1.0000f, 1.1467f, 1.0122f, 0.9831f, 0.9704f, 0.9482f, 0.9253f, 0.8985f, 0.8776f, 0.8651f, 0.8404f, 0.8230f, 0.7667f, 0.7088f,
+    // 44100 Hz, LF 0.75, HF 0, size 0.5
+    1.0000f, 1.0425f, 1.0425f, 1.0228f, 1.0040f, 0.9757f, 0.9469f, 0.9194f, 0.8998f, 0.8859f, 0.8653f, 0.8530f, 0.8158f, 0.7750f,
+    // 44100 Hz, LF 0.75, HF 0, size 0.75
+    1.0000f, 1.1418f, 1.0423f, 1.0423f, 1.0256f, 0.9989f, 0.9725f, 0.9386f, 0.9089f, 0.8906f, 0.8906f, 0.8714f, 0.8399f, 0.8090f,
+    // 44100 Hz, LF 0.75, HF 0, size 1
+    1.0000f, 1.5509f, 1.0678f, 1.0678f, 1.0388f, 1.0076f, 0.9776f, 0.9495f, 0.9118f, 0.9118f, 0.8899f, 0.8899f, 0.8578f, 0.8323f,
+    // 44100 Hz, LF 0.75, HF 0.25, size 0
+    1.0000f, 1.1866f, 1.0356f, 0.9906f, 0.9702f, 0.9544f, 0.9288f, 0.9060f, 0.8599f, 0.8355f, 0.8072f, 0.7704f, 0.6596f, 0.5424f,
+    // 44100 Hz, LF 0.75, HF 0.25, size 0.25
+    1.0000f, 1.2226f, 1.0550f, 1.0291f, 1.0136f, 0.9857f, 0.9547f, 0.9233f, 0.8914f, 0.8779f, 0.8600f, 0.8435f, 0.7776f, 0.7164f,
+    // 44100 Hz, LF 0.75, HF 0.25, size 0.5
+    1.0000f, 1.1045f, 1.0848f, 1.0654f, 1.0480f, 1.0183f, 0.9832f, 0.9459f, 0.9196f, 0.9029f, 0.8737f, 0.8737f, 0.8273f, 0.7873f,
+    // 44100 Hz, LF 0.75, HF 0.25, size 0.75
+    1.0000f, 1.1825f, 1.0839f, 1.0694f, 1.0694f, 1.0407f, 1.0106f, 0.9687f, 0.9289f, 0.9106f, 0.9106f, 0.8950f, 0.8552f, 0.8248f,
+    // 44100 Hz, LF 0.75, HF 0.25, size 1
+    1.0000f, 1.5071f, 1.0778f, 1.0778f, 1.0778f, 1.0548f, 1.0226f, 0.9854f, 0.9417f, 0.9251f, 0.9251f, 0.9118f, 0.8767f, 0.8393f,
+    // 44100 Hz, LF 0.75, HF 0.5, size 0
+    1.0000f, 1.1152f, 1.0260f, 0.9870f, 0.9693f, 0.9592f, 0.9366f, 0.9105f, 0.8598f, 0.8332f, 0.7947f, 0.7484f, 0.6310f, 0.5039f,
+    // 44100 Hz, LF 0.75, HF 0.5, size 0.25
+    1.0000f, 1.2411f, 1.0567f, 1.0303f, 1.0195f, 0.9920f, 0.9584f, 0.9254f, 0.8807f, 0.8807f, 0.8589f, 0.8367f, 0.7666f, 0.6991f,
+    // 44100 Hz, LF 0.75, HF 0.5, size 0.5
+    1.0000f, 1.1082f, 1.0844f, 1.0674f, 1.0534f, 1.0244f, 0.9876f, 0.9497f, 0.9227f, 0.9030f, 0.8843f, 0.8708f, 0.8204f, 0.7767f,
+    // 44100 Hz, LF 0.75, HF 0.5, size 0.75
+    1.0000f, 1.1562f, 1.0755f, 1.0755f, 1.0755f, 1.0488f, 1.0180f, 0.9742f, 0.9296f, 0.9078f, 0.9078f, 0.8909f, 0.8499f, 0.8151f,
+    // 44100 Hz, LF 0.75, HF 0.5, size 1
+    1.0000f, 1.4624f, 1.0762f, 1.0762f, 1.0762f, 1.0584f, 1.0289f, 0.9940f, 0.9450f, 0.9347f, 0.9243f, 0.9072f, 0.8698f, 0.8304f,
+    // 44100 Hz, LF 0.75, HF 0.625, size 0
+    1.0000f, 1.0734f, 1.0148f, 0.9842f, 0.9702f, 0.9602f, 0.9355f, 0.9056f, 0.8491f, 0.8163f, 0.7630f, 0.7055f, 0.5716f, 0.4186f,
+    // 44100 Hz, LF 0.75, HF 0.625, size 0.25
+    1.0000f, 1.2212f, 1.0467f, 1.0126f, 1.0126f, 0.9913f, 0.9584f, 0.9251f, 0.8839f, 0.8711f, 0.8382f, 0.8098f, 0.7266f, 0.6482f,
+    // 44100 Hz, LF 0.75, HF 0.625, size 0.5
+    1.0000f, 1.1051f, 1.0823f, 1.0674f, 1.0531f, 1.0222f, 0.9846f, 0.9491f, 0.9199f, 0.8972f, 0.8791f, 0.8599f, 0.7990f, 0.7416f,
+    // 44100 Hz, LF 0.75, HF 0.625, size 0.75
+    1.0000f, 1.1337f, 1.0752f, 1.0752f, 1.0752f, 1.0491f, 1.0194f, 0.9741f, 0.9270f, 0.8968f, 0.8968f, 0.8773f, 0.8314f, 0.7914f,
+    // 44100 Hz, LF 0.75, HF 0.625, size 1
+    1.0000f, 1.4417f, 1.0718f, 1.0718f, 1.0718f, 1.0533f, 1.0268f, 0.9948f, 0.9439f, 0.9320f, 0.9159f, 0.8910f, 0.8523f, 0.8079f,
+    // 44100 Hz, LF 0.75, HF 0.75, size 0
+    1.0000f, 1.0231f, 1.0051f, 0.9756f, 0.9643f, 0.9509f, 0.9182f, 0.8787f, 0.8066f, 0.7545f, 0.6691f, 0.5744f, 0.3945f, 0.2985f,
+    // 44100 Hz, LF 0.75, HF 0.75, size 0.25
+    1.0000f, 1.1279f, 1.0334f, 1.0043f, 1.0043f, 0.9867f, 0.9501f, 0.9116f, 0.8593f, 0.8331f, 0.7844f, 0.7408f, 0.6260f, 0.5149f,
+    // 44100 Hz, LF 0.75, HF 0.75, size 0.5
+    1.0000f, 1.0982f, 1.0770f, 1.0656f, 1.0487f, 1.0162f, 0.9788f, 0.9444f, 0.9064f, 0.8812f, 0.8531f, 0.8154f, 0.7280f, 0.6330f,
+    // 44100 Hz, LF 0.75, HF 0.75, size 0.75
+    1.0000f, 1.0988f, 1.0469f, 1.0739f, 1.0739f, 1.0474f, 1.0168f, 0.9702f, 0.9166f, 0.8902f, 0.8691f, 0.8384f, 0.7745f, 0.7159f,
+    // 44100 Hz, LF 0.75, HF 0.75, size 1
+    1.0000f, 1.3872f, 1.0670f, 1.0670f, 1.0670f, 1.0420f, 1.0185f, 0.9855f, 0.9315f, 0.9162f, 0.8910f, 0.8595f, 0.8077f, 0.7597f,
+    // 44100 Hz, LF 0.75, HF 0.875, size 0
+    1.0000f, 0.9947f, 0.9482f, 0.9254f, 0.9104f, 0.8790f, 0.8302f, 0.7618f, 0.6129f, 0.5190f, 0.3152f, 0.1492f, 0.2238f, 0.2985f,
+    // 44100 Hz, LF 0.75, HF 0.875, size 0.25
+    1.0000f, 1.0792f, 1.0342f, 0.9676f, 0.9676f, 0.9409f, 0.8959f, 0.8373f, 0.7541f, 0.6978f, 0.6149f, 0.4995f, 0.2489f, 0.1705f,
+    // 44100 Hz, LF 0.75, HF 0.875, size 0.5
+    1.0000f, 1.1053f, 1.0749f, 1.0528f, 1.0282f, 1.0010f, 0.9493f, 0.9048f, 0.8342f, 0.7891f, 0.7170f, 0.6366f, 0.4652f, 0.2951f,
+    // 44100 Hz, LF 0.75, HF 0.875, size 0.75
+    1.0000f, 1.0567f, 1.0360f, 1.0619f, 1.0619f, 1.0336f, 1.0019f, 0.9313f, 0.8625f, 0.8250f, 0.7725f, 0.7170f, 0.5809f, 0.4395f,
+    // 44100 Hz, LF 0.75, HF 0.875, size 1
+    1.0000f, 1.2444f, 1.0945f, 1.0945f, 1.0634f, 1.0282f, 0.9995f, 0.9512f, 0.8904f, 0.8538f, 0.8016f, 0.7539f, 0.6509f, 0.5421f,
+    // 44100 Hz, LF 0.75, HF 1, size 0
+    1.0000f, 0.8162f, 0.6961f, 0.6070f, 0.4775f, 0.3964f, 0.2289f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 44100 Hz, LF 0.75, HF 1, size 0.25
+    1.0000f, 0.9396f, 0.7846f, 0.7386f, 0.7058f, 0.6341f, 0.5471f, 0.3693f, 0.0426f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 44100 Hz, LF 0.75, HF 1, size 0.5
+    1.0000f, 0.9752f, 0.9471f, 0.8803f, 0.8342f, 0.7745f, 0.7150f, 0.5837f, 0.3234f, 0.1082f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 44100 Hz, LF 0.75, HF 1, size 0.75
+    1.0000f, 0.9295f, 0.9777f, 0.9437f, 0.8808f, 0.8120f, 0.7608f, 0.6521f, 0.4956f, 0.3331f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 44100 Hz, LF 0.75, HF 1, size 1
+    1.0000f, 1.0467f, 0.9671f, 1.0573f, 1.0313f, 0.9493f, 0.8459f, 0.7353f, 0.5828f, 0.4381f, 0.1977f, 0.0373f, 0.0560f, 0.0746f,
+    // 44100 Hz, LF 1, HF 0, size 0
+    1.0000f, 1.1675f, 1.0157f, 0.9624f, 0.9361f, 0.9081f, 0.8769f, 0.8596f, 0.8132f, 0.7797f, 0.7324f, 0.6646f, 0.5498f, 0.4157f,
+    // 44100 Hz, LF 1, HF 0, size 0.25
+    1.0000f, 1.1454f, 1.0090f, 0.9780f, 0.9626f, 0.9401f, 0.9153f, 0.8860f, 0.8617f, 0.8433f, 0.8101f, 0.7816f, 0.7076f, 0.6275f,
+    // 44100 Hz, LF 1, HF 0, size 0.5
+    1.0000f, 1.0387f, 1.0387f, 1.0185f, 0.9985f, 0.9693f, 0.9389f, 0.9094f, 0.8853f, 0.8692f, 0.8424f, 0.8237f, 0.7709f, 0.7140f,
+    // 44100 Hz, LF 1, HF 0, size 0.75
+    1.0000f, 1.1419f, 1.0391f, 1.0391f, 1.0205f, 0.9931f, 0.9662f, 0.9310f, 0.8992f, 0.8726f, 0.8726f, 0.8464f, 0.8055f, 0.7613f,
+    // 44100 Hz, LF 1, HF 0, size 1
+    1.0000f, 1.5531f, 1.0636f, 1.0636f, 1.0338f, 1.0016f, 0.9707f, 0.9425f, 0.9007f, 0.9007f, 0.8823f, 0.8702f, 0.8286f, 0.7937f,
+    // 44100 Hz, LF 1, HF 0.25, size 0
+    1.0000f, 1.1927f, 1.0313f, 0.9807f, 0.9578f, 0.9385f, 0.9112f, 0.8832f, 0.8269f, 0.7954f, 0.7499f, 0.6880f, 0.5413f, 0.3803f,
+    // 44100 Hz, LF 1, HF 0.25, size 0.25
+    1.0000f, 1.2221f, 1.0512f, 1.0236f, 1.0051f, 0.9765f, 0.9440f, 0.9089f, 0.8729f, 0.8508f, 0.8233f, 0.7978f, 0.7121f, 0.6341f,
+    // 44100 Hz, LF 1, HF 0.25, size 0.5
+    1.0000f, 1.1007f, 1.0794f, 1.0599f, 1.0418f, 1.0111f, 0.9735f, 0.9332f, 0.9025f, 0.8818f, 0.8541f, 0.8404f, 0.7795f, 0.7191f,
+    // 44100 Hz, LF 1, HF 0.25, size 0.75
+    1.0000f, 1.1830f, 1.0800f, 1.0635f, 1.0635f, 1.0340f, 1.0034f, 0.9599f, 0.9169f, 0.8902f, 0.8902f, 0.8679f, 0.8193f, 0.7772f,
+    // 44100 Hz, LF 1, HF 0.25, size 1
+    1.0000f, 1.5139f, 1.0814f, 1.0712f, 1.0712f, 1.0473f, 1.0142f, 0.9758f, 0.9228f, 0.9228f, 0.9078f, 0.8912f, 0.8485f, 0.8106f,
+    // 44100 Hz, LF 1, HF 0.5, size 0
+    1.0000f, 1.1274f, 1.0194f, 0.9724f, 0.9512f, 0.9384f, 0.9151f, 0.8806f, 0.8162f, 0.7796f, 0.7211f, 0.6428f, 0.4790f, 0.3084f,
+    // 44100 Hz, LF 1, HF 0.5, size 0.25
+    1.0000f, 1.2514f, 1.0514f, 1.0234f, 1.0087f, 0.9802f, 0.9445f, 0.9063f, 0.8623f, 0.8448f, 0.8147f, 0.7810f, 0.6786f, 0.5823f,
+    // 44100 Hz, LF 1, HF 0.5, size 0.5
+    1.0000f, 1.1030f, 1.0771f, 1.0601f, 1.0455f, 1.0151f, 0.9745f, 0.9324f, 0.9005f, 0.8750f, 0.8444f, 0.8253f, 0.7557f, 0.6919f,
+    // 44100 Hz, LF 1, HF 0.5, size 0.75
+    1.0000f, 1.1561f, 1.0678f, 1.0678f, 1.0678f, 1.0399f, 1.0088f, 0.9628f, 0.9128f, 0.8799f, 0.8799f, 0.8554f, 0.8016f, 0.7549f,
+    // 44100 Hz, LF 1, HF 0.5, size 1
+    1.0000f, 1.4684f, 1.0668f, 1.0668f, 1.0668f, 1.0483f, 1.0181f, 0.9834f, 0.9314f, 0.9183f, 0.9016f, 0.8822f, 0.8309f, 0.7882f,
+    // 44100 Hz, LF 1, HF 0.625, size 0
+    1.0000f, 1.0708f, 1.0057f, 0.9656f, 0.9463f, 0.9337f, 0.9061f, 0.8663f, 0.7903f, 0.7452f, 0.6648f, 0.5758f, 0.3632f, 0.2985f,
+    // 44100 Hz, LF 1, HF 0.625, size 0.25
+    1.0000f, 1.2214f, 1.0388f, 0.9985f, 0.9985f, 0.9762f, 0.9413f, 0.9018f, 0.8490f, 0.8284f, 0.7805f, 0.7352f, 0.6123f, 0.4928f,
+    // 44100 Hz, LF 1, HF 0.625, size 0.5
+    1.0000f, 1.0982f, 1.0733f, 1.0581f, 1.0430f, 1.0097f, 0.9674f, 0.9266f, 0.8917f, 0.8598f, 0.8246f, 0.7986f, 0.7135f, 0.6333f,
+    // 44100 Hz, LF 1, HF 0.625, size 0.75
+    1.0000f, 1.1334f, 1.0655f, 1.0655f, 1.0655f, 1.0378f, 1.0077f, 0.9595f, 0.9050f, 0.8780f, 0.8587f, 0.8309f, 0.7670f, 0.7059f,
+    // 44100 Hz, LF 1, HF 0.625, size 1
+    1.0000f, 1.4504f, 1.0699f, 1.0595f, 1.0595f, 1.0401f, 1.0128f, 0.9815f, 0.9267f, 0.9115f, 0.8860f, 0.8559f, 0.7976f, 0.7434f,
+    // 44100 Hz, LF 1, HF 0.75, size 0
+    1.0000f, 1.0120f, 0.9918f, 0.9491f, 0.9299f, 0.9123f, 0.8724f, 0.8177f, 0.7211f, 0.6368f, 0.4902f, 0.3491f, 0.2238f, 0.2985f,
+    // 44100 Hz, LF 1, HF 0.75, size 0.25
+    1.0000f, 1.1322f, 1.0206f, 0.9839f, 0.9839f, 0.9652f, 0.9250f, 0.8796f, 0.8114f, 0.7693f, 0.6830f, 0.5945f, 0.4157f, 0.2515f,
+    // 44100 Hz, LF 1, HF 0.75, size 0.5
+    1.0000f, 1.0873f, 1.0642f, 1.0528f, 1.0349f, 1.0086f, 0.9528f, 0.9113f, 0.8655f, 0.8260f, 0.7754f, 0.7242f, 0.5875f, 0.4475f,
+    // 44100 Hz, LF 1, HF 0.75, size 0.75
+    1.0000f, 1.0977f, 1.0357f, 1.0605f, 1.0605f, 1.0316f, 1.0012f, 0.9600f, 0.8844f, 0.8481f, 0.8105f, 0.7651f, 0.6683f, 0.5734f,
+    // 44100 Hz, LF 1, HF 0.75, size 1
+    1.0000f, 1.3975f, 1.0696f, 1.0588f, 1.0487f, 1.0219f, 0.9979f, 0.9655f, 0.9045f, 0.8863f, 0.8440f, 0.7953f, 0.7154f, 0.6355f,
+    // 44100 Hz, LF 1, HF 0.875, size 0
+    1.0000f, 0.9644f, 0.9193f, 0.8754f, 0.8429f, 0.8037f, 0.7321f, 0.6358f, 0.4276f, 0.2553f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 44100 Hz, LF 1, HF 0.875, size 0.25
+    1.0000f, 1.0620f, 1.0178f, 0.9474f, 0.9293f, 0.8935f, 0.8326f, 0.7625f, 0.6434f, 0.5444f, 0.3716f, 0.2019f, 0.1279f, 0.1705f,
+    // 44100 Hz, LF 1, HF 0.875, size 0.5
+    1.0000f, 1.0909f, 1.0576f, 1.0315f, 1.0027f, 0.9713f, 0.8995f, 0.8427f, 0.7588f, 0.6939f, 0.5691f, 0.4258f, 0.1433f, 0.1194f,
+    // 44100 Hz, LF 1, HF 0.875, size 0.75
+    1.0000f, 1.0500f, 1.0166f, 1.0404f, 1.0404f, 1.0074f, 0.9704f, 0.8903f, 0.7984f, 0.7345f, 0.6413f, 0.5371f, 0.3268f, 0.1272f,
+    // 44100 Hz, LF 1, HF 0.875, size 1
+    1.0000f, 1.2582f, 1.0664f, 1.0664f, 1.0309f, 0.9909f, 0.9624f, 0.9209f, 0.8338f, 0.7892f, 0.7041f, 0.6227f, 0.4434f, 0.2877f,
+    // 44100 Hz, LF 1, HF 1, size 0
+    1.0000f, 0.7024f, 0.4803f, 0.3161f, 0.1757f, 0.0224f, 0.0280f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 44100 Hz, LF 1, HF 1, size 0.25
+    1.0000f, 0.8779f, 0.7196f, 0.6108f, 0.5400f, 0.4201f, 0.2677f, 0.0213f, 0.0320f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 44100 Hz, LF 1, HF 1, size 0.5
+    1.0000f, 0.9452f, 0.8717f, 0.7801f, 0.6944f, 0.6001f, 0.5103f, 0.3202f, 0.0224f, 0.0298f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 44100 Hz, LF 1, HF 1, size 0.75
+    1.0000f, 0.8999f, 0.9130f, 0.8719f, 0.7935f, 0.7285f, 0.6316f, 0.4554f, 0.1864f, 0.0230f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 44100 Hz, LF 1, HF 1, size 1
+    1.0000f, 1.0389f, 0.9216f, 0.9818f, 0.9265f, 0.8571f, 0.7494f, 0.5791f, 0.3344f, 0.1118f, 0.0280f, 0.0373f, 0.0560f, 0.0746f,
+    // 48000 Hz, LF 0, HF 0, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0745f, 1.3432f, 1.0740f, 0.9943f, 0.9620f, 0.9428f, 0.9530f, 0.9530f, 0.9530f, 0.9530f, 0.9426f,
+    // 48000 Hz, LF 0, HF 0, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0523f, 1.3154f, 1.0647f, 0.9887f, 0.9574f, 0.9459f, 0.9459f, 0.9598f, 0.9598f, 0.9485f, 0.9485f,
+    // 48000 Hz, LF 0, HF 0, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.1611f, 1.4514f, 1.1079f, 1.0148f, 0.9711f, 0.9457f, 0.9457f, 0.9457f, 0.9457f, 0.9457f, 0.9457f,
+    // 48000 Hz, LF 0, HF 0, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.2699f, 1.5874f, 1.1456f, 1.0362f, 0.9796f, 0.9510f, 0.9510f, 0.9510f, 0.9384f, 0.9384f, 0.9384f,
+    // 48000 Hz, LF 0, HF 0, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.2637f, 1.5797f, 1.2185f, 1.0373f, 0.9819f, 0.9532f, 0.9532f, 0.9532f, 0.9532f, 0.9421f, 0.9421f,
+    // 48000 Hz, LF 0, HF 0.25, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.2863f, 1.6079f, 1.1553f, 1.0420f, 0.9906f, 0.9715f, 0.9715f, 0.9715f, 0.9715f, 0.9611f, 0.9611f,
+    // 48000 Hz, LF 0, HF 0.25, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1742f, 1.0450f, 0.9930f, 0.9790f, 0.9790f, 0.9790f, 0.9790f, 0.9683f, 0.9683f,
+    // 48000 Hz, LF 0, HF 0.25, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0576f, 1.2691f, 1.0780f, 1.0039f, 0.9709f, 0.9709f, 0.9709f, 0.9709f, 0.9709f, 0.9709f,
+    // 48000 Hz, LF 0, HF 0.25, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1629f, 1.3955f, 1.1004f, 1.0192f, 0.9783f, 0.9783f, 0.9783f, 0.9679f, 0.9679f, 0.9679f,
+    // 48000 Hz, LF 0, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0418f, 1.3022f, 1.5626f, 1.1250f, 1.0272f, 0.9854f, 0.9854f, 0.9854f, 0.9854f, 0.9701f, 0.9701f,
+    // 48000 Hz, LF 0, HF 0.5, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0191f, 1.2229f, 1.0705f, 1.0091f, 0.9794f, 0.9794f, 0.9794f, 0.9794f, 0.9794f, 0.9794f,
+    // 48000 Hz, LF 0, HF 0.5, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0495f, 1.2594f, 1.0749f, 1.0102f, 0.9852f, 0.9852f, 0.9852f, 0.9852f, 0.9852f, 0.9852f,
+    // 48000 Hz, LF 0, HF 0.5, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1919f, 1.4303f, 1.1043f, 1.0197f, 0.9881f, 0.9881f, 0.9881f, 0.9881f, 0.9881f, 0.9881f,
+    // 48000 Hz, LF 0, HF 0.5, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0734f, 1.3418f, 1.6102f, 1.1483f, 1.0348f, 0.9849f, 0.9849f, 0.9849f, 0.9849f, 0.9849f, 0.9849f,
+    // 48000 Hz, LF 0, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1765f, 1.0442f, 0.9992f, 0.9864f, 0.9968f, 0.9968f, 0.9856f, 0.9856f,
+    // 48000 Hz, LF 0, HF 0.625, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0701f, 1.2842f, 1.0912f, 1.0241f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.625, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1237f, 1.3484f, 1.0934f, 1.0194f, 0.9886f, 0.9886f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.625, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0528f, 1.3160f, 1.5791f, 1.1244f, 1.0279f, 0.9883f, 0.9883f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.625, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1830f, 1.0584f, 0.9890f, 0.9890f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2226f, 1.0667f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.75, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1598f, 1.3917f, 1.1202f, 1.0416f, 1.0102f, 1.0102f, 1.0102f, 1.0102f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.75, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2274f, 1.4729f, 1.1259f, 1.0279f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.75, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1697f, 1.0392f, 0.9978f, 0.9978f, 1.0147f, 1.0147f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.75, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2474f, 1.0754f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0762f, 1.3453f, 1.0874f, 1.0189f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 48000 Hz, LF 0, HF 0.875, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.0307f, 1.2883f, 1.5460f, 1.1729f, 1.0641f, 1.0193f, 1.0193f, 1.0193f, 1.0193f, 1.0193f, 1.0193f,
+    // 48000 Hz, LF 0, HF 0.875, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1771f, 1.0435f, 1.0143f, 1.0143f, 1.0143f, 1.0143f, 1.0143f, 1.0143f,
+    // 48000 Hz, LF 0, HF 0.875, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0095f, 1.2619f, 1.0688f, 1.0087f, 1.0087f, 1.0190f, 1.0190f, 1.0190f, 1.0190f,
+    // 48000 Hz, LF 0, HF 0.875, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1118f, 1.3898f, 1.0943f, 1.0164f, 1.0043f, 1.0160f, 1.0160f, 1.0160f, 1.0160f,
+    // 48000 Hz, LF 0, HF 0.875, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0678f, 1.2814f, 1.6017f, 1.1142f, 1.0334f, 1.0102f, 1.0102f, 1.0102f, 1.0102f, 1.0102f,
+    // 48000 Hz, LF 0, HF 1, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1621f, 1.4527f, 1.7432f, 1.2369f, 1.1086f, 1.0570f, 1.0570f, 1.0434f, 1.0434f, 1.0434f, 1.0434f,
+    // 48000 Hz, LF 0, HF 1, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0833f, 1.3541f, 1.0917f, 1.0517f, 1.0517f, 1.0392f, 1.0392f, 1.0258f, 1.0258f,
+    // 48000 Hz, LF 0, HF 1, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0364f, 1.2436f, 1.5546f, 1.1202f, 1.0392f, 1.0392f, 1.0392f, 1.0241f, 1.0241f, 1.0241f,
+    // 48000 Hz, LF 0, HF 1, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1675f, 1.0388f, 1.0248f, 1.0350f, 1.0196f, 1.0196f, 1.0306f,
+    // 48000 Hz, LF 0, HF 1, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2530f, 1.0571f, 1.0253f, 1.0253f, 1.0253f, 1.0253f, 1.0253f,
+    // 48000 Hz, LF 0.25, HF 0, size 0
+    1.0000f, 1.1289f, 1.0126f, 0.9883f, 0.9661f, 0.9537f, 0.9318f, 0.9151f, 0.8942f, 0.8942f, 0.8808f, 0.8808f, 0.8564f, 0.8112f,
+    // 48000 Hz, LF 0.25, HF 0, size 0.25
+    1.0000f, 1.0806f, 1.0180f, 0.9768f, 0.9768f, 0.9638f, 0.9445f, 0.9278f, 0.9115f, 0.9115f, 0.9115f, 0.9115f, 0.8865f, 0.8535f,
+    // 48000 Hz, LF 0.25, HF 0, size 0.5
+    1.0000f, 1.0353f, 1.0353f, 1.0245f, 0.9989f, 0.9749f, 0.9749f, 0.9485f, 0.9151f, 0.9151f, 0.9151f, 0.9151f, 0.9052f, 0.8856f,
+    // 48000 Hz, LF 0.25, HF 0, size 0.75
+    1.0000f, 1.1389f, 1.0452f, 1.0347f, 1.0183f, 1.0031f, 0.9804f, 0.9556f, 0.9200f, 0.9200f, 0.9200f, 0.9200f, 0.9048f, 0.8832f,
+    // 48000 Hz, LF 0.25, HF 0, size 1
+    1.0000f, 1.0000f, 1.1223f, 1.0839f, 1.0363f, 1.0090f, 0.9827f, 0.9594f, 0.9266f, 0.9266f, 0.9266f, 0.9266f, 0.9161f, 0.8987f,
+    // 48000 Hz, LF 0.25, HF 0.25, size 0
+    1.0000f, 1.1214f, 1.0303f, 1.0200f, 1.0037f, 0.9896f, 0.9628f, 0.9405f, 0.9178f, 0.9070f, 0.9070f, 0.8969f, 0.8669f, 0.8226f,
+    // 48000 Hz, LF 0.25, HF 0.25, size 0.25
+    1.0000f, 1.0777f, 1.0525f, 1.0128f, 1.0128f, 1.0018f, 0.9822f, 0.9588f, 0.9311f, 0.9311f, 0.9311f, 0.9311f, 0.9056f, 0.8783f,
+    // 48000 Hz, LF 0.25, HF 0.25, size 0.5
+    1.0000f, 1.0897f, 1.0897f, 1.0784f, 1.0461f, 1.0256f, 1.0131f, 0.9772f, 0.9411f, 0.9411f, 0.9411f, 0.9411f, 0.9273f, 0.9070f,
+    // 48000 Hz, LF 0.25, HF 0.25, size 0.75
+    1.0000f, 1.1854f, 1.0555f, 1.0555f, 1.0555f, 1.0432f, 1.0187f, 0.9915f, 0.9575f, 0.9446f, 0.9446f, 0.9446f, 0.9288f, 0.9107f,
+    // 48000 Hz, LF 0.25, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.1306f, 1.1015f, 1.0786f, 1.0569f, 1.0252f, 0.9979f, 0.9570f, 0.9570f, 0.9570f, 0.9570f, 0.9397f, 0.9238f,
+    // 48000 Hz, LF 0.25, HF 0.5, size 0
+    1.0000f, 1.0811f, 1.0249f, 1.0249f, 1.0132f, 1.0023f, 0.9777f, 0.9516f, 0.9263f, 0.9083f, 0.9083f, 0.9083f, 0.8728f, 0.8314f,
+    // 48000 Hz, LF 0.25, HF 0.5, size 0.25
+    1.0000f, 1.0797f, 1.0569f, 1.0161f, 1.0161f, 1.0161f, 0.9977f, 0.9694f, 0.9417f, 0.9417f, 0.9417f, 0.9417f, 0.9162f, 0.8906f,
+    // 48000 Hz, LF 0.25, HF 0.5, size 0.5
+    1.0000f, 1.0872f, 1.0872f, 1.0872f, 1.0533f, 1.0336f, 1.0218f, 0.9868f, 0.9553f, 0.9553f, 0.9553f, 0.9553f, 0.9384f, 0.9209f,
+    // 48000 Hz, LF 0.25, HF 0.5, size 0.75
+    1.0000f, 1.1572f, 1.0491f, 1.0491f, 1.0491f, 1.0491f, 1.0288f, 1.0020f, 0.9659f, 0.9543f, 0.9543f, 0.9543f, 0.9370f, 0.9222f,
+    // 48000 Hz, LF 0.25, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.1236f, 1.0978f, 1.0801f, 1.0622f, 1.0332f, 1.0074f, 0.9645f, 0.9645f, 0.9645f, 0.9645f, 0.9461f, 0.9337f,
+    // 48000 Hz, LF 0.25, HF 0.625, size 0
+    1.0000f, 1.0555f, 1.0229f, 1.0229f, 1.0072f, 1.0072f, 0.9850f, 0.9574f, 0.9197f, 0.9197f, 0.9066f, 0.9066f, 0.8640f, 0.8214f,
+    // 48000 Hz, LF 0.25, HF 0.625, size 0.25
+    1.0000f, 1.0859f, 1.0608f, 1.0223f, 1.0223f, 1.0223f, 1.0036f, 0.9729f, 0.9420f, 0.9420f, 0.9420f, 0.9420f, 0.9149f, 0.8907f,
+    // 48000 Hz, LF 0.25, HF 0.625, size 0.5
+    1.0000f, 1.0801f, 1.0907f, 1.0907f, 1.0560f, 1.0375f, 1.0252f, 0.9892f, 0.9481f, 0.9481f, 0.9616f, 0.9616f, 0.9384f, 0.9200f,
+    // 48000 Hz, LF 0.25, HF 0.625, size 0.75
+    1.0000f, 1.1406f, 1.0336f, 1.0519f, 1.0519f, 1.0519f, 1.0351f, 1.0087f, 0.9704f, 0.9555f, 0.9555f, 0.9555f, 0.9365f, 0.9229f,
+    // 48000 Hz, LF 0.25, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.1112f, 1.0917f, 1.0782f, 1.0654f, 1.0404f, 1.0153f, 0.9773f, 0.9655f, 0.9655f, 0.9655f, 0.9470f, 0.9352f,
+    // 48000 Hz, LF 0.25, HF 0.75, size 0
+    1.0000f, 1.0593f, 1.0121f, 1.0121f, 1.0121f, 1.0121f, 0.9898f, 0.9580f, 0.9214f, 0.9039f, 0.9039f, 0.8912f, 0.8361f, 0.7827f,
+    // 48000 Hz, LF 0.25, HF 0.75, size 0.25
+    1.0000f, 1.0927f, 1.0640f, 1.0248f, 1.0248f, 1.0248f, 1.0042f, 0.9701f, 0.9290f, 0.9290f, 0.9290f, 0.9290f, 0.9008f, 0.8719f,
+    // 48000 Hz, LF 0.25, HF 0.75, size 0.5
+    1.0000f, 1.0725f, 1.0924f, 1.0924f, 1.0551f, 1.0387f, 1.0270f, 0.9892f, 0.9462f, 0.9462f, 0.9599f, 0.9599f, 0.9272f, 0.9034f,
+    // 48000 Hz, LF 0.25, HF 0.75, size 0.75
+    1.0000f, 1.1379f, 1.0304f, 1.0514f, 1.0514f, 1.0514f, 1.0385f, 1.0136f, 0.9705f, 0.9489f, 0.9489f, 0.9489f, 0.9301f, 0.9148f,
+    // 48000 Hz, LF 0.25, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0892f, 1.0892f, 1.0670f, 1.0670f, 1.0469f, 1.0212f, 0.9806f, 0.9606f, 0.9606f, 0.9606f, 0.9432f, 0.9291f,
+    // 48000 Hz, LF 0.25, HF 0.875, size 0
+    1.0000f, 1.0540f, 1.0067f, 1.0067f, 1.0067f, 1.0067f, 0.9851f, 0.9488f, 0.8922f, 0.8734f, 0.8479f, 0.8258f, 0.7400f, 0.6593f,
+    // 48000 Hz, LF 0.25, HF 0.875, size 0.25
+    1.0000f, 1.1059f, 1.0500f, 1.0148f, 1.0148f, 1.0148f, 0.9910f, 0.9558f, 0.9128f, 0.9026f, 0.9026f, 0.8924f, 0.8398f, 0.7877f,
+    // 48000 Hz, LF 0.25, HF 0.875, size 0.5
+    1.0000f, 1.0496f, 1.0963f, 1.0834f, 1.0442f, 1.0260f, 1.0260f, 0.9853f, 0.9444f, 0.9321f, 0.9321f, 0.9321f, 0.8811f, 0.8414f,
+    // 48000 Hz, LF 0.25, HF 0.875, size 0.75
+    1.0000f, 1.1310f, 1.0435f, 1.0435f, 1.0435f, 1.0289f, 1.0289f, 1.0055f, 0.9625f, 0.9384f, 0.9384f, 0.9218f, 0.8932f, 0.8647f,
+    // 48000 Hz, LF 0.25, HF 0.875, size 1
+    1.0000f, 1.3762f, 1.0709f, 1.0978f, 1.0788f, 1.0682f, 1.0473f, 1.0157f, 0.9785f, 0.9433f, 0.9433f, 0.9433f, 0.9152f, 0.8916f,
+    // 48000 Hz, LF 0.25, HF 1, size 0
+    1.0000f, 1.0071f, 0.9915f, 0.9768f, 0.9382f, 0.8856f, 0.8529f, 0.7954f, 0.6718f, 0.5722f, 0.3855f, 0.1982f, 0.2238f, 0.2985f,
+    // 48000 Hz, LF 0.25, HF 1, size 0.25
+    1.0000f, 1.0533f, 0.9677f, 0.9570f, 0.9715f, 0.9610f, 0.9392f, 0.8842f, 0.8031f, 0.7490f, 0.6271f, 0.5065f, 0.2768f, 0.1705f,
+    // 48000 Hz, LF 0.25, HF 1, size 0.5
+    1.0000f, 1.0206f, 1.0658f, 1.0204f, 0.9832f, 0.9832f, 0.9722f, 0.9213f, 0.8477f, 0.7935f, 0.7219f, 0.6668f, 0.4999f, 0.3337f,
+    // 48000 Hz, LF 0.25, HF 1, size 0.75
+    1.0000f, 1.0671f, 1.0671f, 1.0371f, 0.9999f, 0.9810f, 0.9810f, 0.9649f, 0.8915f, 0.8422f, 0.7861f, 0.7182f, 0.6059f, 0.4828f,
+    // 48000 Hz, LF 0.25, HF 1, size 1
+    1.0000f, 1.0418f, 1.0149f, 1.1138f, 1.0855f, 1.0561f, 0.9986f, 0.9697f, 0.9329f, 0.8873f, 0.8267f, 0.7672f, 0.6526f, 0.5654f,
+    // 48000 Hz, LF 0.5, HF 0, size 0
+    1.0000f, 1.1386f, 1.0089f, 0.9805f, 0.9571f, 0.9422f, 0.9165f, 0.8964f, 0.8681f, 0.8681f, 0.8505f, 0.8277f, 0.7769f, 0.7162f,
+    // 48000 Hz, LF 0.5, HF 0, size 0.25
+    1.0000f, 1.0786f, 1.0170f, 0.9818f, 0.9705f, 0.9564f, 0.9347f, 0.9176f, 0.9029f, 0.8886f, 0.8886f, 0.8786f, 0.8382f, 0.8031f,
+    // 48000 Hz, LF 0.5, HF 0, size 0.5
+    1.0000f, 1.0334f, 1.0334f, 1.0224f, 0.9966f, 0.9797f, 0.9670f, 0.9396f, 0.8986f, 0.8986f, 0.8880f, 0.8880f, 0.8688f, 0.8475f,
+    // 48000 Hz, LF 0.5, HF 0, size 0.75
+    1.0000f, 1.1476f, 1.0329f, 1.0329f, 1.0168f, 1.0004f, 0.9753f, 0.9471f, 0.9138f, 0.9138f, 0.9026f, 0.9026f, 0.8793f, 0.8463f,
+    // 48000 Hz, LF 0.5, HF 0, size 1
+    1.0000f, 1.0000f, 1.1217f, 1.0812f, 1.0332f, 1.0055f, 0.9785f, 0.9540f, 0.9269f, 0.9107f, 0.9107f, 0.9107f, 0.8934f, 0.8664f,
+    // 48000 Hz, LF 0.5, HF 0.25, size 0
+    1.0000f, 1.1299f, 1.0260f, 1.0123f, 0.9938f, 0.9766f, 0.9447f, 0.9205f, 0.8944f, 0.8820f, 0.8643f, 0.8393f, 0.7852f, 0.7224f,
+    // 48000 Hz, LF 0.5, HF 0.25, size 0.25
+    1.0000f, 1.0741f, 1.0495f, 1.0051f, 1.0051f, 0.9929f, 0.9707f, 0.9470f, 0.9276f, 0.9090f, 0.9090f, 0.8980f, 0.8572f, 0.8101f,
+    // 48000 Hz, LF 0.5, HF 0.25, size 0.5
+    1.0000f, 1.0875f, 1.0875f, 1.0762f, 1.0428f, 1.0200f, 1.0043f, 0.9668f, 0.9257f, 0.9257f, 0.9092f, 0.9092f, 0.8906f, 0.8596f,
+    // 48000 Hz, LF 0.5, HF 0.25, size 0.75
+    1.0000f, 1.1851f, 1.0541f, 1.0541f, 1.0541f, 1.0406f, 1.0125f, 0.9810f, 0.9454f, 0.9344f, 0.9344f, 0.9239f, 0.8996f, 0.8696f,
+    // 48000 Hz, LF 0.5, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.1397f, 1.0973f, 1.0745f, 1.0526f, 1.0200f, 0.9907f, 0.9483f, 0.9483f, 0.9383f, 0.9383f, 0.9162f, 0.8900f,
+    // 48000 Hz, LF 0.5, HF 0.5, size 0
+    1.0000f, 1.0815f, 1.0148f, 1.0148f, 1.0016f, 0.9863f, 0.9554f, 0.9268f, 0.8973f, 0.8822f, 0.8592f, 0.8359f, 0.7733f, 0.6962f,
+    // 48000 Hz, LF 0.5, HF 0.5, size 0.25
+    1.0000f, 1.0747f, 1.0529f, 1.0047f, 1.0047f, 1.0047f, 0.9834f, 0.9539f, 0.9247f, 0.9247f, 0.9130f, 0.8989f, 0.8542f, 0.8055f,
+    // 48000 Hz, LF 0.5, HF 0.5, size 0.5
+    1.0000f, 1.0847f, 1.0847f, 1.0847f, 1.0491f, 1.0264f, 1.0107f, 0.9727f, 0.9285f, 0.9285f, 0.9167f, 0.9167f, 0.8946f, 0.8605f,
+    // 48000 Hz, LF 0.5, HF 0.5, size 0.75
+    1.0000f, 1.1551f, 1.0460f, 1.0460f, 1.0460f, 1.0460f, 1.0211f, 0.9882f, 0.9439f, 0.9439f, 0.9283f, 0.9283f, 0.9024f, 0.8730f,
+    // 48000 Hz, LF 0.5, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.1217f, 1.0917f, 1.0747f, 1.0566f, 1.0266f, 0.9981f, 0.9511f, 0.9511f, 0.9406f, 0.9406f, 0.9168f, 0.8920f,
+    // 48000 Hz, LF 0.5, HF 0.625, size 0
+    1.0000f, 1.0590f, 1.0111f, 1.0111f, 1.0009f, 0.9875f, 0.9588f, 0.9277f, 0.8912f, 0.8729f, 0.8451f, 0.8136f, 0.7462f, 0.6578f,
+    // 48000 Hz, LF 0.5, HF 0.625, size 0.25
+    1.0000f, 1.0801f, 1.0556f, 1.0082f, 1.0082f, 1.0082f, 0.9862f, 0.9529f, 0.9194f, 0.9194f, 0.9032f, 0.8879f, 0.8410f, 0.7871f,
+    // 48000 Hz, LF 0.5, HF 0.625, size 0.5
+    1.0000f, 1.0875f, 1.0875f, 1.0875f, 1.0509f, 1.0287f, 1.0116f, 0.9739f, 0.9349f, 0.9157f, 0.9157f, 0.9157f, 0.8856f, 0.8486f,
+    // 48000 Hz, LF 0.5, HF 0.625, size 0.75
+    1.0000f, 1.1373f, 1.0249f, 1.0484f, 1.0484f, 1.0484f, 1.0258f, 0.9926f, 0.9514f, 0.9344f, 0.9344f, 0.9239f, 0.8934f, 0.8617f,
+    // 48000 Hz, LF 0.5, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.1086f, 1.0836f, 1.0712f, 1.0584f, 1.0327f, 1.0041f, 0.9599f, 0.9482f, 0.9355f, 0.9355f, 0.9092f, 0.8828f,
+    // 48000 Hz, LF 0.5, HF 0.75, size 0
+    1.0000f, 1.0426f, 0.9952f, 0.9952f, 0.9952f, 0.9840f, 0.9533f, 0.9139f, 0.8656f, 0.8403f, 0.7964f, 0.7497f, 0.6526f, 0.5353f,
+    // 48000 Hz, LF 0.5, HF 0.75, size 0.25
+    1.0000f, 1.0851f, 1.0565f, 1.0061f, 1.0061f, 1.0061f, 0.9809f, 0.9411f, 0.9061f, 0.8939f, 0.8733f, 0.8505f, 0.7834f, 0.7252f,
+    // 48000 Hz, LF 0.5, HF 0.75, size 0.5
+    1.0000f, 1.0687f, 1.0880f, 1.0880f, 1.0484f, 1.0267f, 1.0081f, 0.9675f, 0.9265f, 0.9133f, 0.9133f, 0.8993f, 0.8474f, 0.7962f,
+    // 48000 Hz, LF 0.5, HF 0.75, size 0.75
+    1.0000f, 1.1300f, 1.0188f, 1.0352f, 1.0470f, 1.0470f, 1.0264f, 0.9923f, 0.9446f, 0.9200f, 0.9200f, 0.9060f, 0.8653f, 0.8238f,
+    // 48000 Hz, LF 0.5, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0930f, 1.0778f, 1.0574f, 1.0574f, 1.0368f, 1.0061f, 0.9562f, 0.9384f, 0.9274f, 0.9169f, 0.8872f, 0.8546f,
+    // 48000 Hz, LF 0.5, HF 0.875, size 0
+    1.0000f, 1.0250f, 0.9672f, 0.9780f, 0.9585f, 0.9585f, 0.9238f, 0.8544f, 0.7673f, 0.7021f, 0.6164f, 0.5357f, 0.2985f, 0.2985f,
+    // 48000 Hz, LF 0.5, HF 0.875, size 0.25
+    1.0000f, 1.0978f, 1.0486f, 0.9954f, 0.9954f, 0.9814f, 0.9447f, 0.8976f, 0.8399f, 0.8163f, 0.7837f, 0.7270f, 0.5945f, 0.4558f,
+    // 48000 Hz, LF 0.5, HF 0.875, size 0.5
+    1.0000f, 1.0419f, 1.0876f, 1.0743f, 1.0315f, 1.0104f, 0.9938f, 0.9475f, 0.8952f, 0.8726f, 0.8440f, 0.8060f, 0.7061f, 0.6217f,
+    // 48000 Hz, LF 0.5, HF 0.875, size 0.75
+    1.0000f, 1.1159f, 1.0289f, 1.0289f, 1.0289f, 1.0289f, 1.0064f, 0.9678f, 0.9158f, 0.8957f, 0.8675f, 0.8351f, 0.7594f, 0.6931f,
+    // 48000 Hz, LF 0.5, HF 0.875, size 1
+    1.0000f, 1.3976f, 1.0641f, 1.0796f, 1.0629f, 1.0524f, 1.0312f, 0.9883f, 0.9360f, 0.9024f, 0.8857f, 0.8616f, 0.8022f, 0.7361f,
+    // 48000 Hz, LF 0.5, HF 1, size 0
+    1.0000f, 0.9064f, 0.8840f, 0.8492f, 0.7583f, 0.7162f, 0.6268f, 0.4668f, 0.1657f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 48000 Hz, LF 0.5, HF 1, size 0.25
+    1.0000f, 1.0148f, 0.8864f, 0.8626f, 0.8626f, 0.8267f, 0.7705f, 0.6678f, 0.4800f, 0.3341f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 48000 Hz, LF 0.5, HF 1, size 0.5
+    1.0000f, 0.9775f, 1.0353f, 0.9891f, 0.9225f, 0.8994f, 0.8593f, 0.7804f, 0.5971f, 0.4831f, 0.2908f, 0.0895f, 0.0895f, 0.1194f,
+    // 48000 Hz, LF 0.5, HF 1, size 0.75
+    1.0000f, 1.0243f, 1.0243f, 1.0003f, 0.9602f, 0.9164f, 0.8977f, 0.8430f, 0.7250f, 0.6147f, 0.4536f, 0.2817f, 0.0689f, 0.0918f,
+    // 48000 Hz, LF 0.5, HF 1, size 1
+    1.0000f, 1.0405f, 0.9905f, 1.0697f, 1.0518f, 0.9988f, 0.9481f, 0.8619f, 0.7817f, 0.6849f, 0.5484f, 0.4145f, 0.1310f, 0.0746f,
+    // 48000 Hz, LF 0.75, HF 0, size 0
+    1.0000f, 1.1620f, 1.0058f, 0.9712f, 0.9460f, 0.9298f, 0.9039f, 0.8796f, 0.8508f, 0.8374f, 0.8067f, 0.7703f, 0.6836f, 0.5923f,
+    // 48000 Hz, LF 0.75, HF 0, size 0.25
+    1.0000f, 1.0759f, 1.0149f, 0.9776f, 0.9635f, 0.9486f, 0.9254f, 0.9080f, 0.8867f, 0.8762f, 0.8594f, 0.8430f, 0.7860f, 0.7389f,
+    // 48000 Hz, LF 0.75, HF 0, size 0.5
+    1.0000f, 1.0306f, 1.0306f, 1.0190f, 0.9924f, 0.9746f, 0.9594f, 0.9309f, 0.8964f, 0.8838f, 0.8731f, 0.8625f, 0.8290f, 0.7994f,
+    // 48000 Hz, LF 0.75, HF 0, size 0.75
+    1.0000f, 1.1479f, 1.0300f, 1.0300f, 1.0135f, 0.9961f, 0.9698f, 0.9401f, 0.9088f, 0.8964f, 0.8964f, 0.8828f, 0.8481f, 0.8170f,
+    // 48000 Hz, LF 0.75, HF 0, size 1
+    1.0000f, 1.0000f, 1.1211f, 1.0781f, 1.0292f, 1.0006f, 0.9728f, 0.9474f, 0.9101f, 0.9101f, 0.8945f, 0.8945f, 0.8681f, 0.8439f,
+    // 48000 Hz, LF 0.75, HF 0.25, size 0
+    1.0000f, 1.1527f, 1.0225f, 1.0026f, 0.9809f, 0.9618f, 0.9282f, 0.9009f, 0.8684f, 0.8527f, 0.8222f, 0.7789f, 0.6852f, 0.5757f,
+    // 48000 Hz, LF 0.75, HF 0.25, size 0.25
+    1.0000f, 1.0696f, 1.0463f, 0.9965f, 0.9965f, 0.9838f, 0.9600f, 0.9365f, 0.9113f, 0.8951f, 0.8783f, 0.8623f, 0.8017f, 0.7456f,
+    // 48000 Hz, LF 0.75, HF 0.25, size 0.5
+    1.0000f, 1.0837f, 1.0837f, 1.0723f, 1.0379f, 1.0137f, 0.9954f, 0.9555f, 0.9081f, 0.9081f, 0.8904f, 0.8785f, 0.8473f, 0.8004f,
+    // 48000 Hz, LF 0.75, HF 0.25, size 0.75
+    1.0000f, 1.1860f, 1.0502f, 1.0502f, 1.0502f, 1.0357f, 1.0057f, 0.9716f, 0.9270f, 0.9270f, 0.9164f, 0.9010f, 0.8667f, 0.8250f,
+    // 48000 Hz, LF 0.75, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.1394f, 1.0925f, 1.0691f, 1.0465f, 1.0127f, 0.9842f, 0.9469f, 0.9312f, 0.9312f, 0.9205f, 0.8903f, 0.8558f,
+    // 48000 Hz, LF 0.75, HF 0.5, size 0
+    1.0000f, 1.0870f, 1.0130f, 1.0020f, 0.9857f, 0.9676f, 0.9335f, 0.9011f, 0.8668f, 0.8441f, 0.8043f, 0.7581f, 0.6525f, 0.5330f,
+    // 48000 Hz, LF 0.75, HF 0.5, size 0.25
+    1.0000f, 1.0687f, 1.0502f, 1.0028f, 1.0028f, 0.9928f, 0.9697f, 0.9398f, 0.9130f, 0.8951f, 0.8759f, 0.8499f, 0.7838f, 0.7113f,
+    // 48000 Hz, LF 0.75, HF 0.5, size 0.5
+    1.0000f, 1.0797f, 1.0797f, 1.0797f, 1.0428f, 1.0181f, 0.9991f, 0.9590f, 0.9182f, 0.9067f, 0.8873f, 0.8749f, 0.8398f, 0.7883f,
+    // 48000 Hz, LF 0.75, HF 0.5, size 0.75
+    1.0000f, 1.1555f, 1.0399f, 1.0399f, 1.0399f, 1.0399f, 1.0123f, 0.9763f, 0.9251f, 0.9251f, 0.9134f, 0.8984f, 0.8600f, 0.8150f,
+    // 48000 Hz, LF 0.75, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.1303f, 1.0848f, 1.0675f, 1.0483f, 1.0170f, 0.9896f, 0.9481f, 0.9373f, 0.9273f, 0.9171f, 0.8834f, 0.8466f,
+    // 48000 Hz, LF 0.75, HF 0.625, size 0
+    1.0000f, 1.0566f, 0.9943f, 0.9943f, 0.9809f, 0.9633f, 0.9304f, 0.8960f, 0.8530f, 0.8235f, 0.7699f, 0.7076f, 0.5908f, 0.4597f,
+    // 48000 Hz, LF 0.75, HF 0.625, size 0.25
+    1.0000f, 1.0728f, 1.0518f, 1.0030f, 0.9930f, 0.9930f, 0.9690f, 0.9344f, 0.9046f, 0.8856f, 0.8589f, 0.8251f, 0.7426f, 0.6580f,
+    // 48000 Hz, LF 0.75, HF 0.625, size 0.5
+    1.0000f, 1.0812f, 1.0812f, 1.0812f, 1.0430f, 1.0182f, 0.9966f, 0.9554f, 0.9125f, 0.8975f, 0.8778f, 0.8606f, 0.8156f, 0.7542f,
+    // 48000 Hz, LF 0.75, HF 0.625, size 0.75
+    1.0000f, 1.1355f, 1.0161f, 1.0411f, 1.0411f, 1.0411f, 1.0151f, 0.9782f, 0.9318f, 0.9175f, 0.9020f, 0.8845f, 0.8386f, 0.7855f,
+    // 48000 Hz, LF 0.75, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.1057f, 1.0743f, 1.0618f, 1.0480f, 1.0208f, 0.9923f, 0.9441f, 0.9306f, 0.9156f, 0.9043f, 0.8651f, 0.8219f,
+    // 48000 Hz, LF 0.75, HF 0.75, size 0
+    1.0000f, 1.0278f, 0.9763f, 0.9763f, 0.9655f, 0.9466f, 0.9127f, 0.8687f, 0.8054f, 0.7623f, 0.6738f, 0.5743f, 0.4023f, 0.2985f,
+    // 48000 Hz, LF 0.75, HF 0.75, size 0.25
+    1.0000f, 1.0753f, 1.0515f, 1.0006f, 0.9848f, 0.9848f, 0.9570f, 0.9132f, 0.8706f, 0.8492f, 0.7996f, 0.7512f, 0.6391f, 0.5177f,
+    // 48000 Hz, LF 0.75, HF 0.75, size 0.5
+    1.0000f, 1.0627f, 1.0791f, 1.0791f, 1.0372f, 1.0117f, 0.9858f, 0.9396f, 0.8923f, 0.8702f, 0.8517f, 0.8203f, 0.7409f, 0.6519f,
+    // 48000 Hz, LF 0.75, HF 0.75, size 0.75
+    1.0000f, 1.1368f, 1.0058f, 1.0231f, 1.0373f, 1.0373f, 1.0113f, 0.9721f, 0.9160f, 0.8955f, 0.8704f, 0.8452f, 0.7776f, 0.7148f,
+    // 48000 Hz, LF 0.75, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0889f, 1.0650f, 1.0531f, 1.0423f, 1.0207f, 0.9896f, 0.9321f, 0.9120f, 0.8870f, 0.8666f, 0.8146f, 0.7528f,
+    // 48000 Hz, LF 0.75, HF 0.875, size 0
+    1.0000f, 1.0097f, 0.9278f, 0.9278f, 0.9059f, 0.8817f, 0.8216f, 0.7417f, 0.6220f, 0.5093f, 0.3164f, 0.1492f, 0.2238f, 0.2985f,
+    // 48000 Hz, LF 0.75, HF 0.875, size 0.25
+    1.0000f, 1.0837f, 1.0374f, 0.9782f, 0.9615f, 0.9413f, 0.8959f, 0.8361f, 0.7580f, 0.7046f, 0.5885f, 0.4945f, 0.2485f, 0.1705f,
+    // 48000 Hz, LF 0.75, HF 0.875, size 0.5
+    1.0000f, 1.0304f, 1.0716f, 1.0569f, 1.0096f, 0.9818f, 0.9531f, 0.8981f, 0.8259f, 0.7833f, 0.7218f, 0.6414f, 0.4747f, 0.3029f,
+    // 48000 Hz, LF 0.75, HF 0.875, size 0.75
+    1.0000f, 1.1058f, 1.0092f, 1.0235f, 1.0235f, 1.0133f, 0.9887f, 0.9271f, 0.8572f, 0.8251f, 0.7766f, 0.7198f, 0.5803f, 0.4432f,
+    // 48000 Hz, LF 0.75, HF 0.875, size 1
+    1.0000f, 1.4235f, 1.0562f, 1.0562f, 1.0383f, 1.0261f, 1.0040f, 0.9561f, 0.8884f, 0.8504f, 0.7997f, 0.7503f, 0.6523f, 0.5449f,
+    // 48000 Hz, LF 0.75, HF 1, size 0
+    1.0000f, 0.8069f, 0.7002f, 0.6251f, 0.5108f, 0.4186f, 0.2515f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 48000 Hz, LF 0.75, HF 1, size 0.25
+    1.0000f, 0.9486f, 0.8093f, 0.7575f, 0.7159f, 0.6529f, 0.5436f, 0.3739f, 0.0426f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 48000 Hz, LF 0.75, HF 1, size 0.5
+    1.0000f, 0.9407f, 0.9798f, 0.9232f, 0.8306f, 0.7814f, 0.7206f, 0.5748f, 0.3109f, 0.0937f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 48000 Hz, LF 0.75, HF 1, size 0.75
+    1.0000f, 0.9790f, 0.9790f, 0.9554f, 0.8868f, 0.8179f, 0.7708f, 0.6697f, 0.4918f, 0.3149f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 48000 Hz, LF 0.75, HF 1, size 1
+    1.0000f, 1.0412f, 0.9292f, 1.0067f, 0.9781f, 0.9313f, 0.8691f, 0.7406f, 0.5727f, 0.4244f, 0.1785f, 0.0373f, 0.0560f, 0.0746f,
+    // 48000 Hz, LF 1, HF 0, size 0
+    1.0000f, 1.1781f, 1.0032f, 0.9626f, 0.9357f, 0.9183f, 0.8909f, 0.8627f, 0.8238f, 0.8001f, 0.7545f, 0.6924f, 0.5879f, 0.4679f,
+    // 48000 Hz, LF 1, HF 0, size 0.25
+    1.0000f, 1.0733f, 1.0118f, 0.9730f, 0.9569f, 0.9401f, 0.9153f, 0.8962f, 0.8688f, 0.8556f, 0.8290f, 0.8028f, 0.7283f, 0.6612f,
+    // 48000 Hz, LF 1, HF 0, size 0.5
+    1.0000f, 1.0270f, 1.0270f, 1.0149f, 0.9877f, 0.9691f, 0.9521f, 0.9219f, 0.8840f, 0.8699f, 0.8517f, 0.8357f, 0.7856f, 0.7418f,
+    // 48000 Hz, LF 1, HF 0, size 0.75
+    1.0000f, 1.1482f, 1.0269f, 1.0269f, 1.0089f, 0.9906f, 0.9639f, 0.9331f, 0.8994f, 0.8808f, 0.8808f, 0.8625f, 0.8159f, 0.7761f,
+    // 48000 Hz, LF 1, HF 0, size 1
+    1.0000f, 1.0000f, 1.1221f, 1.0856f, 1.0251f, 0.9956f, 0.9669f, 0.9416f, 0.9125f, 0.9001f, 0.8882f, 0.8768f, 0.8423f, 0.8111f,
+    // 48000 Hz, LF 1, HF 0.25, size 0
+    1.0000f, 1.1719f, 1.0198f, 0.9933f, 0.9685f, 0.9473f, 0.9115f, 0.8802f, 0.8374f, 0.8190f, 0.7690f, 0.7105f, 0.5712f, 0.4268f,
+    // 48000 Hz, LF 1, HF 0.25, size 0.25
+    1.0000f, 1.0653f, 1.0437f, 0.9991f, 0.9879f, 0.9739f, 0.9483f, 0.9241f, 0.8911f, 0.8715f, 0.8452f, 0.8193f, 0.7369f, 0.6590f,
+    // 48000 Hz, LF 1, HF 0.25, size 0.5
+    1.0000f, 1.0785f, 1.0785f, 1.0672f, 1.0320f, 1.0069f, 0.9868f, 0.9452f, 0.9027f, 0.8894f, 0.8656f, 0.8470f, 0.8017f, 0.7520f,
+    // 48000 Hz, LF 1, HF 0.25, size 0.75
+    1.0000f, 1.1862f, 1.0441f, 1.0441f, 1.0441f, 1.0289f, 0.9984f, 0.9627f, 0.9132f, 0.9132f, 0.8981f, 0.8763f, 0.8318f, 0.7767f,
+    // 48000 Hz, LF 1, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.1392f, 1.0883f, 1.0635f, 1.0395f, 1.0043f, 0.9761f, 0.9384f, 0.9262f, 0.9155f, 0.9003f, 0.8616f, 0.8178f,
+    // 48000 Hz, LF 1, HF 0.5, size 0
+    1.0000f, 1.1076f, 1.0088f, 0.9896f, 0.9698f, 0.9490f, 0.9109f, 0.8723f, 0.8256f, 0.7947f, 0.7333f, 0.6537f, 0.5068f, 0.3461f,
+    // 48000 Hz, LF 1, HF 0.5, size 0.25
+    1.0000f, 1.0619f, 1.0439f, 0.9910f, 0.9910f, 0.9796f, 0.9542f, 0.9234f, 0.8869f, 0.8602f, 0.8284f, 0.7953f, 0.7055f, 0.6169f,
+    // 48000 Hz, LF 1, HF 0.5, size 0.5
+    1.0000f, 1.0729f, 1.0729f, 1.0729f, 1.0348f, 1.0088f, 0.9875f, 0.9438f, 0.8974f, 0.8813f, 0.8518f, 0.8312f, 0.7770f, 0.7144f,
+    // 48000 Hz, LF 1, HF 0.5, size 0.75
+    1.0000f, 1.1531f, 1.0257f, 1.0411f, 1.0411f, 1.0309f, 1.0026f, 0.9656f, 0.9189f, 0.9063f, 0.8874f, 0.8642f, 0.8120f, 0.7493f,
+    // 48000 Hz, LF 1, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.1300f, 1.0786f, 1.0597f, 1.0386f, 1.0056f, 0.9788f, 0.9362f, 0.9224f, 0.9060f, 0.8901f, 0.8437f, 0.7936f,
+    // 48000 Hz, LF 1, HF 0.625, size 0
+    1.0000f, 1.0603f, 0.9897f, 0.9772f, 0.9604f, 0.9388f, 0.8997f, 0.8574f, 0.8005f, 0.7552f, 0.6698f, 0.5671f, 0.3833f, 0.2985f,
+    // 48000 Hz, LF 1, HF 0.625, size 0.25
+    1.0000f, 1.0642f, 1.0437f, 0.9863f, 0.9863f, 0.9756f, 0.9489f, 0.9125f, 0.8726f, 0.8399f, 0.7980f, 0.7453f, 0.6281f, 0.5137f,
+    // 48000 Hz, LF 1, HF 0.625, size 0.5
+    1.0000f, 1.0725f, 1.0725f, 1.0725f, 1.0328f, 1.0063f, 0.9810f, 0.9353f, 0.8855f, 0.8656f, 0.8278f, 0.8013f, 0.7310f, 0.6380f,
+    // 48000 Hz, LF 1, HF 0.625, size 0.75
+    1.0000f, 1.1333f, 1.0061f, 1.0297f, 1.0297f, 1.0297f, 1.0027f, 0.9632f, 0.9113f, 0.8923f, 0.8666f, 0.8382f, 0.7724f, 0.7051f,
+    // 48000 Hz, LF 1, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.1137f, 1.0658f, 1.0518f, 1.0355f, 1.0064f, 0.9788f, 0.9282f, 0.9108f, 0.8871f, 0.8688f, 0.8125f, 0.7501f,
+    // 48000 Hz, LF 1, HF 0.75, size 0
+    1.0000f, 1.0141f, 0.9499f, 0.9499f, 0.9338f, 0.9084f, 0.8660f, 0.8126f, 0.7227f, 0.6426f, 0.5054f, 0.3432f, 0.2238f, 0.2985f,
+    // 48000 Hz, LF 1, HF 0.75, size 0.25
+    1.0000f, 1.0634f, 1.0418f, 0.9843f, 0.9714f, 0.9593f, 0.9277f, 0.8790f, 0.8221f, 0.7824f, 0.7006f, 0.6262f, 0.4463f, 0.2641f,
+    // 48000 Hz, LF 1, HF 0.75, size 0.5
+    1.0000f, 1.0547f, 1.0670f, 1.0670f, 1.0225f, 0.9942f, 0.9609f, 0.9075f, 0.8514f, 0.8222f, 0.7715f, 0.7249f, 0.6035f, 0.4797f,
+    // 48000 Hz, LF 1, HF 0.75, size 0.75
+    1.0000f, 1.1326f, 0.9911f, 1.0083f, 1.0216f, 1.0216f, 0.9931f, 0.9504f, 0.8852f, 0.8557f, 0.8099f, 0.7700f, 0.6719f, 0.5766f,
+    // 48000 Hz, LF 1, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0845f, 1.0521f, 1.0383f, 1.0240f, 1.0002f, 0.9702f, 0.9068f, 0.8799f, 0.8416f, 0.8122f, 0.7298f, 0.6378f,
+    // 48000 Hz, LF 1, HF 0.875, size 0
+    1.0000f, 0.9906f, 0.8743f, 0.8743f, 0.8396f, 0.7963f, 0.7275f, 0.6160f, 0.4292f, 0.2605f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 48000 Hz, LF 1, HF 0.875, size 0.25
+    1.0000f, 1.0654f, 1.0196f, 0.9458f, 0.9188f, 0.8909f, 0.8361f, 0.7630f, 0.6545f, 0.5699f, 0.3663f, 0.1811f, 0.1279f, 0.1705f,
+    // 48000 Hz, LF 1, HF 0.875, size 0.5
+    1.0000f, 1.0160f, 1.0475f, 1.0338f, 0.9805f, 0.9472f, 0.9029f, 0.8374f, 0.7460f, 0.6696f, 0.5642f, 0.4329f, 0.1526f, 0.1194f,
+    // 48000 Hz, LF 1, HF 0.875, size 0.75
+    1.0000f, 1.0949f, 0.9866f, 0.9984f, 0.9984f, 0.9861f, 0.9550f, 0.8824f, 0.7898f, 0.7306f, 0.6547f, 0.5568f, 0.3347f, 0.1151f,
+    // 48000 Hz, LF 1, HF 0.875, size 1
+    1.0000f, 1.4453f, 1.0479f, 1.0322f, 1.0095f, 0.9906f, 0.9672f, 0.9272f, 0.8363f, 0.7887f, 0.7012f, 0.6149f, 0.4421f, 0.2815f,
+    // 48000 Hz, LF 1, HF 1, size 0
+    1.0000f, 0.6731f, 0.5045f, 0.3461f, 0.2018f, 0.0409f, 0.0280f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 48000 Hz, LF 1, HF 1, size 0.25
+    1.0000f, 0.8666f, 0.7244f, 0.6228f, 0.5350f, 0.4363f, 0.2768f, 0.0213f, 0.0320f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 48000 Hz, LF 1, HF 1, size 0.5
+    1.0000f, 0.8854f, 0.9105f, 0.8192f, 0.7066f, 0.6176f, 0.5180f, 0.3109f, 0.0224f, 0.0298f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 48000 Hz, LF 1, HF 1, size 0.75
+    1.0000f, 0.9384f, 0.9211f, 0.8749f, 0.7975f, 0.7108f, 0.6299f, 0.4665f, 0.2013f, 0.0230f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 48000 Hz, LF 1, HF 1, size 1
+    1.0000f, 1.0315f, 0.8754f, 0.9239f, 0.8714f, 0.8392f, 0.7619f, 0.5860f, 0.3263f, 0.1040f, 0.0280f, 0.0373f, 0.0560f, 0.0746f,
+    // 88200 Hz, LF 0, HF 0, size 0
+    1.0000f, 1.0000f, 1.2576f, 1.0327f, 0.9960f, 0.9767f, 0.9621f, 0.9478f, 0.9378f, 0.9378f, 0.9497f, 0.9611f, 0.9508f, 0.9508f,
+    // 88200 Hz, LF 0, HF 0, size 0.25
+    1.0000f, 1.0000f, 1.4224f, 1.0679f, 1.0066f, 0.9815f, 0.9577f, 0.9457f, 0.9358f, 0.9358f, 0.9505f, 0.9505f, 0.9505f, 0.9505f,
+    // 88200 Hz, LF 0, HF 0, size 0.5
+    1.0000f, 1.0000f, 1.4354f, 1.1059f, 1.0400f, 1.0109f, 0.9819f, 0.9613f, 0.9397f, 0.9397f, 0.9397f, 0.9397f, 0.9397f, 0.9397f,
+    // 88200 Hz, LF 0, HF 0, size 0.75
+    1.0000f, 1.0000f, 1.3190f, 1.1572f, 1.0726f, 1.0269f, 0.9978f, 0.9720f, 0.9409f, 0.9409f, 0.9409f, 0.9409f, 0.9409f, 0.9409f,
+    // 88200 Hz, LF 0, HF 0, size 1
+    1.0000f, 1.0000f, 1.3711f, 1.1746f, 1.1011f, 1.0418f, 1.0062f, 0.9778f, 0.9411f, 0.9411f, 0.9411f, 0.9411f, 0.9411f, 0.9411f,
+    // 88200 Hz, LF 0, HF 0.25, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1239f, 1.0513f, 1.0329f, 1.0187f, 1.0007f, 0.9805f, 0.9805f, 0.9980f, 0.9980f, 0.9873f, 0.9873f,
+    // 88200 Hz, LF 0, HF 0.25, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.2187f, 1.0741f, 1.0421f, 1.0176f, 0.9899f, 0.9899f, 0.9899f, 0.9899f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.25, size 0.5
+    1.0000f, 1.0000f, 1.1342f, 1.5122f, 1.1435f, 1.0799f, 1.0434f, 1.0128f, 0.9815f, 0.9815f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.25, size 0.75
+    1.0000f, 1.0000f, 1.2584f, 1.6779f, 1.2325f, 1.1182f, 1.0601f, 1.0273f, 0.9959f, 0.9840f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.1992f, 1.5990f, 1.2820f, 1.1418f, 1.0758f, 1.0375f, 1.0029f, 0.9888f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.5, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1663f, 1.0635f, 1.0442f, 1.0284f, 1.0095f, 0.9863f, 0.9863f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.5, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.3104f, 1.1033f, 1.0519f, 1.0260f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.5, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1736f, 1.0922f, 1.0531f, 1.0226f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.5, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0660f, 1.3325f, 1.1405f, 1.0702f, 1.0369f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.1220f, 1.4026f, 1.1640f, 1.0871f, 1.0485f, 1.0139f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.625, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1971f, 1.0726f, 1.0507f, 1.0330f, 1.0131f, 0.9900f, 0.9900f, 1.0117f, 1.0117f, 1.0117f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.625, size 0.25
+    1.0000f, 1.0000f, 1.0593f, 1.4123f, 1.1199f, 1.0593f, 1.0327f, 1.0148f, 0.9997f, 0.9997f, 1.0104f, 1.0104f, 1.0104f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.625, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2140f, 1.1119f, 1.0595f, 1.0280f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.625, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.1524f, 1.4405f, 1.1588f, 1.0783f, 1.0438f, 1.0111f, 0.9980f, 1.0105f, 1.0105f, 1.0000f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.2245f, 1.5306f, 1.1971f, 1.0962f, 1.0560f, 1.0207f, 1.0102f, 1.0102f, 1.0102f, 1.0102f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.75, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.2800f, 1.0913f, 1.0623f, 1.0416f, 1.0209f, 0.9992f, 0.9992f, 1.0166f, 1.0166f, 1.0166f, 1.0166f,
+    // 88200 Hz, LF 0, HF 0.75, size 0.25
+    1.0000f, 1.0000f, 1.1749f, 1.5665f, 1.1442f, 1.0722f, 1.0432f, 1.0249f, 1.0122f, 1.0122f, 1.0122f, 1.0122f, 1.0122f, 1.0122f,
+    // 88200 Hz, LF 0, HF 0.75, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0354f, 1.2942f, 1.1289f, 1.0670f, 1.0356f, 1.0117f, 1.0117f, 1.0117f, 1.0117f, 1.0117f, 1.0000f,
+    // 88200 Hz, LF 0, HF 0.75, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.3034f, 1.6292f, 1.2040f, 1.1006f, 1.0511f, 1.0101f, 1.0101f, 1.0101f, 1.0101f, 1.0101f, 1.0101f,
+    // 88200 Hz, LF 0, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0556f, 1.4074f, 1.7593f, 1.2695f, 1.1221f, 1.0653f, 1.0293f, 1.0116f, 1.0116f, 1.0116f, 1.0116f, 1.0116f,
+    // 88200 Hz, LF 0, HF 0.875, size 0
+    1.0000f, 1.0000f, 1.0691f, 1.4254f, 1.1357f, 1.0817f, 1.0571f, 1.0400f, 1.0226f, 1.0226f, 1.0226f, 1.0226f, 1.0226f, 1.0226f,
+    // 88200 Hz, LF 0, HF 0.875, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2046f, 1.0949f, 1.0560f, 1.0291f, 1.0291f, 1.0184f, 1.0184f, 1.0184f, 1.0184f, 1.0184f,
+    // 88200 Hz, LF 0, HF 0.875, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.1880f, 1.4850f, 1.1861f, 1.0785f, 1.0461f, 1.0145f, 1.0145f, 1.0145f, 1.0145f, 1.0145f, 1.0145f,
+    // 88200 Hz, LF 0, HF 0.875, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0803f, 1.2963f, 1.1193f, 1.0582f, 1.0279f, 1.0173f, 1.0173f, 1.0173f, 1.0173f, 1.0173f,
+    // 88200 Hz, LF 0, HF 0.875, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2304f, 1.4765f, 1.1496f, 1.0707f, 1.0353f, 1.0175f, 1.0175f, 1.0175f, 1.0175f, 1.0175f,
+    // 88200 Hz, LF 0, HF 1, size 0
+    1.0000f, 1.0000f, 1.2189f, 1.6252f, 1.2006f, 1.1062f, 1.0735f, 1.0735f, 1.0524f, 1.0424f, 1.0424f, 1.0424f, 1.0424f, 1.0424f,
+    // 88200 Hz, LF 0, HF 1, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.1397f, 1.4247f, 1.1730f, 1.0766f, 1.0505f, 1.0505f, 1.0505f, 1.0262f, 1.0262f, 1.0262f, 1.0262f,
+    // 88200 Hz, LF 0, HF 1, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1606f, 1.3927f, 1.1266f, 1.0618f, 1.0310f, 1.0468f, 1.0241f, 1.0241f, 1.0241f, 1.0241f,
+    // 88200 Hz, LF 0, HF 1, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0766f, 1.3457f, 1.6149f, 1.2129f, 1.0798f, 1.0421f, 1.0267f, 1.0267f, 1.0267f, 1.0267f, 1.0267f,
+    // 88200 Hz, LF 0, HF 1, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0130f, 1.2662f, 1.1052f, 1.0454f, 1.0269f, 1.0269f, 1.0269f, 1.0269f, 1.0269f,
+    // 88200 Hz, LF 0.25, HF 0, size 0
+    1.1165f, 1.0356f, 1.0108f, 0.9914f, 0.9744f, 0.9590f, 0.9451f, 0.9290f, 0.9101f, 0.9101f, 0.9249f, 0.9249f, 0.9045f, 0.8799f,
+    // 88200 Hz, LF 0.25, HF 0, size 0.25
+    1.0000f, 1.0756f, 1.0445f, 1.0050f, 0.9851f, 0.9675f, 0.9463f, 0.9253f, 0.9253f, 0.9253f, 0.9253f, 0.9253f, 0.9253f, 0.9092f,
+    // 88200 Hz, LF 0.25, HF 0, size 0.5
+    1.0000f, 1.0753f, 1.0537f, 1.0334f, 1.0126f, 0.9972f, 0.9724f, 0.9529f, 0.9338f, 0.9212f, 0.9212f, 0.9212f, 0.9212f, 0.9082f,
+    // 88200 Hz, LF 0.25, HF 0, size 0.75
+    1.0000f, 1.0756f, 1.0634f, 1.0470f, 1.0319f, 1.0115f, 0.9881f, 0.9639f, 0.9382f, 0.9236f, 0.9236f, 0.9236f, 0.9236f, 0.9094f,
+    // 88200 Hz, LF 0.25, HF 0, size 1
+    1.0000f, 1.3053f, 1.0735f, 1.0735f, 1.0442f, 1.0243f, 0.9962f, 0.9716f, 0.9425f, 0.9289f, 0.9289f, 0.9289f, 0.9289f, 0.9163f,
+    // 88200 Hz, LF 0.25, HF 0.25, size 0
+    1.1437f, 1.0588f, 1.0418f, 1.0249f, 1.0129f, 0.9942f, 0.9942f, 0.9733f, 0.9572f, 0.9572f, 0.9572f, 0.9572f, 0.9334f, 0.9142f,
+    // 88200 Hz, LF 0.25, HF 0.25, size 0.25
+    1.0000f, 1.0650f, 1.0650f, 1.0294f, 1.0294f, 1.0167f, 1.0019f, 0.9840f, 0.9590f, 0.9590f, 0.9590f, 0.9590f, 0.9590f, 0.9475f,
+    // 88200 Hz, LF 0.25, HF 0.25, size 0.5
+    1.0000f, 1.0988f, 1.0853f, 1.0853f, 1.0644f, 1.0512f, 1.0273f, 1.0001f, 0.9681f, 0.9681f, 0.9681f, 0.9681f, 0.9499f, 0.9499f,
+    // 88200 Hz, LF 0.25, HF 0.25, size 0.75
+    1.0000f, 1.1199f, 1.0985f, 1.0866f, 1.0866f, 1.0694f, 1.0417f, 1.0133f, 0.9809f, 0.9695f, 0.9695f, 0.9695f, 0.9695f, 0.9577f,
+    // 88200 Hz, LF 0.25, HF 0.25, size 1
+    1.0000f, 1.5354f, 1.0793f, 1.0793f, 1.0793f, 1.0793f, 1.0546f, 1.0249f, 0.9903f, 0.9741f, 0.9741f, 0.9741f, 0.9741f, 0.9629f,
+    // 88200 Hz, LF 0.25, HF 0.5, size 0
+    1.1897f, 1.0547f, 1.0389f, 1.0225f, 1.0071f, 1.0071f, 0.9970f, 0.9755f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9299f, 0.9097f,
+    // 88200 Hz, LF 0.25, HF 0.5, size 0.25
+    1.0000f, 1.0513f, 1.0649f, 1.0326f, 1.0326f, 1.0174f, 1.0050f, 0.9883f, 0.9575f, 0.9575f, 0.9679f, 0.9679f, 0.9556f, 0.9421f,
+    // 88200 Hz, LF 0.25, HF 0.5, size 0.5
+    1.0000f, 1.0845f, 1.0845f, 1.0845f, 1.0647f, 1.0525f, 1.0311f, 1.0048f, 0.9720f, 0.9720f, 0.9720f, 0.9720f, 0.9575f, 0.9463f,
+    // 88200 Hz, LF 0.25, HF 0.5, size 0.75
+    1.0000f, 1.1113f, 1.0927f, 1.0927f, 1.0927f, 1.0746f, 1.0450f, 1.0188f, 0.9853f, 0.9703f, 0.9703f, 0.9703f, 0.9703f, 0.9597f,
+    // 88200 Hz, LF 0.25, HF 0.5, size 1
+    1.0000f, 1.5042f, 1.0671f, 1.0793f, 1.0793f, 1.0793f, 1.0577f, 1.0321f, 0.9972f, 0.9747f, 0.9747f, 0.9747f, 0.9747f, 0.9630f,
+    // 88200 Hz, LF 0.25, HF 0.625, size 0
+    1.2023f, 1.0355f, 1.0355f, 1.0241f, 1.0068f, 1.0068f, 0.9953f, 0.9715f, 0.9404f, 0.9404f, 0.9404f, 0.9404f, 0.9186f, 0.8919f,
+    // 88200 Hz, LF 0.25, HF 0.625, size 0.25
+    1.0000f, 1.0477f, 1.0598f, 1.0328f, 1.0328f, 1.0160f, 1.0058f, 0.9922f, 0.9645f, 0.9645f, 0.9645f, 0.9645f, 0.9473f, 0.9293f,
+    // 88200 Hz, LF 0.25, HF 0.625, size 0.5
+    1.0000f, 1.0729f, 1.0833f, 1.0833f, 1.0616f, 1.0514f, 1.0321f, 1.0061f, 0.9711f, 0.9711f, 0.9711f, 0.9711f, 0.9520f, 0.9368f,
+    // 88200 Hz, LF 0.25, HF 0.625, size 0.75
+    1.0000f, 1.0942f, 1.0723f, 1.0960f, 1.0960f, 1.0771f, 1.0467f, 1.0207f, 0.9784f, 0.9784f, 0.9784f, 0.9667f, 0.9667f, 0.9550f,
+    // 88200 Hz, LF 0.25, HF 0.625, size 1
+    1.0000f, 1.4644f, 1.0626f, 1.0784f, 1.0784f, 1.0784f, 1.0597f, 1.0363f, 1.0007f, 0.9853f, 0.9727f, 0.9727f, 0.9727f, 0.9610f,
+    // 88200 Hz, LF 0.25, HF 0.75, size 0
+    1.1842f, 1.0308f, 1.0308f, 1.0308f, 1.0065f, 1.0065f, 0.9945f, 0.9646f, 0.9341f, 0.9225f, 0.9225f, 0.9123f, 0.8819f, 0.8453f,
+    // 88200 Hz, LF 0.25, HF 0.75, size 0.25
+    1.0000f, 1.0459f, 1.0459f, 1.0292f, 1.0292f, 1.0087f, 1.0087f, 0.9962f, 0.9616f, 0.9514f, 0.9514f, 0.9514f, 0.9267f, 0.8996f,
+    // 88200 Hz, LF 0.25, HF 0.75, size 0.5
+    1.0000f, 1.0648f, 1.0923f, 1.0819f, 1.0476f, 1.0476f, 1.0298f, 1.0066f, 0.9815f, 0.9593f, 0.9593f, 0.9593f, 0.9373f, 0.9173f,
+    // 88200 Hz, LF 0.25, HF 0.75, size 0.75
+    1.0000f, 1.0724f, 1.0552f, 1.0881f, 1.1001f, 1.0790f, 1.0469f, 1.0228f, 0.9877f, 0.9686f, 0.9686f, 0.9686f, 0.9528f, 0.9347f,
+    // 88200 Hz, LF 0.25, HF 0.75, size 1
+    1.0000f, 1.3982f, 1.0612f, 1.0612f, 1.0775f, 1.0775f, 1.0616f, 1.0394f, 1.0032f, 0.9847f, 0.9729f, 0.9729f, 0.9624f, 0.9494f,
+    // 88200 Hz, LF 0.25, HF 0.875, size 0
+    1.1487f, 0.9865f, 1.0359f, 1.0359f, 1.0005f, 1.0005f, 0.9886f, 0.9431f, 0.8921f, 0.8921f, 0.8690f, 0.8394f, 0.7535f, 0.6716f,
+    // 88200 Hz, LF 0.25, HF 0.875, size 0.25
+    1.0000f, 1.0621f, 1.0216f, 1.0216f, 1.0216f, 1.0093f, 1.0093f, 0.9866f, 0.9415f, 0.9115f, 0.9115f, 0.9006f, 0.8504f, 0.7991f,
+    // 88200 Hz, LF 0.25, HF 0.875, size 0.5
+    1.0000f, 1.0500f, 1.1026f, 1.0759f, 1.0500f, 1.0387f, 1.0206f, 1.0019f, 0.9729f, 0.9521f, 0.9282f, 0.9179f, 0.8866f, 0.8495f,
+    // 88200 Hz, LF 0.25, HF 0.875, size 0.75
+    1.0000f, 1.0689f, 1.0689f, 1.0972f, 1.0972f, 1.0734f, 1.0377f, 1.0117f, 0.9809f, 0.9608f, 0.9391f, 0.9391f, 0.9128f, 0.8814f,
+    // 88200 Hz, LF 0.25, HF 0.875, size 1
+    1.0000f, 1.2681f, 1.0546f, 1.0673f, 1.0782f, 1.0782f, 1.0555f, 1.0274f, 0.9931f, 0.9634f, 0.9634f, 0.9533f, 0.9294f, 0.9052f,
+    // 88200 Hz, LF 0.25, HF 1, size 0
+    1.1187f, 0.9745f, 0.9745f, 0.9531f, 0.9170f, 0.8980f, 0.8699f, 0.8126f, 0.6756f, 0.5688f, 0.3856f, 0.1812f, 0.2238f, 0.2985f,
+    // 88200 Hz, LF 0.25, HF 1, size 0.25
+    1.1472f, 1.0600f, 0.9559f, 0.9673f, 0.9673f, 0.9553f, 0.9553f, 0.9021f, 0.8307f, 0.7567f, 0.6303f, 0.5149f, 0.3021f, 0.1705f,
+    // 88200 Hz, LF 0.25, HF 1, size 0.5
+    1.0000f, 1.0281f, 1.0619f, 0.9987f, 0.9859f, 0.9859f, 0.9734f, 0.9394f, 0.8636f, 0.8150f, 0.7364f, 0.6575f, 0.5007f, 0.3359f,
+    // 88200 Hz, LF 0.25, HF 1, size 0.75
+    1.0000f, 1.0025f, 1.0643f, 1.0643f, 1.0209f, 0.9915f, 0.9915f, 0.9556f, 0.9129f, 0.8613f, 0.7993f, 0.7388f, 0.5984f, 0.4798f,
+    // 88200 Hz, LF 0.25, HF 1, size 1
+    1.0000f, 1.0994f, 1.0181f, 1.0864f, 1.0864f, 1.0549f, 1.0170f, 0.9736f, 0.9190f, 0.8845f, 0.8332f, 0.7873f, 0.6849f, 0.5777f,
+    // 88200 Hz, LF 0.5, HF 0, size 0
+    1.1149f, 1.0346f, 1.0080f, 0.9865f, 0.9694f, 0.9536f, 0.9379f, 0.9194f, 0.8984f, 0.8984f, 0.8984f, 0.8984f, 0.8658f, 0.8380f,
+    // 88200 Hz, LF 0.5, HF 0, size 0.25
+    1.0000f, 1.0745f, 1.0435f, 1.0029f, 0.9817f, 0.9630f, 0.9401f, 0.9287f, 0.9138f, 0.9138f, 0.9138f, 0.9138f, 0.8985f, 0.8728f,
+    // 88200 Hz, LF 0.5, HF 0, size 0.5
+    1.0000f, 1.0741f, 1.0525f, 1.0324f, 1.0110f, 0.9946f, 0.9685f, 0.9483f, 0.9275f, 0.9176f, 0.9176f, 0.9036f, 0.9036f, 0.8842f,
+    // 88200 Hz, LF 0.5, HF 0, size 0.75
+    1.0000f, 1.0752f, 1.0625f, 1.0458f, 1.0308f, 1.0099f, 0.9855f, 0.9601f, 0.9329f, 0.9208f, 0.9208f, 0.9208f, 0.9080f, 0.8886f,
+    // 88200 Hz, LF 0.5, HF 0, size 1
+    1.0000f, 1.3055f, 1.0724f, 1.0724f, 1.0427f, 1.0227f, 0.9940f, 0.9687f, 0.9384f, 0.9267f, 0.9267f, 0.9267f, 0.9159f, 0.8989f,
+    // 88200 Hz, LF 0.5, HF 0.25, size 0
+    1.1396f, 1.0558f, 1.0369f, 1.0159f, 1.0038f, 0.9936f, 0.9832f, 0.9603f, 0.9394f, 0.9207f, 0.9207f, 0.9207f, 0.8840f, 0.8505f,
+    // 88200 Hz, LF 0.5, HF 0.25, size 0.25
+    1.0000f, 1.0520f, 1.0646f, 1.0336f, 1.0234f, 1.0095f, 0.9915f, 0.9738f, 0.9480f, 0.9480f, 0.9480f, 0.9480f, 0.9278f, 0.9056f,
+    // 88200 Hz, LF 0.5, HF 0.25, size 0.5
+    1.0000f, 1.0973f, 1.0840f, 1.0840f, 1.0618f, 1.0470f, 1.0209f, 0.9924f, 0.9592f, 0.9476f, 0.9476f, 0.9476f, 0.9346f, 0.9191f,
+    // 88200 Hz, LF 0.5, HF 0.25, size 0.75
+    1.0000f, 1.1187f, 1.0964f, 1.0847f, 1.0847f, 1.0672f, 1.0374f, 1.0066f, 0.9715f, 0.9599f, 0.9599f, 0.9599f, 0.9488f, 0.9300f,
+    // 88200 Hz, LF 0.5, HF 0.25, size 1
+    1.0000f, 1.5349f, 1.0766f, 1.0766f, 1.0766f, 1.0766f, 1.0510f, 1.0199f, 0.9833f, 0.9692f, 0.9692f, 0.9692f, 0.9556f, 0.9410f,
+    // 88200 Hz, LF 0.5, HF 0.5, size 0
+    1.1845f, 1.0504f, 1.0316f, 1.0088f, 0.9919f, 0.9919f, 0.9800f, 0.9567f, 0.9344f, 0.9169f, 0.9058f, 0.9058f, 0.8546f, 0.8080f,
+    // 88200 Hz, LF 0.5, HF 0.5, size 0.25
+    1.0000f, 1.0464f, 1.0639f, 1.0355f, 1.0242f, 1.0069f, 0.9906f, 0.9740f, 0.9480f, 0.9372f, 0.9372f, 0.9372f, 0.9079f, 0.8812f,
+    // 88200 Hz, LF 0.5, HF 0.5, size 0.5
+    1.0000f, 1.0826f, 1.0826f, 1.0826f, 1.0612f, 1.0466f, 1.0218f, 0.9938f, 0.9598f, 0.9430f, 0.9430f, 0.9430f, 0.9224f, 0.9031f,
+    // 88200 Hz, LF 0.5, HF 0.5, size 0.75
+    1.0000f, 1.1100f, 1.0904f, 1.0904f, 1.0904f, 1.0718f, 1.0388f, 1.0096f, 0.9717f, 0.9543f, 0.9543f, 0.9543f, 0.9420f, 0.9214f,
+    // 88200 Hz, LF 0.5, HF 0.5, size 1
+    1.0000f, 1.5005f, 1.0647f, 1.0754f, 1.0754f, 1.0754f, 1.0527f, 1.0254f, 0.9873f, 0.9641f, 0.9641f, 0.9641f, 0.9482f, 0.9301f,
+    // 88200 Hz, LF 0.5, HF 0.625, size 0
+    1.1980f, 1.0385f, 1.0258f, 1.0063f, 0.9875f, 0.9875f, 0.9716f, 0.9459f, 0.9192f, 0.8993f, 0.8871f, 0.8721f, 0.8145f, 0.7527f,
+    // 88200 Hz, LF 0.5, HF 0.625, size 0.25
+    1.0000f, 1.0416f, 1.0583f, 1.0350f, 1.0220f, 1.0021f, 0.9872f, 0.9736f, 0.9425f, 0.9200f, 0.9200f, 0.9200f, 0.8842f, 0.8478f,
+    // 88200 Hz, LF 0.5, HF 0.625, size 0.5
+    1.0000f, 1.0699f, 1.0810f, 1.0810f, 1.0569f, 1.0435f, 1.0200f, 0.9918f, 0.9583f, 0.9361f, 0.9361f, 0.9361f, 0.9052f, 0.8774f,
+    // 88200 Hz, LF 0.5, HF 0.625, size 0.75
+    1.0000f, 1.0913f, 1.0668f, 1.0934f, 1.0934f, 1.0736f, 1.0387f, 1.0098f, 0.9687f, 0.9460f, 0.9460f, 0.9460f, 0.9269f, 0.9039f,
+    // 88200 Hz, LF 0.5, HF 0.625, size 1
+    1.0000f, 1.4631f, 1.0630f, 1.0630f, 1.0733f, 1.0733f, 1.0535f, 1.0280f, 0.9881f, 0.9696f, 0.9549f, 0.9549f, 0.9368f, 0.9156f,
+    // 88200 Hz, LF 0.5, HF 0.75, size 0
+    1.1794f, 1.0173f, 1.0173f, 1.0064f, 0.9785f, 0.9785f, 0.9575f, 0.9231f, 0.8859f, 0.8657f, 0.8358f, 0.8000f, 0.7077f, 0.6078f,
+    // 88200 Hz, LF 0.5, HF 0.75, size 0.25
+    1.0000f, 1.0425f, 1.0425f, 1.0269f, 1.0138f, 0.9947f, 0.9824f, 0.9704f, 0.9265f, 0.9068f, 0.8960f, 0.8745f, 0.8251f, 0.7676f,
+    // 88200 Hz, LF 0.5, HF 0.75, size 0.5
+    1.0000f, 1.0591f, 1.0794f, 1.0794f, 1.0499f, 1.0358f, 1.0117f, 0.9842f, 0.9522f, 0.9346f, 0.9233f, 0.9065f, 0.8573f, 0.8102f,
+    // 88200 Hz, LF 0.5, HF 0.75, size 0.75
+    1.0000f, 1.0673f, 1.0466f, 1.0819f, 1.0968f, 1.0742f, 1.0348f, 1.0059f, 0.9618f, 0.9375f, 0.9375f, 0.9242f, 0.8905f, 0.8580f,
+    // 88200 Hz, LF 0.5, HF 0.75, size 1
+    1.0000f, 1.3918f, 1.0500f, 1.0500f, 1.0704f, 1.0704f, 1.0531f, 1.0278f, 0.9851f, 0.9628f, 0.9469f, 0.9328f, 0.9071f, 0.8788f,
+    // 88200 Hz, LF 0.5, HF 0.875, size 0
+    1.1429f, 0.9657f, 0.9996f, 0.9996f, 0.9668f, 0.9516f, 0.9214f, 0.8569f, 0.7876f, 0.7398f, 0.6503f, 0.5546f, 0.3629f, 0.2985f,
+    // 88200 Hz, LF 0.5, HF 0.875, size 0.25
+    1.0000f, 1.0493f, 1.0036f, 1.0036f, 0.9920f, 0.9778f, 0.9677f, 0.9335f, 0.8688f, 0.8258f, 0.7961f, 0.7497f, 0.6259f, 0.5067f,
+    // 88200 Hz, LF 0.5, HF 0.875, size 0.5
+    1.0000f, 1.0419f, 1.0952f, 1.0708f, 1.0381f, 1.0168f, 0.9869f, 0.9604f, 0.9236f, 0.8903f, 0.8484f, 0.8042f, 0.7132f, 0.6286f,
+    // 88200 Hz, LF 0.5, HF 0.875, size 0.75
+    1.0000f, 1.0543f, 1.0543f, 1.0815f, 1.0932f, 1.0776f, 1.0146f, 0.9806f, 0.9355f, 0.9091f, 0.8805f, 0.8493f, 0.7817f, 0.7089f,
+    // 88200 Hz, LF 0.5, HF 0.875, size 1
+    1.0000f, 1.2636f, 1.0485f, 1.0485f, 1.0653f, 1.0653f, 1.0399f, 1.0044f, 0.9581f, 0.9297f, 0.9018f, 0.8748f, 0.8186f, 0.7580f,
+    // 88200 Hz, LF 0.5, HF 1, size 0
+    1.1171f, 0.8879f, 0.8735f, 0.8243f, 0.7624f, 0.7148f, 0.6320f, 0.4848f, 0.1615f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 88200 Hz, LF 0.5, HF 1, size 0.25
+    1.1216f, 1.0243f, 0.8750f, 0.8750f, 0.8610f, 0.8299f, 0.7703f, 0.6752f, 0.4984f, 0.3373f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 88200 Hz, LF 0.5, HF 1, size 0.5
+    1.0000f, 0.9906f, 1.0354f, 0.9624f, 0.9310f, 0.9079f, 0.8513f, 0.7819f, 0.6530f, 0.5375f, 0.2995f, 0.0895f, 0.0895f, 0.1194f,
+    // 88200 Hz, LF 0.5, HF 1, size 0.75
+    1.0000f, 0.9708f, 1.0449f, 1.0449f, 0.9926f, 0.9404f, 0.9157f, 0.8336f, 0.7358f, 0.6386f, 0.4620f, 0.2907f, 0.0689f, 0.0918f,
+    // 88200 Hz, LF 0.5, HF 1, size 1
+    1.0000f, 1.0795f, 0.9885f, 1.0478f, 1.0478f, 1.0163f, 0.9664f, 0.8656f, 0.7810f, 0.6919f, 0.5609f, 0.4187f, 0.1524f, 0.0746f,
+    // 88200 Hz, LF 0.75, HF 0, size 0
+    1.1133f, 1.0338f, 1.0049f, 0.9820f, 0.9645f, 0.9477f, 0.9295f, 0.9089f, 0.8936f, 0.8697f, 0.8697f, 0.8697f, 0.8231f, 0.7830f,
+    // 88200 Hz, LF 0.75, HF 0, size 0.25
+    1.0000f, 1.0732f, 1.0425f, 1.0007f, 0.9784f, 0.9588f, 0.9344f, 0.9216f, 0.9071f, 0.8959f, 0.8959f, 0.8959f, 0.8708f, 0.8444f,
+    // 88200 Hz, LF 0.75, HF 0, size 0.5
+    1.0000f, 1.0727f, 1.0505f, 1.0304f, 1.0086f, 0.9920f, 0.9653f, 0.9437f, 0.9216f, 0.9098f, 0.8995f, 0.8995f, 0.8835f, 0.8674f,
+    // 88200 Hz, LF 0.75, HF 0, size 0.75
+    1.0000f, 1.0748f, 1.0612f, 1.0439f, 1.0287f, 1.0075f, 0.9827f, 0.9568f, 0.9284f, 0.9098f, 0.9098f, 0.9098f, 0.8936f, 0.8681f,
+    // 88200 Hz, LF 0.75, HF 0, size 1
+    1.0000f, 1.3058f, 1.0709f, 1.0709f, 1.0406f, 1.0203f, 0.9913f, 0.9656f, 0.9341f, 0.9177f, 0.9177f, 0.9177f, 0.9029f, 0.8809f,
+    // 88200 Hz, LF 0.75, HF 0.25, size 0
+    1.1346f, 1.0535f, 1.0315f, 1.0074f, 0.9945f, 0.9834f, 0.9724f, 0.9487f, 0.9201f, 0.8979f, 0.8979f, 0.8831f, 0.8187f, 0.7583f,
+    // 88200 Hz, LF 0.75, HF 0.25, size 0.25
+    1.0000f, 1.0474f, 1.0627f, 1.0293f, 1.0176f, 1.0023f, 0.9816f, 0.9624f, 0.9365f, 0.9207f, 0.9207f, 0.9207f, 0.8909f, 0.8559f,
+    // 88200 Hz, LF 0.75, HF 0.25, size 0.5
+    1.0000f, 1.0952f, 1.0801f, 1.0801f, 1.0574f, 1.0424f, 1.0154f, 0.9845f, 0.9474f, 0.9261f, 0.9261f, 0.9261f, 0.9069f, 0.8806f,
+    // 88200 Hz, LF 0.75, HF 0.25, size 0.75
+    1.0000f, 1.1178f, 1.0932f, 1.0801f, 1.0801f, 1.0627f, 1.0326f, 1.0004f, 0.9624f, 0.9421f, 0.9421f, 0.9421f, 0.9218f, 0.8976f,
+    // 88200 Hz, LF 0.75, HF 0.25, size 1
+    1.0000f, 1.5365f, 1.0717f, 1.0717f, 1.0717f, 1.0717f, 1.0457f, 1.0145f, 0.9753f, 0.9545f, 0.9545f, 0.9545f, 0.9339f, 0.9142f,
+    // 88200 Hz, LF 0.75, HF 0.5, size 0
+    1.1779f, 1.0467f, 1.0233f, 0.9947f, 0.9751f, 0.9751f, 0.9629f, 0.9384f, 0.9051f, 0.8812f, 0.8622f, 0.8370f, 0.7596f, 0.6918f,
+    // 88200 Hz, LF 0.75, HF 0.5, size 0.25
+    1.0000f, 1.0397f, 1.0615f, 1.0294f, 1.0159f, 0.9964f, 0.9766f, 0.9575f, 0.9286f, 0.9142f, 0.8981f, 0.8981f, 0.8522f, 0.8047f,
+    // 88200 Hz, LF 0.75, HF 0.5, size 0.5
+    1.0000f, 1.0770f, 1.0770f, 1.0770f, 1.0548f, 1.0398f, 1.0136f, 0.9824f, 0.9427f, 0.9249f, 0.9249f, 0.9079f, 0.8795f, 0.8452f,
+    // 88200 Hz, LF 0.75, HF 0.5, size 0.75
+    1.0000f, 1.1081f, 1.0841f, 1.0841f, 1.0841f, 1.0656f, 1.0318f, 1.0008f, 0.9589f, 0.9430f, 0.9282f, 0.9282f, 0.9057f, 0.8740f,
+    // 88200 Hz, LF 0.75, HF 0.5, size 1
+    1.0000f, 1.5056f, 1.0684f, 1.0684f, 1.0684f, 1.0684f, 1.0453f, 1.0181f, 0.9774f, 0.9557f, 0.9434f, 0.9434f, 0.9184f, 0.8916f,
+    // 88200 Hz, LF 0.75, HF 0.625, size 0
+    1.1909f, 1.0341f, 1.0148f, 0.9872f, 0.9744f, 0.9644f, 0.9467f, 0.9198f, 0.8786f, 0.8447f, 0.8146f, 0.7822f, 0.6707f, 0.5743f,
+    // 88200 Hz, LF 0.75, HF 0.625, size 0.25
+    1.0000f, 1.0332f, 1.0552f, 1.0273f, 1.0108f, 0.9876f, 0.9684f, 0.9520f, 0.9158f, 0.8965f, 0.8831f, 0.8633f, 0.7989f, 0.7316f,
+    // 88200 Hz, LF 0.75, HF 0.625, size 0.5
+    1.0000f, 1.0739f, 1.0739f, 1.0739f, 1.0483f, 1.0341f, 1.0085f, 0.9760f, 0.9341f, 0.9097f, 0.9097f, 0.8882f, 0.8430f, 0.8072f,
+    // 88200 Hz, LF 0.75, HF 0.625, size 0.75
+    1.0000f, 1.0989f, 1.0600f, 1.0857f, 1.0857f, 1.0657f, 1.0293f, 0.9981f, 0.9508f, 0.9239f, 0.9239f, 0.9096f, 0.8800f, 0.8400f,
+    // 88200 Hz, LF 0.75, HF 0.625, size 1
+    1.0000f, 1.4637f, 1.0538f, 1.0538f, 1.0640f, 1.0640f, 1.0439f, 1.0187f, 0.9747f, 0.9514f, 0.9272f, 0.9272f, 0.8955f, 0.8603f,
+    // 88200 Hz, LF 0.75, HF 0.75, size 0
+    1.1695f, 0.9997f, 0.9997f, 0.9771f, 0.9556f, 0.9422f, 0.9161f, 0.8789f, 0.8228f, 0.7795f, 0.7141f, 0.6322f, 0.4701f, 0.2985f,
+    // 88200 Hz, LF 0.75, HF 0.75, size 0.25
+    1.0000f, 1.0274f, 1.0377f, 1.0156f, 0.9964f, 0.9721f, 0.9540f, 0.9408f, 0.8859f, 0.8565f, 0.8201f, 0.7793f, 0.6778f, 0.5798f,
+    // 88200 Hz, LF 0.75, HF 0.75, size 0.5
+    1.0000f, 1.0525f, 1.0691f, 1.0691f, 1.0367f, 1.0212f, 0.9933f, 0.9591f, 0.9144f, 0.8888f, 0.8686f, 0.8365f, 0.7582f, 0.6886f,
+    // 88200 Hz, LF 0.75, HF 0.75, size 0.75
+    1.0000f, 1.0629f, 1.0357f, 1.0694f, 1.0862f, 1.0629f, 1.0204f, 0.9882f, 0.9338f, 0.9075f, 0.8899f, 0.8669f, 0.8112f, 0.7482f,
+    // 88200 Hz, LF 0.75, HF 0.75, size 1
+    1.0000f, 1.3915f, 1.0347f, 1.0347f, 1.0459f, 1.0568f, 1.0392f, 1.0147f, 0.9654f, 0.9365f, 0.9101f, 0.8862f, 0.8397f, 0.7865f,
+    // 88200 Hz, LF 0.75, HF 0.875, size 0
+    1.1257f, 0.9474f, 0.9622f, 0.9437f, 0.9013f, 0.8755f, 0.8314f, 0.7566f, 0.6448f, 0.5384f, 0.3545f, 0.1601f, 0.2238f, 0.2985f,
+    // 88200 Hz, LF 0.75, HF 0.875, size 0.25
+    1.0000f, 1.0307f, 0.9948f, 0.9803f, 0.9556f, 0.9365f, 0.9187f, 0.8715f, 0.7802f, 0.7168f, 0.6191f, 0.5179f, 0.2961f, 0.1705f,
+    // 88200 Hz, LF 0.75, HF 0.875, size 0.5
+    1.0000f, 1.0298f, 1.0760f, 1.0548f, 1.0151f, 0.9872f, 0.9495f, 0.9109f, 0.8515f, 0.8051f, 0.7342f, 0.6473f, 0.4748f, 0.3096f,
+    // 88200 Hz, LF 0.75, HF 0.875, size 0.75
+    1.0000f, 1.0336f, 1.0336f, 1.0606f, 1.0757f, 1.0594f, 0.9848f, 0.9437f, 0.8811f, 0.8431f, 0.7919f, 0.7245f, 0.5915f, 0.4676f,
+    // 88200 Hz, LF 0.75, HF 0.875, size 1
+    1.0000f, 1.2616f, 1.0220f, 1.0220f, 1.0412f, 1.0412f, 1.0138f, 0.9775f, 0.9165f, 0.8768f, 0.8207f, 0.7688f, 0.6637f, 0.5579f,
+    // 88200 Hz, LF 0.75, HF 1, size 0
+    1.0692f, 0.7608f, 0.7014f, 0.6142f, 0.5140f, 0.4056f, 0.2492f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 88200 Hz, LF 0.75, HF 1, size 0.25
+    1.0940f, 0.9616f, 0.8190f, 0.7634f, 0.7015f, 0.6345f, 0.5350f, 0.3767f, 0.0635f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 88200 Hz, LF 0.75, HF 1, size 0.5
+    1.0000f, 0.9362f, 0.9784f, 0.8868f, 0.8368f, 0.7833f, 0.6932f, 0.5754f, 0.3545f, 0.1270f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 88200 Hz, LF 0.75, HF 1, size 0.75
+    1.0000f, 0.9446f, 0.9869f, 0.9869f, 0.9210f, 0.8706f, 0.7816f, 0.6685f, 0.4922f, 0.3048f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 88200 Hz, LF 0.75, HF 1, size 1
+    1.0000f, 1.0628f, 0.9480f, 0.9903f, 0.9768f, 0.9488f, 0.8808f, 0.7343f, 0.5754f, 0.4295f, 0.1852f, 0.0373f, 0.0560f, 0.0746f,
+    // 88200 Hz, LF 1, HF 0, size 0
+    1.1117f, 1.0331f, 1.0019f, 0.9782f, 0.9602f, 0.9420f, 0.9211f, 0.8975f, 0.8805f, 0.8632f, 0.8532f, 0.8392f, 0.7795f, 0.7266f,
+    // 88200 Hz, LF 1, HF 0, size 0.25
+    1.0000f, 1.0718f, 1.0409f, 0.9982f, 0.9753f, 0.9548f, 0.9291f, 0.9151f, 0.8902f, 0.8902f, 0.8762f, 0.8762f, 0.8412f, 0.8058f,
+    // 88200 Hz, LF 1, HF 0, size 0.5
+    1.0000f, 1.0713f, 1.0481f, 1.0279f, 1.0061f, 0.9892f, 0.9621f, 0.9392f, 0.9156f, 0.9031f, 0.8867f, 0.8867f, 0.8637f, 0.8409f,
+    // 88200 Hz, LF 1, HF 0, size 0.75
+    1.0000f, 1.0745f, 1.0600f, 1.0418f, 1.0260f, 1.0046f, 0.9799f, 0.9529f, 0.9132f, 0.9132f, 0.8984f, 0.8984f, 0.8793f, 0.8479f,
+    // 88200 Hz, LF 1, HF 0, size 1
+    1.0000f, 1.3060f, 1.0696f, 1.0696f, 1.0385f, 1.0176f, 0.9885f, 0.9622f, 0.9292f, 0.9086f, 0.9086f, 0.9086f, 0.8902f, 0.8630f,
+    // 88200 Hz, LF 1, HF 0.25, size 0
+    1.1295f, 1.0513f, 1.0259f, 1.0003f, 0.9864f, 0.9744f, 0.9612f, 0.9345f, 0.8983f, 0.8740f, 0.8571f, 0.8379f, 0.7562f, 0.6757f,
+    // 88200 Hz, LF 1, HF 0.25, size 0.25
+    1.0000f, 1.0427f, 1.0595f, 1.0239f, 1.0118f, 0.9955f, 0.9718f, 0.9493f, 0.9214f, 0.9066f, 0.8883f, 0.8883f, 0.8490f, 0.7988f,
+    // 88200 Hz, LF 1, HF 0.25, size 0.5
+    1.0000f, 1.0926f, 1.0749f, 1.0749f, 1.0523f, 1.0373f, 1.0101f, 0.9766f, 0.9363f, 0.9162f, 0.9162f, 0.9025f, 0.8754f, 0.8356f,
+    // 88200 Hz, LF 1, HF 0.25, size 0.75
+    1.0000f, 1.1168f, 1.0899f, 1.0742f, 1.0742f, 1.0568f, 1.0276f, 0.9938f, 0.9540f, 0.9386f, 0.9223f, 0.9223f, 0.8929f, 0.8604f,
+    // 88200 Hz, LF 1, HF 0.25, size 1
+    1.0000f, 1.5384f, 1.0660f, 1.0660f, 1.0660f, 1.0660f, 1.0397f, 1.0076f, 0.9657f, 0.9376f, 0.9376f, 0.9376f, 0.9093f, 0.8820f,
+    // 88200 Hz, LF 1, HF 0.5, size 0
+    1.1709f, 1.0437f, 1.0147f, 0.9828f, 0.9720f, 0.9597f, 0.9451f, 0.9163f, 0.8716f, 0.8398f, 0.8050f, 0.7571f, 0.6338f, 0.5241f,
+    // 88200 Hz, LF 1, HF 0.5, size 0.25
+    1.0000f, 1.0328f, 1.0571f, 1.0215f, 1.0074f, 0.9860f, 0.9617f, 0.9372f, 0.9062f, 0.8877f, 0.8691f, 0.8489f, 0.7803f, 0.7064f,
+    // 88200 Hz, LF 1, HF 0.5, size 0.5
+    1.0000f, 1.0694f, 1.0694f, 1.0694f, 1.0472f, 1.0321f, 1.0053f, 0.9703f, 0.9246f, 0.8933f, 0.8933f, 0.8706f, 0.8290f, 0.7732f,
+    // 88200 Hz, LF 1, HF 0.5, size 0.75
+    1.0000f, 1.1158f, 1.0756f, 1.0756f, 1.0756f, 1.0572f, 1.0242f, 0.9910f, 0.9458f, 0.9274f, 0.9142f, 0.8973f, 0.8599f, 0.8149f,
+    // 88200 Hz, LF 1, HF 0.5, size 1
+    1.0000f, 1.5081f, 1.0601f, 1.0601f, 1.0601f, 1.0601f, 1.0367f, 1.0087f, 0.9645f, 0.9392f, 0.9287f, 0.9173f, 0.8820f, 0.8440f,
+    // 88200 Hz, LF 1, HF 0.625, size 0
+    1.1828f, 1.0300f, 1.0029f, 0.9688f, 0.9555f, 0.9417f, 0.9197f, 0.8863f, 0.8299f, 0.7813f, 0.7181f, 0.6591f, 0.4968f, 0.3359f,
+    // 88200 Hz, LF 1, HF 0.625, size 0.25
+    1.0000f, 1.0243f, 1.0495f, 1.0171f, 0.9993f, 0.9729f, 0.9479f, 0.9239f, 0.8844f, 0.8592f, 0.8301f, 0.7936f, 0.6959f, 0.6009f,
+    // 88200 Hz, LF 1, HF 0.625, size 0.5
+    1.0000f, 1.0636f, 1.0636f, 1.0636f, 1.0376f, 1.0235f, 0.9966f, 0.9589f, 0.9091f, 0.8831f, 0.8657f, 0.8324f, 0.7674f, 0.7046f,
+    // 88200 Hz, LF 1, HF 0.625, size 0.75
+    1.0000f, 1.0986f, 1.0539f, 1.0747f, 1.0747f, 1.0548f, 1.0192f, 0.9850f, 0.9326f, 0.9105f, 0.8908f, 0.8659f, 0.8167f, 0.7555f,
+    // 88200 Hz, LF 1, HF 0.625, size 1
+    1.0000f, 1.4682f, 1.0530f, 1.0530f, 1.0530f, 1.0530f, 1.0325f, 1.0067f, 0.9578f, 0.9292f, 0.9081f, 0.8925f, 0.8459f, 0.7947f,
+    // 88200 Hz, LF 1, HF 0.75, size 0
+    1.1588f, 0.9992f, 0.9807f, 0.9473f, 0.9247f, 0.9049f, 0.8692f, 0.8227f, 0.7371f, 0.6559f, 0.5386f, 0.4269f, 0.2238f, 0.2985f,
+    // 88200 Hz, LF 1, HF 0.75, size 0.25
+    1.0000f, 1.0142f, 1.0288f, 1.0000f, 0.9778f, 0.9477f, 0.9213f, 0.9006f, 0.8355f, 0.7936f, 0.7296f, 0.6615f, 0.4949f, 0.3225f,
+    // 88200 Hz, LF 1, HF 0.75, size 0.5
+    1.0000f, 1.0443f, 1.0544f, 1.0544f, 1.0198f, 1.0040f, 0.9730f, 0.9296f, 0.8711f, 0.8341f, 0.7966f, 0.7444f, 0.6323f, 0.5249f,
+    // 88200 Hz, LF 1, HF 0.75, size 0.75
+    1.0000f, 1.0692f, 1.0248f, 1.0543f, 1.0708f, 1.0468f, 1.0048f, 0.9673f, 0.9032f, 0.8687f, 0.8343f, 0.7944f, 0.7094f, 0.6120f,
+    // 88200 Hz, LF 1, HF 0.75, size 1
+    1.0000f, 1.3920f, 1.0295f, 1.0295f, 1.0295f, 1.0401f, 1.0225f, 0.9975f, 0.9403f, 0.9028f, 0.8635f, 0.8303f, 0.7547f, 0.6749f,
+    // 88200 Hz, LF 1, HF 0.875, size 0
+    1.1024f, 0.9198f, 0.9198f, 0.8807f, 0.8321f, 0.7941f, 0.7314f, 0.6324f, 0.4520f, 0.2884f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 88200 Hz, LF 1, HF 0.875, size 0.25
+    1.0000f, 1.0078f, 0.9736f, 0.9469f, 0.9144f, 0.8894f, 0.8549f, 0.7920f, 0.6680f, 0.5659f, 0.3924f, 0.2130f, 0.1279f, 0.1705f,
+    // 88200 Hz, LF 1, HF 0.875, size 0.5
+    1.0000f, 1.0137f, 1.0494f, 1.0306f, 0.9843f, 0.9516f, 0.9044f, 0.8481f, 0.7634f, 0.6937f, 0.5678f, 0.4401f, 0.1586f, 0.1194f,
+    // 88200 Hz, LF 1, HF 0.875, size 0.75
+    1.0000f, 1.0279f, 1.0008f, 1.0335f, 1.0483f, 1.0278f, 0.9524f, 0.9104f, 0.8174f, 0.7565f, 0.6680f, 0.5677f, 0.3595f, 0.1508f,
+    // 88200 Hz, LF 1, HF 0.875, size 1
+    1.0000f, 1.2709f, 1.0144f, 0.9956f, 1.0088f, 1.0088f, 0.9808f, 0.9435f, 0.8659f, 0.8088f, 0.7215f, 0.6377f, 0.4678f, 0.2975f,
+    // 88200 Hz, LF 1, HF 1, size 0
+    0.9937f, 0.6199f, 0.5019f, 0.3875f, 0.1912f, 0.0280f, 0.0280f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 88200 Hz, LF 1, HF 1, size 0.25
+    1.0866f, 0.8810f, 0.7406f, 0.6366f, 0.5321f, 0.4146f, 0.2613f, 0.0213f, 0.0320f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 88200 Hz, LF 1, HF 1, size 0.5
+    1.0000f, 0.8887f, 0.8994f, 0.7908f, 0.7001f, 0.6167f, 0.5041f, 0.3270f, 0.0224f, 0.0298f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 88200 Hz, LF 1, HF 1, size 0.75
+    1.0000f, 0.9059f, 0.9171f, 0.8953f, 0.8437f, 0.7795f, 0.6325f, 0.4770f, 0.1897f, 0.0230f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 88200 Hz, LF 1, HF 1, size 1
+    1.0000f, 1.0420f, 0.8980f, 0.9185f, 0.8839f, 0.8517f, 0.7613f, 0.5893f, 0.3509f, 0.1206f, 0.0280f, 0.0373f, 0.0560f, 0.0746f,
+    // 96000 Hz, LF 0, HF 0, size 0
+    1.0000f, 1.0000f, 1.1458f, 1.0186f, 0.9866f, 0.9742f, 0.9639f, 0.9493f, 0.9363f, 0.9363f, 0.9497f, 0.9497f, 0.9497f, 0.9497f,
+    // 96000 Hz, LF 0, HF 0, size 0.25
+    1.0000f, 1.0000f, 1.2446f, 1.0526f, 1.0044f, 0.9801f, 0.9578f, 0.9437f, 0.9322f, 0.9322f, 0.9470f, 0.9470f, 0.9470f, 0.9470f,
+    // 96000 Hz, LF 0, HF 0, size 0.5
+    1.0000f, 1.0000f, 1.2924f, 1.0702f, 1.0329f, 1.0074f, 0.9811f, 0.9587f, 0.9426f, 0.9426f, 0.9426f, 0.9426f, 0.9426f, 0.9426f,
+    // 96000 Hz, LF 0, HF 0, size 0.75
+    1.0000f, 1.0000f, 1.2107f, 1.1304f, 1.0551f, 1.0250f, 0.9964f, 0.9699f, 0.9493f, 0.9493f, 0.9493f, 0.9380f, 0.9380f, 0.9380f,
+    // 96000 Hz, LF 0, HF 0, size 1
+    1.0000f, 1.0000f, 1.2862f, 1.1539f, 1.0864f, 1.0382f, 1.0060f, 0.9777f, 0.9403f, 0.9403f, 0.9403f, 0.9403f, 0.9403f, 0.9403f,
+    // 96000 Hz, LF 0, HF 0.25, size 0
+    1.0000f, 1.0640f, 1.5960f, 1.1014f, 1.0401f, 1.0186f, 1.0186f, 1.0032f, 0.9861f, 0.9861f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.25, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.1861f, 1.0700f, 1.0391f, 1.0146f, 0.9988f, 0.9827f, 0.9827f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.25, size 0.5
+    1.0000f, 1.0000f, 1.0342f, 1.3789f, 1.1182f, 1.0765f, 1.0415f, 1.0135f, 0.9862f, 0.9862f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.25, size 0.75
+    1.0000f, 1.0000f, 1.1403f, 1.5204f, 1.1827f, 1.1093f, 1.0612f, 1.0291f, 0.9975f, 0.9863f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.25, size 1
+    1.0000f, 1.0000f, 1.1022f, 1.4697f, 1.2310f, 1.1270f, 1.0737f, 1.0408f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.5, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1270f, 1.0515f, 1.0286f, 1.0286f, 1.0128f, 0.9952f, 0.9952f, 1.0120f, 1.0120f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.5, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.2619f, 1.0975f, 1.0496f, 1.0232f, 1.0071f, 0.9945f, 0.9945f, 1.0121f, 1.0121f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.5, size 0.5
+    1.0000f, 1.0000f, 1.1860f, 1.5814f, 1.1539f, 1.0881f, 1.0509f, 1.0221f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.5, size 0.75
+    1.0000f, 1.0000f, 1.3199f, 1.7599f, 1.2399f, 1.1273f, 1.0700f, 1.0378f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.5, size 1
+    1.0000f, 1.0000f, 1.3043f, 1.7391f, 1.3257f, 1.1456f, 1.0821f, 1.0494f, 1.0100f, 1.0100f, 1.0100f, 1.0100f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.625, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1590f, 1.0581f, 1.0332f, 1.0332f, 1.0189f, 1.0032f, 1.0032f, 1.0155f, 1.0155f, 1.0155f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.625, size 0.25
+    1.0000f, 1.0000f, 1.0078f, 1.3437f, 1.1127f, 1.0572f, 1.0303f, 1.0135f, 1.0018f, 1.0018f, 1.0127f, 1.0127f, 1.0127f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.625, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1765f, 1.0964f, 1.0569f, 1.0270f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.625, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0431f, 1.3039f, 1.1421f, 1.0766f, 1.0447f, 1.0128f, 0.9999f, 1.0115f, 1.0115f, 1.0000f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.625, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.1435f, 1.4294f, 1.1627f, 1.0903f, 1.0548f, 1.0117f, 1.0117f, 1.0117f, 1.0117f, 1.0117f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.75, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.1995f, 1.0733f, 1.0508f, 1.0405f, 1.0277f, 1.0150f, 1.0150f, 1.0150f, 1.0150f, 1.0150f, 1.0150f,
+    // 96000 Hz, LF 0, HF 0.75, size 0.25
+    1.0000f, 1.0000f, 1.1000f, 1.4667f, 1.1338f, 1.0690f, 1.0412f, 1.0235f, 1.0130f, 1.0130f, 1.0130f, 1.0130f, 1.0130f, 1.0130f,
+    // 96000 Hz, LF 0, HF 0.75, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2398f, 1.1180f, 1.0624f, 1.0339f, 1.0120f, 1.0120f, 1.0120f, 1.0120f, 1.0120f, 1.0000f,
+    // 96000 Hz, LF 0, HF 0.75, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.1633f, 1.4541f, 1.1755f, 1.0857f, 1.0517f, 1.0203f, 1.0102f, 1.0102f, 1.0102f, 1.0102f, 1.0102f,
+    // 96000 Hz, LF 0, HF 0.75, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.2827f, 1.6034f, 1.2092f, 1.1050f, 1.0652f, 1.0295f, 1.0126f, 1.0126f, 1.0126f, 1.0126f, 1.0126f,
+    // 96000 Hz, LF 0, HF 0.875, size 0
+    1.0000f, 1.0000f, 1.0000f, 1.2982f, 1.1028f, 1.0692f, 1.0539f, 1.0416f, 1.0252f, 1.0252f, 1.0252f, 1.0252f, 1.0252f, 1.0252f,
+    // 96000 Hz, LF 0, HF 0.875, size 0.25
+    1.0000f, 1.0000f, 1.2341f, 1.6454f, 1.1815f, 1.0886f, 1.0544f, 1.0299f, 1.0299f, 1.0178f, 1.0178f, 1.0178f, 1.0178f, 1.0178f,
+    // 96000 Hz, LF 0, HF 0.875, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.1021f, 1.3777f, 1.1447f, 1.0722f, 1.0452f, 1.0252f, 1.0252f, 1.0127f, 1.0127f, 1.0127f, 1.0127f,
+    // 96000 Hz, LF 0, HF 0.875, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0318f, 1.2382f, 1.1078f, 1.0556f, 1.0176f, 1.0176f, 1.0176f, 1.0176f, 1.0176f, 1.0176f,
+    // 96000 Hz, LF 0, HF 0.875, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.1471f, 1.3765f, 1.1399f, 1.0699f, 1.0347f, 1.0185f, 1.0185f, 1.0185f, 1.0185f, 1.0185f,
+    // 96000 Hz, LF 0, HF 1, size 0
+    1.0000f, 1.0000f, 1.1051f, 1.4735f, 1.1691f, 1.0934f, 1.0746f, 1.0746f, 1.0545f, 1.0438f, 1.0438f, 1.0438f, 1.0438f, 1.0438f,
+    // 96000 Hz, LF 0, HF 1, size 0.25
+    1.0000f, 1.0000f, 1.0000f, 1.0566f, 1.3208f, 1.1457f, 1.0736f, 1.0503f, 1.0503f, 1.0503f, 1.0261f, 1.0261f, 1.0261f, 1.0261f,
+    // 96000 Hz, LF 0, HF 1, size 0.5
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0947f, 1.3136f, 1.1132f, 1.0596f, 1.0317f, 1.0460f, 1.0229f, 1.0229f, 1.0229f, 1.0229f,
+    // 96000 Hz, LF 0, HF 1, size 0.75
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2491f, 1.4989f, 1.1569f, 1.0776f, 1.0418f, 1.0271f, 1.0271f, 1.0271f, 1.0271f, 1.0271f,
+    // 96000 Hz, LF 0, HF 1, size 1
+    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.2321f, 1.0994f, 1.0440f, 1.0277f, 1.0277f, 1.0277f, 1.0277f, 1.0277f,
+    // 96000 Hz, LF 0.25, HF 0, size 0
+    1.3168f, 1.0342f, 1.0064f, 0.9874f, 0.9611f, 0.9611f, 0.9495f, 0.9343f, 0.9111f, 0.9111f, 0.9244f, 0.9244f, 0.9093f, 0.8865f,
+    // 96000 Hz, LF 0.25, HF 0, size 0.25
+    1.4784f, 1.0703f, 1.0327f, 1.0056f, 0.9875f, 0.9686f, 0.9485f, 0.9339f, 0.9234f, 0.9234f, 0.9234f, 0.9234f, 0.9234f, 0.9100f,
+    // 96000 Hz, LF 0.25, HF 0, size 0.5
+    1.0000f, 1.0512f, 1.0512f, 1.0254f, 1.0111f, 0.9963f, 0.9732f, 0.9502f, 0.9241f, 0.9241f, 0.9241f, 0.9241f, 0.9241f, 0.9113f,
+    // 96000 Hz, LF 0.25, HF 0, size 0.75
+    1.0000f, 1.0478f, 1.0478f, 1.0478f, 1.0318f, 1.0126f, 0.9880f, 0.9623f, 0.9365f, 0.9365f, 0.9365f, 0.9248f, 0.9248f, 0.9112f,
+    // 96000 Hz, LF 0.25, HF 0, size 1
+    1.0000f, 1.0000f, 1.0715f, 1.0715f, 1.0416f, 1.0238f, 0.9976f, 0.9717f, 0.9390f, 0.9390f, 0.9390f, 0.9285f, 0.9285f, 0.9169f,
+    // 96000 Hz, LF 0.25, HF 0.25, size 0
+    1.0000f, 1.0431f, 1.0431f, 1.0259f, 1.0110f, 0.9993f, 0.9993f, 0.9819f, 0.9612f, 0.9612f, 0.9612f, 0.9612f, 0.9381f, 0.9182f,
+    // 96000 Hz, LF 0.25, HF 0.25, size 0.25
+    1.3059f, 1.0825f, 1.0686f, 1.0466f, 1.0324f, 1.0167f, 0.9990f, 0.9839f, 0.9567f, 0.9567f, 0.9800f, 0.9800f, 0.9613f, 0.9480f,
+    // 96000 Hz, LF 0.25, HF 0.25, size 0.5
+    1.0000f, 1.0610f, 1.0729f, 1.0729f, 1.0519f, 1.0519f, 1.0274f, 0.9998f, 0.9657f, 0.9657f, 0.9657f, 0.9657f, 0.9657f, 0.9548f,
+    // 96000 Hz, LF 0.25, HF 0.25, size 0.75
+    1.0000f, 1.1122f, 1.0812f, 1.0812f, 1.0812f, 1.0679f, 1.0447f, 1.0154f, 0.9777f, 0.9777f, 0.9777f, 0.9777f, 0.9611f, 0.9611f,
+    // 96000 Hz, LF 0.25, HF 0.25, size 1
+    1.0000f, 1.4952f, 1.0735f, 1.0735f, 1.0735f, 1.0735f, 1.0543f, 1.0305f, 0.9943f, 0.9838f, 0.9838f, 0.9838f, 0.9680f, 0.9680f,
+    // 96000 Hz, LF 0.25, HF 0.5, size 0
+    1.0000f, 1.0413f, 1.0413f, 1.0257f, 1.0032f, 1.0032f, 1.0032f, 0.9852f, 0.9644f, 0.9538f, 0.9538f, 0.9538f, 0.9327f, 0.9132f,
+    // 96000 Hz, LF 0.25, HF 0.5, size 0.25
+    1.2938f, 1.0711f, 1.0711f, 1.0485f, 1.0365f, 1.0193f, 1.0019f, 0.9886f, 0.9602f, 0.9602f, 0.9813f, 0.9813f, 0.9638f, 0.9481f,
+    // 96000 Hz, LF 0.25, HF 0.5, size 0.5
+    1.0000f, 1.0528f, 1.0765f, 1.0765f, 1.0541f, 1.0541f, 1.0319f, 1.0042f, 0.9743f, 0.9743f, 0.9743f, 0.9743f, 0.9635f, 0.9535f,
+    // 96000 Hz, LF 0.25, HF 0.5, size 0.75
+    1.0000f, 1.1048f, 1.0842f, 1.0842f, 1.0842f, 1.0720f, 1.0475f, 1.0205f, 0.9815f, 0.9815f, 0.9815f, 0.9707f, 0.9707f, 0.9604f,
+    // 96000 Hz, LF 0.25, HF 0.5, size 1
+    1.0000f, 1.4957f, 1.0730f, 1.0730f, 1.0730f, 1.0730f, 1.0547f, 1.0351f, 0.9990f, 0.9776f, 0.9776f, 0.9776f, 0.9776f, 0.9672f,
+    // 96000 Hz, LF 0.25, HF 0.625, size 0
+    1.0000f, 1.0248f, 1.0371f, 1.0227f, 1.0005f, 1.0005f, 1.0005f, 0.9821f, 0.9611f, 0.9470f, 0.9470f, 0.9470f, 0.9181f, 0.8910f,
+    // 96000 Hz, LF 0.25, HF 0.625, size 0.25
+    1.2866f, 1.0696f, 1.0696f, 1.0475f, 1.0370f, 1.0193f, 1.0042f, 0.9912f, 0.9599f, 0.9599f, 0.9731f, 0.9731f, 0.9567f, 0.9370f,
+    // 96000 Hz, LF 0.25, HF 0.625, size 0.5
+    1.0000f, 1.0474f, 1.0793f, 1.0793f, 1.0534f, 1.0534f, 1.0335f, 1.0055f, 0.9724f, 0.9724f, 0.9724f, 0.9724f, 0.9559f, 0.9434f,
+    // 96000 Hz, LF 0.25, HF 0.625, size 0.75
+    1.0000f, 1.0917f, 1.0682f, 1.0861f, 1.0861f, 1.0740f, 1.0486f, 1.0237f, 0.9895f, 0.9778f, 0.9778f, 0.9778f, 0.9678f, 0.9537f,
+    // 96000 Hz, LF 0.25, HF 0.625, size 1
+    1.0000f, 1.4749f, 1.0723f, 1.0723f, 1.0723f, 1.0723f, 1.0564f, 1.0382f, 1.0020f, 0.9862f, 0.9862f, 0.9749f, 0.9749f, 0.9633f,
+    // 96000 Hz, LF 0.25, HF 0.75, size 0
+    1.5013f, 1.0127f, 1.0339f, 1.0221f, 0.9942f, 0.9942f, 0.9942f, 0.9729f, 0.9476f, 0.9476f, 0.9345f, 0.9161f, 0.8775f, 0.8359f,
+    // 96000 Hz, LF 0.25, HF 0.75, size 0.25
+    1.2885f, 1.0594f, 1.0594f, 1.0343f, 1.0343f, 1.0183f, 1.0083f, 0.9954f, 0.9658f, 0.9537f, 0.9537f, 0.9537f, 0.9316f, 0.9061f,
+    // 96000 Hz, LF 0.25, HF 0.75, size 0.5
+    1.0000f, 1.0385f, 1.0819f, 1.0819f, 1.0497f, 1.0497f, 1.0297f, 1.0047f, 0.9746f, 0.9746f, 0.9641f, 0.9641f, 0.9369f, 0.9185f,
+    // 96000 Hz, LF 0.25, HF 0.75, size 0.75
+    1.0000f, 1.0773f, 1.0537f, 1.0773f, 1.0882f, 1.0745f, 1.0476f, 1.0239f, 0.9889f, 0.9691f, 0.9691f, 0.9691f, 0.9515f, 0.9328f,
+    // 96000 Hz, LF 0.25, HF 0.75, size 1
+    1.0000f, 1.4039f, 1.0599f, 1.0599f, 1.0729f, 1.0729f, 1.0596f, 1.0412f, 1.0046f, 0.9864f, 0.9741f, 0.9741f, 0.9638f, 0.9515f,
+    // 96000 Hz, LF 0.25, HF 0.875, size 0
+    1.1838f, 0.9932f, 1.0289f, 1.0289f, 1.0023f, 0.9882f, 0.9882f, 0.9549f, 0.9088f, 0.9088f, 0.8751f, 0.8313f, 0.7542f, 0.6753f,
+    // 96000 Hz, LF 0.25, HF 0.875, size 0.25
+    1.3126f, 1.0675f, 1.0247f, 1.0247f, 1.0247f, 1.0110f, 1.0110f, 0.9872f, 0.9460f, 0.9145f, 0.9145f, 0.9029f, 0.8529f, 0.8026f,
+    // 96000 Hz, LF 0.25, HF 0.875, size 0.5
+    1.0000f, 1.0254f, 1.0891f, 1.0756f, 1.0394f, 1.0394f, 1.0188f, 0.9995f, 0.9729f, 0.9626f, 0.9364f, 0.9199f, 0.8812f, 0.8456f,
+    // 96000 Hz, LF 0.25, HF 0.875, size 0.75
+    1.0000f, 1.0669f, 1.0554f, 1.0859f, 1.0859f, 1.0674f, 1.0351f, 1.0104f, 0.9808f, 0.9621f, 0.9419f, 0.9419f, 0.9134f, 0.8815f,
+    // 96000 Hz, LF 0.25, HF 0.875, size 1
+    1.0000f, 1.3031f, 1.0496f, 1.0646f, 1.0759f, 1.0759f, 1.0554f, 1.0298f, 0.9934f, 0.9649f, 0.9649f, 0.9545f, 0.9318f, 0.9070f,
+    // 96000 Hz, LF 0.25, HF 1, size 0
+    1.1291f, 0.9804f, 0.9804f, 0.9586f, 0.9232f, 0.9036f, 0.8760f, 0.8167f, 0.6796f, 0.5759f, 0.3867f, 0.1849f, 0.2238f, 0.2985f,
+    // 96000 Hz, LF 0.25, HF 1, size 0.25
+    1.2237f, 1.0550f, 0.9515f, 0.9515f, 0.9668f, 0.9568f, 0.9568f, 0.9026f, 0.8305f, 0.7606f, 0.6306f, 0.5176f, 0.3102f, 0.1705f,
+    // 96000 Hz, LF 0.25, HF 1, size 0.5
+    1.0000f, 1.0194f, 1.0501f, 1.0006f, 0.9861f, 0.9861f, 0.9685f, 0.9390f, 0.8657f, 0.8203f, 0.7382f, 0.6611f, 0.5043f, 0.3399f,
+    // 96000 Hz, LF 0.25, HF 1, size 0.75
+    1.0000f, 1.0111f, 1.0580f, 1.0580f, 1.0155f, 0.9904f, 0.9904f, 0.9551f, 0.9105f, 0.8609f, 0.8020f, 0.7413f, 0.6014f, 0.4855f,
+    // 96000 Hz, LF 0.25, HF 1, size 1
+    1.0000f, 1.1309f, 1.0235f, 1.0966f, 1.0825f, 1.0546f, 1.0149f, 0.9716f, 0.9158f, 0.8835f, 0.8374f, 0.7910f, 0.6880f, 0.5840f,
+    // 96000 Hz, LF 0.5, HF 0, size 0
+    1.3155f, 1.0330f, 1.0031f, 0.9829f, 0.9561f, 0.9561f, 0.9418f, 0.9250f, 0.8998f, 0.8998f, 0.8998f, 0.8998f, 0.8739f, 0.8376f,
+    // 96000 Hz, LF 0.5, HF 0, size 0.25
+    1.4778f, 1.0696f, 1.0320f, 1.0039f, 0.9845f, 0.9646f, 0.9432f, 0.9279f, 0.9157f, 0.9157f, 0.9157f, 0.9157f, 0.9024f, 0.8818f,
+    // 96000 Hz, LF 0.5, HF 0, size 0.5
+    1.0000f, 1.0503f, 1.0503f, 1.0245f, 1.0096f, 0.9940f, 0.9698f, 0.9459f, 0.9205f, 0.9205f, 0.9205f, 0.9205f, 0.9069f, 0.8859f,
+    // 96000 Hz, LF 0.5, HF 0, size 0.75
+    1.0000f, 1.0469f, 1.0469f, 1.0469f, 1.0309f, 1.0112f, 0.9857f, 0.9591f, 0.9356f, 0.9209f, 0.9209f, 0.9209f, 0.9090f, 0.8901f,
+    // 96000 Hz, LF 0.5, HF 0, size 1
+    1.0000f, 1.0000f, 1.0703f, 1.0703f, 1.0402f, 1.0223f, 0.9956f, 0.9683f, 0.9300f, 0.9300f, 0.9300f, 0.9300f, 0.9157f, 0.9004f,
+    // 96000 Hz, LF 0.5, HF 0.25, size 0
+    1.0000f, 1.0372f, 1.0372f, 1.0174f, 1.0019f, 0.9886f, 0.9886f, 0.9679f, 0.9428f, 0.9282f, 0.9282f, 0.9282f, 0.8932f, 0.8590f,
+    // 96000 Hz, LF 0.5, HF 0.25, size 0.25
+    1.3077f, 1.0804f, 1.0670f, 1.0434f, 1.0265f, 1.0091f, 0.9887f, 0.9733f, 0.9414f, 0.9414f, 0.9562f, 0.9562f, 0.9280f, 0.9068f,
+    // 96000 Hz, LF 0.5, HF 0.25, size 0.5
+    1.0000f, 1.0591f, 1.0718f, 1.0718f, 1.0583f, 1.0480f, 1.0213f, 0.9916f, 0.9566f, 0.9566f, 0.9566f, 0.9566f, 0.9424f, 0.9258f,
+    // 96000 Hz, LF 0.5, HF 0.25, size 0.75
+    1.0000f, 1.1111f, 1.0797f, 1.0797f, 1.0797f, 1.0658f, 1.0408f, 1.0098f, 0.9741f, 0.9613f, 0.9613f, 0.9613f, 0.9501f, 0.9358f,
+    // 96000 Hz, LF 0.5, HF 0.25, size 1
+    1.0000f, 1.4913f, 1.0707f, 1.0707f, 1.0707f, 1.0707f, 1.0509f, 1.0255f, 0.9871f, 0.9708f, 0.9708f, 0.9708f, 0.9589f, 0.9456f,
+    // 96000 Hz, LF 0.5, HF 0.5, size 0
+    1.0000f, 1.0331f, 1.0331f, 1.0138f, 0.9990f, 0.9886f, 0.9886f, 0.9666f, 0.9369f, 0.9160f, 0.9160f, 0.9055f, 0.8550f, 0.8089f,
+    // 96000 Hz, LF 0.5, HF 0.5, size 0.25
+    1.2974f, 1.0691f, 1.0691f, 1.0439f, 1.0282f, 1.0084f, 0.9869f, 0.9739f, 0.9498f, 0.9389f, 0.9503f, 0.9503f, 0.9129f, 0.8820f,
+    // 96000 Hz, LF 0.5, HF 0.5, size 0.5
+    1.0000f, 1.0501f, 1.0739f, 1.0739f, 1.0487f, 1.0487f, 1.0235f, 0.9929f, 0.9622f, 0.9472f, 0.9472f, 0.9472f, 0.9302f, 0.9088f,
+    // 96000 Hz, LF 0.5, HF 0.5, size 0.75
+    1.0000f, 1.1034f, 1.0820f, 1.0820f, 1.0820f, 1.0693f, 1.0420f, 1.0123f, 0.9745f, 0.9569f, 0.9569f, 0.9569f, 0.9421f, 0.9247f,
+    // 96000 Hz, LF 0.5, HF 0.5, size 1
+    1.0000f, 1.4911f, 1.0691f, 1.0691f, 1.0691f, 1.0691f, 1.0499f, 1.0284f, 0.9896f, 0.9670f, 0.9670f, 0.9670f, 0.9517f, 0.9353f,
+    // 96000 Hz, LF 0.5, HF 0.625, size 0
+    1.0000f, 1.0263f, 1.0263f, 1.0065f, 0.9813f, 0.9813f, 0.9813f, 0.9586f, 0.9239f, 0.9015f, 0.8916f, 0.8758f, 0.8151f, 0.7534f,
+    // 96000 Hz, LF 0.5, HF 0.625, size 0.25
+    1.2917f, 1.0670f, 1.0670f, 1.0414f, 1.0264f, 1.0051f, 0.9847f, 0.9722f, 0.9450f, 0.9339f, 0.9339f, 0.9339f, 0.8873f, 0.8483f,
+    // 96000 Hz, LF 0.5, HF 0.625, size 0.5
+    1.0000f, 1.0436f, 1.0761f, 1.0761f, 1.0464f, 1.0464f, 1.0227f, 0.9912f, 0.9601f, 0.9472f, 0.9358f, 0.9358f, 0.9127f, 0.8849f,
+    // 96000 Hz, LF 0.5, HF 0.625, size 0.75
+    1.0000f, 1.0891f, 1.0633f, 1.0836f, 1.0836f, 1.0707f, 1.0410f, 1.0121f, 0.9715f, 0.9488f, 0.9488f, 0.9488f, 0.9279f, 0.9062f,
+    // 96000 Hz, LF 0.5, HF 0.625, size 1
+    1.0000f, 1.4679f, 1.0672f, 1.0672f, 1.0672f, 1.0672f, 1.0503f, 1.0298f, 0.9899f, 0.9717f, 0.9581f, 0.9581f, 0.9390f, 0.9181f,
+    // 96000 Hz, LF 0.5, HF 0.75, size 0
+    1.4965f, 1.0049f, 1.0178f, 0.9971f, 0.9765f, 0.9608f, 0.9608f, 0.9345f, 0.8958f, 0.8700f, 0.8426f, 0.8071f, 0.7153f, 0.6190f,
+    // 96000 Hz, LF 0.5, HF 0.75, size 0.25
+    1.2943f, 1.0563f, 1.0563f, 1.0324f, 1.0187f, 0.9977f, 0.9811f, 0.9688f, 0.9302f, 0.9017f, 0.9017f, 0.8832f, 0.8264f, 0.7681f,
+    // 96000 Hz, LF 0.5, HF 0.75, size 0.5
+    1.0000f, 1.0328f, 1.0787f, 1.0787f, 1.0494f, 1.0389f, 1.0131f, 0.9828f, 0.9502f, 0.9387f, 0.9240f, 0.9093f, 0.8672f, 0.8243f,
+    // 96000 Hz, LF 0.5, HF 0.75, size 0.75
+    1.0000f, 1.0730f, 1.0460f, 1.0714f, 1.0848f, 1.0696f, 1.0359f, 1.0071f, 0.9636f, 0.9404f, 0.9404f, 0.9256f, 0.8917f, 0.8567f,
+    // 96000 Hz, LF 0.5, HF 0.75, size 1
+    1.0000f, 1.4044f, 1.0545f, 1.0545f, 1.0545f, 1.0657f, 1.0513f, 1.0296f, 0.9871f, 0.9647f, 0.9503f, 0.9343f, 0.9078f, 0.8797f,
+    // 96000 Hz, LF 0.5, HF 0.875, size 0
+    1.1737f, 0.9723f, 0.9975f, 0.9863f, 0.9548f, 0.9364f, 0.9163f, 0.8670f, 0.8036f, 0.7605f, 0.6598f, 0.5506f, 0.3387f, 0.2985f,
+    // 96000 Hz, LF 0.5, HF 0.875, size 0.25
+    1.3126f, 1.0582f, 1.0222f, 1.0095f, 0.9958f, 0.9796f, 0.9669f, 0.9366f, 0.8746f, 0.8308f, 0.7926f, 0.7508f, 0.6324f, 0.5136f,
+    // 96000 Hz, LF 0.5, HF 0.875, size 0.5
+    1.0000f, 1.0145f, 1.0819f, 1.0709f, 1.0368f, 1.0190f, 0.9865f, 0.9570f, 0.9219f, 0.8982f, 0.8569f, 0.8084f, 0.7132f, 0.6254f,
+    // 96000 Hz, LF 0.5, HF 0.875, size 0.75
+    1.0000f, 1.0584f, 1.0404f, 1.0816f, 1.0816f, 1.0684f, 1.0118f, 0.9785f, 0.9359f, 0.9108f, 0.8822f, 0.8500f, 0.7795f, 0.7065f,
+    // 96000 Hz, LF 0.5, HF 0.875, size 1
+    1.0000f, 1.3028f, 1.0470f, 1.0470f, 1.0637f, 1.0637f, 1.0404f, 1.0072f, 0.9592f, 0.9299f, 0.9034f, 0.8743f, 0.8178f, 0.7571f,
+    // 96000 Hz, LF 0.5, HF 1, size 0
+    1.1072f, 0.8780f, 0.8780f, 0.8320f, 0.7723f, 0.7211f, 0.6406f, 0.4907f, 0.1670f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 96000 Hz, LF 0.5, HF 1, size 0.25
+    1.1665f, 1.0204f, 0.8790f, 0.8641f, 0.8641f, 0.8305f, 0.7744f, 0.6767f, 0.4966f, 0.3478f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 96000 Hz, LF 0.5, HF 1, size 0.5
+    1.0000f, 0.9753f, 1.0230f, 0.9626f, 0.9300f, 0.9085f, 0.8473f, 0.7802f, 0.6579f, 0.5401f, 0.3008f, 0.0895f, 0.0895f, 0.1194f,
+    // 96000 Hz, LF 0.5, HF 1, size 0.75
+    1.0000f, 0.9854f, 1.0299f, 1.0299f, 0.9907f, 0.9401f, 0.9179f, 0.8326f, 0.7348f, 0.6413f, 0.4673f, 0.3033f, 0.0689f, 0.0918f,
+    // 96000 Hz, LF 0.5, HF 1, size 1
+    1.0000f, 1.1179f, 0.9940f, 1.0587f, 1.0433f, 1.0161f, 0.9648f, 0.8660f, 0.7802f, 0.6956f, 0.5634f, 0.4202f, 0.1532f, 0.0746f,
+    // 96000 Hz, LF 0.75, HF 0, size 0
+    1.3139f, 1.0321f, 0.9998f, 0.9794f, 0.9610f, 0.9508f, 0.9342f, 0.9173f, 0.8830f, 0.8830f, 0.8730f, 0.8730f, 0.8328f, 0.7967f,
+    // 96000 Hz, LF 0.75, HF 0, size 0.25
+    1.4776f, 1.0685f, 1.0309f, 1.0020f, 0.9817f, 0.9610f, 0.9385f, 0.9219f, 0.9000f, 0.9000f, 0.9000f, 0.9000f, 0.8779f, 0.8588f,
+    // 96000 Hz, LF 0.75, HF 0, size 0.5
+    1.0000f, 1.0486f, 1.0486f, 1.0227f, 1.0076f, 0.9916f, 0.9668f, 0.9414f, 0.9088f, 0.9088f, 0.9088f, 0.9088f, 0.8915f, 0.8635f,
+    // 96000 Hz, LF 0.75, HF 0, size 0.75
+    1.0000f, 1.0453f, 1.0453f, 1.0453f, 1.0290f, 1.0089f, 0.9832f, 0.9559f, 0.9224f, 0.9224f, 0.9108f, 0.9108f, 0.8949f, 0.8698f,
+    // 96000 Hz, LF 0.75, HF 0, size 1
+    1.0000f, 1.0000f, 1.0689f, 1.0689f, 1.0384f, 1.0201f, 0.9932f, 0.9659f, 0.9326f, 0.9219f, 0.9219f, 0.9219f, 0.9035f, 0.8828f,
+    // 96000 Hz, LF 0.75, HF 0.25, size 0
+    1.0000f, 1.0427f, 1.0308f, 1.0097f, 0.9933f, 0.9769f, 0.9769f, 0.9537f, 0.9231f, 0.9033f, 0.9033f, 0.8915f, 0.8359f, 0.7814f,
+    // 96000 Hz, LF 0.75, HF 0.25, size 0.25
+    1.3100f, 1.0770f, 1.0648f, 1.0397f, 1.0208f, 1.0021f, 0.9794f, 0.9614f, 0.9303f, 0.9303f, 0.9303f, 0.9303f, 0.8946f, 0.8629f,
+    // 96000 Hz, LF 0.75, HF 0.25, size 0.5
+    1.0000f, 1.0571f, 1.0674f, 1.0674f, 1.0540f, 1.0434f, 1.0157f, 0.9840f, 0.9488f, 0.9357f, 0.9357f, 0.9357f, 0.9111f, 0.8864f,
+    // 96000 Hz, LF 0.75, HF 0.25, size 0.75
+    1.0000f, 1.1202f, 1.0753f, 1.0753f, 1.0753f, 1.0615f, 1.0365f, 1.0042f, 0.9657f, 0.9433f, 0.9433f, 0.9433f, 0.9249f, 0.9033f,
+    // 96000 Hz, LF 0.75, HF 0.25, size 1
+    1.0000f, 1.4906f, 1.0656f, 1.0656f, 1.0656f, 1.0656f, 1.0458f, 1.0201f, 0.9793f, 0.9564f, 0.9564f, 0.9564f, 0.9379f, 0.9189f,
+    // 96000 Hz, LF 0.75, HF 0.5, size 0
+    1.0000f, 1.0241f, 1.0241f, 1.0026f, 0.9859f, 0.9722f, 0.9722f, 0.9453f, 0.9093f, 0.8861f, 0.8672f, 0.8451f, 0.7641f, 0.6860f,
+    // 96000 Hz, LF 0.75, HF 0.5, size 0.25
+    1.3018f, 1.0660f, 1.0660f, 1.0384f, 1.0199f, 0.9979f, 0.9726f, 0.9569f, 0.9308f, 0.9105f, 0.9105f, 0.9105f, 0.8560f, 0.8077f,
+    // 96000 Hz, LF 0.75, HF 0.5, size 0.5
+    1.0000f, 1.0465f, 1.0677f, 1.0677f, 1.0421f, 1.0421f, 1.0154f, 0.9813f, 0.9460f, 0.9287f, 0.9163f, 0.9163f, 0.8873f, 0.8534f,
+    // 96000 Hz, LF 0.75, HF 0.5, size 0.75
+    1.0000f, 1.1016f, 1.0759f, 1.0759f, 1.0759f, 1.0633f, 1.0356f, 1.0041f, 0.9619f, 0.9424f, 0.9424f, 0.9313f, 0.9081f, 0.8788f,
+    // 96000 Hz, LF 0.75, HF 0.5, size 1
+    1.0000f, 1.4894f, 1.0618f, 1.0618f, 1.0618f, 1.0618f, 1.0425f, 1.0212f, 0.9802f, 0.9593f, 0.9460f, 0.9460f, 0.9236f, 0.8990f,
+    // 96000 Hz, LF 0.75, HF 0.625, size 0
+    1.0000f, 1.0140f, 1.0140f, 0.9901f, 0.9725f, 0.9597f, 0.9597f, 0.9313f, 0.8848f, 0.8508f, 0.8163f, 0.7796f, 0.6753f, 0.5785f,
+    // 96000 Hz, LF 0.75, HF 0.625, size 0.25
+    1.2971f, 1.0631f, 1.0631f, 1.0338f, 1.0154f, 0.9909f, 0.9656f, 0.9498f, 0.9189f, 0.8958f, 0.8958f, 0.8784f, 0.8041f, 0.7393f,
+    // 96000 Hz, LF 0.75, HF 0.625, size 0.5
+    1.0000f, 1.0387f, 1.0683f, 1.0683f, 1.0374f, 1.0374f, 1.0121f, 0.9759f, 0.9388f, 0.9171f, 0.9048f, 0.8916f, 0.8502f, 0.8022f,
+    // 96000 Hz, LF 0.75, HF 0.625, size 0.75
+    1.0000f, 1.0867f, 1.0564f, 1.0758f, 1.0758f, 1.0630f, 1.0323f, 1.0010f, 0.9542f, 0.9293f, 0.9293f, 0.9138f, 0.8818f, 0.8446f,
+    // 96000 Hz, LF 0.75, HF 0.625, size 1
+    1.0000f, 1.4663f, 1.0577f, 1.0577f, 1.0577f, 1.0577f, 1.0406f, 1.0205f, 0.9769f, 0.9539f, 0.9422f, 0.9304f, 0.8995f, 0.8665f,
+    // 96000 Hz, LF 0.75, HF 0.75, size 0
+    1.4923f, 0.9980f, 0.9980f, 0.9686f, 0.9464f, 0.9355f, 0.9242f, 0.8909f, 0.8288f, 0.7828f, 0.7133f, 0.6392f, 0.4687f, 0.2985f,
+    // 96000 Hz, LF 0.75, HF 0.75, size 0.25
+    1.3137f, 1.0505f, 1.0505f, 1.0207f, 1.0015f, 0.9754f, 0.9526f, 0.9361f, 0.8889f, 0.8596f, 0.8298f, 0.7917f, 0.6799f, 0.5797f,
+    // 96000 Hz, LF 0.75, HF 0.75, size 0.5
+    1.0000f, 1.0250f, 1.0679f, 1.0679f, 1.0366f, 1.0244f, 0.9958f, 0.9589f, 0.9162f, 0.8927f, 0.8657f, 0.8370f, 0.7658f, 0.6858f,
+    // 96000 Hz, LF 0.75, HF 0.75, size 0.75
+    1.0000f, 1.0688f, 1.0353f, 1.0588f, 1.0741f, 1.0586f, 1.0222f, 0.9896f, 0.9359f, 0.9107f, 0.8951f, 0.8722f, 0.8135f, 0.7515f,
+    // 96000 Hz, LF 0.75, HF 0.75, size 1
+    1.0000f, 1.4064f, 1.0397f, 1.0397f, 1.0397f, 1.0520f, 1.0376f, 1.0163f, 0.9679f, 0.9392f, 0.9137f, 0.8887f, 0.8414f, 0.7878f,
+    // 96000 Hz, LF 0.75, HF 0.875, size 0
+    1.1551f, 0.9557f, 0.9557f, 0.9278f, 0.8878f, 0.8653f, 0.8301f, 0.7686f, 0.6637f, 0.5523f, 0.3605f, 0.1713f, 0.2238f, 0.2985f,
+    // 96000 Hz, LF 0.75, HF 0.875, size 0.25
+    1.3265f, 1.0404f, 1.0091f, 0.9860f, 0.9596f, 0.9364f, 0.9152f, 0.8769f, 0.7877f, 0.7222f, 0.6287f, 0.5216f, 0.2908f, 0.1705f,
+    // 96000 Hz, LF 0.75, HF 0.875, size 0.5
+    1.0000f, 1.0004f, 1.0536f, 1.0536f, 1.0135f, 0.9898f, 0.9492f, 0.9076f, 0.8502f, 0.8097f, 0.7371f, 0.6564f, 0.4891f, 0.3128f,
+    // 96000 Hz, LF 0.75, HF 0.875, size 0.75
+    1.0000f, 1.0511f, 1.0234f, 1.0504f, 1.0634f, 1.0489f, 0.9820f, 0.9407f, 0.8806f, 0.8455f, 0.7951f, 0.7245f, 0.5894f, 0.4622f,
+    // 96000 Hz, LF 0.75, HF 0.875, size 1
+    1.0000f, 1.3059f, 1.0206f, 1.0206f, 1.0393f, 1.0393f, 1.0150f, 0.9806f, 0.9188f, 0.8777f, 0.8224f, 0.7694f, 0.6636f, 0.5599f,
+    // 96000 Hz, LF 0.75, HF 1, size 0
+    1.0496f, 0.7637f, 0.6983f, 0.6133f, 0.5104f, 0.3971f, 0.2403f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 96000 Hz, LF 0.75, HF 1, size 0.25
+    1.1263f, 0.9573f, 0.8207f, 0.7625f, 0.7042f, 0.6371f, 0.5336f, 0.3776f, 0.0659f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 96000 Hz, LF 0.75, HF 1, size 0.5
+    1.0000f, 0.9301f, 0.9650f, 0.8850f, 0.8353f, 0.7852f, 0.6883f, 0.5771f, 0.3462f, 0.1342f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 96000 Hz, LF 0.75, HF 1, size 0.75
+    1.0000f, 0.9575f, 0.9874f, 0.9718f, 0.9196f, 0.8693f, 0.7807f, 0.6681f, 0.4920f, 0.3070f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 96000 Hz, LF 0.75, HF 1, size 1
+    1.0000f, 1.1112f, 0.9530f, 0.9933f, 0.9722f, 0.9466f, 0.8783f, 0.7341f, 0.5742f, 0.4307f, 0.1860f, 0.0373f, 0.0560f, 0.0746f,
+    // 96000 Hz, LF 1, HF 0, size 0
+    1.3123f, 1.0312f, 0.9968f, 0.9760f, 0.9573f, 0.9458f, 0.9271f, 0.9079f, 0.8809f, 0.8692f, 0.8455f, 0.8455f, 0.7947f, 0.7469f,
+    // 96000 Hz, LF 1, HF 0, size 0.25
+    1.4780f, 1.0674f, 1.0295f, 0.9999f, 0.9791f, 0.9576f, 0.9341f, 0.9158f, 0.9019f, 0.8818f, 0.8818f, 0.8818f, 0.8528f, 0.8249f,
+    // 96000 Hz, LF 1, HF 0, size 0.5
+    1.0000f, 1.0467f, 1.0467f, 1.0207f, 1.0054f, 0.9890f, 0.9638f, 0.9375f, 0.9102f, 0.8961f, 0.8961f, 0.8961f, 0.8763f, 0.8405f,
+    // 96000 Hz, LF 1, HF 0, size 0.75
+    1.0000f, 1.0435f, 1.0435f, 1.0435f, 1.0266f, 1.0064f, 0.9806f, 0.9529f, 0.9271f, 0.9104f, 0.9104f, 0.9005f, 0.8807f, 0.8615f,
+    // 96000 Hz, LF 1, HF 0, size 1
+    1.0000f, 1.0000f, 1.0676f, 1.0676f, 1.0364f, 1.0177f, 0.9906f, 0.9625f, 0.9279f, 0.9135f, 0.9135f, 0.9135f, 0.8916f, 0.8647f,
+    // 96000 Hz, LF 1, HF 0.25, size 0
+    1.0000f, 1.0410f, 1.0248f, 1.0031f, 0.9869f, 0.9750f, 0.9646f, 0.9387f, 0.9003f, 0.8782f, 0.8628f, 0.8404f, 0.7668f, 0.6886f,
+    // 96000 Hz, LF 1, HF 0.25, size 0.25
+    1.3125f, 1.0734f, 1.0614f, 1.0350f, 1.0152f, 0.9954f, 0.9704f, 0.9486f, 0.9238f, 0.9101f, 0.9101f, 0.8977f, 0.8487f, 0.8004f,
+    // 96000 Hz, LF 1, HF 0.25, size 0.5
+    1.0000f, 1.0621f, 1.0621f, 1.0621f, 1.0491f, 1.0383f, 1.0099f, 0.9754f, 0.9364f, 0.9221f, 0.9221f, 0.9119f, 0.8762f, 0.8392f,
+    // 96000 Hz, LF 1, HF 0.25, size 0.75
+    1.0000f, 1.1195f, 1.0694f, 1.0694f, 1.0694f, 1.0559f, 1.0320f, 0.9981f, 0.9575f, 0.9357f, 0.9357f, 0.9217f, 0.8957f, 0.8655f,
+    // 96000 Hz, LF 1, HF 0.25, size 1
+    1.0000f, 1.4892f, 1.0597f, 1.0597f, 1.0597f, 1.0597f, 1.0402f, 1.0136f, 0.9710f, 0.9515f, 0.9396f, 0.9396f, 0.9140f, 0.8878f,
+    // 96000 Hz, LF 1, HF 0.5, size 0
+    1.0000f, 1.0154f, 1.0154f, 0.9929f, 0.9739f, 0.9535f, 0.9535f, 0.9199f, 0.8751f, 0.8439f, 0.8103f, 0.7695f, 0.6494f, 0.5352f,
+    // 96000 Hz, LF 1, HF 0.5, size 0.25
+    1.3063f, 1.0609f, 1.0609f, 1.0310f, 1.0116f, 0.9875f, 0.9580f, 0.9379f, 0.9083f, 0.8807f, 0.8807f, 0.8611f, 0.7871f, 0.7155f,
+    // 96000 Hz, LF 1, HF 0.5, size 0.5
+    1.0000f, 1.0429f, 1.0598f, 1.0598f, 1.0345f, 1.0345f, 1.0070f, 0.9685f, 0.9281f, 0.9080f, 0.8936f, 0.8807f, 0.8323f, 0.7774f,
+    // 96000 Hz, LF 1, HF 0.5, size 0.75
+    1.0000f, 1.1085f, 1.0674f, 1.0674f, 1.0674f, 1.0553f, 1.0289f, 0.9951f, 0.9494f, 0.9286f, 0.9180f, 0.8985f, 0.8628f, 0.8193f,
+    // 96000 Hz, LF 1, HF 0.5, size 1
+    1.0000f, 1.4883f, 1.0532f, 1.0532f, 1.0532f, 1.0532f, 1.0339f, 1.0119f, 0.9675f, 0.9433f, 0.9334f, 0.9198f, 0.8869f, 0.8503f,
+    // 96000 Hz, LF 1, HF 0.625, size 0
+    1.0000f, 1.0019f, 1.0019f, 0.9756f, 0.9554f, 0.9349f, 0.9349f, 0.8964f, 0.8338f, 0.7902f, 0.7343f, 0.6623f, 0.4967f, 0.3354f,
+    // 96000 Hz, LF 1, HF 0.625, size 0.25
+    1.3041f, 1.0566f, 1.0566f, 1.0236f, 1.0040f, 0.9765f, 0.9449f, 0.9229f, 0.8869f, 0.8629f, 0.8423f, 0.8084f, 0.7012f, 0.6066f,
+    // 96000 Hz, LF 1, HF 0.625, size 0.5
+    1.0000f, 1.0332f, 1.0580f, 1.0580f, 1.0269f, 1.0269f, 1.0006f, 0.9585f, 0.9150f, 0.8857f, 0.8621f, 0.8402f, 0.7728f, 0.7060f,
+    // 96000 Hz, LF 1, HF 0.625, size 0.75
+    1.0000f, 1.0952f, 1.0493f, 1.0649f, 1.0649f, 1.0526f, 1.0232f, 0.9888f, 0.9367f, 0.9134f, 0.8962f, 0.8686f, 0.8191f, 0.7590f,
+    // 96000 Hz, LF 1, HF 0.625, size 1
+    1.0000f, 1.4624f, 1.0463f, 1.0463f, 1.0463f, 1.0463f, 1.0291f, 1.0085f, 0.9602f, 0.9324f, 0.9137f, 0.8947f, 0.8502f, 0.8008f,
+    // 96000 Hz, LF 1, HF 0.75, size 0
+    1.4933f, 0.9914f, 0.9780f, 0.9419f, 0.9173f, 0.8997f, 0.8818f, 0.8358f, 0.7452f, 0.6716f, 0.5425f, 0.4245f, 0.2238f, 0.2985f,
+    // 96000 Hz, LF 1, HF 0.75, size 0.25
+    1.3263f, 1.0405f, 1.0405f, 1.0045f, 0.9832f, 0.9523f, 0.9199f, 0.8925f, 0.8367f, 0.7982f, 0.7411f, 0.6719f, 0.4972f, 0.3331f,
+    // 96000 Hz, LF 1, HF 0.75, size 0.5
+    1.0000f, 1.0161f, 1.0532f, 1.0532f, 1.0203f, 1.0075f, 0.9763f, 0.9305f, 0.8770f, 0.8396f, 0.7946f, 0.7478f, 0.6353f, 0.5209f,
+    // 96000 Hz, LF 1, HF 0.75, size 0.75
+    1.0000f, 1.0760f, 1.0241f, 1.0436f, 1.0584f, 1.0433f, 1.0090f, 0.9803f, 0.9063f, 0.8726f, 0.8408f, 0.8014f, 0.7137f, 0.6166f,
+    // 96000 Hz, LF 1, HF 0.75, size 1
+    1.0000f, 1.4067f, 1.0361f, 1.0237f, 1.0237f, 1.0350f, 1.0208f, 0.9991f, 0.9433f, 0.9064f, 0.8674f, 0.8330f, 0.7588f, 0.6795f,
+    // 96000 Hz, LF 1, HF 0.875, size 0
+    1.1455f, 0.9312f, 0.9099f, 0.8655f, 0.8236f, 0.7907f, 0.7343f, 0.6352f, 0.4644f, 0.2882f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 96000 Hz, LF 1, HF 0.875, size 0.25
+    1.3479f, 1.0198f, 0.9878f, 0.9523f, 0.9186f, 0.8890f, 0.8505f, 0.7961f, 0.6699f, 0.5668f, 0.3907f, 0.2166f, 0.1279f, 0.1705f,
+    // 96000 Hz, LF 1, HF 0.875, size 0.5
+    1.0000f, 0.9829f, 1.0294f, 1.0294f, 0.9829f, 0.9545f, 0.9039f, 0.8448f, 0.7653f, 0.6996f, 0.5796f, 0.4485f, 0.1713f, 0.1194f,
+    // 96000 Hz, LF 1, HF 0.875, size 0.75
+    1.0000f, 1.0520f, 1.0017f, 1.0229f, 1.0348f, 1.0175f, 0.9504f, 0.9066f, 0.8163f, 0.7590f, 0.6714f, 0.5701f, 0.3596f, 0.1488f,
+    // 96000 Hz, LF 1, HF 0.875, size 1
+    1.0000f, 1.3059f, 1.0121f, 0.9931f, 1.0072f, 1.0072f, 0.9827f, 0.9473f, 0.8690f, 0.8103f, 0.7223f, 0.6384f, 0.4690f, 0.3012f,
+    // 96000 Hz, LF 1, HF 1, size 0
+    0.9525f, 0.6090f, 0.4958f, 0.3706f, 0.1662f, 0.0224f, 0.0280f, 0.0373f, 0.0560f, 0.0746f, 0.1119f, 0.1492f, 0.2238f, 0.2985f,
+    // 96000 Hz, LF 1, HF 1, size 0.25
+    1.1087f, 0.8765f, 0.7363f, 0.6448f, 0.5316f, 0.4132f, 0.2628f, 0.0213f, 0.0320f, 0.0426f, 0.0640f, 0.0853f, 0.1279f, 0.1705f,
+    // 96000 Hz, LF 1, HF 1, size 0.5
+    1.0000f, 0.8869f, 0.8894f, 0.7873f, 0.6991f, 0.6275f, 0.5000f, 0.3234f, 0.0224f, 0.0298f, 0.0448f, 0.0597f, 0.0895f, 0.1194f,
+    // 96000 Hz, LF 1, HF 1, size 0.75
+    1.0000f, 0.9198f, 0.9198f, 0.8890f, 0.8408f, 0.7860f, 0.6260f, 0.4641f, 0.1883f, 0.0230f, 0.0344f, 0.0459f, 0.0689f, 0.0918f,
+    // 96000 Hz, LF 1, HF 1, size 1
+    1.0000f, 1.0970f, 0.9013f, 0.9185f, 0.8773f, 0.8588f, 0.7559f, 0.5889f, 0.3485f, 0.1218f, 0.0280f, 0.0373f, 0.0560f, 0.0746f,
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,244 @@
+#include "FDNPipeline.hpp"
+#include "RealtimeSafety.hpp"
+#include "TraceBuffer.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr double LOAD_SMOOTHING = 0.05;         // EMA coefficient per helper batch
+    constexpr int SPINS_BEFORE_YIELD = 64;
+}
+
+FDNPipeline::FDNPipeline()
+    : sampleRate_(48000.0)
+    , latency_(0)
+    , primeRemaining_(0)
+    , fdn_(nullptr)
+    , submitted_(0)
+    , processed_(0)
+    , sleeping_(false)
+    , running_(false)
+    , blocks_(0)
+    , stalls_(0)
+    , helperLoad_(0.0)
+    , peakHelperLoad_(0.0) {
+}
+
+FDNPipeline::~FDNPipeline() {
+    shutdown();
+}
+
+bool FDNPipeline::prepare(double sampleRate, int latencySamples) {
+    if (sampleRate <= 0.0 || latencySamples <= 0) {
+        return false;
+    }
+
+    shutdown();
+
+    sampleRate_ = sampleRate;
+    latency_ = latencySamples;
+
+    // One block in flight plus the latency on every ring
+    const size_t capacity = static_cast<size_t>(latency_) * 2;
+    diffusedRing_.resize(capacity);
+    for (int ch = 0; ch < 2; ++ch) {
+        wetRings_[ch].resize(capacity);
+        dryRings_[ch].resize(capacity);
+    }
+
+    submitted_.store(0);
+    processed_.store(0);
+    blocks_.store(0);
+    stalls_.store(0);
+    helperLoad_.store(0.0);
+    peakHelperLoad_.store(0.0);
+    reset();
+
+    running_.store(true, std::memory_order_release);
+    helper_ = std::thread(&FDNPipeline::helperLoop, this);
+    return true;
+}
+
+void FDNPipeline::shutdown() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    sleeping_.store(false);
+    wake_.post();
+    if (helper_.joinable()) {
+        helper_.join();
+    }
+}
+
+FDNPipeline::Statistics FDNPipeline::getStatistics() const {
+    Statistics stats;
+    stats.blocks = blocks_.load(std::memory_order_relaxed);
+    stats.stalls = stalls_.load(std::memory_order_relaxed);
+    stats.helperLoad = helperLoad_.load(std::memory_order_relaxed);
+    stats.peakHelperLoad = peakHelperLoad_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// ============================================================================
+// Audio thread
+// ============================================================================
+
+void FDNPipeline::waitIdle() {
+    const uint64_t submitted = submitted_.load(std::memory_order_relaxed);
+    if (processed_.load(std::memory_order_acquire) == submitted) {
+        return;
+    }
+
+    // The loop took longer than the gap between callbacks
+    stalls_.fetch_add(1, std::memory_order_relaxed);
+    int spins = 0;
+    while (processed_.load(std::memory_order_acquire) != submitted) {
+        if (++spins % SPINS_BEFORE_YIELD == 0) {
+            std::this_thread::yield();
+        } else {
+            ThreadSync::cpuRelax();
+        }
+    }
+}
+
+void FDNPipeline::reset() {
+    waitIdle();
+
+    // The helper is idle and only looks at the rings again after the next submit
+    diffusedRing_.clear();
+    for (int ch = 0; ch < 2; ++ch) {
+        wetRings_[ch].clear();
+        dryRings_[ch].clear();
+        for (int i = 0; i < latency_; ++i) {
+            dryRings_[ch].write(0.0f);
+        }
+    }
+    primeRemaining_ = latency_;
+}
+
+void FDNPipeline::process(FDNReverb& fdn, const float* inputL, const float* inputR,
+                          float* wetL, float* wetR, float* dryL, float* dryR, int numSamples) {
+    numSamples = std::min(numSamples, latency_);
+    if (numSamples <= 0) {
+        return;
+    }
+
+    waitIdle();
+    blocks_.fetch_add(1, std::memory_order_relaxed);
+
+    // Dry path, delayed to line up with the wet one
+    const size_t count = static_cast<size_t>(numSamples);
+    dryRings_[0].write(inputL, count);
+    dryRings_[1].write(inputR, count);
+    dryRings_[0].read(dryL, count);
+    dryRings_[1].read(dryR, count);
+
+    // Input chain for the new block, handed to the helper
+    for (int offset = 0; offset < numSamples; offset += SIMDOptimizer::BLOCK_SIZE) {
+        const int chunk = std::min(SIMDOptimizer::BLOCK_SIZE, numSamples - offset);
+        fdn.processInputStage(inputL + offset, inputR + offset, diffusedScratch_, chunk);
+        diffusedRing_.write(diffusedScratch_, static_cast<size_t>(chunk));
+    }
+
+    fdn_ = &fdn;
+    submitted_.store(submitted_.load(std::memory_order_relaxed) + count);
+    if (sleeping_.exchange(false)) {
+        wake_.post();
+    }
+
+    // Output chain for the block the helper finished last time (silence until
+    // the pipeline has filled)
+    const int silent = std::min(numSamples, primeRemaining_);
+    std::fill(wetL, wetL + silent, 0.0f);
+    std::fill(wetR, wetR + silent, 0.0f);
+    primeRemaining_ -= silent;
+
+    const size_t needed = count - static_cast<size_t>(silent);
+    const size_t readL = wetRings_[0].read(wetL + silent, needed);
+    const size_t readR = wetRings_[1].read(wetR + silent, needed);
+    std::fill(wetL + silent + readL, wetL + numSamples, 0.0f);  // Only if the invariant broke
+    std::fill(wetR + silent + readR, wetR + numSamples, 0.0f);
+
+    for (int offset = 0; offset < numSamples; offset += SIMDOptimizer::BLOCK_SIZE) {
+        const int chunk = std::min(SIMDOptimizer::BLOCK_SIZE, numSamples - offset);
+        fdn.processOutputStage(wetL + offset, wetR + offset, chunk);
+    }
+}
+
+// ============================================================================
+// Helper thread
+// ============================================================================
+
+void FDNPipeline::helperLoop() {
+    VM_TRACE_THREAD_NAME("fdn_pipeline");
+    while (running_.load(std::memory_order_acquire)) {
+        // Spin through the gap between callbacks, then block until the next submit
+        const auto spinUntil = std::chrono::steady_clock::now() + std::chrono::microseconds(SPIN_MICROSECONDS);
+        int spins = 0;
+        while (submitted_.load(std::memory_order_acquire) == processed_.load(std::memory_order_relaxed)) {
+            ThreadSync::cpuRelax();
+            if (++spins % SPINS_BEFORE_YIELD != 0 || std::chrono::steady_clock::now() < spinUntil) {
+                continue;
+            }
+
+            sleeping_.store(true);
+            if (submitted_.load() != processed_.load(std::memory_order_relaxed) && sleeping_.exchange(false)) {
+                break;                              // Submitted before we slept, no post coming
+            }
+            wake_.wait();
+            break;
+        }
+
+        if (!running_.load(std::memory_order_acquire)) {
+            break;
+        }
+        processPending();
+    }
+}
+
+void FDNPipeline::processPending() {
+    VM_RT_SCOPE();
+    const uint64_t target = submitted_.load(std::memory_order_acquire);
+    uint64_t done = processed_.load(std::memory_order_relaxed);
+    if (done == target) {
+        return;
+    }
+
+    FDNReverb* fdn = fdn_;
+    const auto start = std::chrono::steady_clock::now();
+    const uint64_t batch = target - done;
+
+    while (done < target) {
+        const size_t chunk = static_cast<size_t>(std::min<uint64_t>(SIMDOptimizer::BLOCK_SIZE, target - done));
+        const AudioBuffer<float>::ReadSpan span = diffusedRing_.acquireRead(chunk);
+
+        // The ring may hand the chunk back in two pieces around the wrap
+        const float* pieces[2] = { span.first, span.second };
+        const size_t sizes[2] = { span.firstSize, span.secondSize };
+        for (int p = 0; p < 2; ++p) {
+            if (sizes[p] == 0) {
+                continue;
+            }
+            const int n = static_cast<int>(sizes[p]);
+            fdn->processLoopStage(pieces[p], loopScratch_[0], loopScratch_[1], n);
+            wetRings_[0].write(loopScratch_[0], sizes[p]);
+            wetRings_[1].write(loopScratch_[1], sizes[p]);
+        }
+        diffusedRing_.commitRead(span.size());
+
+        done += span.size();
+        processed_.store(done, std::memory_order_release);
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double load = seconds * sampleRate_ / static_cast<double>(batch);
+    double average = helperLoad_.load(std::memory_order_relaxed);
+    average = (average == 0.0) ? load : average + LOAD_SMOOTHING * (load - average);
+    helperLoad_.store(average, std::memory_order_relaxed);
+    peakHelperLoad_.store(std::max(peakHelperLoad_.load(std::memory_order_relaxed), load), std::memory_order_relaxed);
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "AudioBuffer.hpp"
+#include "FDNReverb.hpp"
+#include "ThreadSync.hpp"
+
+namespace VoiceMonitor {
+
+/// Two-core pipelined processing for one heavy stereo FDNReverb
+///
+/// The recurrent loop (delay lines, feedback matrix, damping) runs on a helper
+/// thread one block behind the audio thread, which keeps the input chain
+/// (cross-feed, pre-delay, early reflections, diffusion) and the output chain
+/// (stereo spread, tone filter; the engine adds its wet/dry mix). Each callback
+/// the audio thread waits until the helper has finished the block handed over
+/// last time, runs the input chain on the new block and hands it over, then
+/// finishes the block the helper produced. The loop thereby gets a whole period
+/// of its own core, for getLatencySamples() of extra latency; process() delays
+/// the dry signal by the same amount so the mix stays aligned.
+///
+/// Blocks travel through AudioBuffer rings plus submitted/processed sample
+/// counts - no locks and no allocation after prepare(). While the helper runs,
+/// the audio thread only touches the output chain, so the FDN parameters must
+/// be changed after waitIdle() and before process().
+class FDNPipeline {
+public:
+    static constexpr int SPIN_MICROSECONDS = 100;  // Helper idle spin before it blocks
+
+    struct Statistics {
+        uint64_t blocks = 0;
+        uint64_t stalls = 0;            // Callbacks that had to wait for the helper
+        double helperLoad = 0.0;        // Loop time / audio time (smoothed)
+        double peakHelperLoad = 0.0;
+    };
+
+public:
+    FDNPipeline();
+    ~FDNPipeline();
+
+    FDNPipeline(const FDNPipeline&) = delete;
+    FDNPipeline& operator=(const FDNPipeline&) = delete;
+
+    /// Allocate the rings and start the helper (not real-time safe)
+    /// @param latencySamples Extra latency, and the largest block process() accepts
+    bool prepare(double sampleRate, int latencySamples);
+    void shutdown();
+
+    bool isPrepared() const { return running_.load(std::memory_order_acquire); }
+    int getLatencySamples() const { return latency_; }
+
+    // Audio thread
+
+    /// Wait until the helper has processed everything handed to it
+    void waitIdle();
+
+    /// Drop the blocks in flight and restart the latency with silence (calls waitIdle)
+    void reset();
+
+    /// Wet output of the block before (latency samples back), and the dry input
+    /// delayed to match. numSamples must not exceed the latency.
+    void process(FDNReverb& fdn, const float* inputL, const float* inputR,
+                 float* wetL, float* wetR, float* dryL, float* dryR, int numSamples);
+
+    Statistics getStatistics() const;
+
+private:
+    void helperLoop();
+    void processPending();
+
+    double sampleRate_;
+    int latency_;
+    int primeRemaining_;                // Audio thread: silent wet samples still owed
+
+    // Audio thread -> helper
+    AudioBuffer<float> diffusedRing_;
+    FDNReverb* fdn_;
+    alignas(64) std::atomic<uint64_t> submitted_;
+
+    // Helper -> audio thread
+    AudioBuffer<float> wetRings_[2];
+    alignas(64) std::atomic<uint64_t> processed_;
+
+    // Dry delay (audio thread only)
+    AudioBuffer<float> dryRings_[2];
+
+    alignas(SIMDOptimizer::SIMD_ALIGN) float diffusedScratch_[SIMDOptimizer::BLOCK_SIZE];
+    alignas(SIMDOptimizer::SIMD_ALIGN) float loopScratch_[2][SIMDOptimizer::BLOCK_SIZE];
+
+    std::thread helper_;
+    ThreadSync::WakeSignal wake_;
+    std::atomic<bool> sleeping_;
+    std::atomic<bool> running_;
+
+    // Published
+    std::atomic<uint64_t> blocks_;
+    std::atomic<uint64_t> stalls_;
+    std::atomic<double> helperLoad_;
+    std::atomic<double> peakHelperLoad_;
+};
+
+} // namespace VoiceMonitor
@@ -1,5 +1,6 @@
 #include "FDNReverb.hpp"
 #include "AudioMath.hpp"
+#include "DecayCalibration.hpp"
 #include <algorithm>
 #include <random>
 #include <cstring>
@@ -51,7 +52,8 @@ FDNReverb::DelayLine::DelayLine(int maxLength)
     : buffer_(maxLength, 0.0f)
     , writeIndex_(0)
     , delay_(0.0f)
-    , maxLength_(maxLength) {
+    , maxLength_(maxLength)
+    , interpolate_(true) {
 }
 
 void FDNReverb::DelayLine::setDelay(float delaySamples) {
@@ -68,17 +70,28 @@ float FDNReverb::DelayLine::process(float input) {
         readPos += maxLength_;
     }
     
-    // Linear interpolation for smooth delay
-    int readIndex = static_cast<int>(readPos);
-    float fraction = readPos - readIndex;
-    
-    int readIndex1 = readIndex;
-    int readIndex2 = (readIndex + 1) % maxLength_;
-    
-    float sample1 = buffer_[readIndex1];
-    float sample2 = buffer_[readIndex2];
-    
-    float output = sample1 + fraction * (sample2 - sample1);
+    float output;
+    if (interpolate_) {
+        // Linear interpolation for smooth delay
+        int readIndex = static_cast<int>(readPos);
+        float fraction = readPos - readIndex;
+        
+        // readPos just below maxLength_ can round up to it in float
+        int readIndex1 = readIndex < maxLength_ ? readIndex : readIndex - maxLength_;
+        int readIndex2 = (readIndex1 + 1) % maxLength_;
+        
+        float sample1 = buffer_[readIndex1];
+        float sample2 = buffer_[readIndex2];
+        
+        output = sample1 + fraction * (sample2 - sample1);
+    } else {
+        // Nearest sample (cheaper quality tiers)
+        int readIndex = static_cast<int>(readPos + 0.5f);
+        if (readIndex >= maxLength_) {
+            readIndex -= maxLength_;
+        }
+        output = buffer_[readIndex];
+    }
     
     // Advance write pointer
     writeIndex_ = (writeIndex_ + 1) % maxLength_;
@@ -86,41 +99,108 @@ float FDNReverb::DelayLine::process(float input) {
     return output;
 }
 
+float FDNReverb::DelayLine::read() const {
+    // Same read as process(), relative to the slot about to be written
+    float readPos = writeIndex_ - delay_;
+    if (readPos < 0) {
+        readPos += maxLength_;
+    }
+    
+    if (!interpolate_) {
+        int readIndex = static_cast<int>(readPos + 0.5f);
+        if (readIndex >= maxLength_) {
+            readIndex -= maxLength_;
+        }
+        return buffer_[readIndex];
+    }
+    
+    int readIndex = static_cast<int>(readPos);
+    float fraction = readPos - readIndex;
+    if (readIndex >= maxLength_) {
+        readIndex -= maxLength_;
+    }
+    int readIndex2 = (readIndex + 1) % maxLength_;
+    return buffer_[readIndex] + fraction * (buffer_[readIndex2] - buffer_[readIndex]);
+}
+
+void FDNReverb::DelayLine::write(float input) {
+    buffer_[writeIndex_] = input;
+    writeIndex_ = (writeIndex_ + 1) % maxLength_;
+}
+
 void FDNReverb::DelayLine::clear() {
     std::fill(buffer_.begin(), buffer_.end(), 0.0f);
     writeIndex_ = 0;
 }
 
-// AllPassFilter Implementation
-FDNReverb::AllPassFilter::AllPassFilter(int delayLength, float gain)
-    : delay_(delayLength)
-    , gain_(gain)
-    , lastOutput_(0.0f) {
+void FDNReverb::DelayLine::copyFrom(const DelayLine& other) {
+    copyRecentFrom(other, maxLength_);
 }
 
-float FDNReverb::AllPassFilter::process(float input) {
-    // High-quality all-pass filter implementation for professional diffusion
-    // Based on Schroeder all-pass: y[n] = -g*x[n] + x[n-d] + g*y[n-d]
+void FDNReverb::DelayLine::copyRecentFrom(const DelayLine& other, int length) {
+    if (other.maxLength_ != maxLength_) {
+        return;
+    }
     
-    // Get the delayed signal (what was written d samples ago)
-    float delayedSignal = delay_.process(0.0f);
+    // Copy the samples that precede the write position (at most two segments);
+    // everything older is left as is, so the target is expected to be clear
+    length = std::clamp(length, 0, maxLength_);
+    writeIndex_ = other.writeIndex_;
+    delay_ = other.delay_;
     
-    // Calculate all-pass output
-    float output = -gain_ * input + delayedSignal + gain_ * lastOutput_;
+    int start = writeIndex_ - length;
+    if (start < 0) {
+        start += maxLength_;
+        std::memcpy(&buffer_[start], &other.buffer_[start], (maxLength_ - start) * sizeof(float));
+        std::memcpy(buffer_.data(), other.buffer_.data(), writeIndex_ * sizeof(float));
+    } else {
+        std::memcpy(&buffer_[start], &other.buffer_[start], length * sizeof(float));
+    }
+}
+
+// AllPassFilter Implementation
+FDNReverb::AllPassFilter::AllPassFilter(int delayLength, float gain, int maxLength)
+    : buffer_(std::max({1, delayLength, maxLength}), 0.0f)
+    , length_(std::max(1, delayLength))
+    , index_(0)
+    , gain_(gain) {
+}
+
+float FDNReverb::AllPassFilter::process(float input) {
+    // Schroeder all-pass: v[n] = x[n] + g*v[n-d], y[n] = v[n-d] - g*v[n]
+    // Unity magnitude at every frequency, so the number of stages changes
+    // echo density but not the level or tone of the reverb
     
-    // Feed the input + g*output back into the delay line for next iteration
-    float feedbackSignal = input + gain_ * output;
-    delay_.process(feedbackSignal);
+    // The delayed state has to be read before this sample's write
+    float delayed = buffer_[index_];
+    float v = input + gain_ * delayed;
+    float output = delayed - gain_ * v;
     
-    // Store output for next sample's feedback
-    lastOutput_ = output;
+    buffer_[index_] = v;
+    if (++index_ >= length_) {
+        index_ = 0;
+    }
     
     return output;
 }
 
 void FDNReverb::AllPassFilter::clear() {
-    delay_.clear();
-    lastOutput_ = 0.0f;
+    std::fill(buffer_.begin(), buffer_.end(), 0.0f);
+    index_ = 0;
+}
+
+void FDNReverb::AllPassFilter::setDelayLength(int length) {
+    length_ = std::clamp(length, 1, static_cast<int>(buffer_.size()));
+    if (index_ >= length_) {
+        index_ = 0;
+    }
+}
+
+void FDNReverb::AllPassFilter::copyStateFrom(const AllPassFilter& other) {
+    if (other.buffer_.size() == buffer_.size() && other.length_ == length_) {
+        std::copy(other.buffer_.begin(), other.buffer_.end(), buffer_.begin());
+        index_ = other.index_;
+    }
 }
 
 // Professional DampingFilter Implementation with Separate HF/LF Biquads (AD 480 Style)
@@ -162,6 +242,14 @@ void FDNReverb::DampingFilter::setLFDamping(float dampingPercent, float cutoffHz
     calculateHighpassCoeffs(lfFilter_, lfCutoffHz_, lfDampingPercent_);
 }
 
+float FDNReverb::DampingFilter::getPeakGain() const {
+    // The Butterworth stages themselves peak at unity; the damping scaling is
+    // applied on top (see calculateLowpassCoeffs / calculateHighpassCoeffs)
+    const float hfGain = hfDampingPercent_ > 0.0f ? 1.0f - (hfDampingPercent_ / 100.0f) * 0.8f : 1.0f;
+    const float lfGain = lfDampingPercent_ > 0.0f ? 1.0f - (lfDampingPercent_ / 100.0f) * 0.6f : 1.0f;
+    return hfGain * lfGain;
+}
+
 void FDNReverb::DampingFilter::updateSampleRate(double sampleRate) {
     sampleRate_ = sampleRate;
     
@@ -186,7 +274,8 @@ void FDNReverb::DampingFilter::calculateLowpassCoeffs(BiquadFilter& filter, floa
         return;
     }
     
-    // Calculate digital frequency
+    // Calculate digital frequency (kept below Nyquist for a decimated loop)
+    cutoffHz = std::min(cutoffHz, 0.45f * static_cast<float>(sampleRate_));
     float omega = 2.0f * M_PI * cutoffHz / static_cast<float>(sampleRate_);
     float cos_omega = std::cos(omega);
     float sin_omega = std::sin(omega);
@@ -269,6 +358,10 @@ void FDNReverb::ModulatedDelay::setEnabled(bool enabled) {
     enabled_ = enabled;
 }
 
+void FDNReverb::ModulatedDelay::setInterpolation(bool enabled) {
+    delay_.setInterpolation(enabled);
+}
+
 float FDNReverb::ModulatedDelay::process(float input) {
     if (!enabled_ || modDepth_ <= 0.0f) {
         // No modulation: use fixed delay
@@ -292,6 +385,28 @@ float FDNReverb::ModulatedDelay::process(float input) {
     return delay_.process(input);
 }
 
+float FDNReverb::ModulatedDelay::read() {
+    if (!enabled_ || modDepth_ <= 0.0f) {
+        delay_.setDelay(baseDelay_);
+    } else {
+        // Same modulation as process(); the phase advances in write()
+        float modulation = modDepth_ * std::sin(modPhase_ + phaseOffset_);
+        delay_.setDelay(std::max(1.0f, baseDelay_ + modulation));
+    }
+    return delay_.read();
+}
+
+void FDNReverb::ModulatedDelay::write(float input) {
+    delay_.write(input);
+    
+    if (enabled_ && modDepth_ > 0.0f) {
+        modPhase_ += 2.0f * M_PI * modRate_ / sampleRate_;
+        if (modPhase_ > 2.0f * M_PI) {
+            modPhase_ -= 2.0f * M_PI;
+        }
+    }
+}
+
 void FDNReverb::ModulatedDelay::clear() {
     delay_.clear();
     modPhase_ = phaseOffset_; // Reset to initial phase offset
@@ -301,12 +416,24 @@ void FDNReverb::ModulatedDelay::updateSampleRate(double sampleRate) {
     sampleRate_ = sampleRate;
 }
 
+void FDNReverb::ModulatedDelay::copyStateFrom(const ModulatedDelay& other) {
+    // Only the span the modulated read can reach, not the whole 1 s buffer
+    const int readable = static_cast<int>(other.baseDelay_ + other.modDepth_) + 3;
+    delay_.copyRecentFrom(other.delay_, readable);
+    modPhase_ = other.modPhase_;
+}
+
 // FDNReverb Implementation
 FDNReverb::FDNReverb(double sampleRate, int numDelayLines)
-    : sampleRate_(sampleRate)
-    , numDelayLines_(std::max(4, std::min(numDelayLines, 12)))
+    : numEarlyReflections_(4) // Default: 4 early reflection stages
+    , sampleRate_(sampleRate)
+    , loopSampleRate_(sampleRate)
+    , maxDelayLines_(std::max(4, std::min(numDelayLines, MAX_DELAY_LINES)))
+    , numDelayLines_(maxDelayLines_)
+    , activeDiffusionStages_(0)
     , useInterpolation_(true)
-    , numEarlyReflections_(4) // Default: 4 early reflection stages
+    , outputGain_(1.0f)
+    , clearPosition_(maxDelayLines_ + 1)
     , lastRoomSize_(0.5f)
     , needsBufferFlush_(false)
     , decayTime_(2.0f)
@@ -319,7 +446,15 @@ FDNReverb::FDNReverb(double sampleRate, int numDelayLines)
     , modulationAmount_(1.0f)       // Full modulation amount by default
     , simdEnabled_(SIMD_AVAILABLE)  // Enable SIMD if available
     , lastCpuUsage_(0.0)
-    , coefficientsChanged_(false) { // Initialize coefficient change flag
+    , coefficientsChanged_(false)   // Initialize coefficient change flag
+    , tailDecimation_(1)            // Full-rate loop by default
+    , tailLatency_(0)
+    , tailPending_(0)
+    , outputStageEnabled_(true)
+    , stageProfile_(nullptr)
+    , trace_(nullptr)
+    , bufferFlushes_(0)
+    , coefficientUpdates_(0) {
     
     // Initialize delay lines
     delayLines_.reserve(numDelayLines_);
@@ -336,6 +471,7 @@ FDNReverb::FDNReverb(double sampleRate, int numDelayLines)
         float gain = 0.7f - (i * 0.03f); // Gradually decreasing gains for stability
         diffusionFilters_.emplace_back(std::make_unique<AllPassFilter>(diffusionPrimes[i], gain));
     }
+    activeDiffusionStages_ = diffusionStages;
     
     // Initialize damping filters with sample rate
     for (int i = 0; i < numDelayLines_; ++i) {
@@ -360,6 +496,14 @@ FDNReverb::FDNReverb(double sampleRate, int numDelayLines)
         modulatedDelays_[i]->setPhaseOffset(phaseOffset);
     }
     
+    // Early reflection all-passes, allocated for the longest delay: room size
+    // changes only re-tune them (setupEarlyReflections)
+    for (int i = 0; i < std::min(numEarlyReflections_, MAX_EARLY_REFLECTIONS); ++i) {
+        // Decreasing gain for stability: 0.75, 0.7, 0.65, 0.6
+        float gain = 0.75f - (i * 0.05f);
+        earlyReflectionFilters_.emplace_back(std::make_unique<AllPassFilter>(1, gain, MAX_EARLY_REFLECTION_DELAY));
+    }
+    
     // Initialize pre-delay
     preDelayLine_ = std::make_unique<DelayLine>(static_cast<int>(sampleRate * 0.2)); // 200ms max
     
@@ -377,6 +521,14 @@ FDNReverb::FDNReverb(double sampleRate, int numDelayLines)
     matrixOutputs_.resize(numDelayLines_);
     tempBuffer_.resize(1024); // Temp buffer for processing
     
+    // Feedback matrix (the active block is top-left) and one Householder matrix
+    // per line count, so quality switches on the audio thread only pick one
+    feedbackMatrix_.assign(maxDelayLines_, std::vector<float>(maxDelayLines_, 0.0f));
+    householderMatrices_.resize(maxDelayLines_ + 1);
+    for (int size = 4; size <= maxDelayLines_; ++size) {
+        generateHouseholderMatrix(size, householderMatrices_[size]);
+    }
+    
     // Setup delay lengths and feedback matrix
     setupDelayLengths();
     setupFeedbackMatrix();
@@ -389,47 +541,32 @@ void FDNReverb::processMono(const float* input, float* output, int numSamples) {
     // Check for room size changes and flush buffers if needed
     checkAndFlushBuffers();
     
-    for (int i = 0; i < numSamples; ++i) {
-        // Apply pre-delay
-        float preDelayedInput = preDelayLine_->process(input[i]);
-        
-        // Process through early reflections (creates initial dense cloud)
-        float earlyReflected = processEarlyReflections(preDelayedInput);
-        
-        // Process through high-density diffusion filters (all stages)
-        float diffusedInput = earlyReflected;
-        for (auto& filter : diffusionFilters_) {
-            diffusedInput = filter->process(diffusedInput);
-        }
-        
-        // Read from modulated delay lines (anti-metallic processing)
-        for (int j = 0; j < numDelayLines_; ++j) {
-            delayOutputs_[j] = modulatedDelays_[j]->process(0); // Just read, don't write yet
-        }
-        
-        // Apply feedback matrix (SIMD-optimized if enabled)
-        if (simdEnabled_) {
-            processMatrixSIMD();
-        } else {
-            processMatrix();
-        }
+    for (int offset = 0; offset < numSamples; offset += SIMDOptimizer::BLOCK_SIZE) {
+        const int chunk = std::min(SIMDOptimizer::BLOCK_SIZE, numSamples - offset);
+        float* diffused = tempSIMDBuffer_;
         
-        // Process through damping filters and write back to delays
-        float mixedOutput = 0.0f;
-        for (int j = 0; j < numDelayLines_; ++j) {
-            float dampedSignal = dampingFilters_[j]->process(matrixOutputs_[j]);
+        for (int i = 0; i < chunk; ++i) {
+            // Apply pre-delay
+            float preDelayedInput = preDelayLine_->process(input[offset + i]);
             
-            // Add input with some diffusion
-            float delayInput = diffusedInput * 0.3f + dampedSignal;
+            // Process through early reflections (creates initial dense cloud)
+            float earlyReflected = processEarlyReflections(preDelayedInput);
             
-            // Store in modulated delay line (this will be read next sample)
-            modulatedDelays_[j]->process(delayInput);
+            // Process through high-density diffusion filters (all stages)
+            float diffusedInput = earlyReflected;
+            for (int s = 0; s < activeDiffusionStages_; ++s) {
+                diffusedInput = diffusionFilters_[s]->process(diffusedInput);
+            }
             
-            // Mix to output
-            mixedOutput += dampedSignal;
+            // The stereo loop feeds its lines 0.2x the input, the mono mix 0.3x
+            diffused[i] = diffusedInput * 1.5f;
         }
         
-        output[i] = mixedOutput * 0.3f; // Scale down to prevent clipping
+        // Its two outputs split every line 0.7/0.3, so their sum is the mono mix
+        processLoopStage(diffused, diffused, blockBuffer_, chunk);
+        for (int i = 0; i < chunk; ++i) {
+            output[offset + i] = diffused[i] + blockBuffer_[i];
+        }
     }
 }
 
@@ -438,56 +575,130 @@ void FDNReverb::processStereo(const float* inputL, const float* inputR,
     // Measure processing time for CPU usage monitoring
     auto startTime = std::chrono::high_resolution_clock::now();
     
-    // Check for room size changes and flush buffers if needed
-    checkAndFlushBuffers();
-    
-    // Use pre-allocated SIMD-aligned buffers for zero-allocation processing
-    float* crossFeedL = blockBuffer_;
-    float* crossFeedR = &tempSIMDBuffer_[0];
-    
     // Ensure we don't exceed buffer size
     int processingSamples = std::min(numSamples, SIMDOptimizer::BLOCK_SIZE);
     
-    // Copy input to temporary buffers
-    std::copy(inputL, inputL + processingSamples, crossFeedL);
-    std::copy(inputR, inputR + processingSamples, crossFeedR);
-    
     // Process remaining samples if needed (shouldn't happen with 64-sample blocks)
     if (numSamples > SIMDOptimizer::BLOCK_SIZE) {
         printf("Warning: Processing %d samples exceeds BLOCK_SIZE %d\n", 
                numSamples, SIMDOptimizer::BLOCK_SIZE);
     }
     
+    // The diffused input lands in the output buffer, which the loop then overwrites
+    processInputStage(inputL, inputR, outputL, processingSamples);
+    processLoopStage(outputL, outputL, outputR, processingSamples);
+    processOutputStage(outputL, outputR, processingSamples);
+    
+    // Calculate CPU usage for performance monitoring
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
+    double processingTimeMs = duration.count() / 1000000.0;
+    
+    // Calculate expected block time (64 samples at 48kHz = 1.33ms)
+    double blockTimeMs = (processingSamples / sampleRate_) * 1000.0;
+    lastCpuUsage_ = (processingTimeMs / blockTimeMs) * 100.0;
+}
+
+void FDNReverb::processInputStage(const float* inputL, const float* inputR, float* diffused, int numSamples) {
+    VM_TRACE_BEGIN(trace_, "fdn.input_stage");
+    
+    // Check for room size changes and flush buffers if needed
+    checkAndFlushBuffers();
+    
+    VM_STAGE_CLOCK(stageProfile_);
+    VM_STAGE_SAMPLES(stageProfile_, numSamples);
+    
+    // Use pre-allocated SIMD-aligned buffers for zero-allocation processing
+    float* crossFeedL = blockBuffer_;
+    float* crossFeedR = &tempSIMDBuffer_[0];
+    
+    // Copy input to temporary buffers
+    std::copy(inputL, inputL + numSamples, crossFeedL);
+    std::copy(inputR, inputR + numSamples, crossFeedR);
+    
     // STEP 1: Apply cross-feed BEFORE reverb processing (AD 480 style)
     // This creates the L+R mixing for coherent stereo reverb
     if (crossFeedProcessor_) {
-        crossFeedProcessor_->processStereo(crossFeedL, crossFeedR, processingSamples);
+        crossFeedProcessor_->processStereo(crossFeedL, crossFeedR, numSamples);
     }
+    VM_STAGE_LAP(CrossFeed);
     
-    // STEP 2: Process both channels through separate FDN paths
-    for (int i = 0; i < processingSamples; ++i) {
-        // Use cross-fed signals for reverb input
-        float inputLeftChan = crossFeedL[i];
-        float inputRightChan = crossFeedR[i];
-        
-        // Process LEFT channel through FDN
+    // STEP 2: Pre-delay, early reflections and diffusion (the cross-fed left
+    // channel feeds the network)
+    for (int i = 0; i < numSamples; ++i) {
         // Apply pre-delay
-        float preDelayedL = preDelayLine_->process(inputLeftChan);
+        float preDelayedL = preDelayLine_->process(crossFeedL[i]);
+        VM_STAGE_LAP(PreDelay);
         
         // Process through early reflections
         float earlyReflectedL = processEarlyReflections(preDelayedL);
+        VM_STAGE_LAP(EarlyReflections);
         
         // Process through diffusion filters
         float diffusedL = earlyReflectedL;
-        for (auto& filter : diffusionFilters_) {
-            diffusedL = filter->process(diffusedL);
+        for (int s = 0; s < activeDiffusionStages_; ++s) {
+            diffusedL = diffusionFilters_[s]->process(diffusedL);
+        }
+        diffused[i] = diffusedL;
+        VM_STAGE_LAP(Diffusion);
+    }
+    VM_TRACE_END(trace_, "fdn.input_stage");
+}
+
+void FDNReverb::processLoopStage(const float* diffused, float* outputL, float* outputR, int numSamples) {
+    VM_TRACE_BEGIN(trace_, "fdn.loop_stage");
+    if (tailDecimation_ == 1) {
+        processFeedbackLoop(diffused, outputL, outputR, numSamples);
+        VM_TRACE_END(trace_, "fdn.loop_stage");
+        return;
+    }
+    
+    VM_STAGE_CLOCK(stageProfile_);
+    
+    // Multi-rate tail: decimate the whole input first (outputL may alias it)
+    int loopSamples = tailDecimators_[0].process(diffused, numSamples, tailLoopInput_);
+    if (tailDecimation_ == 4) {
+        loopSamples = tailDecimators_[1].process(tailLoopInput_, loopSamples, tailLoopInput_);
+    }
+    VM_STAGE_LAP(TailResampling);
+    
+    processFeedbackLoop(tailLoopInput_, tailLoopOutput_[0], tailLoopOutput_[1], loopSamples);
+    VM_STAGE_RESTART();
+    
+    // Back to full rate behind the samples left over from the last call (the
+    // decimators emit on the first sample of each group, so there are always
+    // enough: tailPending_ starts at factor - 1)
+    const int produced = loopSamples * tailDecimation_;
+    float* outputs[2] = { outputL, outputR };
+    for (int ch = 0; ch < 2; ++ch) {
+        float* upsampled = tailOutput_[ch] + tailPending_;
+        if (tailDecimation_ == 4) {
+            tailInterpolators_[ch][1].process(tailLoopOutput_[ch], loopSamples, tailUpsampled_);
+            tailInterpolators_[ch][0].process(tailUpsampled_, loopSamples * 2, upsampled);
+        } else {
+            tailInterpolators_[ch][0].process(tailLoopOutput_[ch], loopSamples, upsampled);
         }
         
+        std::copy(tailOutput_[ch], tailOutput_[ch] + numSamples, outputs[ch]);
+        std::copy(tailOutput_[ch] + numSamples, upsampled + produced, tailOutput_[ch]);
+    }
+    tailPending_ += produced - numSamples;
+    VM_STAGE_LAP(TailResampling);
+    VM_TRACE_END(trace_, "fdn.loop_stage");
+}
+
+void FDNReverb::processFeedbackLoop(const float* diffused, float* outputL, float* outputR, int numSamples) {
+    // STEP 3: Recurrent FDN loop (outputL may alias diffused: each sample is read before it is written)
+    VM_STAGE_CLOCK(stageProfile_);
+    for (int i = 0; i < numSamples; ++i) {
+        const float diffusedL = diffused[i];
+        
         // Read from modulated delay lines (anti-metallic processing)
         for (int j = 0; j < numDelayLines_; ++j) {
             // Use modulated delays for anti-metallic effect
-            delayOutputs_[j] = modulatedDelays_[j]->process(0);
+            delayOutputs_[j] = modulatedDelays_[j]->read();
         }
+        VM_STAGE_LAP(DelayLines);
         
         // Apply feedback matrix (SIMD-optimized if enabled)
         if (simdEnabled_) {
@@ -495,6 +706,7 @@ void FDNReverb::processStereo(const float* inputL, const float* inputR,
         } else {
             processMatrix();
         }
+        VM_STAGE_LAP(Matrix);
         
         // Process through damping and create output mix
         float leftOutput = 0.0f;
@@ -505,7 +717,7 @@ void FDNReverb::processStereo(const float* inputL, const float* inputR,
             
             // Add diffused input to modulated delay lines
             float delayInput = diffusedL * 0.2f + dampedSignal;
-            modulatedDelays_[j]->process(delayInput);
+            modulatedDelays_[j]->write(delayInput);
             
             // Create stereo image: 
             // Even delays (0,2,4,6) -> Left channel emphasis
@@ -519,31 +731,34 @@ void FDNReverb::processStereo(const float* inputL, const float* inputR,
         }
         
         // Scale output and mix with original cross-fed dry signal for natural blend
-        float reverbGain = 0.3f;
+        float reverbGain = WET_OUTPUT_GAIN * outputGain_;
         outputL[i] = leftOutput * reverbGain;
         outputR[i] = rightOutput * reverbGain;
+        VM_STAGE_LAP(Damping);
+    }
+}
+
+void FDNReverb::processOutputStage(float* outputL, float* outputR, int numSamples) {
+    if (!outputStageEnabled_) {
+        return;
     }
+    VM_TRACE_BEGIN(trace_, "fdn.output_stage");
+    VM_STAGE_CLOCK(stageProfile_);
     
-    // STEP 3: Apply stereo spread control to wet output (AD 480 "Spread")
+    // STEP 4: Apply stereo spread control to wet output (AD 480 "Spread")
     // This controls the stereo width of the wet signal only
     if (stereoSpreadProcessor_) {
-        stereoSpreadProcessor_->processStereo(outputL, outputR, processingSamples);
+        stereoSpreadProcessor_->processStereo(outputL, outputR, numSamples);
     }
+    VM_STAGE_LAP(Spread);
     
-    // STEP 4: Apply global tone filtering (AD 480 "High Cut" and "Low Cut")
+    // STEP 5: Apply global tone filtering (AD 480 "High Cut" and "Low Cut")
     // This is the final EQ stage before wet/dry mix (out-of-loop filtering)
     if (toneFilter_) {
-        toneFilter_->processStereo(outputL, outputR, processingSamples);
+        toneFilter_->processStereo(outputL, outputR, numSamples);
     }
-    
-    // Calculate CPU usage for performance monitoring
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
-    double processingTimeMs = duration.count() / 1000000.0;
-    
-    // Calculate expected block time (64 samples at 48kHz = 1.33ms)
-    double blockTimeMs = (processingSamples / sampleRate_) * 1000.0;
-    lastCpuUsage_ = (processingTimeMs / blockTimeMs) * 100.0;
+    VM_STAGE_LAP(ToneFilter);
+    VM_TRACE_END(trace_, "fdn.output_stage");
 }
 
 void FDNReverb::processMatrix() {
@@ -557,10 +772,12 @@ void FDNReverb::processMatrix() {
 }
 
 void FDNReverb::setupDelayLengths() {
-    std::vector<int> lengths(numDelayLines_);
+    // Every allocated line gets its length, active or not: changing the line
+    // count then leaves the lengths alone (runs on the audio thread, no allocation)
+    int lengths[MAX_DELAY_LINES];
     calculateDelayLengths(lengths, roomSize_);
     
-    for (int i = 0; i < numDelayLines_; ++i) {
+    for (int i = 0; i < maxDelayLines_; ++i) {
         // Set regular delay lines
         delayLines_[i]->setDelay(static_cast<float>(lengths[i]));
         
@@ -571,7 +788,7 @@ void FDNReverb::setupDelayLengths() {
             // Update modulation parameters based on current settings
             float modRate = 0.1f + (i * 0.05f); // 0.1Hz to 0.4Hz spread
             float baseDepth = 2.0f + (i * 0.5f); // 2-6 samples base depth
-            float actualDepth = baseDepth * modulationAmount_; // Scale by amount
+            float actualDepth = baseDepth * modulationAmount_ / tailDecimation_; // Same time at the loop rate
             
             modulatedDelays_[i]->setModulation(actualDepth, modRate);
             modulatedDelays_[i]->setEnabled(modulationEnabled_);
@@ -579,18 +796,19 @@ void FDNReverb::setupDelayLengths() {
     }
 }
 
-void FDNReverb::calculateDelayLengths(std::vector<int>& lengths, float baseSize) {
-    // Use optimized prime delays scaled by room size and sample rate
-    float sampleRateScale = static_cast<float>(sampleRate_) / 48000.0f;
+void FDNReverb::calculateDelayLengths(int* lengths, float baseSize) {
+    // Use optimized prime delays scaled by room size and loop sample rate
+    float sampleRateScale = static_cast<float>(loopSampleRate_) / 48000.0f;
     float roomScale = 0.5f + baseSize * 1.5f; // 0.5x to 2.0x scaling for room size
+    float minLength = 200.0f / static_cast<float>(tailDecimation_);
     
-    for (int i = 0; i < numDelayLines_; ++i) {
+    for (int i = 0; i < maxDelayLines_; ++i) {
         // Use prime delays with room size and sample rate compensation
         int primeIndex = std::min(i, static_cast<int>(PRIME_DELAYS.size() - 1));
         float scaledDelay = PRIME_DELAYS[primeIndex] * sampleRateScale * roomScale;
         
         // Ensure minimum and maximum bounds
-        lengths[i] = static_cast<int>(std::clamp(scaledDelay, 200.0f, 
+        lengths[i] = static_cast<int>(std::clamp(scaledDelay, minLength, 
                                                static_cast<float>(MAX_DELAY_LENGTH - 1)));
         
         // Add slight variation to prevent perfect alignment (reduces metallic artifacts)
@@ -601,69 +819,51 @@ void FDNReverb::calculateDelayLengths(std::vector<int>& lengths, float baseSize)
 }
 
 void FDNReverb::setupFeedbackMatrix() {
-    // Initialize feedback matrix
-    feedbackMatrix_.resize(numDelayLines_, std::vector<float>(numDelayLines_));
-    
-    // Always use Householder matrix for professional quality
-    generateHouseholderMatrix();
-    
-    // AD 480 calibrated decay time calculation
-    // Calculate average delay time for the FDN network
+    VM_TRACE_BEGIN(trace_, "fdn.coefficient_update");
+    ++coefficientUpdates_;
+    
+    // Always use Householder matrix for professional quality. It only depends on
+    // the line count: the constructor builds one per count and this rescales a
+    // copy, so decay, damping and line-count changes never regenerate it
+    // Classic RT60 formula, gain = 10^(-3 * dt / RT60) with dt the average loop
+    // delay, with dt scaled by the measured calibration (DecayCalibration) so the
+    // broadband RT60 of the tail lands on the target despite damping and diffusion
     float averageDelayTime = calculateAverageDelayTime();
+    float deltaT = averageDelayTime / static_cast<float>(loopSampleRate_); // Convert to seconds
     
     // Apply Size-dependent decay limitation (AD 480 behavior)
     float maxDecayForSize = calculateMaxDecayForSize(roomSize_);
-    float limitedDecayTime = std::min(decayTime_, maxDecayForSize);
-    
-    // Classic RT60 formula: gain = 10^(-3 * Δt / RT60)
-    // where Δt is the average delay time in the network
-    float deltaT = averageDelayTime / static_cast<float>(sampleRate_); // Convert to seconds
-    float rt60 = limitedDecayTime; // Our calibrated RT60 target
-    
-    // Prevent division by zero and ensure minimum decay
-    rt60 = std::max(rt60, 0.05f); // Minimum 50ms decay
-    
-    // Calculate theoretical decay gain
-    float theoreticalGain = std::pow(10.0f, -3.0f * deltaT / rt60);
+    float rt60 = std::max(std::min(decayTime_, maxDecayForSize), 0.05f); // Minimum 50ms decay
     
-    // AD 480 style frequency-dependent scaling
-    // High frequencies decay faster, low frequencies sustain longer
-    float hfDecayFactor = 1.0f - (highFreqDamping_ * 0.25f); // 0-25% HF reduction
-    float lfDecayFactor = 1.0f - (lowFreqDamping_ * 0.15f);  // 0-15% LF reduction
-    float freqWeightedGain = theoreticalGain * hfDecayFactor * lfDecayFactor;
+    float correction = DecayCalibration::getCorrection(rt60, roomSize_, highFreqDamping_, lowFreqDamping_,
+                                                       sampleRate_);
+    float calibratedGain = std::pow(10.0f, -3.0f * deltaT * correction / rt60);
     
-    // Stability enforcement (critical for professional quality)
-    // AD 480 uses approximately 0.97 max gain for guaranteed stability
-    float stabilityLimit = 0.97f;
+    // Stability enforcement on the whole loop (matrix and damping filters)
+    float stabilityLimit = MAX_LOOP_GAIN;
+    float finalGain = std::min(calibratedGain, stabilityLimit);
     
-    // Additional safety margin based on room size (larger rooms need more stability)
-    float sizeStabilityFactor = 0.98f - (roomSize_ * 0.03f); // 0.98 to 0.95 range
-    stabilityLimit = std::min(stabilityLimit, sizeStabilityFactor);
-    
-    float finalGain = std::min(freqWeightedGain, stabilityLimit);
-    
-    // Diagnostic output for calibration verification
+    // Diagnostic output for calibration verification (debug builds: this runs
+    // on the audio thread whenever decay, size or damping is automated)
+    #ifdef DEBUG
     printf("=== AD 480 Decay Calibration ===\n");
     printf("Target RT60: %.2f s (limited from %.2f s)\n", rt60, decayTime_);
     printf("Average delay: %.1f samples (%.2f ms)\n", averageDelayTime, deltaT * 1000.0f);
-    printf("Theoretical gain: %.6f\n", theoreticalGain);
-    printf("Freq-weighted gain: %.6f\n", freqWeightedGain);
+    printf("Calibration factor: %.4f\n", correction);
     printf("Final gain: %.6f (stability limit: %.6f)\n", finalGain, stabilityLimit);
     printf("Room size factor: %.3f\n", roomSize_);
     printf("================================\n");
+    #endif
     
-    // Scale the entire orthogonal matrix
-    for (auto& row : feedbackMatrix_) {
-        for (auto& element : row) {
-            element *= finalGain;
-        }
-    }
+    applyLoopGain(finalGain);
+    VM_TRACE_END(trace_, "fdn.coefficient_update");
     
     // Verify final matrix energy for debugging
+    #ifdef DEBUG
     float matrixEnergy = 0.0f;
-    for (const auto& row : feedbackMatrix_) {
-        for (float element : row) {
-            matrixEnergy += element * element;
+    for (int i = 0; i < numDelayLines_; ++i) {
+        for (int j = 0; j < numDelayLines_; ++j) {
+            matrixEnergy += feedbackMatrix_[i][j] * feedbackMatrix_[i][j];
         }
     }
     printf("Matrix energy after scaling: %.6f (should be < %.1f for stability)\n", 
@@ -676,9 +876,32 @@ void FDNReverb::setupFeedbackMatrix() {
     printf("  Performance Status: %s\n", 
            lastCpuUsage_ < 20.0 ? "EXCELLENT" : 
            lastCpuUsage_ < 50.0 ? "GOOD" : "NEEDS OPTIMIZATION");
+    #endif
 }
 
-void FDNReverb::generateHouseholderMatrix() {
+void FDNReverb::applyLoopGain(float loopGain) {
+    // The damping filters' passband gain is part of the loop: the matrix makes
+    // up the difference, so the calibration only sees their spectral shape
+    const float gain = loopGain / dampingFilters_[0]->getPeakGain();
+    const auto& householder = householderMatrices_[numDelayLines_];
+    
+    // Scale the active orthogonal block
+    for (int i = 0; i < numDelayLines_; ++i) {
+        for (int j = 0; j < numDelayLines_; ++j) {
+            feedbackMatrix_[i][j] = householder[i][j] * gain;
+        }
+    }
+    
+    // Contiguous row-major copy for the SIMD matrix multiply (8×8 max)
+    if (numDelayLines_ <= 8) {
+        for (int i = 0; i < numDelayLines_; ++i) {
+            std::memcpy(&cachedCoeffs_.matrixData[i * numDelayLines_], feedbackMatrix_[i].data(),
+                        numDelayLines_ * sizeof(float));
+        }
+    }
+}
+
+void FDNReverb::generateHouseholderMatrix(int size, std::vector<std::vector<float>>& matrix) {
     // Generate proper orthogonal Householder matrix for uniform energy distribution
     // This ensures no energy loss or gain in the feedback network
     
@@ -687,8 +910,8 @@ void FDNReverb::generateHouseholderMatrix() {
     std::normal_distribution<float> dist(0.0f, 1.0f);
     
     // Generate random vector for Householder reflection
-    std::vector<float> v(numDelayLines_);
-    for (int i = 0; i < numDelayLines_; ++i) {
+    std::vector<float> v(size);
+    for (int i = 0; i < size; ++i) {
         v[i] = dist(gen);
     }
     
@@ -705,10 +928,11 @@ void FDNReverb::generateHouseholderMatrix() {
     
     // Create Householder matrix H = I - 2*v*v^T
     // This creates an orthogonal matrix with determinant -1
-    for (int i = 0; i < numDelayLines_; ++i) {
-        for (int j = 0; j < numDelayLines_; ++j) {
+    matrix.assign(size, std::vector<float>(size));
+    for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) {
             float identity = (i == j) ? 1.0f : 0.0f;
-            feedbackMatrix_[i][j] = identity - 2.0f * v[i] * v[j];
+            matrix[i][j] = identity - 2.0f * v[i] * v[j];
         }
     }
     
@@ -716,11 +940,11 @@ void FDNReverb::generateHouseholderMatrix() {
     #ifdef DEBUG
     // Calculate H * H^T to verify it equals identity matrix
     float maxError = 0.0f;
-    for (int i = 0; i < numDelayLines_; ++i) {
-        for (int j = 0; j < numDelayLines_; ++j) {
+    for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) {
             float dot = 0.0f;
-            for (int k = 0; k < numDelayLines_; ++k) {
-                dot += feedbackMatrix_[i][k] * feedbackMatrix_[j][k];
+            for (int k = 0; k < size; ++k) {
+                dot += matrix[i][k] * matrix[j][k];
             }
             float expected = (i == j) ? 1.0f : 0.0f;
             maxError = std::max(maxError, std::abs(dot - expected));
@@ -732,30 +956,43 @@ void FDNReverb::generateHouseholderMatrix() {
 }
 
 // Parameter setters
+//
+// The engine applies its parameters every block: setters that rebuild state
+// only do so when the value actually changes
 void FDNReverb::setDecayTime(float decayTimeSeconds) {
-    decayTime_ = std::max(0.1f, std::min(decayTimeSeconds, 10.0f));
+    const float newDecay = std::max(0.1f, std::min(decayTimeSeconds, 10.0f));
+    if (newDecay == decayTime_) {
+        return;
+    }
+    decayTime_ = newDecay;
     setupFeedbackMatrix(); // Recalculate matrix with new decay
 }
 
 void FDNReverb::setPreDelay(float preDelaySamples) {
     preDelay_ = std::max(0.0f, std::min(preDelaySamples, float(sampleRate_ * 0.2f)));
-    preDelayLine_->setDelay(preDelay_);
+    preDelayLine_->setDelay(std::max(0.0f, preDelay_ - static_cast<float>(tailLatency_)));
 }
 
 void FDNReverb::setRoomSize(float size) {
     float newSize = std::clamp(size, 0.0f, 1.0f);
+    if (newSize == roomSize_) {
+        return;
+    }
     
     // Check if this is a significant change that requires buffer flush
     if (std::abs(newSize - roomSize_) > ROOM_SIZE_CHANGE_THRESHOLD) {
+        #ifdef DEBUG
         printf("Significant room size change: %.3f -> %.3f\n", roomSize_, newSize);
+        #endif
         needsBufferFlush_ = true;
     }
     
     roomSize_ = newSize;
     
-    // Reconfigure delay lengths and early reflections
+    // Reconfigure delay lengths and early reflections; the loop gain follows the delays
     setupDelayLengths();
     setupEarlyReflections();
+    setupFeedbackMatrix();
 }
 
 void FDNReverb::setDensity(float density) {
@@ -768,7 +1005,11 @@ void FDNReverb::setDensity(float density) {
 }
 
 void FDNReverb::setHighFreqDamping(float damping) {
-    highFreqDamping_ = std::clamp(damping, 0.0f, 1.0f);
+    const float newDamping = std::clamp(damping, 0.0f, 1.0f);
+    if (newDamping == highFreqDamping_ && dampingFilters_[0]->getHFDamping() == newDamping * 100.0f) {
+        return;
+    }
+    highFreqDamping_ = newDamping;
     
     // Convert damping percentage to cutoff frequency (AD 480 style)
     // damping 0% = 12kHz cutoff (no damping), 100% = 1kHz cutoff (heavy damping)
@@ -779,11 +1020,18 @@ void FDNReverb::setHighFreqDamping(float damping) {
         filter->setHFDamping(highFreqDamping_ * 100.0f, cutoffHz);
     }
     
+    #ifdef DEBUG
     printf("HF Damping: %.1f%% (cutoff: %.0f Hz)\n", highFreqDamping_ * 100.0f, cutoffHz);
+    #endif
+    setupFeedbackMatrix(); // Frequency-weighted loop gain
 }
 
 void FDNReverb::setLowFreqDamping(float damping) {
-    lowFreqDamping_ = std::clamp(damping, 0.0f, 1.0f);
+    const float newDamping = std::clamp(damping, 0.0f, 1.0f);
+    if (newDamping == lowFreqDamping_ && dampingFilters_[0]->getLFDamping() == newDamping * 100.0f) {
+        return;
+    }
+    lowFreqDamping_ = newDamping;
     
     // Convert damping percentage to cutoff frequency (AD 480 style)
     // damping 0% = 50Hz cutoff (no LF damping), 100% = 500Hz cutoff (heavy LF damping)
@@ -794,7 +1042,10 @@ void FDNReverb::setLowFreqDamping(float damping) {
         filter->setLFDamping(lowFreqDamping_ * 100.0f, cutoffHz);
     }
     
+    #ifdef DEBUG
     printf("LF Damping: %.1f%% (cutoff: %.0f Hz)\n", lowFreqDamping_ * 100.0f, cutoffHz);
+    #endif
+    setupFeedbackMatrix(); // Frequency-weighted loop gain
 }
 
 // Advanced stereo control methods (AD 480 style)
@@ -879,7 +1130,10 @@ void FDNReverb::setModulationEnabled(bool enabled) {
         delay->setEnabled(enabled);
     }
     
+    // Quality tiers toggle this on the audio thread
+    #ifdef DEBUG
     printf("Anti-metallic modulation: %s\n", enabled ? "ENABLED" : "DISABLED");
+    #endif
 }
 
 void FDNReverb::setModulationAmount(float amount) {
@@ -889,12 +1143,14 @@ void FDNReverb::setModulationAmount(float amount) {
     for (int i = 0; i < modulatedDelays_.size(); ++i) {
         float modRate = 0.1f + (i * 0.05f); // 0.1Hz to 0.4Hz spread
         float baseDepth = 2.0f + (i * 0.5f); // 2-6 samples base depth
-        float actualDepth = baseDepth * modulationAmount_;
+        float actualDepth = baseDepth * modulationAmount_ / tailDecimation_;
         
         modulatedDelays_[i]->setModulation(actualDepth, modRate);
     }
     
+    #ifdef DEBUG
     printf("Anti-metallic modulation amount: %.1f%%\n", modulationAmount_ * 100.0f);
+    #endif
 }
 
 void FDNReverb::reset() {
@@ -934,13 +1190,16 @@ void FDNReverb::clear() {
     
     std::fill(delayOutputs_.begin(), delayOutputs_.end(), 0.0f);
     std::fill(matrixOutputs_.begin(), matrixOutputs_.end(), 0.0f);
+    resetTailConverters();
+    clearPosition_ = maxDelayLines_ + 1;
 }
 
 void FDNReverb::updateSampleRate(double sampleRate) {
     sampleRate_ = sampleRate;
+    loopSampleRate_ = sampleRate_ / tailDecimation_;
     
     for (auto& delay : modulatedDelays_) {
-        delay->updateSampleRate(sampleRate);
+        delay->updateSampleRate(loopSampleRate_);
     }
     
     // Update cross-feed processor with new sample rate
@@ -948,9 +1207,9 @@ void FDNReverb::updateSampleRate(double sampleRate) {
         crossFeedProcessor_->updateSampleRate(sampleRate);
     }
     
-    // Update damping filters with new sample rate
+    // Update damping filters with new sample rate (they run in the loop)
     for (auto& filter : dampingFilters_) {
-        filter->updateSampleRate(sampleRate);
+        filter->updateSampleRate(loopSampleRate_);
     }
     
     // Update tone filter with new sample rate
@@ -961,6 +1220,161 @@ void FDNReverb::updateSampleRate(double sampleRate) {
     reset(); // Recalculate everything for new sample rate
 }
 
+// Quality tiers (driven by QualityGovernor through ReverbEngine)
+void FDNReverb::setDiffusionStages(int stages) {
+    const int newStages = std::clamp(stages, 0, static_cast<int>(diffusionFilters_.size()));
+    
+    // Stages coming back in start from silence rather than stale state
+    for (int s = activeDiffusionStages_; s < newStages; ++s) {
+        diffusionFilters_[s]->clear();
+    }
+    activeDiffusionStages_ = newStages;
+}
+
+void FDNReverb::setInterpolation(bool enabled) {
+    useInterpolation_ = enabled;
+    for (auto& delay : modulatedDelays_) {
+        delay->setInterpolation(enabled);
+    }
+}
+
+void FDNReverb::setActiveDelayLines(int numLines) {
+    const int newLines = std::clamp(numLines, 4, maxDelayLines_);
+    if (newLines == numDelayLines_) {
+        return;
+    }
+    
+    for (int i = numDelayLines_; i < newLines; ++i) {
+        delayLines_[i]->clear();
+        modulatedDelays_[i]->clear();
+        dampingFilters_[i]->clear();
+    }
+    numDelayLines_ = newLines;
+    
+    // Fewer uncorrelated lines sum to a lower level; keep the wet level constant
+    outputGain_ = std::sqrt(static_cast<float>(maxDelayLines_) / static_cast<float>(numDelayLines_));
+    
+    // Line lengths and Householder matrices were set up for every count in
+    // advance: only the loop gain follows the new average delay
+    setupFeedbackMatrix();
+}
+
+void FDNReverb::setTailDecimation(int factor) {
+    const int newFactor = factor >= 4 ? 4 : (factor >= 2 ? 2 : 1);
+    if (newFactor == tailDecimation_) {
+        return;
+    }
+    tailDecimation_ = newFactor;
+    loopSampleRate_ = sampleRate_ / tailDecimation_;
+    
+    // Delay lengths, modulation and damping are per loop sample: the old tail is
+    // meaningless. This runs on the audio thread and allocates nothing; delayLines_
+    // only feed generateImpulseResponse, which clears them itself.
+    for (int i = 0; i < maxDelayLines_; ++i) {
+        modulatedDelays_[i]->clear();
+        modulatedDelays_[i]->updateSampleRate(loopSampleRate_);
+        dampingFilters_[i]->clear();
+        dampingFilters_[i]->updateSampleRate(loopSampleRate_);
+    }
+    std::fill(delayOutputs_.begin(), delayOutputs_.end(), 0.0f);
+    std::fill(matrixOutputs_.begin(), matrixOutputs_.end(), 0.0f);
+    resetTailConverters();
+    
+    // Half-band delay of each decimation stage and its matching interpolation stage
+    // (2 * GROUP_DELAY at the stage's input rate), plus the pending samples
+    tailLatency_ = (tailDecimation_ - 1) * (2 * HalfBandFilter::GROUP_DELAY + 1);
+    setPreDelay(preDelay_);
+    
+    setupDelayLengths();
+    setupFeedbackMatrix();
+}
+
+void FDNReverb::resetTailConverters() {
+    for (auto& decimator : tailDecimators_) {
+        decimator.reset();
+    }
+    for (auto& channel : tailInterpolators_) {
+        channel[0].reset();
+        channel[1].reset();
+    }
+    
+    // Carried-over output starts as factor - 1 samples of silence (see processLoopStage)
+    tailPending_ = tailDecimation_ - 1;
+    std::fill(tailOutput_[0], tailOutput_[0] + tailPending_, 0.0f);
+    std::fill(tailOutput_[1], tailOutput_[1] + tailPending_, 0.0f);
+}
+
+void FDNReverb::copyStateFrom(const FDNReverb& other) {
+    // Windowed copies below assume everything outside the window is silent, and
+    // finishing a pending clear here would be a multi-megabyte wipe on the audio thread
+    if (&other == this || other.maxDelayLines_ != maxDelayLines_ ||
+        other.tailDecimation_ != tailDecimation_ || !isCleared()) {
+        return;
+    }
+    
+    const int sharedLines = std::min(numDelayLines_, other.numDelayLines_);
+    for (int i = 0; i < sharedLines; ++i) {
+        modulatedDelays_[i]->copyStateFrom(*other.modulatedDelays_[i]);
+        *dampingFilters_[i] = *other.dampingFilters_[i];
+    }
+    
+    for (size_t i = 0; i < diffusionFilters_.size() && i < other.diffusionFilters_.size(); ++i) {
+        diffusionFilters_[i]->copyStateFrom(*other.diffusionFilters_[i]);
+    }
+    for (size_t i = 0; i < earlyReflectionFilters_.size() && i < other.earlyReflectionFilters_.size(); ++i) {
+        earlyReflectionFilters_[i]->copyStateFrom(*other.earlyReflectionFilters_[i]);
+    }
+    
+    preDelayLine_->copyRecentFrom(*other.preDelayLine_, static_cast<int>(other.preDelay_) + 2);
+    crossFeedProcessor_->copyStateFrom(*other.crossFeedProcessor_);
+    *toneFilter_ = *other.toneFilter_;
+    
+    std::copy(std::begin(other.tailDecimators_), std::end(other.tailDecimators_), std::begin(tailDecimators_));
+    for (int ch = 0; ch < 2; ++ch) {
+        tailInterpolators_[ch][0] = other.tailInterpolators_[ch][0];
+        tailInterpolators_[ch][1] = other.tailInterpolators_[ch][1];
+        std::copy(other.tailOutput_[ch], other.tailOutput_[ch] + other.tailPending_, tailOutput_[ch]);
+    }
+    tailPending_ = other.tailPending_;
+    
+    // Adopt the flush state too, or the first block would wipe the copied tail
+    lastRoomSize_ = other.lastRoomSize_;
+    needsBufferFlush_ = other.needsBufferFlush_;
+    clearPosition_ = maxDelayLines_ + 1;
+}
+
+void FDNReverb::beginIncrementalClear() {
+    clearPosition_ = 0;
+}
+
+bool FDNReverb::clearIncremental() {
+    if (clearPosition_ > maxDelayLines_) {
+        return true;
+    }
+    
+    if (clearPosition_ < maxDelayLines_) {
+        // One line per step: the 1 s modulated buffer dominates the cost.
+        // delayLines_ only feed generateImpulseResponse, which clears them itself.
+        modulatedDelays_[clearPosition_]->clear();
+        dampingFilters_[clearPosition_]->clear();
+    } else {
+        for (auto& filter : diffusionFilters_) {
+            filter->clear();
+        }
+        for (auto& filter : earlyReflectionFilters_) {
+            filter->clear();
+        }
+        preDelayLine_->clear();
+        crossFeedProcessor_->clear();
+        toneFilter_->clear();
+        std::fill(delayOutputs_.begin(), delayOutputs_.end(), 0.0f);
+        std::fill(matrixOutputs_.begin(), matrixOutputs_.end(), 0.0f);
+        resetTailConverters();
+    }
+    
+    return ++clearPosition_ > maxDelayLines_;
+}
+
 // Professional CrossFeedProcessor Implementation (AD 480 Style)
 FDNReverb::CrossFeedProcessor::CrossFeedProcessor(double sampleRate)
     : crossFeedAmount_(0.5f)          // Default 50% cross-feed (AD 480 default)
@@ -1081,6 +1495,11 @@ void FDNReverb::CrossFeedProcessor::clear() {
     if (crossDelayR_) crossDelayR_->clear();
 }
 
+void FDNReverb::CrossFeedProcessor::copyStateFrom(const CrossFeedProcessor& other) {
+    if (crossDelayL_ && other.crossDelayL_) crossDelayL_->copyFrom(*other.crossDelayL_);
+    if (crossDelayR_ && other.crossDelayR_) crossDelayR_->copyFrom(*other.crossDelayR_);
+}
+
 void FDNReverb::CrossFeedProcessor::updateDelayLengths() {
     // Convert milliseconds to samples
     float delaySamples = (crossDelayMs_ / 1000.0f) * static_cast<float>(sampleRate_);
@@ -1173,7 +1592,8 @@ void FDNReverb::printFDNConfiguration() const {
     printf("\n=== FDN Reverb Configuration ===\n");
     printf("Delay Lines: %d\n", numDelayLines_);
     printf("Sample Rate: %.1f Hz\n", sampleRate_);
-    printf("Diffusion Stages: %zu\n", diffusionFilters_.size());
+    printf("Delay Lines Allocated: %d\n", maxDelayLines_);
+    printf("Diffusion Stages: %d of %zu\n", activeDiffusionStages_, diffusionFilters_.size());
     printf("Early Reflections: %zu stages\n", earlyReflectionFilters_.size());
     printf("Room Size: %.2f (last: %.2f)\n", roomSize_, lastRoomSize_);
     printf("Decay Time: %.2f s\n", decayTime_);
@@ -1201,14 +1621,13 @@ void FDNReverb::printFDNConfiguration() const {
     }
     
     printf("\nFeedback Matrix Properties:\n");
-    printf("  Matrix Size: %dx%d\n", static_cast<int>(feedbackMatrix_.size()), 
-           feedbackMatrix_.empty() ? 0 : static_cast<int>(feedbackMatrix_[0].size()));
+    printf("  Matrix Size: %dx%d\n", numDelayLines_, numDelayLines_);
     
     // Calculate matrix energy
     float matrixEnergy = 0.0f;
-    for (const auto& row : feedbackMatrix_) {
-        for (float element : row) {
-            matrixEnergy += element * element;
+    for (int i = 0; i < numDelayLines_ && i < static_cast<int>(feedbackMatrix_.size()); ++i) {
+        for (int j = 0; j < numDelayLines_; ++j) {
+            matrixEnergy += feedbackMatrix_[i][j] * feedbackMatrix_[i][j];
         }
     }
     printf("  Matrix Energy: %.6f (should be ≈ %d for orthogonal)\n", matrixEnergy, numDelayLines_);
@@ -1217,12 +1636,12 @@ void FDNReverb::printFDNConfiguration() const {
 }
 
 bool FDNReverb::verifyMatrixOrthogonality() const {
-    if (feedbackMatrix_.empty() || feedbackMatrix_.size() != feedbackMatrix_[0].size()) {
+    if (static_cast<int>(feedbackMatrix_.size()) < numDelayLines_) {
         return false;
     }
     
     const float tolerance = 1e-4f;
-    int n = static_cast<int>(feedbackMatrix_.size());
+    int n = numDelayLines_;
     
     // Check if H * H^T = I (within tolerance)
     for (int i = 0; i < n; ++i) {
@@ -1246,13 +1665,15 @@ std::vector<int> FDNReverb::getCurrentDelayLengths() const {
     std::vector<int> lengths(numDelayLines_);
     
     // Reconstruct the delay lengths using the same calculation as setupDelayLengths
-    float sampleRateScale = static_cast<float>(sampleRate_) / 48000.0f;
+    // (samples at the loop rate)
+    float sampleRateScale = static_cast<float>(loopSampleRate_) / 48000.0f;
     float roomScale = 0.5f + roomSize_ * 1.5f;
+    float minLength = 200.0f / static_cast<float>(tailDecimation_);
     
     for (int i = 0; i < numDelayLines_; ++i) {
         int primeIndex = std::min(i, static_cast<int>(PRIME_DELAYS.size() - 1));
         float scaledDelay = PRIME_DELAYS[primeIndex] * sampleRateScale * roomScale;
-        lengths[i] = static_cast<int>(std::clamp(scaledDelay, 200.0f, 
+        lengths[i] = static_cast<int>(std::clamp(scaledDelay, minLength, 
                                                static_cast<float>(MAX_DELAY_LENGTH - 1)));
         if (i > 0) {
             lengths[i] += (i % 3) - 1; // Same variation as in calculateDelayLengths
@@ -1264,25 +1685,37 @@ std::vector<int> FDNReverb::getCurrentDelayLengths() const {
 
 // Early Reflections Implementation
 void FDNReverb::setupEarlyReflections() {
-    // Clear existing early reflection filters
-    earlyReflectionFilters_.clear();
+    // Scale delay lengths by room size and sample rate
+    const int numStages = std::min(static_cast<int>(earlyReflectionFilters_.size()),
+                                   static_cast<int>(EARLY_REFLECTION_DELAYS.size()));
+    const float sampleRateScale = static_cast<float>(sampleRate_) / 48000.0f;
+    const float roomScale = 0.3f + roomSize_ * 0.7f; // 0.3x to 1.0x scaling for early reflections
     
-    // Create early reflection all-pass filters
-    for (int i = 0; i < numEarlyReflections_ && i < EARLY_REFLECTION_DELAYS.size(); ++i) {
-        // Scale delay lengths by room size and sample rate
-        float sampleRateScale = static_cast<float>(sampleRate_) / 48000.0f;
-        float roomScale = 0.3f + roomSize_ * 0.7f; // 0.3x to 1.0x scaling for early reflections
-        
-        int scaledDelay = static_cast<int>(EARLY_REFLECTION_DELAYS[i] * sampleRateScale * roomScale);
-        scaledDelay = std::clamp(scaledDelay, 10, 2400); // 10 samples to 50ms max
-        
-        // Decreasing gain for stability: 0.7, 0.65, 0.6, 0.55
-        float gain = 0.75f - (i * 0.05f);
-        
-        earlyReflectionFilters_.emplace_back(std::make_unique<AllPassFilter>(scaledDelay, gain));
+    auto scaledDelay = [&](int stage) {
+        const int delay = static_cast<int>(EARLY_REFLECTION_DELAYS[stage] * sampleRateScale * roomScale);
+        return std::clamp(delay, 10, MAX_EARLY_REFLECTION_DELAY); // 10 samples to 50ms max
+    };
+    
+    bool unchanged = true;
+    for (int i = 0; i < numStages && unchanged; ++i) {
+        unchanged = earlyReflectionFilters_[i]->getDelayLength() == scaledDelay(i);
+    }
+    
+    // Small size moves often round to the same lengths: keep the filters' state
+    if (unchanged) {
+        return;
     }
     
-    printf("Early Reflections: %d stages configured\n", static_cast<int>(earlyReflectionFilters_.size()));
+    // Re-tune within the buffers allocated at construction (this runs on the
+    // audio thread for room size automation) and restart them from silence
+    for (int i = 0; i < numStages; ++i) {
+        earlyReflectionFilters_[i]->setDelayLength(scaledDelay(i));
+        earlyReflectionFilters_[i]->clear();
+    }
+    
+    #ifdef DEBUG
+    printf("Early Reflections: %d stages configured\n", numStages);
+    #endif
 }
 
 float FDNReverb::processEarlyReflections(float input) {
@@ -1300,9 +1733,12 @@ void FDNReverb::checkAndFlushBuffers() {
     float sizeDelta = std::abs(roomSize_ - lastRoomSize_);
     
     if (sizeDelta > ROOM_SIZE_CHANGE_THRESHOLD) {
+        // Audio thread: diagnostics in debug builds only
+        #ifdef DEBUG
         printf("Room size change detected: %.3f -> %.3f (delta: %.3f)\n", 
                lastRoomSize_, roomSize_, sizeDelta);
         printf("Flushing all buffers to prevent artifacts...\n");
+        #endif
         
         needsBufferFlush_ = true;
         lastRoomSize_ = roomSize_;
@@ -1317,6 +1753,8 @@ void FDNReverb::checkAndFlushBuffers() {
 void FDNReverb::flushAllBuffers() {
     // Flush all delay line buffers to prevent artifacts from size changes
     // This is critical for professional quality as noted in AD 480 manual
+    VM_TRACE_BEGIN(trace_, "fdn.flush_buffers");
+    ++bufferFlushes_;
     
     // Clear main FDN delay lines
     for (auto& delay : delayLines_) {
@@ -1361,8 +1799,12 @@ void FDNReverb::flushAllBuffers() {
     // Clear processing buffers
     std::fill(delayOutputs_.begin(), delayOutputs_.end(), 0.0f);
     std::fill(matrixOutputs_.begin(), matrixOutputs_.end(), 0.0f);
+    resetTailConverters();
+    VM_TRACE_END(trace_, "fdn.flush_buffers");
     
+    #ifdef DEBUG
     printf("All buffers flushed successfully\n");
+    #endif
 }
 
 // AD 480 Calibration Helper Methods
@@ -1370,8 +1812,9 @@ float FDNReverb::calculateAverageDelayTime() {
     // Calculate the average delay time across all FDN delay lines
     // This is critical for accurate RT60 calibration
     
-    float sampleRateScale = static_cast<float>(sampleRate_) / 48000.0f;
+    float sampleRateScale = static_cast<float>(loopSampleRate_) / 48000.0f;
     float roomScale = 0.5f + roomSize_ * 1.5f; // Same scaling as in calculateDelayLengths
+    float minLength = 200.0f / static_cast<float>(tailDecimation_);
     
     float totalDelay = 0.0f;
     for (int i = 0; i < numDelayLines_; ++i) {
@@ -1379,7 +1822,7 @@ float FDNReverb::calculateAverageDelayTime() {
         float scaledDelay = PRIME_DELAYS[primeIndex] * sampleRateScale * roomScale;
         
         // Apply the same bounds and variations as in calculateDelayLengths
-        scaledDelay = std::clamp(scaledDelay, 200.0f, static_cast<float>(MAX_DELAY_LENGTH - 1));
+        scaledDelay = std::clamp(scaledDelay, minLength, static_cast<float>(MAX_DELAY_LENGTH - 1));
         if (i > 0) {
             scaledDelay += (i % 3) - 1; // Same variation pattern
         }
@@ -1437,8 +1880,21 @@ std::vector<float> FDNReverb::generateImpulseResponse(int lengthSamples) {
     // Generate impulse (single sample at maximum amplitude)
     float impulse = 1.0f;
     
+    // A decimated loop only exists in the block path (modulated lines)
+    int inlineSamples = lengthSamples;
+    if (tailDecimation_ > 1) {
+        std::fill(tempBuffer_.begin(), tempBuffer_.end(), 0.0f);
+        tempBuffer_[0] = impulse;
+        for (int offset = 0; offset < lengthSamples; offset += SIMDOptimizer::BLOCK_SIZE) {
+            const int chunk = std::min(SIMDOptimizer::BLOCK_SIZE, lengthSamples - offset);
+            processMono(tempBuffer_.data(), impulseResponse.data() + offset, chunk);
+            tempBuffer_[0] = 0.0f;
+        }
+        inlineSamples = 0;
+    }
+    
     // Process the impulse and subsequent silence
-    for (int i = 0; i < lengthSamples; ++i) {
+    for (int i = 0; i < inlineSamples; ++i) {
         float input = (i == 0) ? impulse : 0.0f; // Impulse only on first sample
         
         // Process single sample (same logic as processMono but inline)
@@ -1451,13 +1907,13 @@ std::vector<float> FDNReverb::generateImpulseResponse(int lengthSamples) {
         
         // Process through diffusion filters
         float diffusedInput = earlyReflected;
-        for (auto& filter : diffusionFilters_) {
-            diffusedInput = filter->process(diffusedInput);
+        for (int s = 0; s < activeDiffusionStages_; ++s) {
+            diffusedInput = diffusionFilters_[s]->process(diffusedInput);
         }
         
         // Read from delay lines
         for (int j = 0; j < numDelayLines_; ++j) {
-            delayOutputs_[j] = delayLines_[j]->process(0); // Just read
+            delayOutputs_[j] = delayLines_[j]->read(); // Read now, write after the matrix
         }
         
         // Apply feedback matrix
@@ -1470,13 +1926,13 @@ std::vector<float> FDNReverb::generateImpulseResponse(int lengthSamples) {
             
             // Add input with diffusion
             float delayInput = diffusedInput * 0.3f + dampedSignal;
-            delayLines_[j]->process(delayInput);
+            delayLines_[j]->write(delayInput);
             
             // Mix to output
             mixedOutput += dampedSignal;
         }
         
-        impulseResponse[i] = mixedOutput * 0.3f; // Same scaling as processMono
+        impulseResponse[i] = mixedOutput * WET_OUTPUT_GAIN * outputGain_; // Same scaling as processMono
     }
     
     // Restore previous state
@@ -1847,8 +2303,8 @@ void SIMDOptimizer::matrixMultiplyBlock(const float* input, float* output,
         int simdSize = (size / 4) * 4;
         
         for (int j = 0; j < simdSize; j += 4) {
-            __m128 vm = _mm_load_ps(&matrixRow[j]);
-            __m128 vi = _mm_load_ps(&input[j]);
+            __m128 vm = _mm_loadu_ps(&matrixRow[j]);
+            __m128 vi = _mm_loadu_ps(&input[j]);
             vsum = _mm_add_ps(vsum, _mm_mul_ps(vm, vi));
         }
         
@@ -1924,7 +2380,9 @@ double SIMDOptimizer::measureBlockProcessingTime(std::function<void()> processFu
 
 void FDNReverb::setSIMDEnabled(bool enabled) {
     simdEnabled_ = enabled && SIMD_AVAILABLE;
+#ifdef DEBUG
     printf("SIMD optimizations: %s\n", simdEnabled_ ? "ENABLED" : "DISABLED");
+#endif
 }
 
 void FDNReverb::enableBlockOptimizations(bool enabled) {
@@ -1933,10 +2391,10 @@ void FDNReverb::enableBlockOptimizations(bool enabled) {
 }
 
 void FDNReverb::processMatrixSIMD() {
-    if (simdEnabled_ && numDelayLines_ >= 4) {
-        // Use SIMD-optimized matrix multiplication
+    if (simdEnabled_ && numDelayLines_ >= 4 && numDelayLines_ <= 8) {
+        // Use SIMD-optimized matrix multiplication on the contiguous matrix copy
         SIMDOptimizer::matrixMultiplyBlock(delayOutputs_.data(), matrixOutputs_.data(),
-                                          feedbackMatrix_[0].data(), numDelayLines_);
+                                          cachedCoeffs_.matrixData, numDelayLines_);
     } else {
         // Fall back to regular matrix processing
         processMatrix();
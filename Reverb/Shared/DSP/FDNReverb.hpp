@@ -6,6 +6,9 @@
 #include <atomic>
 #include <functional>
 #include <chrono>
+#include "HalfBandFilter.hpp"
+#include "StageProfile.hpp"
+#include "TraceBuffer.hpp"
 
 // SIMD optimization headers
 #ifdef __ARM_NEON__
@@ -80,10 +83,25 @@ private:
 
 /// High-quality FDN (Feedback Delay Network) reverb implementation
 /// Based on professional reverb algorithms similar to AD 480 with SIMD optimizations
+class ComponentBenchmark;   // Tools/ComponentBenchmark.cpp
+class LfoSoak;              // Tools/SoakTest.cpp
+class RT60Calibration;      // Tools/RT60Calibration.cpp
+
 class FDNReverb {
+    // Times the nested building blocks and matrix kernels on their own
+    friend class ComponentBenchmark;
+    // Follows one loop LFO through a whole soak session
+    friend class LfoSoak;
+    // Sets the loop gain directly while measuring RT60 for DecayCalibration
+    friend class RT60Calibration;
+    
 public:
     static constexpr int DEFAULT_DELAY_LINES = 8;
+    static constexpr int MAX_DELAY_LINES = 12;     // Most lines a network can be constructed with
     static constexpr int MAX_DELAY_LENGTH = 96000; // 1 second at 96kHz
+    static constexpr float WET_OUTPUT_GAIN = 10.0f; // Typical rooms land around -12 dB re input
+    static constexpr int MAX_TAIL_DECIMATION = 4;
+    static constexpr float MAX_LOOP_GAIN = 0.995f;  // Matrix gain x damping filter passband gain
     
 private:
     // Delay line with interpolation
@@ -91,28 +109,40 @@ private:
     public:
         DelayLine(int maxLength);
         void setDelay(float delaySamples);
+        void setInterpolation(bool enabled) { interpolate_ = enabled; } // Linear or nearest-sample read
         float process(float input);
+        float read() const;         // Sample `delay` samples before the next write
+        void write(float input);
         void clear();
         
+        // State transfer between instances of the same length (no allocation)
+        void copyFrom(const DelayLine& other);
+        void copyRecentFrom(const DelayLine& other, int length); // Only the last `length` samples
+        
     private:
         std::vector<float> buffer_;
         int writeIndex_;
         float delay_;
         int maxLength_;
+        bool interpolate_;
     };
     
     // All-pass filter for diffusion
     class AllPassFilter {
     public:
-        AllPassFilter(int delayLength, float gain = 0.7f);
+        AllPassFilter(int delayLength, float gain = 0.7f, int maxLength = 0); // maxLength: room for setDelayLength
         float process(float input);
         void clear();
         void setGain(float gain) { gain_ = gain; }
+        void setDelayLength(int length);    // Up to the allocated length; does not clear the state
+        int getDelayLength() const { return length_; }
+        void copyStateFrom(const AllPassFilter& other);
         
     private:
-        DelayLine delay_;
+        std::vector<float> buffer_; // Integer delay of length_ samples, read before write
+        int length_;
+        int index_;
         float gain_;
-        float lastOutput_; // State for all-pass feedback
     };
     
     // Professional damping filter with separate HF/LF biquads (AD 480 style)
@@ -130,6 +160,7 @@ private:
         float getLFCutoff() const { return lfCutoffHz_; }
         float getHFDamping() const { return hfDampingPercent_; }
         float getLFDamping() const { return lfDampingPercent_; }
+        float getPeakGain() const;      // Passband gain of both stages (their damping scaling)
         
     private:
         // Professional biquad filter implementation
@@ -181,14 +212,19 @@ private:
         void setModulation(float depth, float rate);
         void setPhaseOffset(float phaseRadians);  // For desynchronized LFOs
         void setEnabled(bool enabled);            // Enable/disable modulation
+        void setInterpolation(bool enabled);      // Linear or nearest-sample modulated read
         float process(float input);
+        float read();                             // FDN loop: read the line output...
+        void write(float input);                  // ...then feed it, once per sample
         void clear();
         void updateSampleRate(double sampleRate);
+        void copyStateFrom(const ModulatedDelay& other); // Readable history and LFO phase
         
         // Getters for current state
         bool isEnabled() const { return enabled_; }
         float getModDepth() const { return modDepth_; }
         float getModRate() const { return modRate_; }
+        float getModPhase() const { return modPhase_; }  // Accumulated LFO phase (radians, wrapped)
         
     private:
         DelayLine delay_;
@@ -213,6 +249,7 @@ private:
         void setBypass(bool bypass);              // Bypass cross-feed processing
         void updateSampleRate(double sampleRate);
         void clear();
+        void copyStateFrom(const CrossFeedProcessor& other);
         
         // Getters for current state
         float getCrossFeedAmount() const { return crossFeedAmount_; }
@@ -323,6 +360,15 @@ public:
     void processStereo(const float* inputL, const float* inputR, 
                       float* outputL, float* outputR, int numSamples);
     
+    // processStereo split at the recurrent loop (at most SIMDOptimizer::BLOCK_SIZE
+    // samples per call), so FDNPipeline can run the loop on another thread. The
+    // input stage touches cross-feed, pre-delay, early reflections and diffusion,
+    // the loop stage only the delay lines, matrix and damping filters, and the
+    // output stage only stereo spread and tone filter.
+    void processInputStage(const float* inputL, const float* inputR, float* diffused, int numSamples);
+    void processLoopStage(const float* diffused, float* outputL, float* outputR, int numSamples);
+    void processOutputStage(float* outputL, float* outputR, int numSamples);
+    
     // Parameter control
     void setDecayTime(float decayTimeSeconds);
     void setPreDelay(float preDelaySamples);
@@ -353,6 +399,29 @@ public:
     void setHighCutEnabled(bool enabled);       // Enable/disable high cut filter
     void setLowCutEnabled(bool enabled);        // Enable/disable low cut filter
     
+    float getStereoSpread() const { return stereoSpreadProcessor_->getStereoWidth(); }
+    bool isStereoSpreadCompensated() const { return stereoSpreadProcessor_->isGainCompensated(); }
+    float getHighCutFreq() const { return toneFilter_->getHighCutFreq(); }
+    float getLowCutFreq() const { return toneFilter_->getLowCutFreq(); }
+    bool isHighCutEnabled() const { return toneFilter_->isHighCutEnabled(); }
+    bool isLowCutEnabled() const { return toneFilter_->isLowCutEnabled(); }
+    
+    // With the output stage off, spread and tone are left to the caller (the
+    // engine's fused OutputStage reads the settings above); on by default
+    void setOutputStageEnabled(bool enabled) { outputStageEnabled_ = enabled; }
+    
+    // Per-stage probes report here when built with VM_STAGE_PROFILING (set
+    // before processing; the profile must outlive the reverb)
+    void setStageProfile(StageProfile* profile) { stageProfile_ = profile; }
+    
+    // Stage, flush and coefficient-update events go here when built with
+    // VM_TRACING (same lifetime rule)
+    void setTraceBuffer(TraceBuffer* trace) { trace_ = trace; }
+    
+    // Rebuild counters for diagnostics (read on the thread that sets parameters)
+    uint64_t getBufferFlushCount() const { return bufferFlushes_; }
+    uint64_t getCoefficientUpdateCount() const { return coefficientUpdates_; }
+    
     // Utility
     void reset();
     void clear();
@@ -360,10 +429,33 @@ public:
     
     // Quality settings
     void setDiffusionStages(int stages); // Number of all-pass stages
-    void setInterpolation(bool enabled) { useInterpolation_ = enabled; }
+    void setInterpolation(bool enabled); // Linear (true) or nearest-sample modulated reads
+    void setActiveDelayLines(int numLines); // 4 up to the constructed line count
+    int getActiveDelayLines() const { return numDelayLines_; }
+    int getMaxDelayLines() const { return maxDelayLines_; }
+    int getDiffusionStages() const { return activeDiffusionStages_; }
+    
+    // Multi-rate tail: the feedback loop runs at 1/2 or 1/4 of the sample rate
+    // between half-band decimation and interpolation, for roughly that fraction
+    // of its cost; the damping already removes most of the band it gives up.
+    // Early reflections, diffusion and the output stage stay at full rate, and
+    // the pre-delay absorbs the converters' latency where it is long enough.
+    // Changing the factor restarts the tail.
+    void setTailDecimation(int factor);  // 1 (full rate), 2 or 4
+    int getTailDecimation() const { return tailDecimation_; }
+    int getTailLatencySamples() const { return tailLatency_; }
+    
+    // Quality switching (see QualityGovernor): a standby instance takes over the
+    // running tail of the active one, and the retired instance is cleared in
+    // small steps from the audio thread instead of all at once
+    void copyStateFrom(const FDNReverb& other); // Same sample rate and room size expected; no-op unless cleared
+    void beginIncrementalClear();
+    bool clearIncremental();                     // One bounded step; true once fully cleared
+    bool isCleared() const { return clearPosition_ > maxDelayLines_; }
     
     // Performance optimization controls
     void setSIMDEnabled(bool enabled);           // Enable/disable SIMD optimizations
+    bool isSIMDEnabled() const { return simdEnabled_; }
     double getCPUUsage() const { return lastCpuUsage_; } // Get current CPU usage %
     void enableBlockOptimizations(bool enabled);  // Block-based coefficient updates
     
@@ -389,12 +481,18 @@ private:
     // Early reflections processing (before FDN)
     std::vector<std::unique_ptr<AllPassFilter>> earlyReflectionFilters_;
     static constexpr int MAX_EARLY_REFLECTIONS = 4;
+    static constexpr int MAX_EARLY_REFLECTION_DELAY = 2400; // 50 ms at 48 kHz
     int numEarlyReflections_;
     
     // Configuration
     double sampleRate_;
-    int numDelayLines_;
+    double loopSampleRate_;               // sampleRate_ / tailDecimation_
+    int maxDelayLines_;                   // Lines allocated at construction
+    int numDelayLines_;                   // Lines in the active network
+    int activeDiffusionStages_;
     bool useInterpolation_;
+    float outputGain_;                    // Level compensation for reduced line counts
+    int clearPosition_;                   // Incremental clear progress (done when > maxDelayLines_)
     
     // Buffer flush management for size changes
     float lastRoomSize_;
@@ -422,6 +520,19 @@ private:
     alignas(16) float blockBuffer_[SIMDOptimizer::BLOCK_SIZE];
     alignas(16) float tempSIMDBuffer_[SIMDOptimizer::BLOCK_SIZE * 2];
     
+    // Multi-rate tail: decimator cascade for the loop input, interpolator cascade
+    // per output channel ([1] is the quarter-rate stage), and full-rate output
+    // samples carried over to the next call
+    int tailDecimation_;
+    int tailLatency_;
+    int tailPending_;
+    HalfBandDecimator tailDecimators_[2];
+    HalfBandInterpolator tailInterpolators_[2][2];
+    alignas(16) float tailLoopInput_[SIMDOptimizer::BLOCK_SIZE];
+    alignas(16) float tailLoopOutput_[2][SIMDOptimizer::BLOCK_SIZE];
+    alignas(16) float tailUpsampled_[SIMDOptimizer::BLOCK_SIZE];
+    alignas(16) float tailOutput_[2][SIMDOptimizer::BLOCK_SIZE + 4 * MAX_TAIL_DECIMATION];
+    
     // Coefficient caching for block updates
     struct CachedCoefficients {
         std::atomic<bool> needsUpdate{false};
@@ -432,6 +543,12 @@ private:
     
     // FDN matrix and state
     std::vector<std::vector<float>> feedbackMatrix_;
+    std::vector<std::vector<std::vector<float>>> householderMatrices_; // Unscaled, indexed by line count
+    bool outputStageEnabled_;
+    StageProfile* stageProfile_;
+    TraceBuffer* trace_;
+    uint64_t bufferFlushes_;
+    uint64_t coefficientUpdates_;
     std::vector<float> delayOutputs_;
     std::vector<float> matrixOutputs_;
     
@@ -444,8 +561,9 @@ private:
     // Initialization helpers
     void setupDelayLengths();
     void setupFeedbackMatrix();
-    void calculateDelayLengths(std::vector<int>& lengths, float baseSize);
-    void generateHouseholderMatrix();
+    void applyLoopGain(float loopGain);   // Scaled Householder block into the matrix and SIMD copy
+    void calculateDelayLengths(int* lengths, float baseSize);  // maxDelayLines_ lengths
+    void generateHouseholderMatrix(int size, std::vector<std::vector<float>>& matrix);
     void setupEarlyReflections();
     
     // Buffer management for size changes
@@ -462,6 +580,8 @@ private:
     
     // DSP utilities
     float interpolateLinear(const std::vector<float>& buffer, float index, int bufferSize);
+    void processFeedbackLoop(const float* diffused, float* outputL, float* outputR, int numSamples);
+    void resetTailConverters();
     void processMatrix();
     float processEarlyReflections(float input);
     
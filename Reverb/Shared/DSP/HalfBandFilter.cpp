@@ -0,0 +1,158 @@
+#include "HalfBandFilter.hpp"
+#include "FDNReverb.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr double KAISER_BETA = 7.0;                 // ~80 dB stopband at 47 taps
+
+    // Zeroth-order modified Bessel function (series), for the Kaiser window
+    double besselI0(double x) {
+        double sum = 1.0;
+        double term = 1.0;
+        for (int k = 1; k < 32; ++k) {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+        return sum;
+    }
+}
+
+static_assert(HalfBandFilter::PHASE_TAPS % 8 == 0, "dotProduct runs two SIMD vectors per step");
+
+void HalfBandFilter::design(float* taps, float gain) {
+    // Outer tap q sits at offset 2q - GROUP_DELAY (always odd) from the centre
+    double sum = 0.0;
+    double values[PHASE_TAPS];
+    for (int q = 0; q < PHASE_TAPS; ++q) {
+        const int n = 2 * q;
+        const double offset = static_cast<double>(n - GROUP_DELAY);
+        const double sinc = std::sin(M_PI * offset / 2.0) / (M_PI * offset);
+        const double position = 2.0 * n / (NUM_TAPS - 1) - 1.0;
+        const double window = besselI0(KAISER_BETA * std::sqrt(1.0 - position * position)) / besselI0(KAISER_BETA);
+        values[q] = sinc * window;
+        sum += values[q];
+    }
+
+    // The centre tap is 0.5; the outer taps make up the other half of unity DC gain
+    for (int q = 0; q < PHASE_TAPS; ++q) {
+        taps[q] = static_cast<float>(values[q] * 0.5 / sum * gain);
+    }
+}
+
+float HalfBandFilter::dotProduct(const float* samples, const float* taps) {
+    #if SIMD_AVAILABLE && defined(__ARM_NEON__)
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    for (int i = 0; i < PHASE_TAPS; i += 8) {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(samples + i), vld1q_f32(taps + i));
+        acc1 = vmlaq_f32(acc1, vld1q_f32(samples + i + 4), vld1q_f32(taps + i + 4));
+    }
+    float results[4];
+    vst1q_f32(results, vaddq_f32(acc0, acc1));
+    return results[0] + results[1] + results[2] + results[3];
+    #elif SIMD_AVAILABLE && defined(__SSE2__)
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    for (int i = 0; i < PHASE_TAPS; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(samples + i), _mm_load_ps(taps + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(samples + i + 4), _mm_load_ps(taps + i + 4)));
+    }
+    alignas(16) float results[4];
+    _mm_store_ps(results, _mm_add_ps(acc0, acc1));
+    return results[0] + results[1] + results[2] + results[3];
+    #else
+    float sum = 0.0f;
+    for (int i = 0; i < PHASE_TAPS; ++i) {
+        sum += samples[i] * taps[i];
+    }
+    return sum;
+    #endif
+}
+
+// ============================================================================
+// Decimator
+// ============================================================================
+
+HalfBandDecimator::HalfBandDecimator() {
+    design(taps_, 1.0f);
+    reset();
+}
+
+void HalfBandDecimator::reset() {
+    std::fill(evens_, evens_ + HISTORY, 0.0f);
+    std::fill(odds_, odds_ + HISTORY, 0.0f);
+    evenCount_ = HISTORY;
+    oddCount_ = HISTORY;
+    oddPhase_ = false;
+}
+
+int HalfBandDecimator::process(const float* input, int numSamples, float* output) {
+    // Pair m is (x[2m], x[2m+1]); evens_[i] and odds_[i] belong to the same pair.
+    // Output m needs x[2m - 2q] for every outer tap and x[2m - GROUP_DELAY] for the
+    // centre one, i.e. odd sample of pair m - (GROUP_DELAY + 1) / 2.
+    constexpr int CENTRE_PAIRS = (GROUP_DELAY + 1) / 2;
+    int produced = 0;
+
+    for (int offset = 0; offset < numSamples; offset += CHUNK) {
+        const int count = std::min(CHUNK, numSamples - offset);
+        for (int i = 0; i < count; ++i) {
+            const float sample = input[offset + i];
+            if (oddPhase_) {
+                odds_[oddCount_++] = sample;
+            } else {
+                evens_[evenCount_] = sample;
+                output[produced++] = dotProduct(evens_ + evenCount_ - HISTORY, taps_)
+                                   + 0.5f * odds_[evenCount_ - CENTRE_PAIRS];
+                ++evenCount_;
+            }
+            oddPhase_ = !oddPhase_;
+        }
+
+        // Keep the last HISTORY pairs (odd phase may be one sample behind)
+        const int drop = evenCount_ - HISTORY;
+        std::memmove(evens_, evens_ + drop, HISTORY * sizeof(float));
+        std::memmove(odds_, odds_ + drop, (oddCount_ - drop) * sizeof(float));
+        evenCount_ = HISTORY;
+        oddCount_ -= drop;
+    }
+
+    return produced;
+}
+
+// ============================================================================
+// Interpolator
+// ============================================================================
+
+HalfBandInterpolator::HalfBandInterpolator() {
+    design(taps_, 2.0f);   // Zero-stuffing halves the level
+    reset();
+}
+
+void HalfBandInterpolator::reset() {
+    std::fill(history_, history_ + HISTORY, 0.0f);
+}
+
+void HalfBandInterpolator::process(const float* input, int numSamples, float* output) {
+    // Even outputs run the outer taps over the input history; odd outputs only
+    // see the centre tap, i.e. the input (GROUP_DELAY - 1) / 2 samples back
+    constexpr int CENTRE_DELAY = (GROUP_DELAY - 1) / 2;
+
+    for (int offset = 0; offset < numSamples; offset += CHUNK) {
+        const int count = std::min(CHUNK, numSamples - offset);
+        std::copy(input + offset, input + offset + count, history_ + HISTORY);
+
+        float* out = output + 2 * offset;
+        for (int i = 0; i < count; ++i) {
+            out[2 * i] = dotProduct(history_ + i, taps_);
+            out[2 * i + 1] = history_[HISTORY + i - CENTRE_DELAY];
+        }
+
+        std::memmove(history_, history_ + count, HISTORY * sizeof(float));
+    }
+}
+
+} // namespace VoiceMonitor
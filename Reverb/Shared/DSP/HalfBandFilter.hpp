@@ -0,0 +1,62 @@
+#pragma once
+
+namespace VoiceMonitor {
+
+/// Linear-phase half-band FIR for 2:1 sample-rate changes (Kaiser-windowed sinc,
+/// passband flat to 0.2 and stopband from 0.3 of the higher rate, ~80 dB).
+///
+/// Every other tap of a half-band filter is zero except the centre one, so in
+/// polyphase form one phase is a pure delay and the other a short symmetric
+/// FIR: the converters below only run those PHASE_TAPS taps (SIMD dot product)
+/// once per sample at the lower rate. Streaming, any block size, no allocation.
+class HalfBandFilter {
+public:
+    static constexpr int NUM_TAPS = 47;
+    static constexpr int PHASE_TAPS = (NUM_TAPS + 1) / 2;  // Non-zero taps besides the centre
+    static constexpr int GROUP_DELAY = (NUM_TAPS - 1) / 2; // Samples at the higher rate
+
+protected:
+    static constexpr int HISTORY = PHASE_TAPS - 1;
+    static constexpr int CHUNK = 64;                        // Samples buffered per pass
+
+    /// The PHASE_TAPS non-zero outer taps, scaled by gain (symmetric, so they
+    /// also apply as-is to a history ordered oldest first)
+    static void design(float* taps, float gain);
+    static float dotProduct(const float* samples, const float* taps);
+};
+
+/// Half-band lowpass, then every second sample (input rate -> input rate / 2)
+class HalfBandDecimator : public HalfBandFilter {
+public:
+    HalfBandDecimator();
+
+    /// @return Samples written: one per input pair, counted from the first input
+    /// after reset() (so numSamples / 2, rounded by the running phase). Works in
+    /// place.
+    int process(const float* input, int numSamples, float* output);
+    void reset();
+
+private:
+    alignas(16) float taps_[PHASE_TAPS];
+    alignas(16) float evens_[HISTORY + CHUNK];  // Phase through the FIR
+    float odds_[HISTORY + CHUNK];               // Phase through the centre tap
+    int evenCount_;
+    int oddCount_;
+    bool oddPhase_;
+};
+
+/// Zero-stuffing by two, then the half-band lowpass (input rate -> input rate * 2)
+class HalfBandInterpolator : public HalfBandFilter {
+public:
+    HalfBandInterpolator();
+
+    /// Writes 2 * numSamples samples
+    void process(const float* input, int numSamples, float* output);
+    void reset();
+
+private:
+    alignas(16) float taps_[PHASE_TAPS];
+    alignas(16) float history_[HISTORY + CHUNK];
+};
+
+} // namespace VoiceMonitor
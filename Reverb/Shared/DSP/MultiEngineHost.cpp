@@ -0,0 +1,413 @@
+#include "MultiEngineHost.hpp"
+#include "ReverbEngine.hpp"
+#include "ThreadSync.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr double LOAD_SMOOTHING = 0.05;         // EMA coefficient per cycle
+    constexpr int SPINS_BEFORE_YIELD = 64;          // Failed steal rounds before giving up the core
+
+    double threadCpuSeconds() {
+        timespec ts;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+    }
+
+    int pinCurrentThread(int cpu) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+            return cpu;
+        }
+#else
+        (void)cpu;
+#endif
+        return -1;
+    }
+
+    void addRelaxed(std::atomic<double>& counter, double value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+}
+
+// Chase-Lev deque with a fixed capacity and monotonic 64-bit indices. The audio
+// thread refills a deque between cycles only while its owner is idle, and starts
+// every refill at a fresh base index, so a steal left over from an earlier cycle
+// can never win its CAS on `top`.
+struct MultiEngineHost::Worker {
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    std::unique_ptr<std::atomic<int>[]> tasks;
+
+    // Idle/wake handshake
+    alignas(64) std::atomic<uint64_t> completedGeneration{0};
+    std::atomic<bool> sleeping{false};
+    ThreadSync::WakeSignal wake;
+    std::thread thread;
+    uint32_t randomState = 1;          // Victim selection (owner only)
+
+    // Published by the owner
+    alignas(64) std::atomic<uint64_t> instancesProcessed{0};
+    std::atomic<uint64_t> instancesStolen{0};
+    std::atomic<uint64_t> cyclesJoined{0};
+    std::atomic<double> cpuSeconds{0.0};
+    std::atomic<double> busySeconds{0.0};
+    std::atomic<int> cpu{-1};
+};
+
+MultiEngineHost::MultiEngineHost()
+    : sampleRate_(48000.0)
+    , maxInstances_(0)
+    , numWorkers_(0)
+    , dequeMask_(0)
+    , nextDequeBase_(0)
+    , instances_(nullptr)
+    , numSamples_(0)
+    , generation_(0)
+    , remaining_(0)
+    , running_(false)
+    , spinMicroseconds_(DEFAULT_SPIN_MICROSECONDS)
+    , cycles_(0)
+    , deadlineMisses_(0)
+    , lastLoad_(0.0)
+    , averageLoad_(0.0)
+    , peakLoad_(0.0) {
+}
+
+MultiEngineHost::~MultiEngineHost() {
+    shutdown();
+}
+
+bool MultiEngineHost::prepare(double sampleRate, int maxInstances, int numWorkers, bool pinWorkers) {
+    if (sampleRate <= 0.0 || maxInstances <= 0 || numWorkers <= 0 || numWorkers > MAX_WORKERS) {
+        return false;
+    }
+
+    shutdown();
+
+    sampleRate_ = sampleRate;
+    maxInstances_ = maxInstances;
+    numWorkers_ = numWorkers;
+
+    // A deque may hold every instance of a cycle
+    int64_t capacity = 1;
+    while (capacity < maxInstances) {
+        capacity <<= 1;
+    }
+    dequeMask_ = capacity - 1;
+    nextDequeBase_ = capacity;
+    generation_.store(0);
+    remaining_.store(0);
+
+    workers_.clear();
+    for (int i = 0; i < numWorkers_; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->tasks.reset(new std::atomic<int>[static_cast<size_t>(capacity)]);
+        for (int64_t j = 0; j < capacity; ++j) {
+            worker->tasks[j].store(0, std::memory_order_relaxed);
+        }
+        worker->randomState = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+        workers_.push_back(std::move(worker));
+    }
+
+    running_.store(true);
+    const int numCpus = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int i = 1; i < numWorkers_; ++i) {
+        const int cpu = pinWorkers ? i % numCpus : -1;
+        workers_[i]->thread = std::thread([this, i, cpu]() {
+            if (cpu >= 0) {
+                workers_[i]->cpu.store(pinCurrentThread(cpu), std::memory_order_relaxed);
+            }
+            workerLoop(i);
+        });
+    }
+
+    resetStatistics();
+    return true;
+}
+
+void MultiEngineHost::shutdown() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    generation_.fetch_add(1);
+    for (size_t i = 1; i < workers_.size(); ++i) {
+        workers_[i]->sleeping.store(false);
+        workers_[i]->wake.post();
+    }
+    for (size_t i = 1; i < workers_.size(); ++i) {
+        if (workers_[i]->thread.joinable()) {
+            workers_[i]->thread.join();
+        }
+    }
+    workers_.clear();
+}
+
+// ============================================================================
+// Audio thread
+// ============================================================================
+
+void MultiEngineHost::processCycle(const Instance* instances, int numInstances, int numSamples) {
+    if (numInstances <= 0 || numSamples <= 0 || workers_.empty()) {
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    numInstances = std::min(numInstances, maxInstances_);
+
+    instances_ = instances;
+    numSamples_ = numSamples;
+    remaining_.store(numInstances);
+
+    // Only workers that finished the previous cycle may have their deque refilled;
+    // one still inside it simply joins in by stealing
+    const uint64_t generation = generation_.load(std::memory_order_relaxed);
+    int participants[MAX_WORKERS];
+    int numParticipants = 0;
+    for (int i = 0; i < numWorkers_; ++i) {
+        if (i == 0 || workers_[i]->completedGeneration.load(std::memory_order_acquire) == generation) {
+            participants[numParticipants++] = i;
+        }
+    }
+
+    for (int p = 0; p < numParticipants; ++p) {
+        const int begin = static_cast<int>(static_cast<int64_t>(numInstances) * p / numParticipants);
+        const int end = static_cast<int>(static_cast<int64_t>(numInstances) * (p + 1) / numParticipants);
+        fillDeque(*workers_[participants[p]], begin, end);
+    }
+
+    generation_.store(generation + 1);
+    for (int i = 1; i < numWorkers_; ++i) {
+        if (workers_[i]->sleeping.exchange(false)) {
+            workers_[i]->wake.post();
+        }
+    }
+
+    runCycle(*workers_[0], 0);
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double load = seconds * sampleRate_ / numSamples;
+
+    double average = averageLoad_.load(std::memory_order_relaxed);
+    average = (average == 0.0) ? load : average + LOAD_SMOOTHING * (load - average);
+    averageLoad_.store(average, std::memory_order_relaxed);
+    lastLoad_.store(load, std::memory_order_relaxed);
+    peakLoad_.store(std::max(peakLoad_.load(std::memory_order_relaxed), load), std::memory_order_relaxed);
+    cycles_.fetch_add(1, std::memory_order_relaxed);
+    if (load > 1.0) {
+        deadlineMisses_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void MultiEngineHost::fillDeque(Worker& worker, int begin, int end) {
+    const int64_t base = nextDequeBase_;
+    nextDequeBase_ += dequeMask_ + 1;
+
+    for (int i = begin; i < end; ++i) {
+        worker.tasks[(base + (i - begin)) & dequeMask_].store(i, std::memory_order_relaxed);
+    }
+
+    // `top` moves first: a thief that still holds the old top can only see the
+    // new bottom after the move, so its CAS fails instead of taking a task twice
+    worker.top.store(base, std::memory_order_relaxed);
+    worker.bottom.store(base + (end - begin), std::memory_order_release);
+}
+
+// ============================================================================
+// Workers (the audio thread is worker 0)
+// ============================================================================
+
+void MultiEngineHost::workerLoop(int index) {
+    Worker& self = *workers_[index];
+    uint64_t seen = 0;
+
+    while (running_.load(std::memory_order_relaxed)) {
+        // Spin for the next cycle, then block until the audio thread posts
+        const auto spinUntil = std::chrono::steady_clock::now() +
+                               std::chrono::microseconds(spinMicroseconds_.load(std::memory_order_relaxed));
+        int spins = 0;
+        while (generation_.load(std::memory_order_acquire) == seen) {
+            ThreadSync::cpuRelax();
+            if (++spins % SPINS_BEFORE_YIELD != 0) {
+                continue;
+            }
+            if (std::chrono::steady_clock::now() < spinUntil) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            self.sleeping.store(true);
+            if (generation_.load() != seen && self.sleeping.exchange(false)) {
+                break;                              // Cycle started before we slept, no post coming
+            }
+            self.wake.wait();
+            break;
+        }
+
+        const uint64_t generation = generation_.load(std::memory_order_acquire);
+        if (!running_.load(std::memory_order_relaxed)) {
+            break;
+        }
+        if (generation == seen) {
+            continue;
+        }
+
+        runCycle(self, index);
+        self.completedGeneration.store(generation, std::memory_order_release);
+        seen = generation;
+    }
+}
+
+void MultiEngineHost::runCycle(Worker& self, int index) {
+    const double cpuStart = threadCpuSeconds();
+    self.cyclesJoined.fetch_add(1, std::memory_order_relaxed);
+
+    int spins = 0;
+    int task = 0;
+    for (;;) {
+        if (popLocal(self, task)) {
+            runInstance(self, task);
+            spins = 0;
+        } else if (stealAny(self, index, task)) {
+            self.instancesStolen.fetch_add(1, std::memory_order_relaxed);
+            runInstance(self, task);
+            spins = 0;
+        } else if (remaining_.load(std::memory_order_acquire) == 0) {
+            break;
+        } else if (++spins % SPINS_BEFORE_YIELD == 0) {
+            // Everything is taken but not finished; let a preempted worker run
+            std::this_thread::yield();
+        } else {
+            ThreadSync::cpuRelax();
+        }
+    }
+
+    addRelaxed(self.cpuSeconds, threadCpuSeconds() - cpuStart);
+}
+
+void MultiEngineHost::runInstance(Worker& self, int task) {
+    const auto start = std::chrono::steady_clock::now();
+
+    const Instance& instance = instances_[task];
+    if (instance.engine) {
+        instance.engine->processBlock(instance.inputs, instance.outputs, instance.numChannels, numSamples_);
+    }
+
+    addRelaxed(self.busySeconds, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    self.instancesProcessed.fetch_add(1, std::memory_order_relaxed);
+
+    // Release the instance's output to whoever sees the countdown reach zero
+    remaining_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool MultiEngineHost::popLocal(Worker& self, int& task) {
+    const int64_t b = self.bottom.load(std::memory_order_relaxed) - 1;
+    self.bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = self.top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        self.bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    task = self.tasks[b & dequeMask_].load(std::memory_order_relaxed);
+    if (t < b) {
+        return true;
+    }
+
+    // Last item: race the thieves for it
+    const bool won = self.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed);
+    self.bottom.store(b + 1, std::memory_order_relaxed);
+    return won;
+}
+
+bool MultiEngineHost::steal(Worker& victim, int& task) {
+    int64_t t = victim.top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = victim.bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+        return false;
+    }
+
+    task = victim.tasks[t & dequeMask_].load(std::memory_order_relaxed);
+    return victim.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+}
+
+bool MultiEngineHost::stealAny(Worker& self, int index, int& task) {
+    if (numWorkers_ < 2) {
+        return false;
+    }
+
+    // xorshift32: start at a random victim so thieves do not pile onto one deque
+    self.randomState ^= self.randomState << 13;
+    self.randomState ^= self.randomState >> 17;
+    self.randomState ^= self.randomState << 5;
+    const int first = static_cast<int>(self.randomState % static_cast<uint32_t>(numWorkers_));
+
+    for (int i = 0; i < numWorkers_; ++i) {
+        const int victim = (first + i) % numWorkers_;
+        if (victim != index && steal(*workers_[victim], task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+MultiEngineHost::Statistics MultiEngineHost::getStatistics() const {
+    Statistics stats;
+    stats.cycles = cycles_.load(std::memory_order_relaxed);
+    stats.deadlineMisses = deadlineMisses_.load(std::memory_order_relaxed);
+    stats.lastLoad = lastLoad_.load(std::memory_order_relaxed);
+    stats.averageLoad = averageLoad_.load(std::memory_order_relaxed);
+    stats.peakLoad = peakLoad_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+MultiEngineHost::WorkerStatistics MultiEngineHost::getWorkerStatistics(int worker) const {
+    WorkerStatistics stats;
+    if (worker < 0 || worker >= static_cast<int>(workers_.size())) {
+        return stats;
+    }
+
+    const Worker& w = *workers_[worker];
+    stats.instancesProcessed = w.instancesProcessed.load(std::memory_order_relaxed);
+    stats.instancesStolen = w.instancesStolen.load(std::memory_order_relaxed);
+    stats.cyclesJoined = w.cyclesJoined.load(std::memory_order_relaxed);
+    stats.cpuSeconds = w.cpuSeconds.load(std::memory_order_relaxed);
+    stats.busySeconds = w.busySeconds.load(std::memory_order_relaxed);
+    stats.cpu = w.cpu.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void MultiEngineHost::resetStatistics() {
+    // Worker counters are owned by the workers; only the cycle counters start over
+    cycles_.store(0, std::memory_order_relaxed);
+    deadlineMisses_.store(0, std::memory_order_relaxed);
+    lastLoad_.store(0.0, std::memory_order_relaxed);
+    averageLoad_.store(0.0, std::memory_order_relaxed);
+    peakLoad_.store(0.0, std::memory_order_relaxed);
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace VoiceMonitor {
+
+class ReverbEngine;
+
+/// Runs many ReverbEngine instances inside one audio period
+///
+/// The audio callback thread calls processCycle() with the instances of the
+/// period; the host spreads them over a pool of pinned worker threads and
+/// returns once every instance has been processed. The calling thread takes
+/// part as worker 0, so a host without workers is a plain sequential loop.
+///
+/// Scheduling is work-stealing: at the start of a cycle each participating
+/// worker gets a contiguous share of the instances in its own deque, pops work
+/// from the bottom and, once empty, steals from the top of the others. The
+/// caller learns about completion from an atomic countdown of outstanding
+/// instances - there is no barrier, so a worker that wakes late or is
+/// preempted never holds up the cycle as long as someone else can take its
+/// share.
+///
+/// Workers spin briefly between cycles and then block on a semaphore; waking
+/// them is a single post from the audio thread. No allocation or locking
+/// happens in processCycle().
+class MultiEngineHost {
+public:
+    static constexpr int MAX_WORKERS = 64;                  // Including the calling thread
+    static constexpr int DEFAULT_SPIN_MICROSECONDS = 200;   // Idle spin before a worker blocks
+
+    /// One engine and its buffers for the current period
+    struct Instance {
+        ReverbEngine* engine = nullptr;
+        const float* const* inputs = nullptr;
+        float* const* outputs = nullptr;
+        int numChannels = 0;
+    };
+
+    struct WorkerStatistics {
+        uint64_t instancesProcessed = 0;
+        uint64_t instancesStolen = 0;       // Taken from another worker's deque
+        uint64_t cyclesJoined = 0;          // Cycles this worker started in time to take work
+        double cpuSeconds = 0.0;            // Thread CPU time spent inside cycles
+        double busySeconds = 0.0;           // Wall time spent processing instances
+        int cpu = -1;                       // Pinned core, -1 if not pinned
+    };
+
+    struct Statistics {
+        uint64_t cycles = 0;
+        uint64_t deadlineMisses = 0;        // Cycles longer than their audio period
+        double lastLoad = 0.0;              // Cycle time / period
+        double averageLoad = 0.0;           // Smoothed
+        double peakLoad = 0.0;
+    };
+
+public:
+    MultiEngineHost();
+    ~MultiEngineHost();
+
+    MultiEngineHost(const MultiEngineHost&) = delete;
+    MultiEngineHost& operator=(const MultiEngineHost&) = delete;
+
+    /// Start the pool (not real-time safe)
+    /// @param numWorkers Threads including the caller; 1 processes everything on the caller
+    /// @param pinWorkers Pin pool thread i to core i (Linux); the caller is left as it is
+    bool prepare(double sampleRate, int maxInstances, int numWorkers, bool pinWorkers = true);
+    void shutdown();
+
+    /// Audio thread: process every instance for numSamples frames and return when done
+    void processCycle(const Instance* instances, int numInstances, int numSamples);
+
+    void setSpinMicroseconds(int microseconds) { spinMicroseconds_.store(microseconds, std::memory_order_relaxed); }
+
+    int getNumWorkers() const { return numWorkers_; }
+    int getMaxInstances() const { return maxInstances_; }
+
+    Statistics getStatistics() const;
+    WorkerStatistics getWorkerStatistics(int worker) const;
+    void resetStatistics();
+
+private:
+    struct Worker;
+
+    void workerLoop(int index);
+    void runCycle(Worker& self, int index);
+    bool popLocal(Worker& self, int& task);
+    bool steal(Worker& victim, int& task);
+    bool stealAny(Worker& self, int index, int& task);
+    void runInstance(Worker& self, int task);
+    void fillDeque(Worker& worker, int begin, int end);
+
+    double sampleRate_;
+    int maxInstances_;
+    int numWorkers_;
+    int64_t dequeMask_;
+    int64_t nextDequeBase_;             // Audio thread: fresh index range per cycle
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    // Current cycle, published by the generation bump
+    const Instance* instances_;
+    int numSamples_;
+    alignas(64) std::atomic<uint64_t> generation_;
+    alignas(64) std::atomic<int> remaining_;
+    alignas(64) std::atomic<bool> running_;
+    std::atomic<int> spinMicroseconds_;
+
+    // Published by the audio thread
+    std::atomic<uint64_t> cycles_;
+    std::atomic<uint64_t> deadlineMisses_;
+    std::atomic<double> lastLoad_;
+    std::atomic<double> averageLoad_;
+    std::atomic<double> peakLoad_;
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,237 @@
+#include "OutputStage.hpp"
+#include "FDNReverb.hpp"   // SIMD_AVAILABLE and the NEON/SSE headers
+#include <algorithm>
+
+namespace VoiceMonitor {
+
+namespace {
+    // Tone filters use the FDN tone filter's Q, the cross-feed filter the cross-feed processor's
+    constexpr float TONE_Q = 0.7071f;
+    constexpr float CROSS_FEED_Q = 0.707f;
+    constexpr float CROSS_FEED_THRESHOLD = 0.001f;
+    constexpr float CROSS_FEED_SCALE = 0.7f;    // Keeps the summed level in check
+
+    // A stereo sample pair: lane 0 = L, lane 1 = R
+#if SIMD_AVAILABLE && defined(__ARM_NEON__)
+    using Pair = float32x2_t;
+    inline Pair load(const float* left, const float* right) { return vset_lane_f32(*right, vdup_n_f32(*left), 1); }
+    inline void store(float* left, float* right, Pair v) { vst1_lane_f32(left, v, 0); vst1_lane_f32(right, v, 1); }
+    inline Pair fromLanes(const float* lanes) { return vld1_f32(lanes); }
+    inline void toLanes(float* lanes, Pair v) { vst1_f32(lanes, v); }
+    inline Pair broadcast(float x) { return vdup_n_f32(x); }
+    inline Pair add(Pair a, Pair b) { return vadd_f32(a, b); }
+    inline Pair sub(Pair a, Pair b) { return vsub_f32(a, b); }
+    inline Pair mul(Pair a, Pair b) { return vmul_f32(a, b); }
+    inline Pair swapLanes(Pair v) { return vrev64_f32(v); }
+#elif SIMD_AVAILABLE && defined(__SSE2__)
+    using Pair = __m128;    // Lanes 2 and 3 unused
+    inline Pair load(const float* left, const float* right) { return _mm_unpacklo_ps(_mm_load_ss(left), _mm_load_ss(right)); }
+    inline void store(float* left, float* right, Pair v) {
+        _mm_store_ss(left, v);
+        _mm_store_ss(right, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    }
+    inline Pair fromLanes(const float* lanes) { return _mm_setr_ps(lanes[0], lanes[1], 0.0f, 0.0f); }
+    inline void toLanes(float* lanes, Pair v) { _mm_storel_pi(reinterpret_cast<__m64*>(lanes), v); }
+    inline Pair broadcast(float x) { return _mm_set1_ps(x); }
+    inline Pair add(Pair a, Pair b) { return _mm_add_ps(a, b); }
+    inline Pair sub(Pair a, Pair b) { return _mm_sub_ps(a, b); }
+    inline Pair mul(Pair a, Pair b) { return _mm_mul_ps(a, b); }
+    inline Pair swapLanes(Pair v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 2, 0, 1)); }
+#else
+    struct Pair { float l, r; };
+    inline Pair load(const float* left, const float* right) { return { *left, *right }; }
+    inline void store(float* left, float* right, Pair v) { *left = v.l; *right = v.r; }
+    inline Pair fromLanes(const float* lanes) { return { lanes[0], lanes[1] }; }
+    inline void toLanes(float* lanes, Pair v) { lanes[0] = v.l; lanes[1] = v.r; }
+    inline Pair broadcast(float x) { return { x, x }; }
+    inline Pair add(Pair a, Pair b) { return { a.l + b.l, a.r + b.r }; }
+    inline Pair sub(Pair a, Pair b) { return { a.l - b.l, a.r - b.r }; }
+    inline Pair mul(Pair a, Pair b) { return { a.l * b.l, a.r * b.r }; }
+    inline Pair swapLanes(Pair v) { return { v.r, v.l }; }
+#endif
+
+    // Biquad coefficients and state in registers for the length of a block
+    struct PairBiquad {
+        Pair b0, b1, b2, a1, a2;
+        Pair x1, x2, y1, y2;
+
+        // b0 x + b1 x1 + b2 x2 - a1 y1 - a2 y2, in the scalar filters' order
+        Pair process(Pair x) {
+            const Pair y = sub(sub(add(add(mul(b0, x), mul(b1, x1)), mul(b2, x2)), mul(a1, y1)), mul(a2, y2));
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            return y;
+        }
+    };
+}
+
+// ============================================================================
+// StereoBiquad
+// ============================================================================
+
+OutputStage::StereoBiquad::StereoBiquad()
+    : b0(1.0f), b1(0.0f), b2(0.0f), a1(0.0f), a2(0.0f) {
+    clear();
+}
+
+void OutputStage::StereoBiquad::setCoeffs(const AudioMath::BiquadCoeffs& coeffs) {
+    b0 = coeffs.b0;
+    b1 = coeffs.b1;
+    b2 = coeffs.b2;
+    a1 = coeffs.a1;
+    a2 = coeffs.a2;
+}
+
+void OutputStage::StereoBiquad::clear() {
+    std::fill(x1, x1 + 2, 0.0f);
+    std::fill(x2, x2 + 2, 0.0f);
+    std::fill(y1, y1 + 2, 0.0f);
+    std::fill(y2, y2 + 2, 0.0f);
+}
+
+// ============================================================================
+// OutputStage
+// ============================================================================
+
+bool OutputStage::Settings::operator==(const Settings& other) const {
+    return spreadWidth == other.spreadWidth && spreadCompensation == other.spreadCompensation &&
+           highCutEnabled == other.highCutEnabled && highCutHz == other.highCutHz &&
+           lowCutEnabled == other.lowCutEnabled && lowCutHz == other.lowCutHz;
+}
+
+OutputStage::OutputStage()
+    : sampleRate_(48000.0)
+    , spreadDirect_(1.0f)
+    , spreadSwapped_(0.0f)
+    , spreadActive_(false) {
+}
+
+void OutputStage::prepare(double sampleRate, int maxBlockSize) {
+    sampleRate_ = sampleRate;
+    crossFeed_.prepare(sampleRate, CROSS_FEED_SMOOTHING_SECONDS, maxBlockSize);
+
+    const float rate = static_cast<float>(sampleRate_);
+    highCut_.setCoeffs(AudioMath::createLowpass(rate, settings_.highCutHz, TONE_Q));
+    lowCut_.setCoeffs(AudioMath::createHighpass(rate, settings_.lowCutHz, TONE_Q));
+    crossFeedFilter_.setCoeffs(AudioMath::createLowpass(rate, CROSS_FEED_ROLLOFF_HZ, CROSS_FEED_Q));
+    updateSpread();
+    reset();
+}
+
+void OutputStage::configure(const Settings& settings) {
+    if (settings == settings_) {
+        return;
+    }
+
+    const float rate = static_cast<float>(sampleRate_);
+    if (settings.highCutHz != settings_.highCutHz) {
+        highCut_.setCoeffs(AudioMath::createLowpass(rate, settings.highCutHz, TONE_Q));
+    }
+    if (settings.lowCutHz != settings_.lowCutHz) {
+        lowCut_.setCoeffs(AudioMath::createHighpass(rate, settings.lowCutHz, TONE_Q));
+    }
+    settings_ = settings;
+    updateSpread();
+}
+
+void OutputStage::updateSpread() {
+    // L/R -> M/S -> L/R collapses to v * (m + s) + swap(v) * (m - s), with
+    // m = 0.5 * mid gain and s = 0.5 * width (see StereoSpreadProcessor)
+    const float width = settings_.spreadWidth;
+    float midGain = 1.0f;
+    if (settings_.spreadCompensation && width > 1.0f) {
+        midGain = std::max(1.0f - (width - 1.0f) * 0.15f, 0.7f);
+    }
+    spreadDirect_ = 0.5f * midGain + 0.5f * width;
+    spreadSwapped_ = 0.5f * midGain - 0.5f * width;
+    spreadActive_ = spreadDirect_ != 1.0f || spreadSwapped_ != 0.0f;
+}
+
+void OutputStage::reset() {
+    highCut_.clear();
+    lowCut_.clear();
+    crossFeedFilter_.clear();
+    crossFeed_.snapTo(crossFeed_.getTarget());
+}
+
+void OutputStage::process(float* wetL, float* wetR, const float* dryL, const float* dryR,
+                          float* outputL, float* outputR, int numSamples,
+                          const ParameterRamp* mix, const ParameterRamp* gain, bool storeWet) {
+    crossFeed_.process(numSamples);
+    const float* crossFeedValues = crossFeed_.getValues();
+    const float crossFeedValue = crossFeed_.getValue();
+    const bool crossFeedActive = crossFeedValues || crossFeedValue > CROSS_FEED_THRESHOLD;
+
+    const float* mixValues = mix ? mix->getValues() : nullptr;
+    const float* gainValues = gain ? gain->getValues() : nullptr;
+    const Pair mixConstant = broadcast(mix ? mix->getValue() : 1.0f);
+    const Pair gainConstant = broadcast(gain ? gain->getValue() : 1.0f);
+
+    // Coefficients and state into registers
+    auto loadBiquad = [](const StereoBiquad& filter) {
+        PairBiquad pair;
+        pair.b0 = broadcast(filter.b0);
+        pair.b1 = broadcast(filter.b1);
+        pair.b2 = broadcast(filter.b2);
+        pair.a1 = broadcast(filter.a1);
+        pair.a2 = broadcast(filter.a2);
+        pair.x1 = fromLanes(filter.x1);
+        pair.x2 = fromLanes(filter.x2);
+        pair.y1 = fromLanes(filter.y1);
+        pair.y2 = fromLanes(filter.y2);
+        return pair;
+    };
+    auto saveBiquad = [](const PairBiquad& pair, StereoBiquad& filter) {
+        toLanes(filter.x1, pair.x1);
+        toLanes(filter.x2, pair.x2);
+        toLanes(filter.y1, pair.y1);
+        toLanes(filter.y2, pair.y2);
+    };
+    PairBiquad highCut = loadBiquad(highCut_);
+    PairBiquad lowCut = loadBiquad(lowCut_);
+    PairBiquad crossFeedFilter = loadBiquad(crossFeedFilter_);
+    const Pair spreadDirect = broadcast(spreadDirect_);
+    const Pair spreadSwapped = broadcast(spreadSwapped_);
+
+    for (int i = 0; i < numSamples; ++i) {
+        Pair wet = load(wetL + i, wetR + i);
+
+        if (spreadActive_) {
+            wet = add(mul(wet, spreadDirect), mul(swapLanes(wet), spreadSwapped));
+        }
+        if (settings_.highCutEnabled) {
+            wet = highCut.process(wet);
+        }
+        if (settings_.lowCutEnabled) {
+            wet = lowCut.process(wet);
+        }
+        if (crossFeedActive) {
+            // Each side picks up the other's low-passed signal
+            const Pair filtered = crossFeedFilter.process(wet);
+            const float amount = crossFeedValues ? crossFeedValues[i] : crossFeedValue;
+            if (amount > CROSS_FEED_THRESHOLD) {
+                wet = add(wet, mul(broadcast(amount * CROSS_FEED_SCALE), swapLanes(filtered)));
+            }
+        }
+        if (storeWet) {
+            store(wetL + i, wetR + i, wet);
+        }
+
+        if (mix) {
+            const Pair dry = load(dryL + i, dryR + i);
+            const Pair amount = mixValues ? broadcast(mixValues[i]) : mixConstant;
+            const Pair level = gainValues ? broadcast(gainValues[i]) : gainConstant;
+            store(outputL + i, outputR + i, mul(add(dry, mul(amount, sub(wet, dry))), level));
+        } else {
+            store(outputL + i, outputR + i, wet);
+        }
+    }
+
+    saveBiquad(highCut, highCut_);
+    saveBiquad(lowCut, lowCut_);
+    saveBiquad(crossFeedFilter, crossFeedFilter_);
+}
+
+} // namespace VoiceMonitor
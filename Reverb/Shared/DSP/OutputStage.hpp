@@ -0,0 +1,75 @@
+#pragma once
+
+#include "AudioMath.hpp"
+#include "ParameterRamp.hpp"
+
+namespace VoiceMonitor {
+
+/// Fused stereo output stage: everything between the FDN loop and the output
+///
+/// Replaces four passes over the block (FDN stereo spread, FDN tone filter,
+/// the engine's cross-feed and its wet/dry mix) with one. L and R travel
+/// together as the two lanes of a vector (NEON float32x2, the low half of an
+/// SSE register, or a scalar pair), so every biquad runs both channels in one
+/// set of multiplies and the M/S and cross-feed terms are a lane swap away.
+/// Same per-sample arithmetic as the separate stages, without intermediate
+/// buffers. Audio thread only, apart from prepare().
+class OutputStage {
+public:
+    /// Spread and tone settings, mirrored from the FDN (its own output stage is off)
+    struct Settings {
+        float spreadWidth = 1.0f;           // 0 = mono wet, 1 = natural, 2 = wide
+        bool spreadCompensation = true;     // Mid gain compensation above width 1
+        bool highCutEnabled = false;
+        float highCutHz = 20000.0f;
+        bool lowCutEnabled = false;
+        float lowCutHz = 20.0f;
+
+        bool operator==(const Settings& other) const;
+        bool operator!=(const Settings& other) const { return !(*this == other); }
+    };
+
+    static constexpr float CROSS_FEED_ROLLOFF_HZ = 8000.0f;    // Low-passed cross terms
+    static constexpr double CROSS_FEED_SMOOTHING_SECONDS = 0.02;
+
+    OutputStage();
+
+    void prepare(double sampleRate, int maxBlockSize);
+    void configure(const Settings& settings);           // Recomputes coefficients on change
+    void setCrossFeed(float amount) { crossFeed_.setTarget(amount); }  // 0-1
+    void reset();
+
+    /// wet -> spread -> high cut -> low cut -> cross-feed -> mix with dry and
+    /// gain into output. Without a mix ramp the output is the processed wet
+    /// signal. storeWet also writes the processed wet back (recording tap).
+    /// Outputs may alias the wet or dry buffers.
+    void process(float* wetL, float* wetR, const float* dryL, const float* dryR,
+                 float* outputL, float* outputR, int numSamples,
+                 const ParameterRamp* mix, const ParameterRamp* gain, bool storeWet);
+
+private:
+    // Direct form I, same recurrence as the tone and cross-feed filters; one
+    // coefficient per lane pair
+    struct StereoBiquad {
+        float b0, b1, b2, a1, a2;
+        float x1[2], x2[2], y1[2], y2[2];
+
+        StereoBiquad();
+        void setCoeffs(const AudioMath::BiquadCoeffs& coeffs);
+        void clear();
+    };
+
+    Settings settings_;
+    double sampleRate_;
+    float spreadDirect_;        // Spread as v * direct + swap(v) * swapped
+    float spreadSwapped_;
+    bool spreadActive_;
+    StereoBiquad highCut_;
+    StereoBiquad lowCut_;
+    StereoBiquad crossFeedFilter_;
+    ParameterRamp crossFeed_;
+
+    void updateSpread();
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,89 @@
+#include "ParameterEventQueue.hpp"
+#include <algorithm>
+
+namespace VoiceMonitor {
+
+ParameterEventQueue::ParameterEventQueue(int capacity)
+    : ring_(static_cast<size_t>(std::max(1, capacity)))
+    , schedule_(static_cast<size_t>(std::max(1, capacity)))
+    , head_(0)
+    , count_(0)
+    , blockSamples_(0)
+    , dropped_(0) {
+}
+
+bool ParameterEventQueue::push(ParameterId id, float value, int sampleOffset) {
+    ParameterEvent event;
+    event.sampleOffset = std::max(0, sampleOffset);
+    event.id = id;
+    event.value = value;
+
+    if (!ring_.write(event)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void ParameterEventQueue::beginBlock(int numSamples) {
+    blockSamples_ = numSamples;
+
+    ParameterEvent event;
+    while (ring_.read(event)) {
+        schedule(event);
+    }
+}
+
+void ParameterEventQueue::schedule(const ParameterEvent& event) {
+    if (count_ == static_cast<int>(schedule_.size())) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Usually already in order: append. Otherwise shift later events up by one.
+    int index = count_;
+    while (index > head_ && schedule_[index - 1].sampleOffset > event.sampleOffset) {
+        schedule_[index] = schedule_[index - 1];
+        --index;
+    }
+    schedule_[index] = event;
+    ++count_;
+}
+
+int ParameterEventQueue::nextEventOffset() const {
+    if (head_ == count_) {
+        return blockSamples_;
+    }
+    return std::min(schedule_[head_].sampleOffset, blockSamples_);
+}
+
+bool ParameterEventQueue::popEvent(int position, ParameterEvent& event) {
+    if (head_ == count_ || schedule_[head_].sampleOffset > position) {
+        return false;
+    }
+    event = schedule_[head_++];
+    return true;
+}
+
+void ParameterEventQueue::endBlock() {
+    // Move what is left to the front, rebased to the next block
+    int remaining = 0;
+    for (int i = head_; i < count_; ++i) {
+        ParameterEvent event = schedule_[i];
+        event.sampleOffset = std::max(0, event.sampleOffset - blockSamples_);
+        schedule_[remaining++] = event;
+    }
+    head_ = 0;
+    count_ = remaining;
+    blockSamples_ = 0;
+}
+
+void ParameterEventQueue::clear() {
+    ParameterEvent event;
+    while (ring_.read(event)) {
+    }
+    head_ = 0;
+    count_ = 0;
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "AudioBuffer.hpp"
+
+namespace VoiceMonitor {
+
+/// Automatable ReverbEngine parameters (values in the units of the engine's setters)
+enum class ParameterId : uint8_t {
+    WetDryMix,          // 0-100%
+    DecayTime,          // 0.1-8.0 s
+    PreDelay,           // 0-200 ms
+    CrossFeed,          // 0.0-1.0
+    RoomSize,           // 0.0-1.0
+    Density,            // 0-100%
+    HighFreqDamping,    // 0-100%
+    LowFreqDamping,     // 0-100%
+    StereoWidth,        // 0.0-2.0
+    PhaseInvert,        // > 0.5 = on
+    Bypass,             // > 0.5 = on
+    InputGain,          // -60 to +12 dB
+    OutputGain          // -60 to +12 dB
+};
+
+struct ParameterEvent {
+    int sampleOffset = 0;       // From the start of the block it falls in
+    ParameterId id = ParameterId::WetDryMix;
+    float value = 0.0f;
+};
+
+/// Timestamped parameter changes from one producer thread to the audio thread
+///
+/// push() is wait-free (SPSC ring). Offsets count from the start of the next
+/// block the consumer begins, so a host can schedule a whole buffer of
+/// automation just before processing it; events further out than that block
+/// are carried over. At the start of each block the consumer moves newly
+/// arrived events into a fixed-capacity schedule kept in time order (events at
+/// the same offset keep their push order), then pops them as it reaches their
+/// offsets.
+class ParameterEventQueue {
+public:
+    static constexpr int DEFAULT_CAPACITY = 1024;
+
+    explicit ParameterEventQueue(int capacity = DEFAULT_CAPACITY);
+
+    /// Producer. False if the ring is full (event dropped).
+    bool push(ParameterId id, float value, int sampleOffset = 0);
+
+    /// Consumer: collect the events pushed since the last block
+    void beginBlock(int numSamples);
+
+    /// Offset of the next event in this block, or the block length if none is left
+    int nextEventOffset() const;
+    bool hasEventsInBlock() const { return nextEventOffset() < blockSamples_; }
+
+    /// Next event at or before `position` (in time order)
+    bool popEvent(int position, ParameterEvent& event);
+
+    /// Consumer: carry the events beyond this block into the next one
+    void endBlock();
+
+    /// Consumer: drop everything scheduled or still in the ring
+    void clear();
+
+    /// Events lost to a full ring or schedule
+    uint64_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void schedule(const ParameterEvent& event);
+
+    AudioBuffer<ParameterEvent> ring_;
+    std::vector<ParameterEvent> schedule_;      // Consumer-owned, sorted by offset
+    int head_;                                  // First unapplied event in schedule_
+    int count_;                                 // Events in schedule_ (from index 0)
+    int blockSamples_;
+    std::atomic<uint64_t> dropped_;
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,208 @@
+#include "ParameterRamp.hpp"
+#include "FDNReverb.hpp"   // SIMD_AVAILABLE and the NEON/SSE headers
+#include <algorithm>
+#include <cmath>
+
+#if SIMD_AVAILABLE && defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace VoiceMonitor {
+
+namespace {
+    // A ramp settles once the distance left is this small relative to its target
+    constexpr float SETTLE_THRESHOLD = 1e-5f;
+
+    // output = (dry + mix * (wet - dry)) * gain; constant operands are broadcast
+    template<bool RampMix, bool RampGain>
+    void mixKernel(const float* dry, const float* wet, float* output, int numSamples,
+                   const float* mixValues, float mixValue, const float* gainValues, float gainValue) {
+        int i = 0;
+#if SIMD_AVAILABLE && defined(__ARM_NEON__)
+        const float32x4_t mixConstant = vdupq_n_f32(mixValue);
+        const float32x4_t gainConstant = vdupq_n_f32(gainValue);
+        for (; i + 4 <= numSamples; i += 4) {
+            const float32x4_t d = vld1q_f32(dry + i);
+            const float32x4_t w = vld1q_f32(wet + i);
+            const float32x4_t m = RampMix ? vld1q_f32(mixValues + i) : mixConstant;
+            const float32x4_t g = RampGain ? vld1q_f32(gainValues + i) : gainConstant;
+            vst1q_f32(output + i, vmulq_f32(vmlaq_f32(d, m, vsubq_f32(w, d)), g));
+        }
+#elif SIMD_AVAILABLE && defined(__AVX__)
+        const __m256 mixConstant = _mm256_set1_ps(mixValue);
+        const __m256 gainConstant = _mm256_set1_ps(gainValue);
+        for (; i + 8 <= numSamples; i += 8) {
+            const __m256 d = _mm256_loadu_ps(dry + i);
+            const __m256 w = _mm256_loadu_ps(wet + i);
+            const __m256 m = RampMix ? _mm256_loadu_ps(mixValues + i) : mixConstant;
+            const __m256 g = RampGain ? _mm256_loadu_ps(gainValues + i) : gainConstant;
+            _mm256_storeu_ps(output + i, _mm256_mul_ps(_mm256_add_ps(d, _mm256_mul_ps(m, _mm256_sub_ps(w, d))), g));
+        }
+#elif SIMD_AVAILABLE && defined(__SSE2__)
+        const __m128 mixConstant = _mm_set1_ps(mixValue);
+        const __m128 gainConstant = _mm_set1_ps(gainValue);
+        for (; i + 4 <= numSamples; i += 4) {
+            const __m128 d = _mm_loadu_ps(dry + i);
+            const __m128 w = _mm_loadu_ps(wet + i);
+            const __m128 m = RampMix ? _mm_loadu_ps(mixValues + i) : mixConstant;
+            const __m128 g = RampGain ? _mm_loadu_ps(gainValues + i) : gainConstant;
+            _mm_storeu_ps(output + i, _mm_mul_ps(_mm_add_ps(d, _mm_mul_ps(m, _mm_sub_ps(w, d))), g));
+        }
+#endif
+        for (; i < numSamples; ++i) {
+            const float m = RampMix ? mixValues[i] : mixValue;
+            const float g = RampGain ? gainValues[i] : gainValue;
+            output[i] = (dry[i] + m * (wet[i] - dry[i])) * g;
+        }
+    }
+
+    template<bool RampGain>
+    void gainKernel(const float* input, float* output, int numSamples,
+                    const float* gainValues, float gainValue) {
+        int i = 0;
+#if SIMD_AVAILABLE && defined(__ARM_NEON__)
+        const float32x4_t gainConstant = vdupq_n_f32(gainValue);
+        for (; i + 4 <= numSamples; i += 4) {
+            const float32x4_t g = RampGain ? vld1q_f32(gainValues + i) : gainConstant;
+            vst1q_f32(output + i, vmulq_f32(vld1q_f32(input + i), g));
+        }
+#elif SIMD_AVAILABLE && defined(__AVX__)
+        const __m256 gainConstant = _mm256_set1_ps(gainValue);
+        for (; i + 8 <= numSamples; i += 8) {
+            const __m256 g = RampGain ? _mm256_loadu_ps(gainValues + i) : gainConstant;
+            _mm256_storeu_ps(output + i, _mm256_mul_ps(_mm256_loadu_ps(input + i), g));
+        }
+#elif SIMD_AVAILABLE && defined(__SSE2__)
+        const __m128 gainConstant = _mm_set1_ps(gainValue);
+        for (; i + 4 <= numSamples; i += 4) {
+            const __m128 g = RampGain ? _mm_loadu_ps(gainValues + i) : gainConstant;
+            _mm_storeu_ps(output + i, _mm_mul_ps(_mm_loadu_ps(input + i), g));
+        }
+#endif
+        for (; i < numSamples; ++i) {
+            output[i] = input[i] * (RampGain ? gainValues[i] : gainValue);
+        }
+    }
+}
+
+ParameterRamp::ParameterRamp()
+    : current_(0.0f)
+    , target_(0.0f)
+    , pole_(0.0f)
+    , ramping_(false) {
+}
+
+void ParameterRamp::prepare(double sampleRate, double smoothingSeconds, int maxBlockSize) {
+    values_.assign(static_cast<size_t>(std::max(1, maxBlockSize)), 0.0f);
+    pole_ = (smoothingSeconds > 0.0 && sampleRate > 0.0)
+        ? static_cast<float>(std::exp(-1.0 / (smoothingSeconds * sampleRate)))
+        : 0.0f;
+    snapTo(target_);
+}
+
+void ParameterRamp::snapTo(float value) {
+    current_ = value;
+    target_ = value;
+    ramping_ = false;
+}
+
+bool ParameterRamp::settle() {
+    if (std::fabs(current_ - target_) > SETTLE_THRESHOLD * std::max(1.0f, std::fabs(target_))) {
+        return false;
+    }
+    current_ = target_;
+    return true;
+}
+
+void ParameterRamp::process(int numSamples) {
+    if (settle() || numSamples <= 0) {
+        ramping_ = false;
+        return;
+    }
+    numSamples = std::min(numSamples, static_cast<int>(values_.size()));
+
+    // values[i] = target + distance * pole^(i + 1); `offset` is distance * pole^(i + 1)
+    const float distance = current_ - target_;
+    float* values = values_.data();
+    float offset = distance * pole_;
+    int i = 0;
+
+#if SIMD_AVAILABLE && defined(__ARM_NEON__)
+    const float p2 = pole_ * pole_;
+    const float lanes[4] = { offset, offset * pole_, offset * p2, offset * p2 * pole_ };
+    float32x4_t offsets = vld1q_f32(lanes);
+    const float32x4_t stride = vdupq_n_f32(p2 * p2);
+    const float32x4_t target = vdupq_n_f32(target_);
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(values + i, vaddq_f32(target, offsets));
+        offsets = vmulq_f32(offsets, stride);
+    }
+    offset = vgetq_lane_f32(offsets, 0);
+#elif SIMD_AVAILABLE && defined(__AVX__)
+    float lanes[8];
+    float power = 1.0f;
+    for (int lane = 0; lane < 8; ++lane) {
+        lanes[lane] = offset * power;
+        power *= pole_;
+    }
+    __m256 offsets = _mm256_loadu_ps(lanes);
+    const __m256 stride = _mm256_set1_ps(power);
+    const __m256 target = _mm256_set1_ps(target_);
+    for (; i + 8 <= numSamples; i += 8) {
+        _mm256_storeu_ps(values + i, _mm256_add_ps(target, offsets));
+        offsets = _mm256_mul_ps(offsets, stride);
+    }
+    offset = _mm256_cvtss_f32(offsets);
+#elif SIMD_AVAILABLE && defined(__SSE2__)
+    const float p2 = pole_ * pole_;
+    __m128 offsets = _mm_set_ps(offset * p2 * pole_, offset * p2, offset * pole_, offset);
+    const __m128 stride = _mm_set1_ps(p2 * p2);
+    const __m128 target = _mm_set1_ps(target_);
+    for (; i + 4 <= numSamples; i += 4) {
+        _mm_storeu_ps(values + i, _mm_add_ps(target, offsets));
+        offsets = _mm_mul_ps(offsets, stride);
+    }
+    offset = _mm_cvtss_f32(offsets);
+#endif
+    for (; i < numSamples; ++i) {
+        values[i] = target_ + offset;
+        offset *= pole_;
+    }
+
+    current_ = values[numSamples - 1];
+    ramping_ = true;
+}
+
+float ParameterRamp::advance(int numSamples) {
+    ramping_ = false;
+    if (!settle() && numSamples > 0) {
+        current_ = target_ + (current_ - target_) * std::pow(pole_, static_cast<float>(numSamples));
+        settle();
+    }
+    return current_;
+}
+
+void ParameterRamp::mix(const float* dry, const float* wet, float* output, int numSamples,
+                        const ParameterRamp& mixRamp, const ParameterRamp& gainRamp) {
+    const float* mixValues = mixRamp.getValues();
+    const float* gainValues = gainRamp.getValues();
+    if (mixValues && gainValues) {
+        mixKernel<true, true>(dry, wet, output, numSamples, mixValues, 0.0f, gainValues, 0.0f);
+    } else if (mixValues) {
+        mixKernel<true, false>(dry, wet, output, numSamples, mixValues, 0.0f, nullptr, gainRamp.getValue());
+    } else if (gainValues) {
+        mixKernel<false, true>(dry, wet, output, numSamples, nullptr, mixRamp.getValue(), gainValues, 0.0f);
+    } else {
+        mixKernel<false, false>(dry, wet, output, numSamples, nullptr, mixRamp.getValue(), nullptr, gainRamp.getValue());
+    }
+}
+
+void ParameterRamp::applyGain(const float* input, float* output, int numSamples, const ParameterRamp& gainRamp) {
+    if (const float* gainValues = gainRamp.getValues()) {
+        gainKernel<true>(input, output, numSamples, gainValues, 0.0f);
+    } else {
+        gainKernel<false>(input, output, numSamples, nullptr, gainRamp.getValue());
+    }
+}
+
+} // namespace VoiceMonitor
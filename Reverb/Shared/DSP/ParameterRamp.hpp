@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+namespace VoiceMonitor {
+
+/// One-pole parameter smoother that renders a whole block of values at once
+///
+/// Same response as a per-sample `current += c * (target - current)`, but
+/// generated in closed form (target + distance * pole^n) from a vector of
+/// successive powers of the pole: a moving parameter costs one vector multiply
+/// and add per 4 samples (8 with AVX). Once within a hair of its target the ramp
+/// settles and getValues() returns nullptr, so the kernels below fall back to
+/// a broadcast constant. Audio thread only, apart from prepare().
+class ParameterRamp {
+public:
+    ParameterRamp();
+
+    /// Allocates the value buffer; snaps to the current target
+    void prepare(double sampleRate, double smoothingSeconds, int maxBlockSize);
+
+    void setTarget(float target) { target_ = target; }
+    void snapTo(float value);
+
+    /// Renders the next numSamples values (up to the prepared block size)
+    void process(int numSamples);
+
+    /// Control-rate use: moves numSamples on without rendering, returns the value reached
+    float advance(int numSamples);
+
+    /// Values of the last process() span, or nullptr when it was constant (getValue())
+    const float* getValues() const { return ramping_ ? values_.data() : nullptr; }
+    float getValue() const { return current_; }
+    float getTarget() const { return target_; }
+    bool isRamping() const { return ramping_; }
+
+    // ========================================================================
+    // Fused kernels: one pass, ramped or constant mix and gain
+
+    /// output = (dry + mix * (wet - dry)) * gain
+    static void mix(const float* dry, const float* wet, float* output, int numSamples,
+                    const ParameterRamp& mixRamp, const ParameterRamp& gainRamp);
+
+    /// output = input * gain (in place allowed)
+    static void applyGain(const float* input, float* output, int numSamples, const ParameterRamp& gainRamp);
+
+private:
+    bool settle();
+
+    std::vector<float> values_;
+    float current_;
+    float target_;
+    float pole_;
+    bool ramping_;
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,321 @@
+#include "PolyphaseResampler.hpp"
+#include "FDNReverb.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+
+namespace VoiceMonitor {
+
+struct PolyphaseResampler::Kernel {
+    int taps = 0;
+    int phases = 0;
+    double cutoff = 0.0;                // Fraction of the input Nyquist
+    double beta = 0.0;
+    std::vector<float> coefficients;    // (phases + 1) rows of taps; row p is offset p / phases
+};
+
+namespace {
+    struct QualitySpec {
+        int taps;                       // At the output rate
+        double attenuation;             // dB
+        int arbitraryPhaseBits;         // Table rows for arbitrary ratios (linear interpolation
+                                        // error drops 12 dB per bit)
+    };
+
+    constexpr QualitySpec QUALITY_SPECS[] = {
+        { 24, 60.0, 8 },
+        { 48, 90.0, 8 },
+        { 96, 120.0, 10 },
+        { 192, 140.0, 11 }
+    };
+
+    double besselI0(double x) {
+        double sum = 1.0;
+        double term = 1.0;
+        for (int k = 1; k < 64; ++k) {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+            if (term < sum * 1e-17) {
+                break;
+            }
+        }
+        return sum;
+    }
+
+    std::shared_ptr<const PolyphaseResampler::Kernel> buildKernel(int taps, int phases, double cutoff, double beta) {
+        auto kernel = std::make_shared<PolyphaseResampler::Kernel>();
+        kernel->taps = taps;
+        kernel->phases = phases;
+        kernel->cutoff = cutoff;
+        kernel->beta = beta;
+        kernel->coefficients.resize(static_cast<size_t>(phases + 1) * taps);
+
+        // Row p, tap k weighs input frame (index - taps/2 + 1 + k) for an output
+        // p / phases of a frame after `index`
+        const double half = taps / 2;
+        const double windowNorm = besselI0(beta);
+        for (int p = 0; p <= phases; ++p) {
+            float* row = &kernel->coefficients[static_cast<size_t>(p) * taps];
+            const double offset = static_cast<double>(p) / phases;
+            double sum = 0.0;
+            std::vector<double> values(taps);
+            for (int k = 0; k < taps; ++k) {
+                const double x = offset + half - 1.0 - k;
+                const double position = x / half;
+                if (std::fabs(position) >= 1.0) {
+                    values[k] = 0.0;
+                    continue;
+                }
+                const double arg = M_PI * cutoff * x;
+                const double sinc = (std::fabs(arg) < 1e-12) ? 1.0 : std::sin(arg) / arg;
+                const double window = besselI0(beta * std::sqrt(1.0 - position * position)) / windowNorm;
+                values[k] = cutoff * sinc * window;
+                sum += values[k];
+            }
+
+            // Unity DC gain for every phase
+            for (int k = 0; k < taps; ++k) {
+                row[k] = static_cast<float>(values[k] / sum);
+            }
+        }
+        return kernel;
+    }
+
+    // One table per design, alive as long as some converter uses it
+    std::shared_ptr<const PolyphaseResampler::Kernel> acquireKernel(int taps, int phases, double cutoff, double beta) {
+        static std::mutex mutex;
+        static std::vector<std::weak_ptr<const PolyphaseResampler::Kernel>> cache;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        cache.erase(std::remove_if(cache.begin(), cache.end(),
+                                   [](const auto& entry) { return entry.expired(); }),
+                    cache.end());
+
+        for (const auto& entry : cache) {
+            auto kernel = entry.lock();
+            if (kernel && kernel->taps == taps && kernel->phases == phases &&
+                kernel->cutoff == cutoff && kernel->beta == beta) {
+                return kernel;
+            }
+        }
+
+        auto kernel = buildKernel(taps, phases, cutoff, beta);
+        cache.push_back(kernel);
+        return kernel;
+    }
+
+    inline float dotProduct(const float* samples, const float* taps, int numTaps) {
+        #if SIMD_AVAILABLE && defined(__ARM_NEON__)
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        for (int i = 0; i < numTaps; i += 8) {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(samples + i), vld1q_f32(taps + i));
+            acc1 = vmlaq_f32(acc1, vld1q_f32(samples + i + 4), vld1q_f32(taps + i + 4));
+        }
+        float results[4];
+        vst1q_f32(results, vaddq_f32(acc0, acc1));
+        return results[0] + results[1] + results[2] + results[3];
+        #elif SIMD_AVAILABLE && defined(__SSE2__)
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        for (int i = 0; i < numTaps; i += 8) {
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(samples + i), _mm_loadu_ps(taps + i)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(samples + i + 4), _mm_loadu_ps(taps + i + 4)));
+        }
+        alignas(16) float results[4];
+        _mm_store_ps(results, _mm_add_ps(acc0, acc1));
+        return results[0] + results[1] + results[2] + results[3];
+        #else
+        float sum = 0.0f;
+        for (int i = 0; i < numTaps; ++i) {
+            sum += samples[i] * taps[i];
+        }
+        return sum;
+        #endif
+    }
+
+    inline void blendRows(const float* row0, const float* row1, float amount, float* output, int numTaps) {
+        #if SIMD_AVAILABLE && defined(__ARM_NEON__)
+        const float32x4_t vamount = vdupq_n_f32(amount);
+        for (int i = 0; i < numTaps; i += 4) {
+            const float32x4_t a = vld1q_f32(row0 + i);
+            vst1q_f32(output + i, vmlaq_f32(a, vsubq_f32(vld1q_f32(row1 + i), a), vamount));
+        }
+        #elif SIMD_AVAILABLE && defined(__SSE2__)
+        const __m128 vamount = _mm_set1_ps(amount);
+        for (int i = 0; i < numTaps; i += 4) {
+            const __m128 a = _mm_loadu_ps(row0 + i);
+            _mm_storeu_ps(output + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(row1 + i), a), vamount)));
+        }
+        #else
+        for (int i = 0; i < numTaps; ++i) {
+            output[i] = row0[i] + (row1[i] - row0[i]) * amount;
+        }
+        #endif
+    }
+
+    bool isWholeRate(double rate) {
+        return rate == std::floor(rate) && rate < 4.0e9;
+    }
+}
+
+PolyphaseResampler::PolyphaseResampler()
+    : rows_(nullptr)
+    , numChannels_(0)
+    , halfTaps_(0)
+    , ratio_(1.0)
+    , passbandEdge_(0.0)
+    , rational_(true)
+    , phases_(1)
+    , step_(1)
+    , phase_(0)
+    , stepFrames_(1)
+    , stepFraction_(0)
+    , fraction_(0)
+    , rowShift_(56)
+    , count_(0)
+    , index_(0) {
+}
+
+PolyphaseResampler::~PolyphaseResampler() = default;
+
+double PolyphaseResampler::getStopbandAttenuation(Quality quality) {
+    return QUALITY_SPECS[static_cast<int>(quality)].attenuation;
+}
+
+bool PolyphaseResampler::prepare(double inputRate, double outputRate, int numChannels, Quality quality) {
+    if (inputRate <= 0.0 || outputRate <= 0.0 || numChannels < 1 || numChannels > MAX_CHANNELS) {
+        return false;
+    }
+
+    numChannels_ = numChannels;
+    ratio_ = outputRate / inputRate;
+
+    // Phase mode
+    const QualitySpec& spec = QUALITY_SPECS[static_cast<int>(quality)];
+    rational_ = false;
+    if (isWholeRate(inputRate) && isWholeRate(outputRate)) {
+        const int64_t in = static_cast<int64_t>(inputRate);
+        const int64_t out = static_cast<int64_t>(outputRate);
+        const int64_t divisor = std::gcd(in, out);
+        if (out / divisor <= MAX_RATIONAL_PHASES) {
+            rational_ = true;
+            phases_ = static_cast<int>(out / divisor);
+            step_ = in / divisor;
+        }
+    }
+    if (!rational_) {
+        phases_ = 1 << spec.arbitraryPhaseBits;
+        rowShift_ = 64 - spec.arbitraryPhaseBits;
+        const long double step = static_cast<long double>(inputRate) / outputRate;
+        stepFrames_ = static_cast<int>(step);
+        stepFraction_ = static_cast<uint64_t>(std::ldexp(step - stepFrames_, 64));
+    }
+
+    // Kaiser design: the transition band the length allows at this attenuation,
+    // placed so the stopband starts at the lower Nyquist. Downsampling stretches
+    // the filter over proportionally more input frames.
+    const double bandScale = std::min(1.0, ratio_);
+    const double transition = (spec.attenuation - 8.0) / (2.285 * (spec.taps - 1) * M_PI);
+    const double beta = 0.1102 * (spec.attenuation - 8.7);
+    const double cutoff = bandScale * (1.0 - 0.5 * transition);
+    const int taps = ((static_cast<int>(std::ceil(spec.taps / bandScale)) + 7) / 8) * 8;
+
+    passbandEdge_ = 1.0 - transition;
+    halfTaps_ = taps / 2;
+    kernel_ = acquireKernel(taps, phases_, cutoff, beta);
+    rows_ = kernel_->coefficients.data();
+
+    for (int ch = 0; ch < numChannels_; ++ch) {
+        history_[ch].assign(static_cast<size_t>(taps + INPUT_CHUNK), 0.0f);
+    }
+    for (int ch = numChannels_; ch < MAX_CHANNELS; ++ch) {
+        history_[ch].clear();
+    }
+    blendedRow_.assign(static_cast<size_t>(taps), 0.0f);
+
+    reset();
+    return true;
+}
+
+void PolyphaseResampler::reset() {
+    // Silence before the first frame, which sits at index halfTaps_ - 1 so the
+    // first output's window starts at the beginning of the history
+    for (int ch = 0; ch < numChannels_; ++ch) {
+        std::fill(history_[ch].begin(), history_[ch].end(), 0.0f);
+    }
+    count_ = halfTaps_ - 1;
+    index_ = halfTaps_ - 1;
+    phase_ = 0;
+    fraction_ = 0;
+}
+
+int PolyphaseResampler::getMaxOutputFrames(int numInputFrames) const {
+    return static_cast<int>(std::ceil(numInputFrames * ratio_)) + 2;
+}
+
+int PolyphaseResampler::process(const float* const* input, int numInputFrames, float* const* output) {
+    if (!kernel_) {
+        return 0;
+    }
+
+    const int taps = halfTaps_ * 2;
+    int produced = 0;
+
+    for (int offset = 0; offset < numInputFrames; offset += INPUT_CHUNK) {
+        const int frames = std::min(INPUT_CHUNK, numInputFrames - offset);
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            std::copy(input[ch] + offset, input[ch] + offset + frames, history_[ch].data() + count_);
+        }
+        count_ += frames;
+
+        // Every output whose window is complete
+        while (index_ + halfTaps_ < count_) {
+            const float* row;
+            if (rational_) {
+                row = rows_ + static_cast<size_t>(phase_) * taps;
+            } else {
+                const uint64_t position = fraction_ >> rowShift_;
+                const uint64_t remainder = (fraction_ << (64 - rowShift_)) >> 40;     // 24 bits
+                const float amount = static_cast<float>(remainder) * (1.0f / 16777216.0f);
+                const float* row0 = rows_ + static_cast<size_t>(position) * taps;
+                blendRows(row0, row0 + taps, amount, blendedRow_.data(), taps);
+                row = blendedRow_.data();
+            }
+
+            const int start = index_ - halfTaps_ + 1;
+            for (int ch = 0; ch < numChannels_; ++ch) {
+                output[ch][produced] = dotProduct(history_[ch].data() + start, row, taps);
+            }
+            ++produced;
+
+            if (rational_) {
+                phase_ += step_;
+                index_ += static_cast<int>(phase_ / phases_);
+                phase_ %= phases_;
+            } else {
+                const uint64_t fraction = fraction_ + stepFraction_;
+                index_ += stepFrames_ + (fraction < fraction_ ? 1 : 0);
+                fraction_ = fraction;
+            }
+        }
+
+        // Drop the frames no future window reaches (with a large downsampling
+        // step the next output may lie beyond what has arrived)
+        const int drop = std::min(count_, index_ - halfTaps_ + 1);
+        if (drop > 0) {
+            for (int ch = 0; ch < numChannels_; ++ch) {
+                float* history = history_[ch].data();
+                std::memmove(history, history + drop, static_cast<size_t>(count_ - drop) * sizeof(float));
+            }
+            count_ -= drop;
+            index_ -= drop;
+        }
+    }
+
+    return produced;
+}
+
+} // namespace VoiceMonitor
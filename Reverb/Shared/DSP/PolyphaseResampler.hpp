@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace VoiceMonitor {
+
+/// Band-limited sample-rate converter (Kaiser-windowed sinc, polyphase)
+///
+/// Rate pairs whose reduced ratio needs at most MAX_RATIONAL_PHASES phases
+/// (44.1 <-> 48 kHz, any integer factor) step through the phases exactly;
+/// any other ratio steps a 64-bit fixed-point fraction through a table of 256
+/// (Draft, Standard) to 2048 (Mastering) phases and interpolates linearly
+/// between neighbouring rows, finely enough to stay below the stopband. Each
+/// output frame is one SIMD dot product per channel.
+///
+/// Coefficient tables are immutable and shared: converters with the same
+/// quality, phase count and cutoff reference one table, built on first use in
+/// prepare() (not real-time safe). process() does not allocate.
+///
+/// Output frame n lines up with input time n * inputRate / outputRate, counted
+/// from the first input frame after reset(). It is written once
+/// getLookaheadFrames() further input frames have arrived, so a file is
+/// flushed with that many frames of silence.
+class PolyphaseResampler {
+public:
+    /// Filter length (in output-rate taps; downsampling widens it to match)
+    /// and stopband attenuation. The passband ends where the transition band
+    /// has to start for the stopband to begin at the output Nyquist.
+    enum class Quality {
+        Draft,          // 24 taps, 60 dB
+        Standard,       // 48 taps, 90 dB
+        High,           // 96 taps, 120 dB
+        Mastering       // 192 taps, 140 dB
+    };
+
+    static constexpr int MAX_CHANNELS = 8;
+    static constexpr int MAX_RATIONAL_PHASES = 1024;
+    static constexpr int INPUT_CHUNK = 512;         // Input frames buffered per pass
+
+    struct Kernel;
+
+public:
+    PolyphaseResampler();
+    ~PolyphaseResampler();
+
+    PolyphaseResampler(const PolyphaseResampler&) = delete;
+    PolyphaseResampler& operator=(const PolyphaseResampler&) = delete;
+
+    /// Pick the phase mode, acquire the shared table and allocate the history
+    bool prepare(double inputRate, double outputRate, int numChannels, Quality quality = Quality::Standard);
+    void reset();
+
+    /// Consume numInputFrames and write every output frame that became available.
+    /// output must hold getMaxOutputFrames(numInputFrames) frames per channel.
+    /// @return Frames written
+    int process(const float* const* input, int numInputFrames, float* const* output);
+
+    int getMaxOutputFrames(int numInputFrames) const;
+    int getLookaheadFrames() const { return halfTaps_; }    // Input frames
+    int getNumTaps() const { return halfTaps_ * 2; }
+    int getNumChannels() const { return numChannels_; }
+    double getRatio() const { return ratio_; }              // Output rate / input rate
+    bool isRational() const { return rational_; }
+    bool isPrepared() const { return kernel_ != nullptr; }
+
+    /// Passband edge as a fraction of the lower of the two Nyquist frequencies
+    double getPassbandEdge() const { return passbandEdge_; }
+
+    static double getStopbandAttenuation(Quality quality);     // dB
+
+private:
+    std::shared_ptr<const Kernel> kernel_;
+    const float* rows_;                 // kernel_->coefficients, (phases + 1) rows
+    int numChannels_;
+    int halfTaps_;
+    double ratio_;
+    double passbandEdge_;
+    bool rational_;
+
+    // Rational stepping: phase_ / phases_ of an input frame, + step_ per output
+    int phases_;
+    int64_t step_;
+    int64_t phase_;
+
+    // Arbitrary stepping: whole frames plus a 0.64 fixed-point fraction per output
+    // (top bits of the fraction pick the row, the next ones blend it with the
+    // following row)
+    int stepFrames_;
+    uint64_t stepFraction_;
+    uint64_t fraction_;
+    int rowShift_;
+
+    // History: frames from the oldest one the next output reads (index_ is the
+    // frame at or before the next output time)
+    std::vector<float> history_[MAX_CHANNELS];
+    int count_;
+    int index_;
+
+    std::vector<float> blendedRow_;     // Arbitrary mode: interpolated phase row
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,162 @@
+#include "QualityGovernor.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace VoiceMonitor {
+
+namespace {
+    // Indexed by QualityTier
+    const QualityGovernor::TierConfig TIER_CONFIGS[QualityGovernor::NUM_TIERS] = {
+        { 8, 8, true,  true  },     // Maximum
+        { 6, 8, true,  true  },     // High
+        { 6, 4, false, false },     // Standard
+        { 4, 2, false, false }      // Minimal
+    };
+}
+
+const QualityGovernor::TierConfig& QualityGovernor::getTierConfig(QualityTier tier) {
+    const int index = std::clamp(static_cast<int>(tier), 0, NUM_TIERS - 1);
+    return TIER_CONFIGS[index];
+}
+
+QualityGovernor::QualityGovernor()
+    : sampleRate_(48000.0)
+    , tier_(0)
+    , averageLoad_(0.0)
+    , samplesSinceChange_(0.0)
+    , samplesWithHeadroom_(0.0)
+    , upgradeHoldoff_(UPGRADE_HOLDOFF)
+    , lastChangeWasUpgrade_(false)
+    , cpuBudget_(DEFAULT_CPU_BUDGET)
+    , enabled_(false)
+    , ceiling_(0)
+    , publishedTier_(0)
+    , publishedAverage_(0.0)
+    , peakLoad_(0.0)
+    , downgrades_(0)
+    , upgrades_(0)
+    , spikes_(0) {
+}
+
+void QualityGovernor::prepare(double sampleRate) {
+    sampleRate_ = sampleRate > 0.0 ? sampleRate : 48000.0;
+    reset();
+}
+
+void QualityGovernor::reset() {
+    tier_ = std::clamp(ceiling_.load(std::memory_order_relaxed), 0, NUM_TIERS - 1);
+    averageLoad_ = 0.0;
+    samplesSinceChange_ = 0.0;
+    samplesWithHeadroom_ = 0.0;
+    upgradeHoldoff_ = UPGRADE_HOLDOFF;
+    lastChangeWasUpgrade_ = false;
+
+    publishedTier_.store(tier_, std::memory_order_relaxed);
+    publishedAverage_.store(0.0, std::memory_order_relaxed);
+    peakLoad_.store(0.0, std::memory_order_relaxed);
+    downgrades_.store(0, std::memory_order_relaxed);
+    upgrades_.store(0, std::memory_order_relaxed);
+    spikes_.store(0, std::memory_order_relaxed);
+}
+
+QualityTier QualityGovernor::update(double load, int numSamples, bool transitioning) {
+    const int ceiling = std::clamp(ceiling_.load(std::memory_order_relaxed), 0, NUM_TIERS - 1);
+
+    // Fixed quality, or a ceiling that was just lowered below the current tier
+    if (!enabled_.load(std::memory_order_relaxed) || tier_ < ceiling) {
+        if (tier_ != ceiling) {
+            tier_ = ceiling;
+            samplesSinceChange_ = 0.0;
+            samplesWithHeadroom_ = 0.0;
+            publishedTier_.store(tier_, std::memory_order_relaxed);
+        }
+        return static_cast<QualityTier>(tier_);
+    }
+
+    if (transitioning || numSamples <= 0) {
+        return static_cast<QualityTier>(tier_);
+    }
+
+    peakLoad_.store(std::max(peakLoad_.load(std::memory_order_relaxed), load), std::memory_order_relaxed);
+
+    // Exponential average with a fixed time constant whatever the block size;
+    // restarted from the first block after every tier change
+    const double samples = static_cast<double>(numSamples);
+    if (samplesSinceChange_ == 0.0) {
+        averageLoad_ = load;
+    } else {
+        const double alpha = 1.0 - std::exp(-samples / (LOAD_TIME_CONSTANT * sampleRate_));
+        averageLoad_ += alpha * (load - averageLoad_);
+    }
+    samplesSinceChange_ += samples;
+    publishedAverage_.store(averageLoad_, std::memory_order_relaxed);
+
+    const double budget = cpuBudget_.load(std::memory_order_relaxed);
+    const bool settled = samplesSinceChange_ >= LOAD_TIME_CONSTANT * sampleRate_;
+
+    if (tier_ < NUM_TIERS - 1) {
+        // A block this slow is nearly an xrun: do not wait for the average
+        if (load > SPIKE_THRESHOLD) {
+            changeTier(tier_ + 1, true);
+            return static_cast<QualityTier>(tier_);
+        }
+        if (settled && averageLoad_ > budget) {
+            changeTier(tier_ + 1, false);
+            return static_cast<QualityTier>(tier_);
+        }
+    }
+
+    // An upgrade that held for a full holdoff earns back a shorter wait
+    if (lastChangeWasUpgrade_ && samplesSinceChange_ >= upgradeHoldoff_ * sampleRate_) {
+        upgradeHoldoff_ = std::max(UPGRADE_HOLDOFF, upgradeHoldoff_ * 0.5);
+        lastChangeWasUpgrade_ = false;
+    }
+
+    if (averageLoad_ < budget * RECOVERY_FACTOR) {
+        samplesWithHeadroom_ += samples;
+    } else {
+        samplesWithHeadroom_ = 0.0;
+    }
+
+    if (tier_ > ceiling && samplesWithHeadroom_ >= upgradeHoldoff_ * sampleRate_) {
+        changeTier(tier_ - 1, false);
+    }
+
+    return static_cast<QualityTier>(tier_);
+}
+
+void QualityGovernor::changeTier(int tier, bool spike) {
+    const bool upgrade = tier < tier_;
+
+    if (upgrade) {
+        upgrades_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        // Undoing a recent upgrade means the headroom was not real
+        if (lastChangeWasUpgrade_ && samplesSinceChange_ < upgradeHoldoff_ * sampleRate_) {
+            upgradeHoldoff_ = std::min(MAX_UPGRADE_HOLDOFF, upgradeHoldoff_ * 2.0);
+        }
+        downgrades_.fetch_add(1, std::memory_order_relaxed);
+        if (spike) {
+            spikes_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    lastChangeWasUpgrade_ = upgrade;
+    tier_ = tier;
+    samplesSinceChange_ = 0.0;
+    samplesWithHeadroom_ = 0.0;
+    publishedTier_.store(tier_, std::memory_order_relaxed);
+}
+
+QualityGovernor::Statistics QualityGovernor::getStatistics() const {
+    Statistics stats;
+    stats.tier = getTier();
+    stats.averageLoad = publishedAverage_.load(std::memory_order_relaxed);
+    stats.peakLoad = peakLoad_.load(std::memory_order_relaxed);
+    stats.downgrades = downgrades_.load(std::memory_order_relaxed);
+    stats.upgrades = upgrades_.load(std::memory_order_relaxed);
+    stats.spikes = spikes_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace VoiceMonitor
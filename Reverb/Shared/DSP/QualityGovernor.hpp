@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace VoiceMonitor {
+
+/// FDN quality tiers, best first (mirrors MemoryBatteryManager's ProcessingQuality)
+enum class QualityTier {
+    Maximum = 0,    // Full network: every line, all diffusion stages, modulated linear reads
+    High,           // Six lines
+    Standard,       // Six lines, half the diffusion, static nearest-sample delays
+    Minimal         // Four lines, two diffusion stages, static delays
+};
+
+/// CPU-budget governor for the reverb engine
+///
+/// Fed the measured load of every processed block (processing time over block
+/// duration), it picks the FDN tier the engine should run. A single block over
+/// the spike threshold, or a smoothed load above the budget, drops one tier at
+/// once; only a long stretch well under budget raises quality again. Each time
+/// an upgrade is undone soon after, the wait before the next upgrade doubles, so
+/// a load sitting on a tier boundary settles instead of oscillating.
+///
+/// Disabled by default: tier switches change the sound, so hosts opt in.
+/// Disabled, it holds the ceiling tier.
+///
+/// update() runs on the audio thread; budget, enable flag and ceiling are
+/// atomics and may be changed from any thread.
+class QualityGovernor {
+public:
+    static constexpr int NUM_TIERS = 4;
+    static constexpr double DEFAULT_CPU_BUDGET = 0.5;      // Fraction of the block period
+    static constexpr double SPIKE_THRESHOLD = 0.9;         // One block this close to an xrun
+    static constexpr double RECOVERY_FACTOR = 0.5;         // Upgrade below budget * this
+    static constexpr double LOAD_TIME_CONSTANT = 0.2;      // Seconds
+    static constexpr double UPGRADE_HOLDOFF = 3.0;         // Seconds of headroom before upgrading
+    static constexpr double MAX_UPGRADE_HOLDOFF = 30.0;
+
+    struct TierConfig {
+        int delayLines;
+        int diffusionStages;
+        bool interpolation;     // Linear (true) or nearest-sample modulated reads
+        bool modulation;
+    };
+
+    struct Statistics {
+        QualityTier tier = QualityTier::Maximum;
+        double averageLoad = 0.0;           // Smoothed, fraction of the block period
+        double peakLoad = 0.0;
+        uint64_t downgrades = 0;
+        uint64_t upgrades = 0;
+        uint64_t spikes = 0;                // Downgrades triggered by a single block
+    };
+
+    static const TierConfig& getTierConfig(QualityTier tier);
+
+    QualityGovernor();
+
+    /// Set the time base and start over at the ceiling tier
+    void prepare(double sampleRate);
+    void reset();
+
+    /// Audio thread: account one block and return the tier to run.
+    /// While the engine is crossfading between tiers the load is not representative
+    /// (both networks run) and is ignored.
+    QualityTier update(double load, int numSamples, bool transitioning);
+
+    // Control (any thread)
+    void setCpuBudget(double budget) { cpuBudget_.store(budget > 0.0 ? budget : DEFAULT_CPU_BUDGET, std::memory_order_relaxed); }
+    void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    void setCeiling(QualityTier tier) { ceiling_.store(static_cast<int>(tier), std::memory_order_relaxed); }
+    double getCpuBudget() const { return cpuBudget_.load(std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+    QualityTier getCeiling() const { return static_cast<QualityTier>(ceiling_.load(std::memory_order_relaxed)); }
+
+    QualityTier getTier() const { return static_cast<QualityTier>(publishedTier_.load(std::memory_order_relaxed)); }
+    Statistics getStatistics() const;
+
+private:
+    void changeTier(int tier, bool spike);
+
+    double sampleRate_;
+
+    // Audio thread state
+    int tier_;
+    double averageLoad_;
+    double samplesSinceChange_;
+    double samplesWithHeadroom_;
+    double upgradeHoldoff_;             // Seconds, doubled on oscillation
+    bool lastChangeWasUpgrade_;
+
+    std::atomic<double> cpuBudget_;
+    std::atomic<bool> enabled_;
+    std::atomic<int> ceiling_;
+
+    // Published for other threads
+    std::atomic<int> publishedTier_;
+    std::atomic<double> publishedAverage_;
+    std::atomic<double> peakLoad_;
+    std::atomic<uint64_t> downgrades_;
+    std::atomic<uint64_t> upgrades_;
+    std::atomic<uint64_t> spikes_;
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,269 @@
+// The checked build defines printf itself, which the fortified inline wrappers would clash with
+#undef _FORTIFY_SOURCE
+
+#include "RealtimeSafety.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if VM_RT_SAFETY_CHECKS
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <ctime>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace VoiceMonitor {
+
+namespace {
+    struct ThreadState {
+        int depth;                      // Open Scopes
+        bool reporting;                 // Inside check(): the report's own calls are not violations
+    };
+
+    thread_local ThreadState threadState = { 0, false };
+
+    std::atomic<int> mode{static_cast<int>(RealtimeSafety::Mode::Report)};
+    std::atomic<uint64_t> violations{0};
+
+    // Environment default, and backtrace() warmed up (its first call loads the unwinder)
+    struct Startup {
+        Startup() {
+            const char* setting = std::getenv("VM_RT_SAFETY");
+            if (setting && std::strcmp(setting, "abort") == 0) {
+                mode.store(static_cast<int>(RealtimeSafety::Mode::Abort), std::memory_order_relaxed);
+            }
+#if VM_RT_SAFETY_CHECKS
+            void* frames[1];
+            backtrace(frames, 1);
+#endif
+        }
+    } startup;
+}
+
+void RealtimeSafety::setMode(Mode newMode) {
+    mode.store(static_cast<int>(newMode), std::memory_order_relaxed);
+}
+
+RealtimeSafety::Mode RealtimeSafety::getMode() {
+    return static_cast<Mode>(mode.load(std::memory_order_relaxed));
+}
+
+bool RealtimeSafety::isRealtimeThread() {
+    return threadState.depth > 0;
+}
+
+uint64_t RealtimeSafety::getViolationCount() {
+    return violations.load(std::memory_order_relaxed);
+}
+
+void RealtimeSafety::enter() {
+    ++threadState.depth;
+}
+
+void RealtimeSafety::leave() {
+    --threadState.depth;
+}
+
+void RealtimeSafety::check(const char* call) {
+    ThreadState& state = threadState;
+    if (state.depth == 0 || state.reporting) {
+        return;
+    }
+    state.reporting = true;
+
+    const uint64_t count = violations.fetch_add(1, std::memory_order_relaxed) + 1;
+#if VM_RT_SAFETY_CHECKS
+    const bool abortNow = getMode() == Mode::Abort;
+    if (abortNow || count <= static_cast<uint64_t>(MAX_REPORTS)) {
+        char line[128];
+        const int length = snprintf(line, sizeof(line), "RealtimeSafety: %s on a real-time thread (violation %llu)\n",
+                                    call, static_cast<unsigned long long>(count));
+        if (write(STDERR_FILENO, line, static_cast<size_t>(length)) < 0) {
+            // Nowhere left to report to
+        }
+        void* frames[MAX_FRAMES];
+        const int depth = backtrace(frames, MAX_FRAMES);
+        backtrace_symbols_fd(frames + 1, depth - 1, STDERR_FILENO);     // Without check() itself
+    }
+    if (abortNow) {
+        abort();
+    }
+#else
+    (void)call;
+    (void)count;
+#endif
+
+    state.reporting = false;
+}
+
+} // namespace VoiceMonitor
+
+// ============================================================================
+// Interposers (glibc): replace the libc symbols for the whole process and
+// forward to the real implementation after the check
+// ============================================================================
+
+#if VM_RT_SAFETY_CHECKS
+
+namespace {
+    template <typename Function>
+    Function nextSymbol(const char* name) {
+        return reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+    }
+}
+
+#define VM_RT_NEXT(name) \
+    static const auto next = nextSymbol<decltype(&::name)>(#name)
+
+using VoiceMonitor::RealtimeSafety;
+
+extern "C" {
+
+// glibc's own allocator entry points, so the interposers never recurse through dlsym
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* pointer);
+
+int __printf_chk(int flag, const char* format, ...);
+int __vprintf_chk(int flag, const char* format, va_list arguments);
+
+void* malloc(size_t size) {
+    RealtimeSafety::check("malloc");
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    RealtimeSafety::check("calloc");
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+    RealtimeSafety::check("realloc");
+    return __libc_realloc(pointer, size);
+}
+
+void free(void* pointer) {
+    if (pointer) {
+        RealtimeSafety::check("free");
+    }
+    __libc_free(pointer);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    RealtimeSafety::check("aligned_alloc");
+    return __libc_memalign(alignment, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    RealtimeSafety::check("memalign");
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** pointer, size_t alignment, size_t size) {
+    RealtimeSafety::check("posix_memalign");
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    void* memory = __libc_memalign(alignment, size);
+    if (!memory) {
+        return ENOMEM;
+    }
+    *pointer = memory;
+    return 0;
+}
+
+int printf(const char* format, ...) {
+    RealtimeSafety::check("printf");
+    va_list arguments;
+    va_start(arguments, format);
+    const int result = vprintf(format, arguments);
+    va_end(arguments);
+    return result;
+}
+
+int __printf_chk(int flag, const char* format, ...) {
+    RealtimeSafety::check("printf");
+    va_list arguments;
+    va_start(arguments, format);
+    const int result = __vprintf_chk(flag, format, arguments);
+    va_end(arguments);
+    return result;
+}
+
+int puts(const char* text) {
+    RealtimeSafety::check("puts");
+    VM_RT_NEXT(puts);
+    return next(text);
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) {
+    RealtimeSafety::check("pthread_mutex_lock");
+    VM_RT_NEXT(pthread_mutex_lock);
+    return next(mutex);
+}
+
+int pthread_cond_wait(pthread_cond_t* condition, pthread_mutex_t* mutex) {
+    RealtimeSafety::check("pthread_cond_wait");
+    VM_RT_NEXT(pthread_cond_wait);
+    return next(condition, mutex);
+}
+
+int pthread_cond_timedwait(pthread_cond_t* condition, pthread_mutex_t* mutex, const struct timespec* time) {
+    RealtimeSafety::check("pthread_cond_timedwait");
+    VM_RT_NEXT(pthread_cond_timedwait);
+    return next(condition, mutex, time);
+}
+
+int nanosleep(const struct timespec* duration, struct timespec* remaining) {
+    RealtimeSafety::check("nanosleep");
+    VM_RT_NEXT(nanosleep);
+    return next(duration, remaining);
+}
+
+int clock_nanosleep(clockid_t clock, int flags, const struct timespec* time, struct timespec* remaining) {
+    RealtimeSafety::check("clock_nanosleep");
+    VM_RT_NEXT(clock_nanosleep);
+    return next(clock, flags, time, remaining);
+}
+
+int usleep(useconds_t microseconds) {
+    RealtimeSafety::check("usleep");
+    VM_RT_NEXT(usleep);
+    return next(microseconds);
+}
+
+int sched_yield() {
+    RealtimeSafety::check("sched_yield");
+    VM_RT_NEXT(sched_yield);
+    return next();
+}
+
+ssize_t read(int descriptor, void* buffer, size_t size) {
+    RealtimeSafety::check("read");
+    VM_RT_NEXT(read);
+    return next(descriptor, buffer, size);
+}
+
+ssize_t write(int descriptor, const void* buffer, size_t size) {
+    RealtimeSafety::check("write");
+    VM_RT_NEXT(write);
+    return next(descriptor, buffer, size);
+}
+
+int fsync(int descriptor) {
+    RealtimeSafety::check("fsync");
+    VM_RT_NEXT(fsync);
+    return next(descriptor);
+}
+
+} // extern "C"
+
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+// Real-time safety checks are compiled in only with VM_RT_SAFETY_CHECKS=1
+// (CMake option ENABLE_RT_SAFETY_CHECKS, Linux/glibc); otherwise VM_RT_SCOPE
+// expands to nothing and no allocator or libc call is interposed
+#ifndef VM_RT_SAFETY_CHECKS
+#define VM_RT_SAFETY_CHECKS 0
+#endif
+
+namespace VoiceMonitor {
+
+/// Debug mode that catches allocations, locks and blocking calls on the audio path
+///
+/// Code that must be real-time safe - ReverbEngine::processBlock(), the
+/// FDNPipeline helper's loop work - opens a Scope, which marks the calling
+/// thread. The checked build interposes malloc/calloc/realloc/free and the
+/// aligned allocators (operator new and delete land there too), the stdio
+/// printers, pthread mutex and condition waits, sleeps and read/write/fsync;
+/// each of them, called while the thread is marked, is a violation. It is
+/// counted and reported on stderr with a stack trace (the first MAX_REPORTS),
+/// or aborts the process in Abort mode (environment VM_RT_SAFETY=abort).
+///
+/// Unmarked threads pay one thread-local load per interposed call.
+class RealtimeSafety {
+public:
+    static constexpr bool ENABLED = VM_RT_SAFETY_CHECKS != 0;
+    static constexpr int MAX_REPORTS = 16;      // Stack traces printed; later violations are only counted
+    static constexpr int MAX_FRAMES = 32;       // Per stack trace
+
+    enum class Mode {
+        Report,
+        Abort
+    };
+
+    /// Marks the calling thread as real-time for its lifetime (nests)
+    class Scope {
+    public:
+        Scope() { enter(); }
+        ~Scope() { leave(); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    static void setMode(Mode mode);
+    static Mode getMode();
+
+    static bool isRealtimeThread();
+    static uint64_t getViolationCount();
+
+    /// Interposers: `call` happened on this thread; reports it if the thread is marked
+    static void check(const char* call);
+
+private:
+    static void enter();
+    static void leave();
+};
+
+} // namespace VoiceMonitor
+
+#if VM_RT_SAFETY_CHECKS
+#define VM_RT_SCOPE_CONCAT2(a, b) a##b
+#define VM_RT_SCOPE_CONCAT(a, b) VM_RT_SCOPE_CONCAT2(a, b)
+#define VM_RT_SCOPE() ::VoiceMonitor::RealtimeSafety::Scope VM_RT_SCOPE_CONCAT(realtimeScope, __LINE__)
+#else
+#define VM_RT_SCOPE() ((void)0)
+#endif
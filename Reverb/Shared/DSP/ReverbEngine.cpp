@@ -1,33 +1,44 @@
 #include "ReverbEngine.hpp"
 #include "FDNReverb.hpp"
 #include "AudioMath.hpp"
+#include "MultiStreamRecorder.hpp"
+#include "RealtimeSafety.hpp"
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <functional>
 #include <memory>
 
 namespace VoiceMonitor {
 
-// Parameter smoothing class for glitch-free parameter changes
-class ReverbEngine::ParameterSmoother {
-public:
-    ParameterSmoother(double sampleRate) : sampleRate_(sampleRate) {
-        setSmoothingTime(0.05); // 50ms smoothing time
-    }
-    
-    void setSmoothingTime(double timeInSeconds) {
-        smoothingCoeff_ = 1.0 - std::exp(-1.0 / (timeInSeconds * sampleRate_));
+namespace {
+    void configureTier(FDNReverb& fdn, QualityTier tier) {
+        const QualityGovernor::TierConfig& config = QualityGovernor::getTierConfig(tier);
+        fdn.setActiveDelayLines(config.delayLines);
+        fdn.setDiffusionStages(config.diffusionStages);
+        fdn.setInterpolation(config.interpolation);
+        fdn.setModulationEnabled(config.modulation);
     }
     
-    float process(float target, float& current) {
-        current += smoothingCoeff_ * (target - current);
-        return current;
-    }
-    
-private:
-    double sampleRate_;
-    double smoothingCoeff_;
-};
+#if VM_TRACING
+    // Trace event names, in ParameterId order
+    const char* const PARAMETER_TRACE_NAMES[] = {
+        "param.wet_dry_mix",
+        "param.decay_time",
+        "param.pre_delay",
+        "param.cross_feed",
+        "param.room_size",
+        "param.density",
+        "param.high_freq_damping",
+        "param.low_freq_damping",
+        "param.stereo_width",
+        "param.phase_invert",
+        "param.bypass",
+        "param.input_gain",
+        "param.output_gain"
+    };
+#endif
+}
 
 // Cross-feed processor for stereo width control (now replaced by StereoEnhancer)
 class ReverbEngine::InternalCrossFeedProcessor {
@@ -50,35 +61,140 @@ ReverbEngine::ReverbEngine()
     : currentPreset_(Preset::Clean)
     , sampleRate_(44100.0)
     , maxBlockSize_(512)
-    , initialized_(false) {
+    , initialized_(false)
+    , hostSampleRate_(44100.0)
+    , hostMaxBlockSize_(512)
+    , hostLatency_(0)
+    , rateAdapted_(false)
+    , blocksProcessed_(0)
+    , parameterEventsApplied_(0)
+    , lastBufferFlushes_(0)
+    , lastCoefficientUpdates_(0)
+    , lastParameterEvents_(0)
+    , lastRoomSize_(0.0f)
+    , activeTier_(QualityTier::Maximum)
+    , crossfadeLength_(0)
+    , crossfadeRemaining_(0)
+    , pipelineActive_(false) {
 }
 
 ReverbEngine::~ReverbEngine() = default;
 
+double ReverbEngine::engineSampleRateFor(double hostSampleRate) {
+    if (hostSampleRate < MIN_HOST_SAMPLE_RATE || hostSampleRate > MAX_HOST_SAMPLE_RATE) {
+        return 0.0;
+    }
+    if (hostSampleRate < MIN_SAMPLE_RATE) {
+        return std::ceil(MIN_SAMPLE_RATE / hostSampleRate) * hostSampleRate;
+    }
+    if (hostSampleRate > MAX_SAMPLE_RATE) {
+        return hostSampleRate / std::ceil(hostSampleRate / MAX_SAMPLE_RATE);
+    }
+    return hostSampleRate;
+}
+
 bool ReverbEngine::initialize(double sampleRate, int maxBlockSize) {
-    if (sampleRate < MIN_SAMPLE_RATE || sampleRate > MAX_SAMPLE_RATE) {
+    const double engineRate = engineSampleRateFor(sampleRate);
+    if (engineRate == 0.0 || maxBlockSize <= 0) {
         return false;
     }
     
-    sampleRate_ = sampleRate;
+    hostSampleRate_ = sampleRate;
+    hostMaxBlockSize_ = maxBlockSize;
+    rateAdapted_ = engineRate != sampleRate;
+    sampleRate_ = engineRate;
     maxBlockSize_ = maxBlockSize;
+    hostLatency_ = 0;
+    
+    if (rateAdapted_) {
+        if (!hostToEngine_.prepare(hostSampleRate_, sampleRate_, MAX_CHANNELS) ||
+            !engineToHost_.prepare(sampleRate_, hostSampleRate_, MAX_CHANNELS)) {
+            return false;
+        }
+        
+        // Engine blocks follow the resampler's output; a host frame's wet signal
+        // is complete once both filters have seen their lookahead
+        maxBlockSize_ = hostToEngine_.getMaxOutputFrames(hostMaxBlockSize_);
+        const int hostWetFrames = std::max(engineToHost_.getMaxOutputFrames(maxBlockSize_), hostMaxBlockSize_);
+        hostLatency_ = static_cast<int>(std::ceil(hostToEngine_.getLookaheadFrames() +
+                                                  engineToHost_.getLookaheadFrames() * hostSampleRate_ / sampleRate_)) + 2;
+        
+        engineInputBuffers_.assign(MAX_CHANNELS, std::vector<float>(maxBlockSize_));
+        engineOutputBuffers_.assign(MAX_CHANNELS, std::vector<float>(maxBlockSize_));
+        hostWetBuffers_.assign(MAX_CHANNELS, std::vector<float>(hostWetFrames));
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+            wetFifo_[ch].resize(static_cast<size_t>(hostLatency_ + hostWetFrames + hostMaxBlockSize_));
+            dryDelay_[ch].resize(static_cast<size_t>(hostLatency_ + hostMaxBlockSize_));
+        }
+        resetRateAdapter();
+        
+        // The dry delay does not cover the pipeline's extra block
+        pipelined_.store(false, std::memory_order_release);
+    }
     
     // Initialize components
     fdnReverb_ = std::make_unique<FDNReverb>(sampleRate_, MAX_DELAY_LINES);
-    crossFeed_ = std::make_unique<StereoEnhancer>();
-    smoother_ = std::make_unique<ParameterSmoother>(sampleRate_);
+    fdnStandby_ = std::make_unique<FDNReverb>(sampleRate_, MAX_DELAY_LINES);
+    outputStage_.prepare(sampleRate_, maxBlockSize_);
+    
+    // Spread and tone move into the fused output stage, after the tier crossfade
+    fdnReverb_->setOutputStageEnabled(false);
+    fdnStandby_->setOutputStageEnabled(false);
+    fdnReverb_->setStageProfile(&stageProfile_);
+    fdnStandby_->setStageProfile(&stageProfile_);
+    fdnReverb_->setTraceBuffer(&trace_);
+    fdnStandby_->setTraceBuffer(&trace_);
     
-    // Allocate processing buffers
+    // Smoothing runs at the host rate, where the parameters are applied
+    wetDryRamp_.prepare(hostSampleRate_, MIX_SMOOTHING_SECONDS, hostMaxBlockSize_);
+    inputGainRamp_.prepare(hostSampleRate_, GAIN_SMOOTHING_SECONDS, hostMaxBlockSize_);
+    outputGainRamp_.prepare(hostSampleRate_, GAIN_SMOOTHING_SECONDS, hostMaxBlockSize_);
+    decayRamp_.prepare(hostSampleRate_, DECAY_SMOOTHING_SECONDS, 1);
+    highDampingRamp_.prepare(hostSampleRate_, DAMPING_SMOOTHING_SECONDS, 1);
+    lowDampingRamp_.prepare(hostSampleRate_, DAMPING_SMOOTHING_SECONDS, 1);
+    
+    // Allocate processing buffers (the temp buffers also hold host-rate dry blocks)
     tempBuffers_.resize(MAX_CHANNELS);
     for (auto& buffer : tempBuffers_) {
-        buffer.resize(maxBlockSize_);
+        buffer.resize(std::max(maxBlockSize_, hostMaxBlockSize_));
     }
     
     wetBuffer_.resize(maxBlockSize_);
     dryBuffer_.resize(maxBlockSize_);
     
-    // Apply default preset
+    inputBuffers_.resize(MAX_CHANNELS);
+    for (auto& buffer : inputBuffers_) {
+        buffer.resize(hostMaxBlockSize_);
+    }
+    
+    standbyBuffers_.resize(MAX_CHANNELS);
+    for (auto& buffer : standbyBuffers_) {
+        buffer.resize(maxBlockSize_);
+    }
+    
+    pipelineDryBuffers_.resize(MAX_CHANNELS);
+    for (auto& buffer : pipelineDryBuffers_) {
+        buffer.resize(maxBlockSize_);
+    }
+    
+    // A running pipeline follows the new rate and block size (its latency)
+    pipelineActive_ = false;
+    pipelineReported_.store(false, std::memory_order_relaxed);
+    if (pipeline_ && !pipeline_->prepare(sampleRate_, maxBlockSize_)) {
+        return false;
+    }
+    
+    // Quality tiers: start at the best allowed tier (the governor counts host-rate
+    // callbacks, the crossfade engine-rate samples)
+    governor_.prepare(hostSampleRate_);
+    crossfadeLength_ = std::max(1, static_cast<int>(TIER_CROSSFADE_SECONDS * sampleRate_));
+    crossfadeRemaining_ = 0;
+    activeTier_ = governor_.getTier();
+    configureTier(*fdnReverb_, activeTier_);
+    
+    // Apply default preset (no ramp from the previous settings)
     setPreset(Preset::VocalBooth);
+    snapRamps();
     
     initialized_ = true;
     return true;
@@ -86,7 +202,8 @@ bool ReverbEngine::initialize(double sampleRate, int maxBlockSize) {
 
 void ReverbEngine::processBlock(const float* const* inputs, float* const* outputs, 
                                int numChannels, int numSamples) {
-    if (!initialized_ || numSamples > maxBlockSize_ || numChannels > MAX_CHANNELS) {
+    VM_RT_SCOPE();
+    if (!initialized_ || numSamples > hostMaxBlockSize_ || numChannels > MAX_CHANNELS) {
         // Copy input to output if not initialized
         for (int ch = 0; ch < numChannels; ++ch) {
             std::copy(inputs[ch], inputs[ch] + numSamples, outputs[ch]);
@@ -94,33 +211,278 @@ void ReverbEngine::processBlock(const float* const* inputs, float* const* output
         return;
     }
     
-    // Measure CPU usage
-    auto startTime = std::chrono::high_resolution_clock::now();
+    // Input level for the xrun recorder, taken before in-place
+    // processing overwrites it (and outside the timed region)
+    float inputRms[MAX_CHANNELS] = { 0.0f, 0.0f };
+    if (xrunRecorder_.isActive()) {
+        for (int ch = 0; ch < numChannels; ++ch) {
+            float sum = 0.0f;
+            for (int i = 0; i < numSamples; ++i) {
+                sum += inputs[ch][i] * inputs[ch][i];
+            }
+            inputRms[ch] = numSamples > 0 ? std::sqrt(sum / numSamples) : 0.0f;
+        }
+        if (numChannels == 1) {
+            inputRms[1] = inputRms[0];
+        }
+    }
+    
+    // Session capture logs the input and the parameters the block starts with
+    if (sessionCapture_.isActive()) {
+        float parameters[SessionCapture::NUM_PARAMETERS];
+        readParameters(parameters);
+        sessionCapture_.beginBlock(inputs, numChannels, numSamples, parameters);
+    }
+    
+    const auto startTime = std::chrono::steady_clock::now();
+    VM_TRACE_THREAD_NAME("audio");
+    VM_TRACE_BEGIN(&trace_, "process_block");
+    
+    parameterEvents_.beginBlock(numSamples);
+    ParameterEvent event;
+    
+    if (pipelineActive_ || !parameterEvents_.hasEventsInBlock()) {
+        // No automation in this block (or pipelined): one pass, events applied up front
+        while (parameterEvents_.popEvent(numSamples - 1, event)) {
+            applyParameterEvent(event, 0);
+        }
+        processSegment(inputs, outputs, numChannels, numSamples);
+    } else {
+        // Render up to each event, apply it, continue
+        int position = 0;
+        while (position < numSamples) {
+            while (parameterEvents_.popEvent(position, event)) {
+                applyParameterEvent(event, position);
+            }
+            const int end = parameterEvents_.nextEventOffset();
+            
+            const float* segmentInputs[MAX_CHANNELS];
+            float* segmentOutputs[MAX_CHANNELS];
+            for (int ch = 0; ch < numChannels; ++ch) {
+                segmentInputs[ch] = inputs[ch] + position;
+                segmentOutputs[ch] = outputs[ch] + position;
+            }
+            processSegment(segmentInputs, segmentOutputs, numChannels, end - position);
+            position = end;
+        }
+    }
+    parameterEvents_.endBlock();
+    
+    // Whole callback against the host period: resampling, segments and all
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime);
+    const uint64_t periodNanoseconds = static_cast<uint64_t>(numSamples * 1e9 / hostSampleRate_);
+    blockTimes_.record(static_cast<uint64_t>(elapsed.count()), periodNanoseconds);
+    recordXrunBlock(static_cast<uint64_t>(elapsed.count()), periodNanoseconds, numSamples, inputRms);
+    sessionCapture_.endBlock(static_cast<int>(activeTier_), pipelineActive_, static_cast<uint64_t>(elapsed.count()));
+    
+    // CPU usage and the quality governor see the same whole-callback load, once
+    // per host period, however many event segments the block was split into
+    if (params_.bypass.load() || periodNanoseconds == 0) {
+        cpuUsage_.store(0.0);
+    } else {
+        const double load = static_cast<double>(elapsed.count()) / static_cast<double>(periodNanoseconds);
+        cpuUsage_.store(load * 100.0);
+        
+        // Trade reverb quality for time before the deadline is missed (the tier
+        // holds while pipelined: the load here no longer includes the loop). A
+        // switch waits until the retired network has been wiped; the governor
+        // keeps reporting the pending tier, so it starts at a later block.
+        const QualityTier tier = governor_.update(load, numSamples, crossfadeRemaining_ > 0 || pipelineActive_);
+        if (tier != activeTier_ && crossfadeRemaining_ == 0 && !pipelineActive_ &&
+            fdnStandby_->isCleared()) {
+            beginTierSwitch(tier);
+        }
+    }
+    VM_TRACE_END(&trace_, "process_block");
+}
+
+void ReverbEngine::applyParameterEvent(const ParameterEvent& event, int position) {
+    ++parameterEventsApplied_;
+    VM_TRACE_INSTANT(&trace_, PARAMETER_TRACE_NAMES[static_cast<int>(event.id)], event.value);
+    setParameter(event.id, event.value);
+    
+    if (sessionCapture_.isActive()) {
+        // Logged as stored (clamped), where it actually applied (0 while pipelined)
+        float parameters[SessionCapture::NUM_PARAMETERS];
+        readParameters(parameters);
+        sessionCapture_.recordEvent(event.id, parameters[static_cast<int>(event.id)], position);
+    }
+}
+
+void ReverbEngine::setParameter(ParameterId id, float value) {
+    switch (id) {
+        case ParameterId::WetDryMix:       setWetDryMix(value); break;
+        case ParameterId::DecayTime:       setDecayTime(value); break;
+        case ParameterId::PreDelay:        setPreDelay(value); break;
+        case ParameterId::CrossFeed:       setCrossFeed(value); break;
+        case ParameterId::RoomSize:        setRoomSize(value); break;
+        case ParameterId::Density:         setDensity(value); break;
+        case ParameterId::HighFreqDamping: setHighFreqDamping(value); break;
+        case ParameterId::LowFreqDamping:  setLowFreqDamping(value); break;
+        case ParameterId::StereoWidth:     setStereoWidth(value); break;
+        case ParameterId::PhaseInvert:     setPhaseInvert(value > 0.5f); break;
+        case ParameterId::Bypass:          setBypass(value > 0.5f); break;
+        case ParameterId::InputGain:       setInputGain(value); break;
+        case ParameterId::OutputGain:      setOutputGain(value); break;
+    }
+}
+
+void ReverbEngine::readParameters(float* parameters) const {
+    parameters[static_cast<int>(ParameterId::WetDryMix)] = params_.wetDryMix.load();
+    parameters[static_cast<int>(ParameterId::DecayTime)] = params_.decayTime.load();
+    parameters[static_cast<int>(ParameterId::PreDelay)] = params_.preDelay.load();
+    parameters[static_cast<int>(ParameterId::CrossFeed)] = params_.crossFeed.load();
+    parameters[static_cast<int>(ParameterId::RoomSize)] = params_.roomSize.load();
+    parameters[static_cast<int>(ParameterId::Density)] = params_.density.load();
+    parameters[static_cast<int>(ParameterId::HighFreqDamping)] = params_.highFreqDamping.load();
+    parameters[static_cast<int>(ParameterId::LowFreqDamping)] = params_.lowFreqDamping.load();
+    parameters[static_cast<int>(ParameterId::StereoWidth)] = params_.stereoWidth.load();
+    parameters[static_cast<int>(ParameterId::PhaseInvert)] = params_.phaseInvert.load() ? 1.0f : 0.0f;
+    parameters[static_cast<int>(ParameterId::Bypass)] = params_.bypass.load() ? 1.0f : 0.0f;
+    parameters[static_cast<int>(ParameterId::InputGain)] = params_.inputGain.load();
+    parameters[static_cast<int>(ParameterId::OutputGain)] = params_.outputGain.load();
+}
+
+void ReverbEngine::updateRamps(int numSamples) {
+    wetDryRamp_.setTarget(params_.wetDryMix.load() * 0.01f);
+    inputGainRamp_.setTarget(AudioMath::dbToLinear(params_.inputGain.load()));
+    outputGainRamp_.setTarget(AudioMath::dbToLinear(params_.outputGain.load()));
+    wetDryRamp_.process(numSamples);
+    inputGainRamp_.process(numSamples);
+    outputGainRamp_.process(numSamples);
+    
+    decayRamp_.setTarget(params_.decayTime.load());
+    highDampingRamp_.setTarget(params_.highFreqDamping.load());
+    lowDampingRamp_.setTarget(params_.lowFreqDamping.load());
+    decayRamp_.advance(numSamples);
+    highDampingRamp_.advance(numSamples);
+    lowDampingRamp_.advance(numSamples);
+}
+
+void ReverbEngine::snapRamps() {
+    wetDryRamp_.snapTo(params_.wetDryMix.load() * 0.01f);
+    inputGainRamp_.snapTo(AudioMath::dbToLinear(params_.inputGain.load()));
+    outputGainRamp_.snapTo(AudioMath::dbToLinear(params_.outputGain.load()));
+    decayRamp_.snapTo(params_.decayTime.load());
+    highDampingRamp_.snapTo(params_.highFreqDamping.load());
+    lowDampingRamp_.snapTo(params_.lowFreqDamping.load());
+}
+
+void ReverbEngine::processSegment(const float* const* inputs, float* const* outputs,
+                                  int numChannels, int numSamples) {
+    MultiStreamRecorder* recorder = recorder_.load(std::memory_order_acquire);
     
     // Handle bypass
     if (params_.bypass.load()) {
         for (int ch = 0; ch < numChannels; ++ch) {
             std::copy(inputs[ch], inputs[ch] + numSamples, outputs[ch]);
         }
-        cpuUsage_.store(0.0);
+        if (recorder) {
+            // Keep recordings continuous: silent wet stream while bypassed
+            recorder->captureBlock(inputs, nullptr, outputs, numChannels, numSamples);
+        }
         return;
     }
     
+    updateRamps(numSamples);
+    
+    // Input gain (skipped at unity): the dry path and the reverb both see it
+    const float* gainedInputs[MAX_CHANNELS];
+    if (inputGainRamp_.isRamping() || inputGainRamp_.getValue() != 1.0f) {
+        for (int ch = 0; ch < numChannels; ++ch) {
+            ParameterRamp::applyGain(inputs[ch], inputBuffers_[ch].data(), numSamples, inputGainRamp_);
+            gainedInputs[ch] = inputBuffers_[ch].data();
+        }
+        inputs = gainedInputs;
+    }
+    
+    if (rateAdapted_) {
+        processResampled(inputs, outputs, numChannels, numSamples, recorder);
+    } else {
+        processEngineBlock(inputs, outputs, numChannels, numSamples, true, recorder);
+    }
+}
+
+void ReverbEngine::processResampled(const float* const* inputs, float* const* outputs,
+                                    int numChannels, int numSamples, MultiStreamRecorder* recorder) {
+    // The converters always run two channels; mono feeds the same signal twice
+    const float* hostIn[MAX_CHANNELS] = { inputs[0], inputs[numChannels - 1] };
+    float* engineIn[MAX_CHANNELS] = { engineInputBuffers_[0].data(), engineInputBuffers_[1].data() };
+    float* engineOut[MAX_CHANNELS] = { engineOutputBuffers_[0].data(), engineOutputBuffers_[1].data() };
+    float* hostWet[MAX_CHANNELS] = { hostWetBuffers_[0].data(), hostWetBuffers_[1].data() };
+    
+    // Wet only at the engine rate; dry and mix stay at the host rate
+    const int engineFrames = hostToEngine_.process(hostIn, numSamples, engineIn);
+    if (engineFrames > 0) {
+        processEngineBlock(engineIn, engineOut, numChannels, engineFrames, false, nullptr);
+    }
+    
+    const float* wetIn[MAX_CHANNELS] = { engineOut[0], engineOut[numChannels - 1] };
+    const int hostFrames = engineToHost_.process(wetIn, engineFrames, hostWet);
+    
+    const size_t count = static_cast<size_t>(numSamples);
+    const float* dry[MAX_CHANNELS] = { tempBuffers_[0].data(), tempBuffers_[1].data() };
+    for (int ch = 0; ch < numChannels; ++ch) {
+        wetFifo_[ch].write(hostWet[ch], static_cast<size_t>(hostFrames));
+        const size_t read = wetFifo_[ch].read(hostWet[ch], count);
+        std::fill(hostWet[ch] + read, hostWet[ch] + numSamples, 0.0f);     // Only if the invariant broke
+        
+        dryDelay_[ch].write(inputs[ch], count);
+        dryDelay_[ch].read(tempBuffers_[ch].data(), count);
+    }
+    
+    for (int ch = 0; ch < numChannels; ++ch) {
+        ParameterRamp::mix(dry[ch], hostWet[ch], outputs[ch], numSamples, wetDryRamp_, outputGainRamp_);
+    }
+    
+    if (recorder) {
+        const float* wet[MAX_CHANNELS] = { hostWet[0], hostWet[1] };
+        recorder->captureBlock(dry, wet, outputs, numChannels, numSamples);
+    }
+}
+
+void ReverbEngine::processEngineBlock(const float* const* inputs, float* const* outputs,
+                                      int numChannels, int numSamples,
+                                      bool mixOutput, MultiStreamRecorder* recorder) {
+    // Pipelined mode changes between blocks. While it is on, the FDN is only
+    // touched once the helper has finished the previous block.
+    const bool pipelined = numChannels == 2 && crossfadeRemaining_ == 0 &&
+                           pipelined_.load(std::memory_order_acquire);
+    if (pipelined != pipelineActive_) {
+        if (pipelined) {
+            pipeline_->reset();
+        } else {
+            pipeline_->waitIdle();
+        }
+        pipelineActive_ = pipelined;
+        pipelineReported_.store(pipelined, std::memory_order_relaxed);
+    }
+    if (pipelineActive_) {
+        pipeline_->waitIdle();
+    }
+    
     // Get current parameter values with smoothing
-    const float wetDryMix = params_.wetDryMix.load() * 0.01f; // Convert to 0-1
-    const float decayTime = params_.decayTime.load();
-    const float preDelay = params_.preDelay.load();
     const float crossFeedAmount = params_.crossFeed.load();
-    const float roomSize = params_.roomSize.load();
-    const float density = params_.density.load() * 0.01f;
-    const float hfDamping = params_.highFreqDamping.load() * 0.01f;
+    const bool crossfading = crossfadeRemaining_ > 0;
+    
+    // Both networks share the loop rate, or the standby could not take over the tail
+    const int tailDecimation = tailDecimation_.load(std::memory_order_relaxed);
+    if (!crossfading && tailDecimation != fdnReverb_->getTailDecimation()) {
+        fdnReverb_->setTailDecimation(tailDecimation);
+        fdnStandby_->setTailDecimation(tailDecimation);
+    }
+    const bool simd = simdEnabled_.load(std::memory_order_relaxed) && SIMD_AVAILABLE;
+    if (simd != fdnReverb_->isSIMDEnabled()) {
+        fdnReverb_->setSIMDEnabled(simd);
+        fdnStandby_->setSIMDEnabled(simd);
+    }
     
-    // Update FDN parameters
-    fdnReverb_->setDecayTime(decayTime);
-    fdnReverb_->setPreDelay(preDelay * 0.001 * sampleRate_); // Convert ms to samples
-    fdnReverb_->setRoomSize(roomSize);
-    fdnReverb_->setDensity(density);
-    fdnReverb_->setHighFreqDamping(hfDamping);
+    // Update FDN parameters (both networks while switching tiers)
+    applyFdnParameters(*fdnReverb_);
+    if (crossfading) {
+        applyFdnParameters(*fdnStandby_);
+    }
     
     // Process mono to stereo if needed
     if (numChannels == 1) {
@@ -128,14 +490,18 @@ void ReverbEngine::processBlock(const float* const* inputs, float* const* output
         std::copy(inputs[0], inputs[0] + numSamples, dryBuffer_.data());
         
         // Process reverb
-        fdnReverb_->processMono(inputs[0], wetBuffer_.data(), numSamples);
+        float* wet[1] = { wetBuffer_.data() };
+        renderWet(*fdnReverb_, inputs, wet, numChannels, numSamples);
+        if (crossfading) {
+            renderTierCrossfade(inputs, wet, numChannels, numSamples);
+        }
         
-        // Apply wet/dry mix
-        for (int i = 0; i < numSamples; ++i) {
-            const float dry = dryBuffer_[i];
-            const float wet = wetBuffer_[i];
-            const float mixed = dry * (1.0f - wetDryMix) + wet * wetDryMix;
-            outputs[0][i] = mixed;
+        // Apply wet/dry mix and output gain
+        if (mixOutput) {
+            ParameterRamp::mix(dryBuffer_.data(), wetBuffer_.data(), outputs[0], numSamples,
+                               wetDryRamp_, outputGainRamp_);
+        } else {
+            std::copy(wetBuffer_.data(), wetBuffer_.data() + numSamples, outputs[0]);
         }
         
         // Copy to second channel if stereo output
@@ -143,6 +509,11 @@ void ReverbEngine::processBlock(const float* const* inputs, float* const* output
             std::copy(outputs[0], outputs[0] + numSamples, outputs[1]);
         }
         
+        if (recorder) {
+            const float* wet[1] = { wetBuffer_.data() };
+            recorder->captureBlock(inputs, wet, outputs, numChannels, numSamples);
+        }
+        
     } else if (numChannels == 2) {
         // Stereo processing
         
@@ -151,35 +522,179 @@ void ReverbEngine::processBlock(const float* const* inputs, float* const* output
         std::copy(inputs[1], inputs[1] + numSamples, tempBuffers_[1].data());
         
         // Process reverb
-        fdnReverb_->processStereo(inputs[0], inputs[1], 
-                                 tempBuffers_[0].data(), tempBuffers_[1].data(), 
-                                 numSamples);
-        
-        // Apply cross-feed
-        if (crossFeedAmount > 0.001f) {
-            crossFeed_->setCrossFeedAmount(crossFeedAmount);
-            crossFeed_->processBlock(tempBuffers_[0].data(), tempBuffers_[1].data(), numSamples);
+        float* wet[2] = { tempBuffers_[0].data(), tempBuffers_[1].data() };
+        const float* dry[2] = { inputs[0], inputs[1] };
+        if (pipelineActive_) {
+            // Wet and dry both come out one block late
+            float* delayedDry[2] = { pipelineDryBuffers_[0].data(), pipelineDryBuffers_[1].data() };
+            pipeline_->process(*fdnReverb_, inputs[0], inputs[1], wet[0], wet[1],
+                               delayedDry[0], delayedDry[1], numSamples);
+            dry[0] = delayedDry[0];
+            dry[1] = delayedDry[1];
+        } else {
+            renderWet(*fdnReverb_, inputs, wet, numChannels, numSamples);
+            if (crossfading) {
+                renderTierCrossfade(inputs, wet, numChannels, numSamples);
+            }
         }
         
-        // Apply wet/dry mix
-        for (int i = 0; i < numSamples; ++i) {
-            outputs[0][i] = inputs[0][i] * (1.0f - wetDryMix) + tempBuffers_[0][i] * wetDryMix;
-            outputs[1][i] = inputs[1][i] * (1.0f - wetDryMix) + tempBuffers_[1][i] * wetDryMix;
+        // Spread, tone, cross-feed, wet/dry mix and output gain in one pass; the
+        // processed wet is kept only for the recorder
+        OutputStage::Settings settings;
+        settings.spreadWidth = fdnReverb_->getStereoSpread();
+        settings.spreadCompensation = fdnReverb_->isStereoSpreadCompensated();
+        settings.highCutEnabled = fdnReverb_->isHighCutEnabled();
+        settings.highCutHz = fdnReverb_->getHighCutFreq();
+        settings.lowCutEnabled = fdnReverb_->isLowCutEnabled();
+        settings.lowCutHz = fdnReverb_->getLowCutFreq();
+        outputStage_.configure(settings);
+        outputStage_.setCrossFeed(crossFeedAmount);
+        VM_STAGE_CLOCK(&stageProfile_);
+        VM_TRACE_BEGIN(&trace_, "output_stage");
+        outputStage_.process(wet[0], wet[1], dry[0], dry[1], outputs[0], outputs[1], numSamples,
+                             mixOutput ? &wetDryRamp_ : nullptr, mixOutput ? &outputGainRamp_ : nullptr,
+                             recorder != nullptr);
+        VM_STAGE_LAP(OutputStage);
+        VM_TRACE_END(&trace_, "output_stage");
+        
+        if (recorder) {
+            // Record straight from the engine's own buffers - no extra copies
+            const float* wet[2] = { tempBuffers_[0].data(), tempBuffers_[1].data() };
+            recorder->captureBlock(dry, wet, outputs, numChannels, numSamples);
+        }
+    }
+    
+    // The retired network is wiped a line per block rather than in one go
+    if (!crossfading) {
+        fdnStandby_->clearIncremental();
+    }
+    
+}
+
+void ReverbEngine::applyFdnParameters(FDNReverb& fdn) {
+    VM_TRACE_BEGIN(&trace_, "apply_parameters");
+    fdn.setDecayTime(decayRamp_.getValue());
+    fdn.setPreDelay(params_.preDelay.load() * 0.001 * sampleRate_); // Convert ms to samples
+    fdn.setRoomSize(params_.roomSize.load());
+    fdn.setDensity(params_.density.load() * 0.01f);
+    fdn.setHighFreqDamping(highDampingRamp_.getValue() * 0.01f);
+    fdn.setLowFreqDamping(lowDampingRamp_.getValue() * 0.01f);
+    VM_TRACE_END(&trace_, "apply_parameters");
+}
+
+void ReverbEngine::renderWet(FDNReverb& fdn, const float* const* inputs, float* const* wet,
+                             int numChannels, int numSamples) {
+    if (numChannels == 1) {
+        fdn.processMono(inputs[0], wet[0], numSamples);
+        return;
+    }
+    
+    // FDN stereo path works on SIMD-sized sub-blocks
+    for (int offset = 0; offset < numSamples; offset += SIMDOptimizer::BLOCK_SIZE) {
+        const int chunk = std::min(SIMDOptimizer::BLOCK_SIZE, numSamples - offset);
+        fdn.processStereo(inputs[0] + offset, inputs[1] + offset,
+                          wet[0] + offset, wet[1] + offset, chunk);
+    }
+}
+
+void ReverbEngine::renderTierCrossfade(const float* const* inputs, float* const* wet,
+                                       int numChannels, int numSamples) {
+    float* incoming[MAX_CHANNELS] = { standbyBuffers_[0].data(), standbyBuffers_[1].data() };
+    renderWet(*fdnStandby_, inputs, incoming, numChannels, numSamples);
+    
+    // The incoming network continues the outgoing one's tail (copied state), so the
+    // two are strongly correlated: an equal-gain raised-cosine fade keeps the level
+    const int fadeSamples = std::min(numSamples, crossfadeRemaining_);
+    const int fadeStart = crossfadeLength_ - crossfadeRemaining_;
+    const float phaseScale = static_cast<float>(M_PI) / static_cast<float>(crossfadeLength_);
+    
+    for (int ch = 0; ch < numChannels; ++ch) {
+        float* out = wet[ch];
+        const float* in = incoming[ch];
+        for (int i = 0; i < fadeSamples; ++i) {
+            const float gainIn = 0.5f - 0.5f * std::cos(phaseScale * static_cast<float>(fadeStart + i + 1));
+            out[i] += gainIn * (in[i] - out[i]);
         }
+        // Fade finished inside this block: the rest is the new network alone
+        std::copy(in + fadeSamples, in + numSamples, out + fadeSamples);
+    }
+    
+    crossfadeRemaining_ -= fadeSamples;
+    if (crossfadeRemaining_ == 0) {
+        std::swap(fdnReverb_, fdnStandby_);
+        fdnStandby_->beginIncrementalClear();
+        VM_TRACE_INSTANT(&trace_, "tier_swap", static_cast<double>(activeTier_));
+    }
+}
+
+void ReverbEngine::beginTierSwitch(QualityTier tier) {
+    // Bring the standby to the current parameters and the new tier, then hand it
+    // the running tail so the fade is between two versions of the same reverb
+    applyFdnParameters(*fdnStandby_);
+    configureTier(*fdnStandby_, tier);
+    fdnStandby_->copyStateFrom(*fdnReverb_);
+    
+    activeTier_ = tier;
+    crossfadeRemaining_ = crossfadeLength_;
+    VM_TRACE_INSTANT(&trace_, "tier_switch", static_cast<double>(tier));
+}
+
+void ReverbEngine::recordXrunBlock(uint64_t nanoseconds, uint64_t periodNanoseconds, int numSamples,
+                                   const float* inputRms) {
+    ++blocksProcessed_;
+    const uint64_t bufferFlushes = fdnReverb_->getBufferFlushCount() + fdnStandby_->getBufferFlushCount();
+    const uint64_t coefficientUpdates = fdnReverb_->getCoefficientUpdateCount() +
+                                        fdnStandby_->getCoefficientUpdateCount();
+    const float roomSize = params_.roomSize.load();
+    
+    if (xrunRecorder_.isActive()) {
+        XrunRecorder::BlockRecord record;
+        record.block = blocksProcessed_;
+        record.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+        record.nanoseconds = static_cast<uint32_t>(std::min<uint64_t>(nanoseconds, UINT32_MAX));
+        record.periodNanoseconds = static_cast<uint32_t>(std::min<uint64_t>(periodNanoseconds, UINT32_MAX));
+        record.numSamples = numSamples;
+        record.inputRms[0] = inputRms[0];
+        record.inputRms[1] = inputRms[1];
+        
+        readParameters(record.parameters);
+        record.roomSizeDelta = roomSize - lastRoomSize_;
+        record.bufferFlushes = static_cast<uint16_t>(bufferFlushes - lastBufferFlushes_);
+        record.coefficientUpdates = static_cast<uint16_t>(coefficientUpdates - lastCoefficientUpdates_);
+        record.parameterEvents = static_cast<uint16_t>(parameterEventsApplied_ - lastParameterEvents_);
+        record.tier = static_cast<uint8_t>(activeTier_);
+        record.crossfading = crossfadeRemaining_ > 0;
+        record.pipelined = pipelineActive_;
+        xrunRecorder_.record(record);
     }
     
-    // Calculate CPU usage
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
-    double processingTime = duration.count() / 1000.0; // Convert to ms
-    double blockTime = (numSamples / sampleRate_) * 1000.0; // Block duration in ms
-    cpuUsage_.store((processingTime / blockTime) * 100.0);
+    lastBufferFlushes_ = bufferFlushes;
+    lastCoefficientUpdates_ = coefficientUpdates;
+    lastParameterEvents_ = parameterEventsApplied_;
+    lastRoomSize_ = roomSize;
 }
 
 void ReverbEngine::reset() {
+    if (pipelineActive_) {
+        pipeline_->waitIdle();
+    }
+    
+    // Complete a pending tier switch at once - both networks are cleared anyway
+    if (crossfadeRemaining_ > 0) {
+        std::swap(fdnReverb_, fdnStandby_);
+        crossfadeRemaining_ = 0;
+    }
+    
     if (fdnReverb_) {
         fdnReverb_->reset();
     }
+    if (fdnStandby_) {
+        fdnStandby_->clear();
+    }
+    if (pipelineActive_) {
+        pipeline_->reset();
+    }
     
     // Clear all buffers
     for (auto& buffer : tempBuffers_) {
@@ -187,6 +702,81 @@ void ReverbEngine::reset() {
     }
     std::fill(wetBuffer_.begin(), wetBuffer_.end(), 0.0f);
     std::fill(dryBuffer_.begin(), dryBuffer_.end(), 0.0f);
+    outputStage_.reset();
+    snapRamps();
+    
+    if (rateAdapted_) {
+        resetRateAdapter();
+    }
+}
+
+void ReverbEngine::resetRateAdapter() {
+    hostToEngine_.reset();
+    engineToHost_.reset();
+    for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+        wetFifo_[ch].clear();
+        dryDelay_[ch].clear();
+        for (int i = 0; i < hostLatency_; ++i) {
+            wetFifo_[ch].write(0.0f);
+            dryDelay_[ch].write(0.0f);
+        }
+    }
+}
+
+int ReverbEngine::getLatencySamples() const {
+    if (rateAdapted_) {
+        return hostLatency_;
+    }
+    // Only blocks that actually went through the pipeline are delayed
+    return pipelineReported_.load(std::memory_order_relaxed) ? maxBlockSize_ : 0;
+}
+
+bool ReverbEngine::setPipelinedMode(bool enabled) {
+    if (enabled && rateAdapted_) {
+        return false;
+    }
+    
+    if (enabled && !pipeline_) {
+        if (!initialized_) {
+            return false;
+        }
+        
+        // Published before the flag, so the audio thread never sees one without the other
+        auto pipeline = std::make_unique<FDNPipeline>();
+        if (!pipeline->prepare(sampleRate_, maxBlockSize_)) {
+            return false;
+        }
+        pipeline_ = std::move(pipeline);
+    }
+    
+    pipelined_.store(enabled, std::memory_order_release);
+    return true;
+}
+
+FDNPipeline::Statistics ReverbEngine::getPipelineStatistics() const {
+    return pipeline_ ? pipeline_->getStatistics() : FDNPipeline::Statistics();
+}
+
+bool ReverbEngine::startSessionCapture(const std::string& path) {
+    if (!initialized_) {
+        return false;
+    }
+    
+    SessionCapture::Header header;
+    header.sampleRate = hostSampleRate_;
+    header.maxBlockSize = static_cast<uint32_t>(hostMaxBlockSize_);
+    header.tailDecimation = static_cast<uint8_t>(tailDecimation_.load(std::memory_order_relaxed));
+    header.simdEnabled = simdEnabled_.load(std::memory_order_relaxed) ? 1 : 0;
+    header.adaptiveQuality = governor_.isEnabled() ? 1 : 0;
+    header.qualityCeiling = static_cast<uint8_t>(governor_.getCeiling());
+    return sessionCapture_.start(path, header);
+}
+
+bool ReverbEngine::startTrace(const std::string& path, TraceBuffer::Format format) {
+    if (!TraceBuffer::ENABLED) {
+        return false;   // No probes compiled in: the trace would be empty
+    }
+    return trace_.startCapture(path, format);
 }
 
 void ReverbEngine::setPreset(Preset preset) {
@@ -292,6 +882,14 @@ void ReverbEngine::setPhaseInvert(bool invert) {
     params_.phaseInvert.store(invert);
 }
 
+void ReverbEngine::setInputGain(float decibels) {
+    params_.inputGain.store(clamp(decibels, -60.0f, 12.0f));
+}
+
+void ReverbEngine::setOutputGain(float decibels) {
+    params_.outputGain.store(clamp(decibels, -60.0f, 12.0f));
+}
+
 float ReverbEngine::clamp(float value, float min, float max) const {
     return std::max(min, std::min(max, value));
 }
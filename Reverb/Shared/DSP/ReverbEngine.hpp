@@ -4,11 +4,25 @@
 #include <memory>
 #include <atomic>
 #include <cstdint>
+#include <string>
 #include "FDNReverb.hpp"
-#include "CrossFeed.hpp"
+#include "OutputStage.hpp"
+#include "StageProfile.hpp"
+#include "TraceBuffer.hpp"
+#include "XrunRecorder.hpp"
+#include "SessionCapture.hpp"
+#include "QualityGovernor.hpp"
+#include "FDNPipeline.hpp"
+#include "PolyphaseResampler.hpp"
+#include "ParameterEventQueue.hpp"
+#include "ParameterRamp.hpp"
+#include "AudioBuffer.hpp"
+#include "BlockTimeHistogram.hpp"
 
 namespace VoiceMonitor {
 
+class MultiStreamRecorder;
+
 /// Main reverb engine implementing high-quality FDN (Feedback Delay Network)
 /// Based on AD 480 specifications for studio-grade reverb quality
 class ReverbEngine {
@@ -18,6 +32,15 @@ public:
     static constexpr int MAX_DELAY_LINES = 8;
     static constexpr double MIN_SAMPLE_RATE = 44100.0;
     static constexpr double MAX_SAMPLE_RATE = 96000.0;
+    static constexpr double MIN_HOST_SAMPLE_RATE = 8000.0;     // Resampled to MIN..MAX_SAMPLE_RATE
+    static constexpr double MAX_HOST_SAMPLE_RATE = 192000.0;
+    static constexpr double TIER_CROSSFADE_SECONDS = 0.05;  // Quality tier switch
+    
+    // Parameter smoothing times (one-pole time constants)
+    static constexpr double MIX_SMOOTHING_SECONDS = 0.03;
+    static constexpr double GAIN_SMOOTHING_SECONDS = 0.04;
+    static constexpr double DECAY_SMOOTHING_SECONDS = 0.2;
+    static constexpr double DAMPING_SMOOTHING_SECONDS = 0.1;
     
     // Preset definitions matching current Swift implementation
     enum class Preset {
@@ -41,13 +64,18 @@ public:
         std::atomic<float> stereoWidth{1.0f};       // 0.0-2.0 (AD 480 feature)
         std::atomic<bool> phaseInvert{false};       // L/R phase inversion
         std::atomic<bool> bypass{false};
+        std::atomic<float> inputGain{0.0f};         // -60 to +12 dB
+        std::atomic<float> outputGain{0.0f};        // -60 to +12 dB
     };
 
 public:
     ReverbEngine();
     ~ReverbEngine();
     
-    // Core processing
+    // Core processing. Host rates between MIN_HOST_SAMPLE_RATE and MIN_SAMPLE_RATE
+    // or MAX_SAMPLE_RATE and MAX_HOST_SAMPLE_RATE run the reverb at
+    // getEngineSampleRate(): the input is resampled on the way in, the wet signal
+    // on the way out, and the dry signal is delayed to match (getLatencySamples()).
     bool initialize(double sampleRate, int maxBlockSize = 512);
     void processBlock(const float* const* inputs, float* const* outputs, 
                      int numChannels, int numSamples);
@@ -69,6 +97,23 @@ public:
     void setStereoWidth(float value);       // AD 480 feature
     void setPhaseInvert(bool invert);       // AD 480 feature
     void setBypass(bool bypass);
+    void setInputGain(float decibels);
+    void setOutputGain(float decibels);
+    
+    // Sample-accurate automation (one producer thread, wait-free): the value
+    // takes effect (smoothed parameters start their ramp) sampleOffset samples
+    // into the next processBlock() call, which renders up to each event, applies
+    // it and carries on. Offsets past that block carry over to the following
+    // ones. While pipelined, a block's events all apply at its start.
+    // RoomSize re-tunes the delays where it lands (a jump over 5% restarts the
+    // tail there, as setRoomSize does); the rebuild does not allocate.
+    bool scheduleParameter(ParameterId id, float value, int sampleOffset = 0) {
+        return parameterEvents_.push(id, value, sampleOffset);
+    }
+    uint64_t getDroppedParameterEvents() const { return parameterEvents_.getDroppedCount(); }
+    
+    // Immediate counterpart of scheduleParameter(): the matching setter
+    void setParameter(ParameterId id, float value);
     
     // Getters
     float getWetDryMix() const { return params_.wetDryMix.load(); }
@@ -82,39 +127,214 @@ public:
     float getStereoWidth() const { return params_.stereoWidth.load(); }
     bool getPhaseInvert() const { return params_.phaseInvert.load(); }
     bool isBypassed() const { return params_.bypass.load(); }
+    float getInputGain() const { return params_.inputGain.load(); }
+    float getOutputGain() const { return params_.outputGain.load(); }
     
     // Performance monitoring
     double getCpuUsage() const { return cpuUsage_.load(); }
+    
+    // Distribution of whole processBlock() times and blocks over 50/80/100% of
+    // their period, since construction (tail latency; cpuUsage is the last block only)
+    BlockTimeHistogram::Snapshot getBlockTimeStatistics() const { return blockTimes_.snapshot(); }
     bool isInitialized() const { return initialized_; }
+    double getSampleRate() const { return hostSampleRate_; }
+    double getEngineSampleRate() const { return sampleRate_; }
+    bool isRateAdapted() const { return rateAdapted_; }
+    
+    /// Rate the reverb runs at for a host rate: the host rate itself when
+    /// supported, otherwise the nearest integer multiple or fraction of it inside
+    /// MIN..MAX_SAMPLE_RATE (8 and 16 kHz -> 48 kHz, 22.05 kHz -> 44.1 kHz,
+    /// 176.4 kHz -> 88.2 kHz, 192 kHz -> 96 kHz). 0 when out of range.
+    static double engineSampleRateFor(double hostSampleRate);
+    
+    // Adaptive quality: under load the FDN drops to cheaper tiers (crossfaded)
+    // instead of missing the deadline, and climbs back once headroom returns.
+    // Off by default (the ceiling tier runs throughout)
+    void setCpuBudget(double fractionOfBlock) { governor_.setCpuBudget(fractionOfBlock); }
+    void setAdaptiveQuality(bool enabled) { governor_.setEnabled(enabled); }
+    void setQualityCeiling(QualityTier tier) { governor_.setCeiling(tier); } // Best tier allowed
+    QualityTier getQualityTier() const { return governor_.getTier(); }
+    QualityGovernor::Statistics getQualityStatistics() const { return governor_.getStatistics(); }
+    
+    // Pipelined mode (stereo): the FDN loop runs on a second core one block behind
+    // the rest of the engine, for maxBlockSize of extra latency. Control thread; the
+    // helper thread is started on first use and the switch takes effect at the next
+    // stereo block without a tier crossfade (mono blocks and crossfades run
+    // unpipelined). Quality tiers hold while pipelined. Not available at resampled
+    // host rates.
+    bool setPipelinedMode(bool enabled);
+    bool isPipelined() const { return pipelined_.load(std::memory_order_relaxed); }
+    int getLatencySamples() const;              // Host-rate samples, as of the last block
+    FDNPipeline::Statistics getPipelineStatistics() const;
+    
+    // Time per signal-path stage since initialization (all zero unless built
+    // with ENABLE_STAGE_PROFILING); subtract two snapshots for an interval
+    StageProfile::Snapshot getStageProfile() const { return stageProfile_.snapshot(); }
+    
+    // Timeline capture (control thread; builds with ENABLE_TRACING only, false
+    // otherwise): processBlock, FDN stages, parameter applies, buffer flushes
+    // and coefficient updates, written to `path` in the background until stopTrace()
+    bool startTrace(const std::string& path, TraceBuffer::Format format = TraceBuffer::Format::ChromeJson);
+    bool stopTrace() { return trace_.stopCapture(); }
+    uint64_t getDroppedTraceEvents() const { return trace_.getDroppedEvents(); }
+    
+    // Xrun forensics (control thread): keeps the last XrunRecorder::HISTORY_BLOCKS
+    // blocks' timing, parameters, buffer flushes, coefficient updates and input
+    // level, and dumps them as JSON into `directory` whenever a block takes at
+    // least `threshold` of its period
+    bool startXrunCapture(const std::string& directory, double threshold = 1.0) {
+        return xrunRecorder_.start(directory, threshold);
+    }
+    void stopXrunCapture() { xrunRecorder_.stop(); }
+    uint64_t getXrunCount() const { return xrunRecorder_.getOverrunCount(); }
+    
+    // Session capture (control thread, initialized engine): every block's input,
+    // the parameter values it starts with and the scheduled events at the
+    // samples they applied, streamed to `path` until stopSessionCapture(), for
+    // Tools/SessionReplay.cpp to re-run offline. Ends early (still a valid,
+    // shorter session) if the writer falls behind by SessionCapture::DEFAULT_BUFFER_SECONDS.
+    bool startSessionCapture(const std::string& path);
+    bool stopSessionCapture() { return sessionCapture_.stop(); }
+    uint64_t getCapturedSessionBlocks() const { return sessionCapture_.getCapturedBlocks(); }
+    
+    // Multi-rate tail: run the FDN loop at 1/2 or 1/4 of the sample rate (see
+    // FDNReverb::setTailDecimation). Cheaper long tails, mainly at 88.2/96 kHz.
+    // Takes effect at the next block (after a pending tier crossfade) and
+    // restarts the tail. Factors round down to 1, 2 or 4.
+    void setTailDecimation(int factor) {
+        tailDecimation_.store(factor >= 4 ? 4 : (factor >= 2 ? 2 : 1), std::memory_order_relaxed);
+    }
+    int getTailDecimation() const { return tailDecimation_.load(std::memory_order_relaxed); }
+    
+    // Runtime switch for the FDN's SIMD kernels (scalar reference renders, see
+    // Tools/RegressionGate.cpp); takes effect at the next block
+    void setSIMDEnabled(bool enabled) { simdEnabled_.store(enabled, std::memory_order_relaxed); }
+    bool isSIMDEnabled() const { return simdEnabled_.load(std::memory_order_relaxed); }
+    
+    // Recording tap: dry, wet and mix of every processed block (nullptr to detach)
+    void setRecorder(MultiStreamRecorder* recorder) { recorder_.store(recorder, std::memory_order_release); }
 
 private:
     // Forward declarations
-    class ParameterSmoother;
     class InternalCrossFeedProcessor;
     
     std::unique_ptr<FDNReverb> fdnReverb_;
-    std::unique_ptr<StereoEnhancer> crossFeed_;
-    std::unique_ptr<ParameterSmoother> smoother_;
+    std::unique_ptr<FDNReverb> fdnStandby_;     // Next tier during a switch, cleared in the background otherwise
+    OutputStage outputStage_;                   // Spread, tone, cross-feed and mix in one pass (stereo)
     
     // Engine state
     Parameters params_;
     Preset currentPreset_;
-    double sampleRate_;
-    int maxBlockSize_;
+    double sampleRate_;                         // Engine rate
+    int maxBlockSize_;                          // Engine-rate frames
     bool initialized_;
     
+    // Host-rate adaptation (audio thread): input resampled to the engine rate,
+    // wet resampled back into a FIFO primed with hostLatency_ frames of silence,
+    // dry delayed by the same amount
+    double hostSampleRate_;
+    int hostMaxBlockSize_;
+    int hostLatency_;
+    bool rateAdapted_;
+    PolyphaseResampler hostToEngine_;
+    PolyphaseResampler engineToHost_;
+    std::vector<std::vector<float>> engineInputBuffers_;
+    std::vector<std::vector<float>> engineOutputBuffers_;
+    std::vector<std::vector<float>> hostWetBuffers_;
+    AudioBuffer<float> wetFifo_[MAX_CHANNELS];
+    AudioBuffer<float> dryDelay_[MAX_CHANNELS];
+    
     // Performance monitoring
     std::atomic<double> cpuUsage_{0.0};
+    StageProfile stageProfile_;                 // Written by the audio and pipeline threads
+    BlockTimeHistogram blockTimes_;             // Written by the audio thread
+    TraceBuffer trace_;                         // Outlives the pipeline helper
+    
+    // Xrun forensics (audio thread): running counts the block records are diffed against
+    XrunRecorder xrunRecorder_;
+    uint64_t blocksProcessed_;
+    uint64_t parameterEventsApplied_;
+    uint64_t lastBufferFlushes_;
+    uint64_t lastCoefficientUpdates_;
+    uint64_t lastParameterEvents_;
+    float lastRoomSize_;
+    
+    // Session capture (records written by the audio thread)
+    SessionCapture sessionCapture_;
+    
+    // Quality tiers (audio thread)
+    QualityGovernor governor_;
+    QualityTier activeTier_;
+    int crossfadeLength_;
+    int crossfadeRemaining_;
+    
+    // Multi-rate tail factor and SIMD switch requested for both networks
+    std::atomic<int> tailDecimation_{1};
+    std::atomic<bool> simdEnabled_{true};
+    
+    // Pipelined mode (helper thread owned by pipeline_, destroyed before the networks)
+    std::unique_ptr<FDNPipeline> pipeline_;
+    std::atomic<bool> pipelined_{false};
+    bool pipelineActive_;                       // Audio thread's view
+    std::atomic<bool> pipelineReported_{false}; // pipelineActive_ published for getLatencySamples()
+    std::vector<std::vector<float>> pipelineDryBuffers_;
+    
+    // Optional recording tap (not owned)
+    std::atomic<MultiStreamRecorder*> recorder_{nullptr};
     
     // Internal processing buffers
     std::vector<std::vector<float>> tempBuffers_;
     std::vector<float> wetBuffer_;
     std::vector<float> dryBuffer_;
+    std::vector<std::vector<float>> standbyBuffers_;
+    
+    // Timestamped parameter changes (consumed by processBlock)
+    ParameterEventQueue parameterEvents_;
+    
+    // Smoothed parameters (audio thread, host rate). Mix and gains are rendered
+    // per segment and consumed by the fused mix/gain kernels; decay and damping
+    // move at control rate (once per segment). Room size stays stepped: it
+    // re-lays the delay lines.
+    ParameterRamp wetDryRamp_;                  // 0-1
+    ParameterRamp inputGainRamp_;               // Linear
+    ParameterRamp outputGainRamp_;              // Linear
+    ParameterRamp decayRamp_;                   // Seconds
+    ParameterRamp highDampingRamp_;             // 0-100%
+    ParameterRamp lowDampingRamp_;              // 0-100%
+    std::vector<std::vector<float>> inputBuffers_;  // Host input after the input gain
     
     // Preset configurations
     void applyPresetParameters(Preset preset);
     void updateInternalParameters();
     
+    // Host-rate processing of the span between two parameter events
+    void processSegment(const float* const* inputs, float* const* outputs,
+                        int numChannels, int numSamples);
+    void applyParameterEvent(const ParameterEvent& event, int position);  // position: where it applies
+    void readParameters(float* parameters) const;                           // ParameterId order
+    void updateRamps(int numSamples);
+    void snapRamps();
+    
+    // Engine-rate processing (the whole engine when no resampling is needed)
+    void processEngineBlock(const float* const* inputs, float* const* outputs,
+                            int numChannels, int numSamples,
+                            bool mixOutput, MultiStreamRecorder* recorder);   // false: wet only
+    void processResampled(const float* const* inputs, float* const* outputs,
+                          int numChannels, int numSamples, MultiStreamRecorder* recorder);
+    void resetRateAdapter();
+    
+    // FDN rendering and tier switching
+    void applyFdnParameters(FDNReverb& fdn);
+    void renderWet(FDNReverb& fdn, const float* const* inputs, float* const* wet,
+                   int numChannels, int numSamples);
+    void renderTierCrossfade(const float* const* inputs, float* const* wet,
+                             int numChannels, int numSamples);
+    void beginTierSwitch(QualityTier tier);
+    
+    // One XrunRecorder record per processBlock() (baselines only while disarmed)
+    void recordXrunBlock(uint64_t nanoseconds, uint64_t periodNanoseconds, int numSamples,
+                         const float* inputRms);
+    
     // Utility functions
     float clamp(float value, float min, float max) const;
 };
@@ -0,0 +1,252 @@
+#include "SessionCapture.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace VoiceMonitor {
+
+namespace {
+    static_assert(sizeof(SessionCapture::Header) == 24, "Session file layout");
+    static_assert(sizeof(SessionCapture::ParameterRecord) == 8, "Session file layout");
+    static_assert(sizeof(SessionCapture::BlockRecord) == 4, "Session file layout");
+    static_assert(sizeof(SessionCapture::BlockEndRecord) == 8, "Session file layout");
+
+    // Sequential copy into a reserved (possibly wrapped) ring region
+    class SpanWriter {
+    public:
+        explicit SpanWriter(const AudioBuffer<uint8_t>::WriteSpan& span)
+            : span_(span)
+            , position_(0) {
+        }
+
+        void write(const void* data, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            if (position_ < span_.firstSize) {
+                const size_t count = std::min(size, span_.firstSize - position_);
+                std::memcpy(span_.first + position_, bytes, count);
+                position_ += count;
+                bytes += count;
+                size -= count;
+            }
+            if (size > 0) {
+                std::memcpy(span_.second + (position_ - span_.firstSize), bytes, size);
+                position_ += size;
+            }
+        }
+
+    private:
+        const AudioBuffer<uint8_t>::WriteSpan& span_;
+        size_t position_;
+    };
+}
+
+SessionCapture::SessionCapture()
+    : firstBlock_(true)
+    , blockOpen_(false)
+    , file_(nullptr) {
+    std::fill(lastParameters_, lastParameters_ + NUM_PARAMETERS, 0.0f);
+}
+
+SessionCapture::~SessionCapture() {
+    stop();
+}
+
+bool SessionCapture::start(const std::string& path, const Header& header, double bufferSeconds) {
+    if (writerRunning_.load() || header.sampleRate <= 0.0 || header.maxBlockSize == 0 ||
+        header.maxBlockSize > static_cast<uint32_t>(MAX_BLOCK_SIZE)) {
+        return false;
+    }
+
+    file_ = fopen(path.c_str(), "wb");
+    if (!file_) {
+        printf("SessionCapture: cannot create %s\n", path.c_str());
+        return false;
+    }
+    Header fileHeader = header;
+    std::memcpy(fileHeader.magic, Header().magic, sizeof(fileHeader.magic));
+    fileHeader.version = VERSION;
+    if (fwrite(&fileHeader, sizeof(fileHeader), 1, file_) != 1) {
+        fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+
+    // Room for a whole block even with very short buffers
+    const double seconds = bufferSeconds > 0.0 ? bufferSeconds : DEFAULT_BUFFER_SECONDS;
+    const size_t audioBytes = static_cast<size_t>(seconds * header.sampleRate) * MAX_CHANNELS * sizeof(float);
+    const size_t blockBytes = sizeof(BlockRecord) + sizeof(BlockEndRecord) +
+                              2 * NUM_PARAMETERS * sizeof(ParameterRecord) +
+                              header.maxBlockSize * MAX_CHANNELS * sizeof(float);
+    ring_.resize(std::max(audioBytes + audioBytes / 4, 4 * blockBytes));
+
+    firstBlock_ = true;
+    blockOpen_ = false;
+    overflowed_.store(false, std::memory_order_relaxed);
+    writeError_.store(false, std::memory_order_relaxed);
+    capturedBlocks_.store(0, std::memory_order_relaxed);
+    bytesWritten_.store(sizeof(fileHeader), std::memory_order_relaxed);
+
+    writerRunning_.store(true);
+    writer_ = std::thread(&SessionCapture::writerLoop, this);
+    active_.store(true, std::memory_order_release);
+    return true;
+}
+
+bool SessionCapture::stop() {
+    if (!writerRunning_.load()) {
+        return false;
+    }
+
+    active_.store(false, std::memory_order_release);
+    writerRunning_.store(false);
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+    while (drain() > 0) {
+    }
+
+    if (fclose(file_) != 0) {
+        writeError_.store(true, std::memory_order_relaxed);
+    }
+    file_ = nullptr;
+    printf("SessionCapture: %llu blocks, %llu bytes%s\n",
+           static_cast<unsigned long long>(capturedBlocks_.load()),
+           static_cast<unsigned long long>(bytesWritten_.load()),
+           overflowed_.load() ? " (stopped early: ring overflow)" : "");
+    return !writeError_.load();
+}
+
+// ============================================================================
+// Audio thread
+// ============================================================================
+
+bool SessionCapture::reserve(size_t size, AudioBuffer<uint8_t>::WriteSpan& span) {
+    span = ring_.acquireWrite(size);
+    if (span.size() < size) {
+        // Ends the session here: a gap would make the replay diverge
+        overflowed_.store(true, std::memory_order_relaxed);
+        active_.store(false, std::memory_order_release);
+        blockOpen_ = false;
+        return false;
+    }
+    return true;
+}
+
+void SessionCapture::beginBlock(const float* const* inputs, int numChannels, int numSamples, const float* parameters) {
+    if (!active_.load(std::memory_order_acquire) || numChannels < 1 || numChannels > MAX_CHANNELS ||
+        numSamples < 0 || numSamples > MAX_BLOCK_SIZE) {
+        return;
+    }
+
+    int changes = 0;
+    for (int p = 0; p < NUM_PARAMETERS; ++p) {
+        if (firstBlock_ || parameters[p] != lastParameters_[p]) {
+            ++changes;
+        }
+    }
+
+    const size_t audioBytes = static_cast<size_t>(numChannels) * static_cast<size_t>(numSamples) * sizeof(float);
+    AudioBuffer<uint8_t>::WriteSpan span;
+    if (!reserve(changes * sizeof(ParameterRecord) + sizeof(BlockRecord) + audioBytes, span)) {
+        return;
+    }
+
+    SpanWriter writer(span);
+    for (int p = 0; p < NUM_PARAMETERS; ++p) {
+        if (firstBlock_ || parameters[p] != lastParameters_[p]) {
+            ParameterRecord record;
+            record.type = ParameterSet;
+            record.id = static_cast<uint8_t>(p);
+            record.value = parameters[p];
+            writer.write(&record, sizeof(record));
+            lastParameters_[p] = parameters[p];
+        }
+    }
+
+    BlockRecord block;
+    block.numChannels = static_cast<uint8_t>(numChannels);
+    block.numSamples = static_cast<uint16_t>(numSamples);
+    writer.write(&block, sizeof(block));
+    for (int ch = 0; ch < numChannels; ++ch) {
+        writer.write(inputs[ch], static_cast<size_t>(numSamples) * sizeof(float));
+    }
+    ring_.commitWrite(span.size());
+
+    firstBlock_ = false;
+    blockOpen_ = true;
+}
+
+void SessionCapture::recordEvent(ParameterId id, float value, int sampleOffset) {
+    if (!blockOpen_ || !active_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    AudioBuffer<uint8_t>::WriteSpan span;
+    if (!reserve(sizeof(ParameterRecord), span)) {
+        return;
+    }
+
+    ParameterRecord record;
+    record.type = ParameterEvent;
+    record.id = static_cast<uint8_t>(id);
+    record.sampleOffset = static_cast<uint16_t>(std::clamp(sampleOffset, 0, MAX_BLOCK_SIZE));
+    record.value = value;
+    SpanWriter(span).write(&record, sizeof(record));
+    ring_.commitWrite(span.size());
+
+    // Already logged: the next block must not set it again
+    lastParameters_[static_cast<int>(id)] = value;
+}
+
+void SessionCapture::endBlock(int tier, bool pipelined, uint64_t nanoseconds) {
+    if (!blockOpen_ || !active_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    AudioBuffer<uint8_t>::WriteSpan span;
+    if (!reserve(sizeof(BlockEndRecord), span)) {
+        return;
+    }
+
+    BlockEndRecord record;
+    record.tier = static_cast<uint8_t>(tier);
+    record.pipelined = pipelined ? 1 : 0;
+    record.nanoseconds = static_cast<uint32_t>(std::min<uint64_t>(nanoseconds, UINT32_MAX));
+    SpanWriter(span).write(&record, sizeof(record));
+    ring_.commitWrite(span.size());
+
+    blockOpen_ = false;
+    capturedBlocks_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Writer thread
+// ============================================================================
+
+void SessionCapture::writerLoop() {
+    while (writerRunning_.load()) {
+        if (drain() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+        }
+    }
+}
+
+size_t SessionCapture::drain() {
+    const AudioBuffer<uint8_t>::ReadSpan span = ring_.acquireRead(WRITE_CHUNK_BYTES);
+    if (span.size() == 0) {
+        return 0;
+    }
+
+    bool ok = fwrite(span.first, 1, span.firstSize, file_) == span.firstSize;
+    if (span.secondSize > 0) {
+        ok = ok && fwrite(span.second, 1, span.secondSize, file_) == span.secondSize;
+    }
+    if (!ok) {
+        writeError_.store(true, std::memory_order_relaxed);
+    }
+    ring_.commitRead(span.size());
+    bytesWritten_.fetch_add(span.size(), std::memory_order_relaxed);
+    return span.size();
+}
+
+} // namespace VoiceMonitor
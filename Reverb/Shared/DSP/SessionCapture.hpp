@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include "AudioBuffer.hpp"
+#include "ParameterEventQueue.hpp"
+
+namespace VoiceMonitor {
+
+/// Deterministic capture of a live session, for replaying it offline
+///
+/// The audio thread logs everything a ReverbEngine's output depends on: the
+/// input of every block, the parameter values that changed since the previous
+/// block (whichever thread called the setters), each scheduled parameter event
+/// at the sample offset it was applied, and the quality tier and pipelined
+/// state the block ended with. Records are appended to a byte SPSC ring and a
+/// background thread streams them to a compact binary file (host byte order):
+///
+///   Header, then per block:
+///     ParameterRecord (ParameterSet)*   values set before the block
+///     BlockRecord + numChannels x numSamples float   planar input
+///     ParameterRecord (ParameterEvent)* scheduled events, at their offsets
+///     BlockEndRecord                    tier, pipelined, live block time
+///
+/// The first block sets all parameters. Capture is all-or-nothing per record:
+/// when the ring overflows the session stops there, so the file is always an
+/// exact prefix and SessionReader drops a trailing incomplete block.
+///
+/// beginBlock/recordEvent/endBlock are audio-thread only and never allocate or
+/// block; start/stop belong to one control thread.
+class SessionCapture {
+public:
+    static constexpr int NUM_PARAMETERS = static_cast<int>(ParameterId::OutputGain) + 1;
+    static constexpr int MAX_CHANNELS = 2;
+    static constexpr uint32_t VERSION = 1;
+    static constexpr int MAX_BLOCK_SIZE = UINT16_MAX;
+    static constexpr double DEFAULT_BUFFER_SECONDS = 4.0;
+    static constexpr int POLL_INTERVAL_MS = 10;
+    static constexpr size_t WRITE_CHUNK_BYTES = 1 << 16;
+
+    enum RecordType : uint8_t {
+        ParameterSet = 'S',
+        ParameterEvent = 'E',
+        BlockInput = 'B',
+        BlockEnd = 'T'
+    };
+
+    struct Header {
+        char magic[4] = { 'V', 'M', 'S', 'C' };
+        uint32_t version = VERSION;
+        double sampleRate = 0.0;                // Host rate
+        uint32_t maxBlockSize = 0;
+        uint8_t tailDecimation = 1;
+        uint8_t simdEnabled = 1;
+        uint8_t adaptiveQuality = 0;
+        uint8_t qualityCeiling = 0;             // QualityTier
+    };
+
+    struct ParameterRecord {
+        uint8_t type = ParameterSet;
+        uint8_t id = 0;                         // ParameterId
+        uint16_t sampleOffset = 0;              // Events only
+        float value = 0.0f;
+    };
+
+    struct BlockRecord {
+        uint8_t type = BlockInput;
+        uint8_t numChannels = 0;
+        uint16_t numSamples = 0;
+    };
+
+    struct BlockEndRecord {
+        uint8_t type = BlockEnd;
+        uint8_t tier = 0;
+        uint8_t pipelined = 0;
+        uint8_t reserved = 0;
+        uint32_t nanoseconds = 0;               // processBlock() time in the live session
+    };
+
+    SessionCapture();
+    ~SessionCapture();
+
+    SessionCapture(const SessionCapture&) = delete;
+    SessionCapture& operator=(const SessionCapture&) = delete;
+
+    /// Create `path`, write the header and start the writer. The ring holds
+    /// bufferSeconds of stereo input at header.sampleRate (not real-time safe).
+    bool start(const std::string& path, const Header& header, double bufferSeconds = DEFAULT_BUFFER_SECONDS);
+    /// Stop capturing, write out everything still buffered and close the file
+    bool stop();
+    bool isActive() const { return active_.load(std::memory_order_acquire); }
+
+    /// Audio thread: open a block. `parameters` are the values it starts with,
+    /// in ParameterId order; the input is logged before any in-place processing.
+    void beginBlock(const float* const* inputs, int numChannels, int numSamples, const float* parameters);
+    /// Audio thread: a scheduled event applied `sampleOffset` samples into the
+    /// block (`value` as the engine stored it)
+    void recordEvent(ParameterId id, float value, int sampleOffset);
+    /// Audio thread: close the block
+    void endBlock(int tier, bool pipelined, uint64_t nanoseconds);
+
+    uint64_t getCapturedBlocks() const { return capturedBlocks_.load(std::memory_order_relaxed); }
+    uint64_t getBytesWritten() const { return bytesWritten_.load(std::memory_order_relaxed); }
+    bool hasOverflowed() const { return overflowed_.load(std::memory_order_relaxed); }
+    bool hasWriteError() const { return writeError_.load(std::memory_order_relaxed); }
+
+private:
+    // Reserve `size` bytes for whole records; false (and capture over) if they do not fit
+    bool reserve(size_t size, AudioBuffer<uint8_t>::WriteSpan& span);
+    void writerLoop();
+    size_t drain();
+
+    AudioBuffer<uint8_t> ring_;
+
+    // Audio thread
+    float lastParameters_[NUM_PARAMETERS];      // Values already logged
+    bool firstBlock_;
+    bool blockOpen_;
+
+    // Writer thread
+    FILE* file_;
+
+    std::atomic<bool> active_{false};
+    std::atomic<bool> overflowed_{false};
+    std::atomic<bool> writeError_{false};
+    std::atomic<uint64_t> capturedBlocks_{0};
+    std::atomic<uint64_t> bytesWritten_{0};
+
+    std::atomic<bool> writerRunning_{false};
+    std::thread writer_;
+};
+
+} // namespace VoiceMonitor
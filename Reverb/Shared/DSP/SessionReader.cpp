@@ -0,0 +1,123 @@
+#include "SessionReader.hpp"
+#include <cstring>
+
+namespace VoiceMonitor {
+
+SessionReader::SessionReader()
+    : file_(nullptr)
+    , blocksRead_(0)
+    , framesRead_(0)
+    , truncated_(false) {
+}
+
+SessionReader::~SessionReader() {
+    close();
+}
+
+bool SessionReader::open(const std::string& path) {
+    close();
+
+    file_ = fopen(path.c_str(), "rb");
+    if (!file_) {
+        printf("SessionReader: cannot open %s\n", path.c_str());
+        return false;
+    }
+
+    const SessionCapture::Header expected;
+    if (!read(&header_, sizeof(header_)) ||
+        std::memcmp(header_.magic, expected.magic, sizeof(header_.magic)) != 0) {
+        printf("SessionReader: %s is not a session capture\n", path.c_str());
+        close();
+        return false;
+    }
+    if (header_.version != SessionCapture::VERSION || header_.sampleRate <= 0.0 || header_.maxBlockSize == 0) {
+        printf("SessionReader: unsupported session (version %u)\n", header_.version);
+        close();
+        return false;
+    }
+
+    blocksRead_ = 0;
+    framesRead_ = 0;
+    truncated_ = false;
+    return true;
+}
+
+void SessionReader::close() {
+    if (file_) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool SessionReader::read(void* data, size_t size) {
+    return fread(data, 1, size, file_) == size;
+}
+
+bool SessionReader::readBlock(Block& block) {
+    if (!file_) {
+        return false;
+    }
+
+    block.sets.clear();
+    block.events.clear();
+    bool haveInput = false;
+    bool started = false;
+
+    uint8_t type = 0;
+    while (read(&type, 1)) {
+        started = true;
+        if (type == SessionCapture::ParameterSet || type == SessionCapture::ParameterEvent) {
+            SessionCapture::ParameterRecord record;
+            record.type = type;
+            if (!read(reinterpret_cast<uint8_t*>(&record) + 1, sizeof(record) - 1) ||
+                record.id >= SessionCapture::NUM_PARAMETERS ||
+                (type == SessionCapture::ParameterSet) == haveInput) {
+                break;  // Sets precede the input, events follow it
+            }
+            ParameterEvent event;
+            event.id = static_cast<ParameterId>(record.id);
+            event.value = record.value;
+            event.sampleOffset = type == SessionCapture::ParameterEvent ? record.sampleOffset : 0;
+            (type == SessionCapture::ParameterSet ? block.sets : block.events).push_back(event);
+        } else if (type == SessionCapture::BlockInput && !haveInput) {
+            SessionCapture::BlockRecord record;
+            if (!read(reinterpret_cast<uint8_t*>(&record) + 1, sizeof(record) - 1) ||
+                record.numChannels < 1 || record.numChannels > MAX_CHANNELS ||
+                record.numSamples > header_.maxBlockSize) {
+                break;
+            }
+            block.numChannels = record.numChannels;
+            block.numSamples = record.numSamples;
+            bool ok = true;
+            for (int ch = 0; ch < block.numChannels && ok; ++ch) {
+                block.samples[ch].resize(static_cast<size_t>(block.numSamples));
+                ok = read(block.samples[ch].data(), static_cast<size_t>(block.numSamples) * sizeof(float));
+                block.channels[ch] = block.samples[ch].data();
+            }
+            if (!ok) {
+                break;
+            }
+            haveInput = true;
+        } else if (type == SessionCapture::BlockEnd && haveInput) {
+            SessionCapture::BlockEndRecord record;
+            if (!read(reinterpret_cast<uint8_t*>(&record) + 1, sizeof(record) - 1)) {
+                break;
+            }
+            block.tier = record.tier;
+            block.pipelined = record.pipelined != 0;
+            block.liveNanoseconds = record.nanoseconds;
+            block.index = blocksRead_++;
+            block.startFrame = framesRead_;
+            framesRead_ += static_cast<uint64_t>(block.numSamples);
+            return true;
+        } else {
+            break;
+        }
+    }
+
+    // Clean end of file, or a partial/unknown record
+    truncated_ = started || !feof(file_);
+    return false;
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "SessionCapture.hpp"
+
+namespace VoiceMonitor {
+
+/// Reads a SessionCapture file back one block at a time (offline)
+///
+/// A block is returned only once its BlockEndRecord has been read, so a file
+/// cut short by a ring overflow or a crash ends at its last complete block.
+class SessionReader {
+public:
+    static constexpr int MAX_CHANNELS = SessionCapture::MAX_CHANNELS;
+
+    struct Block {
+        uint64_t index = 0;
+        uint64_t startFrame = 0;
+        int numChannels = 0;
+        int numSamples = 0;
+        std::vector<ParameterEvent> sets;       // Values in force from the start of the block
+        std::vector<ParameterEvent> events;     // Scheduled events, at their offsets
+        std::vector<float> samples[MAX_CHANNELS];
+        const float* channels[MAX_CHANNELS] = {};
+        int tier = 0;                           // QualityTier the block ended with
+        bool pipelined = false;
+        uint32_t liveNanoseconds = 0;
+    };
+
+    SessionReader();
+    ~SessionReader();
+
+    SessionReader(const SessionReader&) = delete;
+    SessionReader& operator=(const SessionReader&) = delete;
+
+    /// Open a session and check its header
+    bool open(const std::string& path);
+    void close();
+
+    const SessionCapture::Header& getHeader() const { return header_; }
+
+    /// Next complete block; false at the end of the session or on a malformed record
+    bool readBlock(Block& block);
+    bool isTruncated() const { return truncated_; }    // Stopped at an incomplete or malformed block
+
+private:
+    bool read(void* data, size_t size);
+
+    FILE* file_;
+    SessionCapture::Header header_;
+    uint64_t blocksRead_;
+    uint64_t framesRead_;
+    bool truncated_;
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,76 @@
+#include "StageProfile.hpp"
+#include <chrono>
+
+namespace VoiceMonitor {
+
+namespace {
+    const char* const STAGE_NAMES[StageProfile::NUM_STAGES] = {
+        "cross_feed",
+        "pre_delay",
+        "early_reflections",
+        "diffusion",
+        "delay_lines",
+        "matrix",
+        "damping",
+        "tail_resampling",
+        "spread",
+        "tone_filter",
+        "output_stage"
+    };
+}
+
+StageProfile::Snapshot StageProfile::Snapshot::operator-(const Snapshot& earlier) const {
+    Snapshot difference;
+    for (int stage = 0; stage < NUM_STAGES; ++stage) {
+        difference.ticks[stage] = ticks[stage] - earlier.ticks[stage];
+        difference.laps[stage] = laps[stage] - earlier.laps[stage];
+    }
+    difference.samples = samples - earlier.samples;
+    difference.ticksPerSecond = ticksPerSecond;
+    return difference;
+}
+
+StageProfile::Snapshot StageProfile::snapshot() const {
+    Snapshot result;
+    for (int stage = 0; stage < NUM_STAGES; ++stage) {
+        result.ticks[stage] = entries_[stage].ticks.load(std::memory_order_relaxed);
+        result.laps[stage] = entries_[stage].laps.load(std::memory_order_relaxed);
+    }
+    result.samples = samples_.load(std::memory_order_relaxed);
+    result.ticksPerSecond = getTicksPerSecond();
+    return result;
+}
+
+const char* StageProfile::getStageName(int stage) {
+    return (stage >= 0 && stage < NUM_STAGES) ? STAGE_NAMES[stage] : "unknown";
+}
+
+uint64_t StageProfile::steadyNanoseconds() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+double StageProfile::getTicksPerSecond() {
+    static const double ticksPerSecond = []() {
+#if defined(__aarch64__)
+        uint64_t frequency;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+        return static_cast<double>(frequency);
+#elif defined(__x86_64__) || defined(__i386__)
+        // Invariant TSC: count it across a 20 ms busy wait on the steady clock
+        constexpr uint64_t calibrationNanoseconds = 20000000;
+        const uint64_t startNanoseconds = steadyNanoseconds();
+        const uint64_t startTicks = now();
+        uint64_t elapsed = 0;
+        do {
+            elapsed = steadyNanoseconds() - startNanoseconds;
+        } while (elapsed < calibrationNanoseconds);
+        return static_cast<double>(now() - startTicks) * 1e9 / static_cast<double>(elapsed);
+#else
+        return 1e9;     // now() is the steady clock in nanoseconds
+#endif
+    }();
+    return ticksPerSecond;
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Per-stage probes are compiled in only with VM_STAGE_PROFILING=1 (CMake
+// option ENABLE_STAGE_PROFILING); otherwise the VM_STAGE_* macros expand to
+// nothing and the stats block just stays at zero
+#ifndef VM_STAGE_PROFILING
+#define VM_STAGE_PROFILING 0
+#endif
+
+namespace VoiceMonitor {
+
+/// Lock-free per-stage time accounting for the reverb signal path
+///
+/// Probes read the CPU's own counter - TSC on x86, CNTVCT_EL0 on ARM64
+/// (a fixed-frequency timer there, not core cycles) - and add the ticks since
+/// the previous probe to a stage. Every stage has exactly one writer at a time
+/// (the audio thread, or the FDNPipeline helper for the loop stages), so
+/// accumulating is a relaxed load and store, no locked read-modify-write; each
+/// stage sits on its own cache line so the two threads never share one.
+/// Any thread may take a snapshot; counts only grow, so subtract two
+/// snapshots for an interval. Same idea as ARM64::PerformanceCounter in the
+/// iOS tree, but without a system call per reading and with the per-stage
+/// store built in.
+class StageProfile {
+public:
+    enum Stage : int {
+        CrossFeed,          // FDN input cross-feed
+        PreDelay,
+        EarlyReflections,
+        Diffusion,
+        DelayLines,         // Modulated reads of the loop lines
+        Matrix,             // Feedback matrix
+        Damping,            // Damping filters, line writes and the stereo output mix
+        TailResampling,     // Multi-rate tail decimation and interpolation
+        Spread,             // FDN output stage
+        ToneFilter,         // FDN output stage
+        OutputStage,        // Engine's fused spread/tone/cross-feed/mix
+        NUM_STAGES
+    };
+
+    struct Snapshot {
+        uint64_t ticks[NUM_STAGES] = {};
+        uint64_t laps[NUM_STAGES] = {};     // Probe hits (per sample or per block)
+        uint64_t samples = 0;               // FDN input samples (stereo frames)
+        double ticksPerSecond = 0.0;
+
+        Snapshot operator-(const Snapshot& earlier) const;
+        double getSeconds(int stage) const { return ticksPerSecond > 0.0 ? ticks[stage] / ticksPerSecond : 0.0; }
+        double getTicksPerSample(int stage) const { return samples ? static_cast<double>(ticks[stage]) / samples : 0.0; }
+    };
+
+    static constexpr bool ENABLED = VM_STAGE_PROFILING != 0;
+
+    /// Writer side (the stage's owning thread)
+    void add(int stage, uint64_t ticks) {
+        Entry& entry = entries_[stage];
+        entry.ticks.store(entry.ticks.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+        entry.laps.store(entry.laps.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    void addSamples(int numSamples) {
+        samples_.store(samples_.load(std::memory_order_relaxed) + static_cast<uint64_t>(numSamples),
+                       std::memory_order_relaxed);
+    }
+
+    /// Reader side (any thread); the first call calibrates the counter (~20 ms)
+    Snapshot snapshot() const;
+
+    static const char* getStageName(int stage);
+
+    /// Raw counter; unserialized, so a probe can be off by a few instructions
+    static inline uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return steadyNanoseconds();
+#endif
+    }
+
+    /// Counter frequency: read from CNTFRQ_EL0, else measured against steady_clock
+    static double getTicksPerSecond();
+
+private:
+    static uint64_t steadyNanoseconds();
+
+    struct alignas(64) Entry {
+        std::atomic<uint64_t> ticks{0};
+        std::atomic<uint64_t> laps{0};
+    };
+
+    Entry entries_[NUM_STAGES];
+    alignas(64) std::atomic<uint64_t> samples_{0};
+};
+
+/// Probe chain within one function: each lap() charges the time since the
+/// previous one (or construction/restart()) to a stage. No-op without a profile.
+class StageClock {
+public:
+    explicit StageClock(StageProfile* profile)
+        : profile_(profile)
+        , last_(StageProfile::now()) {
+    }
+
+    void lap(int stage) {
+        const uint64_t time = StageProfile::now();
+        if (profile_) {
+            profile_->add(stage, time - last_);
+        }
+        last_ = time;
+    }
+
+    void restart() { last_ = StageProfile::now(); }
+
+private:
+    StageProfile* profile_;
+    uint64_t last_;
+};
+
+} // namespace VoiceMonitor
+
+#if VM_STAGE_PROFILING
+#define VM_STAGE_CLOCK(profile) ::VoiceMonitor::StageClock stageClock(profile)
+#define VM_STAGE_LAP(stage) stageClock.lap(::VoiceMonitor::StageProfile::stage)
+#define VM_STAGE_RESTART() stageClock.restart()
+#define VM_STAGE_SAMPLES(profile, numSamples) \
+    do { if (profile) (profile)->addSamples(numSamples); } while (0)
+#else
+#define VM_STAGE_CLOCK(profile) ((void)0)
+#define VM_STAGE_LAP(stage) ((void)0)
+#define VM_STAGE_RESTART() ((void)0)
+#define VM_STAGE_SAMPLES(profile, numSamples) ((void)0)
+#endif
@@ -0,0 +1,299 @@
+#include "TraceBuffer.hpp"
+#include <chrono>
+#include <cstring>
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr int TRACE_PID = 1;
+
+    // Perfetto protobuf field tags (perfetto/trace/trace_packet.proto and friends)
+    constexpr uint32_t TRACE_PACKET = 1;                // Trace.packet
+    constexpr uint32_t PACKET_TIMESTAMP = 8;
+    constexpr uint32_t PACKET_SEQUENCE_ID = 10;         // trusted_packet_sequence_id
+    constexpr uint32_t PACKET_TRACK_EVENT = 11;
+    constexpr uint32_t PACKET_SEQUENCE_FLAGS = 13;
+    constexpr uint32_t PACKET_TRACK_DESCRIPTOR = 60;
+    constexpr uint32_t EVENT_DEBUG_ANNOTATION = 4;
+    constexpr uint32_t EVENT_TYPE = 9;
+    constexpr uint32_t EVENT_TRACK_UUID = 11;
+    constexpr uint32_t EVENT_NAME = 23;
+    constexpr uint32_t ANNOTATION_DOUBLE = 5;
+    constexpr uint32_t ANNOTATION_NAME = 10;
+    constexpr uint32_t TRACK_UUID = 1;
+    constexpr uint32_t TRACK_THREAD = 4;
+    constexpr uint32_t THREAD_PID = 1;
+    constexpr uint32_t THREAD_TID = 2;
+    constexpr uint32_t THREAD_NAME = 5;
+    constexpr uint64_t SLICE_BEGIN = 1;
+    constexpr uint64_t SLICE_END = 2;
+    constexpr uint64_t INSTANT = 3;
+    constexpr uint64_t INCREMENTAL_STATE_CLEARED = 1;
+    constexpr uint64_t SEQUENCE_ID = 1;
+
+    // Minimal protobuf wire encoding
+    void putVarint(std::string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    void putVarintField(std::string& out, uint32_t field, uint64_t value) {
+        putVarint(out, field << 3);
+        putVarint(out, value);
+    }
+
+    void putBytesField(std::string& out, uint32_t field, const char* data, size_t length) {
+        putVarint(out, (field << 3) | 2);
+        putVarint(out, length);
+        out.append(data, length);
+    }
+
+    void putBytesField(std::string& out, uint32_t field, const std::string& bytes) {
+        putBytesField(out, field, bytes.data(), bytes.size());
+    }
+
+    void putStringField(std::string& out, uint32_t field, const char* text) {
+        putBytesField(out, field, text, std::strlen(text));
+    }
+
+    void putDoubleField(std::string& out, uint32_t field, double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        putVarint(out, (field << 3) | 1);
+        for (int i = 0; i < 8; ++i) {
+            out.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+        }
+    }
+}
+
+TraceBuffer::TraceBuffer()
+    : mask_(0)
+    , dequeuePosition_(0)
+    , file_(nullptr)
+    , format_(Format::ChromeJson)
+    , startTimestamp_(0)
+    , nanosecondsPerTick_(1.0)
+    , firstEvent_(true)
+    , writeError_(false) {
+}
+
+TraceBuffer::~TraceBuffer() {
+    if (writerRunning_.load()) {
+        stopCapture();
+    }
+}
+
+bool TraceBuffer::startCapture(const std::string& path, Format format, int capacity) {
+    if (writerRunning_.load()) {
+        return false;
+    }
+
+    // Probes of an earlier capture may still be writing into the slots, so
+    // they are allocated once and never replaced
+    if (!slots_) {
+        uint64_t size = 2;
+        while (size < static_cast<uint64_t>(capacity)) {
+            size <<= 1;
+        }
+        slots_.reset(new Slot[size]);
+        for (uint64_t i = 0; i < size; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        mask_ = size - 1;
+        dequeuePosition_ = 0;
+        enqueuePosition_.store(0, std::memory_order_relaxed);
+    }
+
+    file_ = fopen(path.c_str(), "wb");
+    if (!file_) {
+        printf("TraceBuffer: cannot create %s\n", path.c_str());
+        return false;
+    }
+
+    format_ = format;
+    output_.clear();
+    describedThreads_.clear();
+    firstEvent_ = true;
+    writeError_ = false;
+    writtenEvents_.store(0, std::memory_order_relaxed);
+    droppedEvents_.store(0, std::memory_order_relaxed);
+    nanosecondsPerTick_ = 1e9 / StageProfile::getTicksPerSecond();
+    startTimestamp_ = StageProfile::now();
+    writeHeader();
+
+    writerRunning_.store(true);
+    capturing_.store(true, std::memory_order_release);
+    writer_ = std::thread(&TraceBuffer::drainLoop, this);
+    return true;
+}
+
+bool TraceBuffer::stopCapture() {
+    if (!writerRunning_.load()) {
+        return false;
+    }
+
+    capturing_.store(false, std::memory_order_release);
+    writerRunning_.store(false);
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+
+    // Whatever is left, then the trailer
+    drain();
+    if (format_ == Format::ChromeJson) {
+        for (int thread = 0; thread < MAX_THREADS; ++thread) {
+            const char* name = threadNames_[thread].load(std::memory_order_relaxed);
+            if (!name) {
+                continue;
+            }
+            char line[160];
+            snprintf(line, sizeof(line),
+                     "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                     firstEvent_ ? "\n" : ",\n", TRACE_PID, thread, name);
+            output_ += line;
+            firstEvent_ = false;
+        }
+        output_ += "\n]}\n";
+    }
+    flushOutput();
+
+    if (fclose(file_) != 0) {
+        writeError_ = true;
+    }
+    file_ = nullptr;
+    return !writeError_;
+}
+
+// ============================================================================
+// Writer thread
+// ============================================================================
+
+void TraceBuffer::drainLoop() {
+    while (writerRunning_.load()) {
+        drain();
+        flushOutput();
+        std::this_thread::sleep_for(std::chrono::milliseconds(DRAIN_INTERVAL_MS));
+    }
+}
+
+void TraceBuffer::drain() {
+    for (;;) {
+        Slot& slot = slots_[dequeuePosition_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition_ + 1) {
+            break;      // Empty, or the next event is still being written
+        }
+        const Event event = slot.event;
+        slot.sequence.store(dequeuePosition_ + mask_ + 1, std::memory_order_release);
+        ++dequeuePosition_;
+
+        // Stragglers from probes that were already running when the last capture stopped
+        if (event.timestamp >= startTimestamp_) {
+            writeEvent(event);
+            writtenEvents_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void TraceBuffer::writeHeader() {
+    if (format_ == Format::ChromeJson) {
+        output_ += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    }
+}
+
+void TraceBuffer::writeEvent(const Event& event) {
+    const uint64_t time = static_cast<uint64_t>((event.timestamp - startTimestamp_) * nanosecondsPerTick_);
+
+    if (format_ == Format::ChromeJson) {
+        char line[256];
+        const char* separator = firstEvent_ ? "\n" : ",\n";
+        const double microseconds = time * 0.001;
+        switch (event.phase) {
+            case Phase::Begin:
+            case Phase::End:
+                snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%u}",
+                         separator, event.name, event.phase == Phase::Begin ? 'B' : 'E',
+                         microseconds, TRACE_PID, event.thread);
+                break;
+            case Phase::Instant:
+                snprintf(line, sizeof(line),
+                         "%s{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":%d,\"tid\":%u,"
+                         "\"args\":{\"value\":%g}}",
+                         separator, event.name, microseconds, TRACE_PID, event.thread, event.value);
+                break;
+        }
+        output_ += line;
+        firstEvent_ = false;
+        return;
+    }
+
+    // Perfetto: one thread track per trace thread, described before its first event
+    if (event.thread >= describedThreads_.size()) {
+        describedThreads_.resize(event.thread + 1, false);
+    }
+    if (!describedThreads_[event.thread]) {
+        writeThreadDescriptor(event.thread);
+        describedThreads_[event.thread] = true;
+    }
+
+    std::string trackEvent;
+    putVarintField(trackEvent, EVENT_TYPE, event.phase == Phase::Begin ? SLICE_BEGIN
+                                           : event.phase == Phase::End ? SLICE_END : INSTANT);
+    putVarintField(trackEvent, EVENT_TRACK_UUID, event.thread);
+    if (event.phase != Phase::End) {
+        putStringField(trackEvent, EVENT_NAME, event.name);
+    }
+    if (event.phase == Phase::Instant) {
+        std::string annotation;
+        putStringField(annotation, ANNOTATION_NAME, "value");
+        putDoubleField(annotation, ANNOTATION_DOUBLE, event.value);
+        putBytesField(trackEvent, EVENT_DEBUG_ANNOTATION, annotation);
+    }
+
+    std::string packet;
+    putVarintField(packet, PACKET_TIMESTAMP, time);
+    putVarintField(packet, PACKET_SEQUENCE_ID, SEQUENCE_ID);
+    putBytesField(packet, PACKET_TRACK_EVENT, trackEvent);
+    putBytesField(output_, TRACE_PACKET, packet);
+}
+
+void TraceBuffer::writeThreadDescriptor(uint32_t thread) {
+    const char* name = thread < MAX_THREADS ? threadNames_[thread].load(std::memory_order_relaxed) : nullptr;
+    char fallback[32];
+    if (!name) {
+        snprintf(fallback, sizeof(fallback), "thread %u", thread);
+        name = fallback;
+    }
+
+    std::string threadDescriptor;
+    putVarintField(threadDescriptor, THREAD_PID, TRACE_PID);
+    putVarintField(threadDescriptor, THREAD_TID, thread);
+    putStringField(threadDescriptor, THREAD_NAME, name);
+
+    std::string track;
+    putVarintField(track, TRACK_UUID, thread);
+    putBytesField(track, TRACK_THREAD, threadDescriptor);
+
+    std::string packet;
+    putVarintField(packet, PACKET_SEQUENCE_ID, SEQUENCE_ID);
+    if (firstEvent_) {
+        putVarintField(packet, PACKET_SEQUENCE_FLAGS, INCREMENTAL_STATE_CLEARED);
+        firstEvent_ = false;
+    }
+    putBytesField(packet, PACKET_TRACK_DESCRIPTOR, track);
+    putBytesField(output_, TRACE_PACKET, packet);
+}
+
+bool TraceBuffer::flushOutput() {
+    if (!output_.empty()) {
+        if (fwrite(output_.data(), 1, output_.size(), file_) != output_.size()) {
+            writeError_ = true;
+        }
+        output_.clear();
+    }
+    return !writeError_;
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "StageProfile.hpp"
+
+// Trace probes are compiled in only with VM_TRACING=1 (CMake option
+// ENABLE_TRACING); otherwise the VM_TRACE_* macros expand to nothing
+#ifndef VM_TRACING
+#define VM_TRACING 0
+#endif
+
+namespace VoiceMonitor {
+
+/// Timeline of what the audio path did, for glitches that averages hide
+///
+/// Probes push begin/end/instant events into a bounded multi-producer queue
+/// (the audio thread, the FDNPipeline helper and control threads may all
+/// trace): a slot is claimed with one compare-and-swap, never a lock, and an
+/// event that finds the queue full is dropped and counted. While a capture is
+/// running, a background thread drains the queue every few milliseconds and
+/// appends the events to a Chrome trace JSON file (chrome://tracing,
+/// ui.perfetto.dev) or a Perfetto protobuf trace (TrackEvent packets).
+///
+/// Timestamps come from the same raw counter as StageProfile, converted to
+/// time by the writer. Outside a capture a probe is one load and a branch;
+/// built without VM_TRACING there are no probes at all.
+class TraceBuffer {
+public:
+    static constexpr int DEFAULT_CAPACITY = 1 << 16;       // Events, power of two
+    static constexpr int MAX_THREADS = 16;                  // Named threads
+    static constexpr int DRAIN_INTERVAL_MS = 10;
+
+    enum class Format {
+        ChromeJson,
+        PerfettoProtobuf
+    };
+
+    static constexpr bool ENABLED = VM_TRACING != 0;
+
+    TraceBuffer();
+    ~TraceBuffer();
+
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+    // Capture control (one control thread). The queue is allocated on the
+    // first start and kept; capacity is rounded up to a power of two.
+    bool startCapture(const std::string& path, Format format, int capacity = DEFAULT_CAPACITY);
+    bool stopCapture();     // Drains, finishes and closes the file; false on a write error
+    bool isCapturing() const { return capturing_.load(std::memory_order_relaxed); }
+
+    uint64_t getWrittenEvents() const { return writtenEvents_.load(std::memory_order_relaxed); }
+    uint64_t getDroppedEvents() const { return droppedEvents_.load(std::memory_order_relaxed); }
+
+    // Probes (any thread). `name` must be a string literal or otherwise outlive the capture.
+    void begin(const char* name) { if (capturing_.load(std::memory_order_acquire)) push(name, Phase::Begin, 0.0); }
+    void end(const char* name) { if (capturing_.load(std::memory_order_acquire)) push(name, Phase::End, 0.0); }
+    void instant(const char* name, double value) {
+        if (capturing_.load(std::memory_order_acquire)) push(name, Phase::Instant, value);
+    }
+
+    /// Label the calling thread in traces (a literal; cheap enough to call per block)
+    static void setThreadName(const char* name) {
+        const uint32_t thread = getThreadId();
+        if (thread < MAX_THREADS && threadNames_[thread].load(std::memory_order_relaxed) != name) {
+            threadNames_[thread].store(name, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    enum class Phase : uint8_t { Begin, End, Instant };
+
+    struct Event {
+        uint64_t timestamp;             // StageProfile::now() ticks
+        const char* name;
+        double value;                   // Instant events
+        uint32_t thread;
+        Phase phase;
+    };
+
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        Event event;
+    };
+
+    // Small per-thread ids in order of first use (trace tids)
+    static uint32_t getThreadId() {
+        static thread_local uint32_t thread = nextThreadId_.fetch_add(1, std::memory_order_relaxed);
+        return thread;
+    }
+
+    void push(const char* name, Phase phase, double value) {
+        const uint64_t timestamp = StageProfile::now();
+        const uint32_t thread = getThreadId();
+
+        // Bounded MPMC queue (Vyukov): a slot is free when its sequence equals the position
+        uint64_t position = enqueuePosition_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[position & mask_];
+            const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const int64_t lag = static_cast<int64_t>(sequence - position);
+            if (lag == 0) {
+                if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.event = { timestamp, name, value, thread, phase };
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return;
+                }
+            } else if (lag < 0) {
+                droppedEvents_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                position = enqueuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Writer thread
+    void drainLoop();
+    void drain();
+    void writeHeader();
+    void writeEvent(const Event& event);
+    void writeThreadDescriptor(uint32_t thread);
+    bool flushOutput();
+
+    static inline std::atomic<uint32_t> nextThreadId_{1};
+    static inline std::atomic<const char*> threadNames_[MAX_THREADS] = {};
+
+    std::unique_ptr<Slot[]> slots_;
+    uint64_t mask_;
+    std::atomic<uint64_t> enqueuePosition_{0};
+    uint64_t dequeuePosition_;
+
+    std::atomic<bool> capturing_{false};
+    std::atomic<bool> writerRunning_{false};
+    std::thread writer_;
+    std::atomic<uint64_t> writtenEvents_{0};
+    std::atomic<uint64_t> droppedEvents_{0};
+
+    // Writer thread state
+    FILE* file_;
+    Format format_;
+    std::string output_;                // Serialized, not yet written
+    uint64_t startTimestamp_;
+    double nanosecondsPerTick_;
+    std::vector<bool> describedThreads_;    // Threads with a Perfetto track so far
+    bool firstEvent_;
+    bool writeError_;
+};
+
+} // namespace VoiceMonitor
+
+#if VM_TRACING
+#define VM_TRACE_BEGIN(trace, name) do { if (trace) (trace)->begin(name); } while (0)
+#define VM_TRACE_END(trace, name) do { if (trace) (trace)->end(name); } while (0)
+#define VM_TRACE_INSTANT(trace, name, value) do { if (trace) (trace)->instant(name, value); } while (0)
+#define VM_TRACE_THREAD_NAME(name) ::VoiceMonitor::TraceBuffer::setThreadName(name)
+#else
+#define VM_TRACE_BEGIN(trace, name) ((void)0)
+#define VM_TRACE_END(trace, name) ((void)0)
+#define VM_TRACE_INSTANT(trace, name, value) ((void)0)
+#define VM_TRACE_THREAD_NAME(name) ((void)0)
+#endif
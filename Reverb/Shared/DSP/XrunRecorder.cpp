@@ -0,0 +1,168 @@
+#include "XrunRecorder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+namespace VoiceMonitor {
+
+namespace {
+    // JSON keys, in ParameterId order
+    const char* const PARAMETER_NAMES[XrunRecorder::NUM_PARAMETERS] = {
+        "wet_dry_mix",
+        "decay_time",
+        "pre_delay",
+        "cross_feed",
+        "room_size",
+        "density",
+        "high_freq_damping",
+        "low_freq_damping",
+        "stereo_width",
+        "phase_invert",
+        "bypass",
+        "input_gain",
+        "output_gain"
+    };
+
+    double toDecibels(float rms) {
+        return rms > 1e-9f ? 20.0 * std::log10(rms) : -180.0;
+    }
+}
+
+XrunRecorder::XrunRecorder()
+    : recorded_(0)
+    , dumpBlocks_(0)
+    , dumpThreshold_(1.0) {
+}
+
+XrunRecorder::~XrunRecorder() {
+    stop();
+}
+
+bool XrunRecorder::start(const std::string& directory, double threshold) {
+    if (writerRunning_.load()) {
+        return false;
+    }
+
+    directory_ = directory;
+    threshold_.store(threshold > 0.0 ? threshold : 1.0, std::memory_order_relaxed);
+    recorded_ = 0;
+    dumpPending_.store(false);
+    overruns_.store(0, std::memory_order_relaxed);
+    dumps_.store(0, std::memory_order_relaxed);
+    skippedDumps_.store(0, std::memory_order_relaxed);
+
+    writerRunning_.store(true);
+    writer_ = std::thread(&XrunRecorder::writerLoop, this);
+    active_.store(true, std::memory_order_release);
+    return true;
+}
+
+void XrunRecorder::stop() {
+    if (!writerRunning_.load()) {
+        return;
+    }
+
+    active_.store(false, std::memory_order_release);
+    writerRunning_.store(false);
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+    if (dumpPending_.load(std::memory_order_acquire)) {
+        writeDump();
+        dumpPending_.store(false, std::memory_order_release);
+    }
+}
+
+void XrunRecorder::record(const BlockRecord& block) {
+    if (!active_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    history_[recorded_ % HISTORY_BLOCKS] = block;
+    ++recorded_;
+
+    const double threshold = threshold_.load(std::memory_order_relaxed);
+    if (block.nanoseconds < threshold * block.periodNanoseconds) {
+        return;
+    }
+
+    overruns_.fetch_add(1, std::memory_order_relaxed);
+    if (dumpPending_.load(std::memory_order_acquire)) {
+        skippedDumps_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Freeze the history, oldest first (a plain copy of a few kB; the block has
+    // already overrun, and the file is written elsewhere)
+    const int count = static_cast<int>(std::min<uint64_t>(recorded_, HISTORY_BLOCKS));
+    const uint64_t first = recorded_ - static_cast<uint64_t>(count);
+    for (int i = 0; i < count; ++i) {
+        dump_[i] = history_[(first + static_cast<uint64_t>(i)) % HISTORY_BLOCKS];
+    }
+    dumpBlocks_ = count;
+    dumpThreshold_ = threshold;
+    dumpPending_.store(true, std::memory_order_release);
+}
+
+// ============================================================================
+// Writer thread
+// ============================================================================
+
+void XrunRecorder::writerLoop() {
+    while (writerRunning_.load()) {
+        if (dumpPending_.load(std::memory_order_acquire)) {
+            writeDump();
+            dumpPending_.store(false, std::memory_order_release);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+    }
+}
+
+bool XrunRecorder::writeDump() {
+    const uint64_t index = dumps_.load(std::memory_order_relaxed);
+    char name[32];
+    snprintf(name, sizeof(name), "/xrun_%04llu.json", static_cast<unsigned long long>(index));
+    const std::string path = directory_ + name;
+
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        printf("XrunRecorder: cannot create %s\n", path.c_str());
+        return false;
+    }
+
+    // The overrunning block is the last one; times are relative to it
+    const BlockRecord& trigger = dump_[dumpBlocks_ - 1];
+    fprintf(file, "{\n");
+    fprintf(file, "  \"xrun\": %llu,\n", static_cast<unsigned long long>(index));
+    fprintf(file, "  \"threshold\": %.3f,\n", dumpThreshold_);
+    fprintf(file, "  \"trigger_block\": %llu,\n", static_cast<unsigned long long>(trigger.block));
+    fprintf(file, "  \"blocks\": [\n");
+    for (int i = 0; i < dumpBlocks_; ++i) {
+        const BlockRecord& r = dump_[i];
+        const double offsetMs = (static_cast<double>(r.timestamp) - static_cast<double>(trigger.timestamp)) * 1e-6;
+        fprintf(file, "    {\"block\": %llu, \"time_ms\": %.3f, \"duration_us\": %.1f, \"period_us\": %.1f, "
+                      "\"load\": %.3f, \"frames\": %d, \"input_rms_db\": [%.1f, %.1f], \"tier\": %d, "
+                      "\"crossfading\": %s, \"pipelined\": %s, \"buffer_flushes\": %d, "
+                      "\"coefficient_updates\": %d, \"parameter_events\": %d, \"room_size_delta\": %.4f, "
+                      "\"parameters\": {",
+                static_cast<unsigned long long>(r.block), offsetMs, r.nanoseconds * 1e-3,
+                r.periodNanoseconds * 1e-3,
+                r.periodNanoseconds ? static_cast<double>(r.nanoseconds) / r.periodNanoseconds : 0.0,
+                r.numSamples, toDecibels(r.inputRms[0]), toDecibels(r.inputRms[1]), r.tier,
+                r.crossfading ? "true" : "false", r.pipelined ? "true" : "false",
+                r.bufferFlushes, r.coefficientUpdates, r.parameterEvents, r.roomSizeDelta);
+        for (int p = 0; p < NUM_PARAMETERS; ++p) {
+            fprintf(file, "%s\"%s\": %g", p ? ", " : "", PARAMETER_NAMES[p], r.parameters[p]);
+        }
+        fprintf(file, "}}%s\n", i + 1 < dumpBlocks_ ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+
+    const bool ok = fclose(file) == 0;
+    dumps_.fetch_add(1, std::memory_order_relaxed);
+    printf("XrunRecorder: %s (%d blocks)\n", path.c_str(), dumpBlocks_);
+    return ok;
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "ParameterEventQueue.hpp"
+
+namespace VoiceMonitor {
+
+/// Flight recorder for overrunning blocks
+///
+/// The audio thread files a record for every processed block - timing,
+/// parameter values, what the networks rebuilt during it (buffer flushes,
+/// coefficient updates, room size jumps), input level - into a fixed ring of
+/// the last HISTORY_BLOCKS blocks. When a block takes at least `threshold` of
+/// its period, the ring is frozen into a dump buffer and a background thread
+/// writes it out as JSON (xrun_NNNN.json in the capture directory), so a
+/// spike can be traced back to, say, the setRoomSize() that flushed every
+/// delay line two blocks earlier. Overruns while a dump is still being
+/// written are counted but not dumped.
+///
+/// record() is audio-thread only and never allocates or blocks; start/stop
+/// belong to one control thread.
+class XrunRecorder {
+public:
+    static constexpr int HISTORY_BLOCKS = 128;
+    static constexpr int POLL_INTERVAL_MS = 20;
+    static constexpr int NUM_PARAMETERS = static_cast<int>(ParameterId::OutputGain) + 1;
+
+    struct BlockRecord {
+        uint64_t block = 0;                     // processBlock() count
+        uint64_t timestamp = 0;                 // steady_clock ns
+        uint32_t nanoseconds = 0;               // Time spent
+        uint32_t periodNanoseconds = 0;         // Time available
+        int numSamples = 0;
+        float inputRms[2] = {};                 // Linear; [1] repeats [0] for mono
+        float parameters[NUM_PARAMETERS] = {};  // Targets, in ParameterId order
+        float roomSizeDelta = 0.0f;             // Since the previous block
+        uint16_t bufferFlushes = 0;             // FDN flushAllBuffers() calls during the block
+        uint16_t coefficientUpdates = 0;        // Feedback matrix rebuilds
+        uint16_t parameterEvents = 0;           // Scheduled events applied
+        uint8_t tier = 0;                       // QualityTier
+        bool crossfading = false;
+        bool pipelined = false;
+    };
+
+    XrunRecorder();
+    ~XrunRecorder();
+
+    XrunRecorder(const XrunRecorder&) = delete;
+    XrunRecorder& operator=(const XrunRecorder&) = delete;
+
+    /// Arm the recorder; dumps go to `directory` (which must exist). threshold
+    /// is the fraction of the period that counts as an overrun (1.0 = missed deadline).
+    bool start(const std::string& directory, double threshold = 1.0);
+    void stop();    // Writes a pending dump first
+    bool isActive() const { return active_.load(std::memory_order_acquire); }
+
+    /// Audio thread
+    void record(const BlockRecord& block);
+
+    uint64_t getOverrunCount() const { return overruns_.load(std::memory_order_relaxed); }
+    uint64_t getDumpCount() const { return dumps_.load(std::memory_order_relaxed); }
+    uint64_t getSkippedDumpCount() const { return skippedDumps_.load(std::memory_order_relaxed); }
+
+private:
+    void writerLoop();
+    bool writeDump();
+
+    BlockRecord history_[HISTORY_BLOCKS];
+    uint64_t recorded_;                         // Audio thread: blocks filed so far
+
+    // Frozen copy, oldest first; owned by the writer while dumpPending_ is set
+    BlockRecord dump_[HISTORY_BLOCKS];
+    int dumpBlocks_;
+    double dumpThreshold_;
+
+    std::atomic<bool> active_{false};
+    std::atomic<bool> dumpPending_{false};
+    std::atomic<double> threshold_{1.0};
+    std::atomic<uint64_t> overruns_{0};
+    std::atomic<uint64_t> dumps_{0};
+    std::atomic<uint64_t> skippedDumps_{0};
+
+    std::string directory_;
+    std::atomic<bool> writerRunning_{false};
+    std::thread writer_;
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,676 @@
+#include "AsyncRecordingWriter.hpp"
+#include "WavFormat.hpp"
+#include "FDNReverb.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+namespace VoiceMonitor {
+
+namespace {
+    // Poll interval for the pwrite backend's completion/idle waits
+    constexpr auto PWRITE_POLL_INTERVAL = std::chrono::microseconds(200);
+
+#ifdef __linux__
+    // IORING_OP_WRITE arrived in Linux 5.6, well after io_uring itself (5.1):
+    // older kernels create the ring and then fail every write with EINVAL. The
+    // probe interface arrived in the same release, so a failed probe also
+    // means no IORING_OP_WRITE.
+    bool supportsWriteOp(int ringFd) {
+        constexpr unsigned MAX_PROBE_OPS = 64;
+        alignas(io_uring_probe) uint8_t storage[sizeof(io_uring_probe) + MAX_PROBE_OPS * sizeof(io_uring_probe_op)];
+        std::memset(storage, 0, sizeof(storage));
+        io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(storage);
+
+        if (syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, MAX_PROBE_OPS) < 0) {
+            return false;
+        }
+        return IORING_OP_WRITE <= probe->last_op && IORING_OP_WRITE < MAX_PROBE_OPS &&
+               (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED) != 0;
+    }
+#endif
+}
+
+AsyncRecordingWriter::AsyncRecordingWriter()
+    : backend_(Backend::None)
+    , writeBlockBytes_(DEFAULT_WRITE_BLOCK_BYTES)
+    , bufferMemory_(nullptr)
+    , inFlight_(0)
+    , error_(false)
+    , ringFd_(-1)
+    , sqRing_(nullptr)
+    , cqRing_(nullptr)
+    , sqes_(nullptr)
+    , sqRingBytes_(0)
+    , cqRingBytes_(0)
+    , sqesBytes_(0)
+    , sqEntries_(0)
+    , sqHead_(nullptr)
+    , sqTail_(nullptr)
+    , sqMask_(nullptr)
+    , sqArray_(nullptr)
+    , cqHead_(nullptr)
+    , cqTail_(nullptr)
+    , cqMask_(nullptr)
+    , cqes_(nullptr)
+    , pendingSubmit_(0)
+    , workerRunning_(false)
+    , workerSyscalls_(0)
+    , bytesWritten_(0)
+    , writeCount_(0)
+    , syscallCount_(0) {
+}
+
+AsyncRecordingWriter::~AsyncRecordingWriter() {
+    shutdown();
+}
+
+const char* AsyncRecordingWriter::getBackendName(Backend backend) {
+    switch (backend) {
+        case Backend::None: return "none";
+        case Backend::IoUring: return "io_uring";
+        case Backend::PwriteThread: return "pwrite thread";
+    }
+    return "unknown";
+}
+
+bool AsyncRecordingWriter::initialize(int maxFiles, int queueDepth, size_t writeBlockBytes, bool allowIoUring) {
+    shutdown();
+
+    if (maxFiles <= 0 || queueDepth <= 0 || writeBlockBytes == 0 || writeBlockBytes % DATA_ALIGNMENT != 0) {
+        return false;
+    }
+
+    writeBlockBytes_ = writeBlockBytes;
+
+    // Every open file can hold one staging buffer while queueDepth others are in flight
+    const int numBuffers = maxFiles + queueDepth;
+    const size_t totalBytes = static_cast<size_t>(numBuffers) * writeBlockBytes_ +
+                              static_cast<size_t>(maxFiles) * DATA_ALIGNMENT;
+    bufferMemory_ = static_cast<uint8_t*>(SIMDOptimizer::alignedAlloc(totalBytes, DATA_ALIGNMENT));
+    if (!bufferMemory_) {
+        return false;
+    }
+
+    buffers_.resize(numBuffers);
+    freeBuffers_.clear();
+    for (int i = numBuffers - 1; i >= 0; --i) {
+        buffers_[i] = bufferMemory_ + static_cast<size_t>(i) * writeBlockBytes_;
+        freeBuffers_.push_back(i);
+    }
+
+    files_.assign(maxFiles, FileState());
+    uint8_t* headers = bufferMemory_ + static_cast<size_t>(numBuffers) * writeBlockBytes_;
+    for (int i = 0; i < maxFiles; ++i) {
+        files_[i].header = headers + static_cast<size_t>(i) * DATA_ALIGNMENT;
+    }
+
+    requests_.assign(queueDepth, Request());
+    freeRequests_.clear();
+    for (int i = queueDepth - 1; i >= 0; --i) {
+        freeRequests_.push_back(i);
+    }
+
+    inFlight_ = 0;
+    error_ = false;
+    bytesWritten_ = 0;
+    writeCount_ = 0;
+    syscallCount_ = 0;
+    workerSyscalls_.store(0);
+
+    if (allowIoUring && setupIoUring(queueDepth)) {
+        backend_ = Backend::IoUring;
+    } else {
+        pendingRequests_.resize(queueDepth);
+        completedRequests_.resize(queueDepth);
+        workerRunning_.store(true);
+        worker_ = std::thread(&AsyncRecordingWriter::pwriteLoop, this);
+        backend_ = Backend::PwriteThread;
+    }
+
+    return true;
+}
+
+void AsyncRecordingWriter::shutdown() {
+    for (int i = 0; i < static_cast<int>(files_.size()); ++i) {
+        if (files_[i].fd >= 0) {
+            closeFile(i);
+        }
+    }
+
+    workerRunning_.store(false);
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    teardownIoUring();
+
+    if (bufferMemory_) {
+        SIMDOptimizer::alignedFree(bufferMemory_);
+        bufferMemory_ = nullptr;
+    }
+    buffers_.clear();
+    freeBuffers_.clear();
+    files_.clear();
+    requests_.clear();
+    freeRequests_.clear();
+    backend_ = Backend::None;
+}
+
+// ============================================================================
+// File API
+// ============================================================================
+
+int AsyncRecordingWriter::openFile(const std::string& path, int numChannels, double sampleRate) {
+    if (backend_ == Backend::None || numChannels <= 0 || sampleRate <= 0.0) {
+        return -1;
+    }
+
+    int fileId = -1;
+    for (int i = 0; i < static_cast<int>(files_.size()); ++i) {
+        if (files_[i].fd < 0) {
+            fileId = i;
+            break;
+        }
+    }
+    if (fileId < 0) {
+        return -1;
+    }
+
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+
+    FileState& file = files_[fileId];
+    uint8_t* header = file.header;
+    file = FileState();
+    file.fd = fd;
+    file.numChannels = numChannels;
+    file.sampleRate = sampleRate;
+    file.header = header;
+
+    // Valid (empty) file from the start
+    WavFormat::writeFloatHeader(file.header, numChannels, sampleRate, 0, DATA_ALIGNMENT);
+    ++syscallCount_;
+    if (pwrite(fd, file.header, DATA_ALIGNMENT, 0) != static_cast<ssize_t>(DATA_ALIGNMENT)) {
+        ::close(fd);
+        file.fd = -1;
+        return -1;
+    }
+
+    preallocate(file, DATA_ALIGNMENT + PREALLOCATE_BYTES);
+    return fileId;
+}
+
+bool AsyncRecordingWriter::write(int fileId, const float* interleaved, int numFrames) {
+    if (fileId < 0 || fileId >= static_cast<int>(files_.size()) || files_[fileId].fd < 0) {
+        return false;
+    }
+
+    FileState& file = files_[fileId];
+    const uint8_t* source = reinterpret_cast<const uint8_t*>(interleaved);
+    size_t remaining = static_cast<size_t>(numFrames) * file.numChannels * sizeof(float);
+
+    while (remaining > 0) {
+        if (file.stagingBuffer < 0) {
+            file.stagingBuffer = acquireBuffer();
+            if (file.stagingBuffer < 0) {
+                return false;
+            }
+            file.stagingBytes = 0;
+        }
+
+        const size_t count = std::min(remaining, writeBlockBytes_ - file.stagingBytes);
+        std::memcpy(buffers_[file.stagingBuffer] + file.stagingBytes, source, count);
+        file.stagingBytes += count;
+        source += count;
+        remaining -= count;
+
+        if (file.stagingBytes == writeBlockBytes_ && !queueData(fileId)) {
+            return false;
+        }
+    }
+
+    return !error_;
+}
+
+bool AsyncRecordingWriter::submit() {
+    if (backend_ == Backend::IoUring) {
+        if (pendingSubmit_ > 0) {
+            enterIoUring(pendingSubmit_, 0);
+        }
+        reapIoUring();
+    } else {
+        reapCompletions(false);
+    }
+    return !error_;
+}
+
+bool AsyncRecordingWriter::closeFile(int fileId) {
+    if (fileId < 0 || fileId >= static_cast<int>(files_.size()) || files_[fileId].fd < 0) {
+        return false;
+    }
+
+    FileState& file = files_[fileId];
+
+    // Tail: a final partial block (still at a page-aligned offset)
+    if (file.stagingBuffer >= 0) {
+        if (file.stagingBytes > 0) {
+            queueData(fileId);
+        } else {
+            freeBuffers_.push_back(file.stagingBuffer);
+            file.stagingBuffer = -1;
+        }
+    }
+
+    submit();
+    while (file.inFlight > 0) {
+        if (!reapCompletions(true)) {
+            break;
+        }
+    }
+
+    // Final header, then release the preallocated space past the end
+    bool success = !error_;
+    WavFormat::writeFloatHeader(file.header, file.numChannels, file.sampleRate, file.dataBytes, DATA_ALIGNMENT);
+    ++syscallCount_;
+    success = pwrite(file.fd, file.header, DATA_ALIGNMENT, 0) == static_cast<ssize_t>(DATA_ALIGNMENT) && success;
+
+    // Truncating to the exact length also frees preallocated blocks past EOF
+    const uint64_t end = DATA_ALIGNMENT + file.dataBytes;
+    if (file.preallocatedEnd > end) {
+        ++syscallCount_;
+        success = ftruncate(file.fd, static_cast<off_t>(end)) == 0 && success;
+    }
+
+    success = ::close(file.fd) == 0 && success;
+    file.fd = -1;
+    return success;
+}
+
+// ============================================================================
+// Request plumbing
+// ============================================================================
+
+bool AsyncRecordingWriter::queueData(int fileId) {
+    FileState& file = files_[fileId];
+    const uint64_t offset = DATA_ALIGNMENT + file.dataBytes;
+    const uint32_t length = static_cast<uint32_t>(file.stagingBytes);
+
+    if (offset + length > file.preallocatedEnd) {
+        preallocate(file, offset + length + PREALLOCATE_BYTES);
+    }
+
+    const int buffer = file.stagingBuffer;
+    if (!queueRequest(fileId, buffer, buffers_[buffer], offset, length)) {
+        return false;
+    }
+
+    file.stagingBuffer = -1;
+    file.stagingBytes = 0;
+    file.dataBytes += length;
+
+    // Periodic header refresh keeps an interrupted recording readable
+    if (file.dataBytes - file.headerBytes >= HEADER_UPDATE_BYTES && !file.headerInFlight) {
+        return queueHeader(fileId);
+    }
+    return true;
+}
+
+bool AsyncRecordingWriter::queueHeader(int fileId) {
+    FileState& file = files_[fileId];
+    WavFormat::writeFloatHeader(file.header, file.numChannels, file.sampleRate, file.dataBytes, DATA_ALIGNMENT);
+    file.headerBytes = file.dataBytes;
+    file.headerInFlight = true;
+    return queueRequest(fileId, -1, file.header, 0, DATA_ALIGNMENT);
+}
+
+bool AsyncRecordingWriter::queueRequest(int fileId, int buffer, const uint8_t* data,
+                                        uint64_t offset, uint32_t length) {
+    const int slot = acquireRequestSlot();
+    if (slot < 0) {
+        return false;
+    }
+
+    Request& request = requests_[slot];
+    request.fileId = fileId;
+    request.buffer = buffer;
+    request.data = data;
+    request.offset = offset;
+    request.length = length;
+    request.result = 0;
+
+    ++inFlight_;
+    ++files_[fileId].inFlight;
+    ++writeCount_;
+
+    if (backend_ == Backend::IoUring) {
+        // SQ full: push what is queued to the kernel and retry
+        while (!pushSqe(slot, files_[fileId].fd, data, offset, length)) {
+            if (!enterIoUring(pendingSubmit_, 0)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    return pendingRequests_.write(slot);
+}
+
+int AsyncRecordingWriter::acquireBuffer() {
+    while (freeBuffers_.empty()) {
+        if (!reapCompletions(true)) {
+            return -1;
+        }
+    }
+    const int buffer = freeBuffers_.back();
+    freeBuffers_.pop_back();
+    return buffer;
+}
+
+int AsyncRecordingWriter::acquireRequestSlot() {
+    while (freeRequests_.empty()) {
+        if (!reapCompletions(true)) {
+            return -1;
+        }
+    }
+    const int slot = freeRequests_.back();
+    freeRequests_.pop_back();
+    return slot;
+}
+
+bool AsyncRecordingWriter::reapCompletions(bool wait) {
+    if (wait && inFlight_ == 0) {
+        return false;   // Nothing outstanding to wait for
+    }
+
+    if (backend_ == Backend::IoUring) {
+        if (!enterIoUring(pendingSubmit_, wait ? 1 : 0)) {
+            return false;
+        }
+        reapIoUring();
+        return true;
+    }
+
+    while (true) {
+        int slot;
+        int reaped = 0;
+        while (completedRequests_.read(slot)) {
+            completeRequest(slot, requests_[slot].result);
+            ++reaped;
+        }
+        if (reaped > 0 || !wait) {
+            return true;
+        }
+        std::this_thread::sleep_for(PWRITE_POLL_INTERVAL);
+    }
+}
+
+void AsyncRecordingWriter::completeRequest(int slot, int result) {
+    Request& request = requests_[slot];
+    FileState& file = files_[request.fileId];
+
+    if (result != static_cast<int>(request.length)) {
+        if (!error_) {
+            printf("AsyncRecordingWriter: write failed (%s)\n",
+                   result < 0 ? std::strerror(-result) : "short write");
+        }
+        error_ = true;
+    } else {
+        bytesWritten_ += request.length;
+    }
+
+    if (request.buffer >= 0) {
+        freeBuffers_.push_back(request.buffer);
+        if (backend_ == Backend::IoUring) {
+            releasePageCache(file.fd, request.offset, request.length);
+        }
+    } else {
+        file.headerInFlight = false;
+    }
+
+    --file.inFlight;
+    --inFlight_;
+    freeRequests_.push_back(slot);
+}
+
+void AsyncRecordingWriter::preallocate(FileState& file, uint64_t end) {
+#ifdef __linux__
+    // KEEP_SIZE: the visible file size still tracks the data actually written
+    if (end > file.preallocatedEnd) {
+        fallocate(file.fd, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(file.preallocatedEnd),
+                  static_cast<off_t>(end - file.preallocatedEnd));
+    }
+#endif
+    file.preallocatedEnd = std::max(file.preallocatedEnd, end);
+}
+
+void AsyncRecordingWriter::releasePageCache(int fd, uint64_t offset, uint64_t length) {
+#ifdef __linux__
+    // Start writeback of the block just written, and drop the block two behind
+    // it (clean by now) so hundreds of streams do not evict everything else
+    sync_file_range(fd, static_cast<off64_t>(offset), static_cast<off64_t>(length), SYNC_FILE_RANGE_WRITE);
+
+    const uint64_t lag = 2 * writeBlockBytes_;
+    if (offset >= DATA_ALIGNMENT + lag) {
+        posix_fadvise(fd, static_cast<off_t>(offset - lag), static_cast<off_t>(length), POSIX_FADV_DONTNEED);
+    }
+#else
+    (void)fd;
+    (void)offset;
+    (void)length;
+#endif
+}
+
+// ============================================================================
+// io_uring backend
+// ============================================================================
+
+#ifdef __linux__
+
+bool AsyncRecordingWriter::setupIoUring(int entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+
+    const int fd = static_cast<int>(syscall(__NR_io_uring_setup, static_cast<unsigned>(entries), &params));
+    if (fd < 0) {
+        // ENOSYS on old kernels, EPERM under seccomp/container policies
+        return false;
+    }
+    ringFd_ = fd;
+
+    if (!supportsWriteOp(fd)) {
+        teardownIoUring();
+        return false;
+    }
+
+    sqRingBytes_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingBytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMap) {
+        sqRingBytes_ = cqRingBytes_ = std::max(sqRingBytes_, cqRingBytes_);
+    }
+
+    sqRing_ = mmap(nullptr, sqRingBytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (sqRing_ == MAP_FAILED) {
+        sqRing_ = nullptr;
+        teardownIoUring();
+        return false;
+    }
+
+    if (singleMap) {
+        cqRing_ = sqRing_;
+    } else {
+        cqRing_ = mmap(nullptr, cqRingBytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (cqRing_ == MAP_FAILED) {
+            cqRing_ = nullptr;
+            teardownIoUring();
+            return false;
+        }
+    }
+
+    sqesBytes_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = mmap(nullptr, sqesBytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes_ == MAP_FAILED) {
+        sqes_ = nullptr;
+        teardownIoUring();
+        return false;
+    }
+
+    uint8_t* sq = static_cast<uint8_t*>(sqRing_);
+    uint8_t* cq = static_cast<uint8_t*>(cqRing_);
+    sqEntries_ = params.sq_entries;
+    sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sqMask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cqMask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = cq + params.cq_off.cqes;
+    pendingSubmit_ = 0;
+    return true;
+}
+
+void AsyncRecordingWriter::teardownIoUring() {
+    if (sqes_) munmap(sqes_, sqesBytes_);
+    if (cqRing_ && cqRing_ != sqRing_) munmap(cqRing_, cqRingBytes_);
+    if (sqRing_) munmap(sqRing_, sqRingBytes_);
+    if (ringFd_ >= 0) ::close(ringFd_);
+
+    sqes_ = nullptr;
+    cqRing_ = nullptr;
+    sqRing_ = nullptr;
+    ringFd_ = -1;
+    pendingSubmit_ = 0;
+}
+
+bool AsyncRecordingWriter::pushSqe(int slot, int fd, const uint8_t* data, uint64_t offset, uint32_t length) {
+    const unsigned tail = *sqTail_;
+    const unsigned head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+    if (tail - head >= sqEntries_) {
+        return false;
+    }
+
+    const unsigned index = tail & *sqMask_;
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes_) + index;
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(data);
+    sqe->len = length;
+    sqe->off = offset;
+    sqe->user_data = static_cast<uint64_t>(slot);
+
+    sqArray_[index] = index;
+    __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+    ++pendingSubmit_;
+    return true;
+}
+
+bool AsyncRecordingWriter::enterIoUring(unsigned toSubmit, unsigned minComplete) {
+    if (toSubmit == 0 && minComplete == 0) {
+        return true;
+    }
+
+    const unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (true) {
+        ++syscallCount_;
+        const long result = syscall(__NR_io_uring_enter, ringFd_, toSubmit, minComplete, flags, nullptr, 0);
+        if (result >= 0) {
+            pendingSubmit_ -= std::min<unsigned>(pendingSubmit_, static_cast<unsigned>(result));
+            return true;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            error_ = true;
+            return false;
+        }
+    }
+}
+
+int AsyncRecordingWriter::reapIoUring() {
+    unsigned head = *cqHead_;
+    const unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+    int reaped = 0;
+
+    while (head != tail) {
+        const io_uring_cqe* cqe = static_cast<const io_uring_cqe*>(cqes_) + (head & *cqMask_);
+        const int slot = static_cast<int>(cqe->user_data);
+        const int result = cqe->res;
+        ++head;
+        __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+
+        completeRequest(slot, result);
+        ++reaped;
+    }
+    return reaped;
+}
+
+#else
+
+bool AsyncRecordingWriter::setupIoUring(int) { return false; }
+void AsyncRecordingWriter::teardownIoUring() {}
+bool AsyncRecordingWriter::pushSqe(int, int, const uint8_t*, uint64_t, uint32_t) { return false; }
+bool AsyncRecordingWriter::enterIoUring(unsigned, unsigned) { return false; }
+int AsyncRecordingWriter::reapIoUring() { return 0; }
+
+#endif
+
+// ============================================================================
+// pwrite backend
+// ============================================================================
+
+void AsyncRecordingWriter::pwriteLoop() {
+    while (true) {
+        int slot;
+        if (!pendingRequests_.read(slot)) {
+            if (!workerRunning_.load(std::memory_order_relaxed)) {
+                break;
+            }
+            std::this_thread::sleep_for(PWRITE_POLL_INTERVAL);
+            continue;
+        }
+
+        Request& request = requests_[slot];
+        const int fd = files_[request.fileId].fd;
+        uint32_t written = 0;
+        int result = 0;
+
+        while (written < request.length) {
+            workerSyscalls_.fetch_add(1, std::memory_order_relaxed);
+            const ssize_t count = pwrite(fd, request.data + written, request.length - written,
+                                         static_cast<off_t>(request.offset + written));
+            if (count < 0) {
+                if (errno == EINTR) continue;
+                result = -errno;
+                break;
+            }
+            if (count == 0) {
+                break;
+            }
+            written += static_cast<uint32_t>(count);
+        }
+
+        if (result == 0) {
+            result = static_cast<int>(written);
+            if (request.buffer >= 0) {
+                releasePageCache(fd, request.offset, request.length);
+            }
+        }
+
+        request.result = result;
+        completedRequests_.write(slot);
+    }
+}
+
+} // namespace VoiceMonitor
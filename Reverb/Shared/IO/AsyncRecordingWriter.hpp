@@ -0,0 +1,160 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AudioBuffer.hpp"
+
+namespace VoiceMonitor {
+
+/// Asynchronous float WAV/RF64 writer for many concurrent long recordings
+///
+/// Samples are staged per file into page-aligned 1 MB buffers; full buffers are
+/// written at page-aligned offsets (the header is padded to DATA_ALIGNMENT).
+/// On Linux writes go through io_uring, batched into one io_uring_enter per
+/// submit(); elsewhere, or when io_uring or its IORING_OP_WRITE (Linux 5.6) is
+/// unavailable, a pwrite worker thread takes over. Files are preallocated with
+/// fallocate in large steps, written ranges are pushed out of the page cache
+/// behind the write head, and the header is rewritten periodically so an
+/// interrupted session stays playable.
+///
+/// Not thread-safe: call everything from one writer thread (never the audio thread).
+class AsyncRecordingWriter {
+public:
+    static constexpr size_t DEFAULT_WRITE_BLOCK_BYTES = 1 << 20;   // 1 MB per write
+    static constexpr size_t DATA_ALIGNMENT = 4096;                 // Header padded to one page
+    static constexpr uint64_t PREALLOCATE_BYTES = 64ull << 20;     // fallocate step
+    static constexpr uint64_t HEADER_UPDATE_BYTES = 16ull << 20;   // Header rewrite interval
+    static constexpr int DEFAULT_QUEUE_DEPTH = 64;
+
+    enum class Backend {
+        None,
+        IoUring,
+        PwriteThread
+    };
+
+    AsyncRecordingWriter();
+    ~AsyncRecordingWriter();
+
+    AsyncRecordingWriter(const AsyncRecordingWriter&) = delete;
+    AsyncRecordingWriter& operator=(const AsyncRecordingWriter&) = delete;
+
+    /// Allocate maxFiles + queueDepth write buffers and set up the backend
+    /// writeBlockBytes must be a multiple of DATA_ALIGNMENT
+    bool initialize(int maxFiles, int queueDepth = DEFAULT_QUEUE_DEPTH,
+                    size_t writeBlockBytes = DEFAULT_WRITE_BLOCK_BYTES, bool allowIoUring = true);
+    void shutdown();
+
+    /// Create a recording; returns a file id, or -1 on failure
+    int openFile(const std::string& path, int numChannels, double sampleRate);
+
+    /// Append interleaved frames (copied into the file's staging buffer)
+    bool write(int fileId, const float* interleaved, int numFrames);
+
+    /// Hand all queued writes to the kernel in one batch and reap finished ones
+    bool submit();
+
+    /// Flush, wait for outstanding writes, finalize the header and close
+    bool closeFile(int fileId);
+
+    Backend getBackend() const { return backend_; }
+    static const char* getBackendName(Backend backend);
+
+    // Statistics
+    uint64_t getBytesWritten() const { return bytesWritten_; }
+    uint64_t getWriteCount() const { return writeCount_; }
+    uint64_t getSyscallCount() const { return syscallCount_ + workerSyscalls_.load(std::memory_order_relaxed); }
+    bool hasError() const { return error_; }
+
+private:
+    struct FileState {
+        int fd = -1;
+        int numChannels = 0;
+        double sampleRate = 0.0;
+        int stagingBuffer = -1;
+        size_t stagingBytes = 0;
+        uint64_t dataBytes = 0;         // Data queued so far
+        uint64_t headerBytes = 0;       // Data size in the last header written
+        uint64_t preallocatedEnd = 0;
+        uint8_t* header = nullptr;      // DATA_ALIGNMENT bytes, aligned
+        bool headerInFlight = false;
+        int inFlight = 0;
+    };
+
+    struct Request {
+        int fileId = -1;
+        int buffer = -1;                // -1 for header writes
+        const uint8_t* data = nullptr;
+        uint64_t offset = 0;
+        uint32_t length = 0;
+        int result = 0;                 // Bytes written or -errno (pwrite backend)
+    };
+
+    // Request plumbing shared by both backends
+    bool queueData(int fileId);
+    bool queueHeader(int fileId);
+    bool queueRequest(int fileId, int buffer, const uint8_t* data, uint64_t offset, uint32_t length);
+    int acquireBuffer();
+    int acquireRequestSlot();
+    bool reapCompletions(bool wait);
+    void completeRequest(int slot, int result);
+    void preallocate(FileState& file, uint64_t end);
+    void releasePageCache(int fd, uint64_t offset, uint64_t length);
+
+    // io_uring backend (Linux)
+    bool setupIoUring(int entries);
+    void teardownIoUring();
+    bool pushSqe(int slot, int fd, const uint8_t* data, uint64_t offset, uint32_t length);
+    bool enterIoUring(unsigned toSubmit, unsigned minComplete);
+    int reapIoUring();
+
+    // pwrite backend
+    void pwriteLoop();
+
+    Backend backend_;
+    size_t writeBlockBytes_;
+    uint8_t* bufferMemory_;
+    std::vector<uint8_t*> buffers_;
+    std::vector<int> freeBuffers_;
+    std::vector<FileState> files_;
+    std::vector<Request> requests_;
+    std::vector<int> freeRequests_;
+    int inFlight_;
+    bool error_;
+
+    // io_uring state
+    int ringFd_;
+    void* sqRing_;
+    void* cqRing_;
+    void* sqes_;
+    size_t sqRingBytes_;
+    size_t cqRingBytes_;
+    size_t sqesBytes_;
+    unsigned sqEntries_;
+    unsigned* sqHead_;
+    unsigned* sqTail_;
+    unsigned* sqMask_;
+    unsigned* sqArray_;
+    unsigned* cqHead_;
+    unsigned* cqTail_;
+    unsigned* cqMask_;
+    void* cqes_;
+    unsigned pendingSubmit_;
+
+    // pwrite worker state: request slot indices in both directions
+    AudioBuffer<int> pendingRequests_;
+    AudioBuffer<int> completedRequests_;
+    std::thread worker_;
+    std::atomic<bool> workerRunning_;
+    std::atomic<uint64_t> workerSyscalls_;
+
+    // Statistics (writer thread)
+    uint64_t bytesWritten_;
+    uint64_t writeCount_;
+    uint64_t syscallCount_;
+};
+
+} // namespace VoiceMonitor
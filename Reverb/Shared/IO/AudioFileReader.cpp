@@ -0,0 +1,530 @@
+#include "AudioFileReader.hpp"
+#include "FlacDecoder.hpp"
+#include "FDNReverb.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace VoiceMonitor {
+
+namespace {
+    // Prefetch window for memory-mapped files (page faults stay on the worker)
+    constexpr uint64_t ADVISE_WINDOW_BYTES = 4 * 1024 * 1024;
+
+    // Keep each channel of each block on its own cache lines
+    constexpr size_t BLOCK_ALIGNMENT = 64;
+
+    inline int32_t readInt24(const uint8_t* p) {
+        const int32_t value = static_cast<int32_t>(p[0]) | (static_cast<int32_t>(p[1]) << 8) |
+                              (static_cast<int32_t>(p[2]) << 16);
+        return (value << 8) >> 8; // Sign-extend
+    }
+}
+
+AudioFileReader::AudioFileReader()
+    : format_(Format::Unknown)
+    , sampleRate_(0.0)
+    , numChannels_(0)
+    , totalFrames_(0)
+    , fileDescriptor_(-1)
+    , mapping_(nullptr)
+    , mappingSize_(0)
+    , adviseFrame_(0)
+    , flacFrameSize_(0)
+    , flacFrameCursor_(0)
+    , flacScale_(1.0f)
+    , blockMemory_(nullptr)
+    , blockFrames_(DEFAULT_BLOCK_FRAMES)
+    , numBlocks_(0)
+    , currentBlock_(-1)
+    , running_(false)
+    , endOfStream_(false)
+    , decodeError_(false)
+    , starvationCount_(0)
+    , framesRead_(0)
+    , framesDelivered_(0)
+    , resampling_(false)
+    , outputSampleRate_(0.0)
+    , outputTotalFrames_(0)
+    , pendingFrames_(0)
+    , flushRemaining_(0)
+    , sourceEnded_(false) {
+}
+
+AudioFileReader::~AudioFileReader() {
+    close();
+}
+
+bool AudioFileReader::open(const std::string& path, int blockFrames, int numBlocks) {
+    close();
+
+    blockFrames_ = std::max(16, blockFrames);
+    numBlocks_ = std::max(2, numBlocks);
+
+    // Sniff the container from the first bytes
+    char magic[4] = {0, 0, 0, 0};
+    FILE* probe = std::fopen(path.c_str(), "rb");
+    if (!probe) {
+        return false;
+    }
+    const size_t magicBytes = std::fread(magic, 1, sizeof(magic), probe);
+    std::fclose(probe);
+    if (magicBytes < sizeof(magic)) {
+        return false;
+    }
+
+    bool opened = false;
+    if (std::memcmp(magic, "RIFF", 4) == 0 || std::memcmp(magic, "RF64", 4) == 0) {
+        opened = openMapped(path);
+    } else if (std::memcmp(magic, "fLaC", 4) == 0 || std::memcmp(magic, "ID3", 3) == 0) {
+        opened = openFlac(path);
+    }
+
+    if (!opened || numChannels_ <= 0 || numChannels_ > MAX_CHANNELS || !allocateBlocks()) {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void AudioFileReader::close() {
+    stop();
+
+    if (mapping_) {
+        munmap(const_cast<uint8_t*>(mapping_), mappingSize_);
+        mapping_ = nullptr;
+        mappingSize_ = 0;
+    }
+    if (fileDescriptor_ >= 0) {
+        ::close(fileDescriptor_);
+        fileDescriptor_ = -1;
+    }
+
+    flacDecoder_.reset();
+
+    if (blockMemory_) {
+        SIMDOptimizer::alignedFree(blockMemory_);
+        blockMemory_ = nullptr;
+    }
+    channelPointers_.clear();
+    blockFrameCounts_.clear();
+    blockStartFrames_.clear();
+
+    format_ = Format::Unknown;
+    sampleRate_ = 0.0;
+    numChannels_ = 0;
+    totalFrames_ = 0;
+    currentBlock_ = -1;
+
+    resampling_ = false;
+    outputSampleRate_ = 0.0;
+    outputTotalFrames_ = 0;
+    sourceBuffers_.clear();
+    pendingBuffers_.clear();
+}
+
+bool AudioFileReader::setOutputSampleRate(double outputRate, PolyphaseResampler::Quality quality) {
+    if (!isOpen() || running_.load()) {
+        return false;
+    }
+
+    if (outputRate <= 0.0 || outputRate == sampleRate_) {
+        resampling_ = false;
+        return true;
+    }
+
+    if (!resampler_.prepare(sampleRate_, outputRate, numChannels_, quality)) {
+        return false;
+    }
+
+    // A pass converts one file block and leaves less than a block pending
+    const int maxOutput = resampler_.getMaxOutputFrames(blockFrames_);
+    sourceBuffers_.assign(numChannels_, std::vector<float>(blockFrames_));
+    pendingBuffers_.assign(numChannels_, std::vector<float>(blockFrames_ + maxOutput));
+
+    resampling_ = true;
+    outputSampleRate_ = outputRate;
+    outputTotalFrames_ = static_cast<uint64_t>(std::ceil(static_cast<double>(totalFrames_) * resampler_.getRatio()));
+    return true;
+}
+
+bool AudioFileReader::openMapped(const std::string& path) {
+    fileDescriptor_ = ::open(path.c_str(), O_RDONLY);
+    if (fileDescriptor_ < 0) {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fileDescriptor_, &fileStat) != 0 || fileStat.st_size <= 0) {
+        return false;
+    }
+
+    mappingSize_ = static_cast<size_t>(fileStat.st_size);
+    void* mapped = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fileDescriptor_, 0);
+    if (mapped == MAP_FAILED) {
+        mappingSize_ = 0;
+        return false;
+    }
+    mapping_ = static_cast<const uint8_t*>(mapped);
+
+    // Sequential access: aggressive kernel read-ahead, early page reclaim behind us
+    madvise(mapped, mappingSize_, MADV_SEQUENTIAL);
+
+    if (!WavFormat::parseHeader(mapping_, mappingSize_, wavInfo_)) {
+        return false;
+    }
+
+    format_ = wavInfo_.isRF64 ? Format::RF64 : Format::Wav;
+    sampleRate_ = wavInfo_.sampleRate;
+    numChannels_ = wavInfo_.numChannels;
+    totalFrames_ = wavInfo_.numFrames;
+    return true;
+}
+
+bool AudioFileReader::openFlac(const std::string& path) {
+    flacDecoder_ = std::make_unique<FlacDecoder>();
+    if (!flacDecoder_->open(path)) {
+        return false;
+    }
+
+    const FlacDecoder::StreamInfo& info = flacDecoder_->getStreamInfo();
+    format_ = Format::Flac;
+    sampleRate_ = info.sampleRate;
+    numChannels_ = info.numChannels;
+    totalFrames_ = info.totalSamples;
+    flacScale_ = 1.0f / static_cast<float>(uint64_t(1) << (info.bitsPerSample - 1));
+    flacFrameSize_ = 0;
+    flacFrameCursor_ = 0;
+    return true;
+}
+
+bool AudioFileReader::allocateBlocks() {
+    // Pad each channel to a whole number of cache lines
+    const size_t floatsPerLine = BLOCK_ALIGNMENT / sizeof(float);
+    const size_t channelStride = ((blockFrames_ + floatsPerLine - 1) / floatsPerLine) * floatsPerLine;
+    const size_t totalFloats = channelStride * numChannels_ * numBlocks_;
+
+    blockMemory_ = static_cast<float*>(SIMDOptimizer::alignedAlloc(totalFloats * sizeof(float), BLOCK_ALIGNMENT));
+    if (!blockMemory_) {
+        return false;
+    }
+    std::memset(blockMemory_, 0, totalFloats * sizeof(float));
+
+    channelPointers_.resize(static_cast<size_t>(numBlocks_) * numChannels_);
+    for (int block = 0; block < numBlocks_; ++block) {
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            const size_t slot = static_cast<size_t>(block) * numChannels_ + ch;
+            channelPointers_[slot] = blockMemory_ + slot * channelStride;
+        }
+    }
+
+    blockFrameCounts_.assign(numBlocks_, 0);
+    blockStartFrames_.assign(numBlocks_, 0);
+
+    readyBlocks_.resize(numBlocks_);
+    freeBlocks_.resize(numBlocks_);
+    return true;
+}
+
+bool AudioFileReader::start() {
+    if (!isOpen() || running_.load()) {
+        return false;
+    }
+
+    readyBlocks_.clear();
+    freeBlocks_.clear();
+    for (int i = 0; i < numBlocks_; ++i) {
+        freeBlocks_.write(i);
+    }
+
+    currentBlock_ = -1;
+    framesRead_ = 0;
+    framesDelivered_ = 0;
+    adviseFrame_ = 0;
+    endOfStream_.store(false);
+    decodeError_.store(false);
+    starvationCount_.store(0);
+
+    // A FLAC stream only decodes forwards: restart it from its first frame
+    if (format_ == Format::Flac) {
+        if (!flacDecoder_->rewind()) {
+            return false;
+        }
+        flacFrameSize_ = 0;
+        flacFrameCursor_ = 0;
+    }
+
+    if (resampling_) {
+        resampler_.reset();
+        pendingFrames_ = 0;
+        flushRemaining_ = 0;
+        sourceEnded_ = false;
+    }
+
+    running_.store(true);
+    worker_ = std::thread(&AudioFileReader::readAheadLoop, this);
+    return true;
+}
+
+void AudioFileReader::stop() {
+    running_.store(false);
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool AudioFileReader::acquireBlock(Block& block) {
+    if (currentBlock_ < 0) {
+        int index;
+        if (!readyBlocks_.read(index)) {
+            if (!endOfStream_.load(std::memory_order_acquire)) {
+                starvationCount_.fetch_add(1, std::memory_order_relaxed);
+            }
+            return false;
+        }
+        currentBlock_ = index;
+    }
+
+    block.channels = channelPointers_.data() + static_cast<size_t>(currentBlock_) * numChannels_;
+    block.numFrames = blockFrameCounts_[currentBlock_];
+    block.startFrame = blockStartFrames_[currentBlock_];
+    return true;
+}
+
+void AudioFileReader::releaseBlock() {
+    if (currentBlock_ >= 0) {
+        freeBlocks_.write(currentBlock_);
+        currentBlock_ = -1;
+    }
+}
+
+bool AudioFileReader::isFinished() const {
+    return endOfStream_.load(std::memory_order_acquire) && readyBlocks_.empty() && currentBlock_ < 0;
+}
+
+// ============================================================================
+// Read-ahead worker
+// ============================================================================
+
+void AudioFileReader::readAheadLoop() {
+    // Back off for a fraction of a block when the consumer has not returned blocks yet
+    const auto idleWait = std::chrono::microseconds(
+        std::max<int64_t>(100, static_cast<int64_t>(250000.0 * blockFrames_ / std::max(sampleRate_, 1.0))));
+
+    while (running_.load(std::memory_order_relaxed)) {
+        int index;
+        if (!freeBlocks_.read(index)) {
+            std::this_thread::sleep_for(idleWait);
+            continue;
+        }
+
+        const int frames = fillBlock(index);
+        if (frames > 0) {
+            readyBlocks_.write(index);
+        }
+
+        if (frames < blockFrames_) {
+            endOfStream_.store(true, std::memory_order_release);
+            break;
+        }
+    }
+}
+
+int AudioFileReader::fillBlock(int blockIndex) {
+    float* const* channels = channelPointers_.data() + static_cast<size_t>(blockIndex) * numChannels_;
+
+    int frames;
+    if (resampling_) {
+        frames = fillResampled(channels, blockFrames_);
+    } else {
+        frames = (format_ == Format::Flac) ? fillFromFlac(channels, blockFrames_)
+                                           : fillFromMapping(channels, blockFrames_);
+        framesRead_ += static_cast<uint64_t>(frames);
+    }
+
+    // Zero the tail of a short final block so SIMD consumers can read whole vectors
+    for (int ch = 0; ch < numChannels_; ++ch) {
+        std::fill(channels[ch] + frames, channels[ch] + blockFrames_, 0.0f);
+    }
+
+    blockFrameCounts_[blockIndex] = frames;
+    blockStartFrames_[blockIndex] = framesDelivered_;
+    framesDelivered_ += static_cast<uint64_t>(frames);
+    return frames;
+}
+
+int AudioFileReader::fillResampled(float* const* channels, int numFrames) {
+    float* source[MAX_CHANNELS];
+    float* pending[MAX_CHANNELS];
+    for (int ch = 0; ch < numChannels_; ++ch) {
+        source[ch] = sourceBuffers_[ch].data();
+        pending[ch] = pendingBuffers_[ch].data();
+    }
+
+    // Convert file blocks until a whole block is pending or the converter is
+    // flushed: after the last frame it needs its lookahead in silence
+    while (pendingFrames_ < numFrames && (!sourceEnded_ || flushRemaining_ > 0)) {
+        int frames;
+        if (!sourceEnded_) {
+            frames = (format_ == Format::Flac) ? fillFromFlac(source, blockFrames_)
+                                               : fillFromMapping(source, blockFrames_);
+            framesRead_ += static_cast<uint64_t>(frames);
+            if (frames < blockFrames_) {
+                sourceEnded_ = true;
+                flushRemaining_ = resampler_.getLookaheadFrames() + 1;
+            }
+        } else {
+            frames = std::min(blockFrames_, flushRemaining_);
+            for (int ch = 0; ch < numChannels_; ++ch) {
+                std::fill(source[ch], source[ch] + frames, 0.0f);
+            }
+            flushRemaining_ -= frames;
+        }
+
+        float* output[MAX_CHANNELS];
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            output[ch] = pending[ch] + pendingFrames_;
+        }
+        pendingFrames_ += resampler_.process(source, frames, output);
+    }
+
+    // The flush overshoots the converted length of the file
+    int frames = std::min(numFrames, pendingFrames_);
+    if (outputTotalFrames_ > 0) {
+        frames = static_cast<int>(std::min<uint64_t>(frames, outputTotalFrames_ - std::min(outputTotalFrames_, framesDelivered_)));
+    }
+
+    for (int ch = 0; ch < numChannels_; ++ch) {
+        std::copy(pending[ch], pending[ch] + frames, channels[ch]);
+        std::memmove(pending[ch], pending[ch] + frames, static_cast<size_t>(pendingFrames_ - frames) * sizeof(float));
+    }
+    pendingFrames_ -= frames;
+    return frames;
+}
+
+int AudioFileReader::fillFromMapping(float* const* channels, int numFrames) {
+    if (framesRead_ >= totalFrames_) {
+        return 0;
+    }
+
+    const int frames = static_cast<int>(std::min<uint64_t>(numFrames, totalFrames_ - framesRead_));
+    const size_t frameBytes = static_cast<size_t>(wavInfo_.bytesPerFrame);
+    const uint8_t* source = mapping_ + wavInfo_.dataOffset + framesRead_ * frameBytes;
+
+    // Ask the kernel to fault in the next window while we convert this one
+    if (framesRead_ >= adviseFrame_) {
+        const uint64_t windowFrames = std::max<uint64_t>(1, ADVISE_WINDOW_BYTES / frameBytes);
+        const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        const uint64_t start = (wavInfo_.dataOffset + adviseFrame_ * frameBytes) & ~(pageSize - 1);
+        const uint64_t end = std::min<uint64_t>(mappingSize_,
+                                                wavInfo_.dataOffset + (adviseFrame_ + windowFrames) * frameBytes);
+        if (end > start) {
+            madvise(const_cast<uint8_t*>(mapping_) + start, end - start, MADV_WILLNEED);
+        }
+        adviseFrame_ += windowFrames;
+    }
+
+    // Single pass: deinterleave + convert straight into the planar block
+    const int numChannels = numChannels_;
+    switch (wavInfo_.sampleFormat) {
+        case WavFormat::SampleFormat::Int16: {
+            const float scale = 1.0f / 32768.0f;
+            for (int i = 0; i < frames; ++i) {
+                const uint8_t* frame = source + i * frameBytes;
+                for (int ch = 0; ch < numChannels; ++ch) {
+                    channels[ch][i] = static_cast<int16_t>(WavFormat::readLE16(frame + ch * 2)) * scale;
+                }
+            }
+            break;
+        }
+
+        case WavFormat::SampleFormat::Int24: {
+            const float scale = 1.0f / 8388608.0f;
+            for (int i = 0; i < frames; ++i) {
+                const uint8_t* frame = source + i * frameBytes;
+                for (int ch = 0; ch < numChannels; ++ch) {
+                    channels[ch][i] = readInt24(frame + ch * 3) * scale;
+                }
+            }
+            break;
+        }
+
+        case WavFormat::SampleFormat::Int32: {
+            const float scale = 1.0f / 2147483648.0f;
+            for (int i = 0; i < frames; ++i) {
+                const uint8_t* frame = source + i * frameBytes;
+                for (int ch = 0; ch < numChannels; ++ch) {
+                    channels[ch][i] = static_cast<int32_t>(WavFormat::readLE32(frame + ch * 4)) * scale;
+                }
+            }
+            break;
+        }
+
+        case WavFormat::SampleFormat::Float32: {
+            for (int i = 0; i < frames; ++i) {
+                const uint8_t* frame = source + i * frameBytes;
+                for (int ch = 0; ch < numChannels; ++ch) {
+                    std::memcpy(&channels[ch][i], frame + ch * 4, sizeof(float));
+                }
+            }
+            break;
+        }
+
+        case WavFormat::SampleFormat::Float64: {
+            for (int i = 0; i < frames; ++i) {
+                const uint8_t* frame = source + i * frameBytes;
+                for (int ch = 0; ch < numChannels; ++ch) {
+                    double value;
+                    std::memcpy(&value, frame + ch * 8, sizeof(double));
+                    channels[ch][i] = static_cast<float>(value);
+                }
+            }
+            break;
+        }
+
+        case WavFormat::SampleFormat::Unsupported:
+            return 0;
+    }
+
+    return frames;
+}
+
+int AudioFileReader::fillFromFlac(float* const* channels, int numFrames) {
+    int filled = 0;
+
+    while (filled < numFrames) {
+        if (flacFrameCursor_ >= flacFrameSize_) {
+            const int decoded = flacDecoder_->decodeFrame();
+            if (decoded <= 0) {
+                if (decoded < 0) {
+                    decodeError_.store(true, std::memory_order_release);
+                }
+                break;
+            }
+            flacFrameSize_ = decoded;
+            flacFrameCursor_ = 0;
+        }
+
+        const int count = std::min(numFrames - filled, flacFrameSize_ - flacFrameCursor_);
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            const int32_t* source = flacDecoder_->getChannelData(ch) + flacFrameCursor_;
+            float* destination = channels[ch] + filled;
+            for (int i = 0; i < count; ++i) {
+                destination[i] = static_cast<float>(source[i]) * flacScale_;
+            }
+        }
+
+        flacFrameCursor_ += count;
+        filled += count;
+    }
+
+    return filled;
+}
+
+} // namespace VoiceMonitor
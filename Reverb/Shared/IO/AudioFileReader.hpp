@@ -0,0 +1,165 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AudioBuffer.hpp"
+#include "PolyphaseResampler.hpp"
+#include "WavFormat.hpp"
+
+namespace VoiceMonitor {
+
+class FlacDecoder;
+
+/// Read-ahead audio file reader for offline processing of long sessions
+///
+/// WAV/RF64 files are memory-mapped; FLAC files are decoded frame by frame.
+/// A worker thread converts the file into SIMD-aligned planar float blocks and
+/// hands them to the processing thread through lock-free SPSC queues, so the
+/// processing thread never touches the disk and each sample is copied once
+/// (file encoding -> planar float). Blocks plug straight into ReverbEngine:
+///
+///     AudioFileReader::Block block;
+///     while (!reader.isFinished()) {
+///         if (reader.acquireBlock(block)) {
+///             engine.processBlock(block.channels, outputs, numChannels, block.numFrames);
+///             reader.releaseBlock();
+///         }
+///     }
+///
+/// Files at a rate the engine does not run at (8 kHz dictation, 192 kHz
+/// masters) can be converted on the worker with setOutputSampleRate(); blocks,
+/// frame counts and positions are then at the output rate.
+class AudioFileReader {
+public:
+    static constexpr int MAX_CHANNELS = 8;
+    static constexpr int DEFAULT_BLOCK_FRAMES = 512;
+    static constexpr int DEFAULT_NUM_BLOCKS = 32;   // ~340ms of read-ahead at 48kHz
+
+    enum class Format {
+        Unknown,
+        Wav,
+        RF64,
+        Flac
+    };
+
+    /// Planar block owned by the reader, valid until releaseBlock()
+    struct Block {
+        const float* const* channels = nullptr;
+        int numFrames = 0;
+        uint64_t startFrame = 0;
+    };
+
+public:
+    AudioFileReader();
+    ~AudioFileReader();
+
+    AudioFileReader(const AudioFileReader&) = delete;
+    AudioFileReader& operator=(const AudioFileReader&) = delete;
+
+    /// Open a file and allocate the block queue (not real-time safe)
+    bool open(const std::string& path, int blockFrames = DEFAULT_BLOCK_FRAMES,
+              int numBlocks = DEFAULT_NUM_BLOCKS);
+    void close();
+
+    /// Deliver blocks at outputRate instead of the file's rate (0 or the file's
+    /// rate turns conversion off). Call after open() and before start(); the
+    /// quality trades worker time for stopband attenuation.
+    bool setOutputSampleRate(double outputRate,
+                             PolyphaseResampler::Quality quality = PolyphaseResampler::Quality::High);
+
+    /// Start/stop the read-ahead worker
+    bool start();
+    void stop();
+
+    /// Consumer side (wait-free, call from the processing thread)
+    /// Returns false if no block is ready yet - the worker is behind or the file ended
+    bool acquireBlock(Block& block);
+    void releaseBlock();
+
+    /// True once the whole file has been delivered and released
+    bool isFinished() const;
+
+    // Stream information (delivered rate and length; 0 frames if the file does not say)
+    Format getFormat() const { return format_; }
+    double getSampleRate() const { return resampling_ ? outputSampleRate_ : sampleRate_; }
+    double getFileSampleRate() const { return sampleRate_; }
+    int getNumChannels() const { return numChannels_; }
+    uint64_t getTotalFrames() const { return resampling_ ? outputTotalFrames_ : totalFrames_; }
+    bool isResampling() const { return resampling_; }
+    int getBlockFrames() const { return blockFrames_; }
+    bool isOpen() const { return format_ != Format::Unknown; }
+
+    // Diagnostics
+    uint64_t getStarvationCount() const { return starvationCount_.load(std::memory_order_relaxed); }
+    bool hasDecodeError() const { return decodeError_.load(std::memory_order_acquire); }
+
+private:
+    // Worker thread
+    void readAheadLoop();
+    int fillBlock(int blockIndex);
+    int fillFromMapping(float* const* channels, int numFrames);
+    int fillFromFlac(float* const* channels, int numFrames);
+    int fillResampled(float* const* channels, int numFrames);
+
+    bool openMapped(const std::string& path);
+    bool openFlac(const std::string& path);
+    bool allocateBlocks();
+
+    Format format_;
+    double sampleRate_;
+    int numChannels_;
+    uint64_t totalFrames_;
+
+    // Memory-mapped WAV/RF64 source
+    int fileDescriptor_;
+    const uint8_t* mapping_;
+    size_t mappingSize_;
+    WavFormat::Info wavInfo_;
+    uint64_t adviseFrame_;      // Next frame to prefetch with madvise
+
+    // Streaming FLAC source
+    std::unique_ptr<FlacDecoder> flacDecoder_;
+    int flacFrameSize_;         // Samples in the current decoded frame
+    int flacFrameCursor_;       // Next unread sample in the current frame
+    float flacScale_;
+
+    // Block storage (one aligned allocation, planar per block)
+    float* blockMemory_;
+    int blockFrames_;
+    int numBlocks_;
+    std::vector<float*> channelPointers_;       // numBlocks * numChannels
+    std::vector<int> blockFrameCounts_;
+    std::vector<uint64_t> blockStartFrames_;
+
+    // Lock-free SPSC handoff: worker -> consumer (ready), consumer -> worker (free)
+    AudioBuffer<int> readyBlocks_;
+    AudioBuffer<int> freeBlocks_;
+    int currentBlock_;          // Consumer-owned
+
+    // Worker state
+    std::thread worker_;
+    std::atomic<bool> running_;
+    std::atomic<bool> endOfStream_;
+    std::atomic<bool> decodeError_;
+    std::atomic<uint64_t> starvationCount_;
+    uint64_t framesRead_;       // Worker-owned, file frames
+    uint64_t framesDelivered_;  // Worker-owned, block frames
+
+    // Sample-rate conversion (worker-owned while running): file blocks are read
+    // into sourceBuffers_, converted into pendingBuffers_ and handed out from there
+    bool resampling_;
+    double outputSampleRate_;
+    uint64_t outputTotalFrames_;
+    PolyphaseResampler resampler_;
+    std::vector<std::vector<float>> sourceBuffers_;
+    std::vector<std::vector<float>> pendingBuffers_;
+    int pendingFrames_;
+    int flushRemaining_;        // Silence still to feed once the file has ended
+    bool sourceEnded_;
+};
+
+} // namespace VoiceMonitor
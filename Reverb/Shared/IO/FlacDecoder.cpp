@@ -0,0 +1,524 @@
+#include "FlacDecoder.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+    // Frame header lookup tables (FLAC format specification)
+    constexpr int SAMPLE_SIZE_TABLE[8] = { 0, 8, 12, 0, 16, 20, 24, 32 };
+
+    // Channel assignments
+    constexpr int CHANNELS_LEFT_SIDE = 8;
+    constexpr int CHANNELS_SIDE_RIGHT = 9;
+    constexpr int CHANNELS_MID_SIDE = 10;
+}
+
+FlacDecoder::FlacDecoder()
+    : file_(nullptr)
+    , firstFrameOffset_(0)
+    , buffer_(READ_BUFFER_SIZE)
+    , pos_(0)
+    , end_(0)
+    , cache_(0)
+    , cacheBits_(0)
+    , eof_(false) {
+}
+
+FlacDecoder::~FlacDecoder() {
+    close();
+}
+
+bool FlacDecoder::open(const std::string& path) {
+    close();
+
+    file_ = std::fopen(path.c_str(), "rb");
+    if (!file_) {
+        return false;
+    }
+
+    if (!readMetadata()) {
+        close();
+        return false;
+    }
+
+    // Metadata ends on a byte boundary: whatever is still buffered or cached
+    // belongs to the first frame
+    firstFrameOffset_ = std::ftell(file_) - static_cast<long>(end_ - pos_) - cacheBits_ / 8;
+
+    for (int ch = 0; ch < streamInfo_.numChannels; ++ch) {
+        channels_[ch].assign(std::max(streamInfo_.maxBlockSize, 1), 0);
+    }
+    return true;
+}
+
+void FlacDecoder::close() {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+    pos_ = end_ = 0;
+    cache_ = 0;
+    cacheBits_ = 0;
+    eof_ = false;
+    streamInfo_ = StreamInfo();
+    firstFrameOffset_ = 0;
+}
+
+bool FlacDecoder::rewind() {
+    if (!file_ || std::fseek(file_, firstFrameOffset_, SEEK_SET) != 0) {
+        return false;
+    }
+    pos_ = end_ = 0;
+    cache_ = 0;
+    cacheBits_ = 0;
+    eof_ = false;
+    return true;
+}
+
+// ============================================================================
+// Bit reader
+// ============================================================================
+
+bool FlacDecoder::fillByte(uint8_t& byte) {
+    if (pos_ == end_) {
+        end_ = file_ ? std::fread(buffer_.data(), 1, buffer_.size(), file_) : 0;
+        pos_ = 0;
+        if (end_ == 0) {
+            eof_ = true;
+            byte = 0;
+            return false;
+        }
+    }
+    byte = buffer_[pos_++];
+    return true;
+}
+
+uint32_t FlacDecoder::readBits(int numBits) {
+    if (numBits == 0) return 0;
+
+    while (cacheBits_ < numBits) {
+        uint8_t byte;
+        fillByte(byte); // Past EOF reads zeros; callers check eof_
+        cache_ = (cache_ << 8) | byte;
+        cacheBits_ += 8;
+    }
+
+    cacheBits_ -= numBits;
+    return static_cast<uint32_t>((cache_ >> cacheBits_) & ((uint64_t(1) << numBits) - 1));
+}
+
+int32_t FlacDecoder::readSignedBits(int numBits) {
+    if (numBits == 0) return 0;
+    const uint32_t raw = readBits(numBits);
+    const int shift = 32 - numBits;
+    return static_cast<int32_t>(raw << shift) >> shift;
+}
+
+uint32_t FlacDecoder::readUnary() {
+    // Count zero bits before the terminating one, consuming whole bytes at a time
+    uint32_t count = 0;
+    for (;;) {
+        if (cacheBits_ == 0) {
+            uint8_t byte;
+            if (!fillByte(byte)) return count;
+            cache_ = (cache_ << 8) | byte;
+            cacheBits_ = 8;
+        }
+
+        const uint64_t pending = cache_ & ((uint64_t(1) << cacheBits_) - 1);
+        if (pending == 0) {
+            count += cacheBits_;
+            cacheBits_ = 0;
+            continue;
+        }
+
+        const int highestBit = 63 - __builtin_clzll(pending);
+        const int zeros = cacheBits_ - 1 - highestBit;
+        count += zeros;
+        cacheBits_ -= zeros + 1;
+        return count;
+    }
+}
+
+uint64_t FlacDecoder::readUTF8Number(bool& valid) {
+    // Frame/sample numbers use UTF-8 style variable-length coding (up to 36 bits)
+    uint32_t first = readBits(8);
+    int extraBytes = 0;
+    uint64_t value = 0;
+
+    if ((first & 0x80) == 0) {
+        value = first;
+    } else if ((first & 0xE0) == 0xC0) {
+        value = first & 0x1F; extraBytes = 1;
+    } else if ((first & 0xF0) == 0xE0) {
+        value = first & 0x0F; extraBytes = 2;
+    } else if ((first & 0xF8) == 0xF0) {
+        value = first & 0x07; extraBytes = 3;
+    } else if ((first & 0xFC) == 0xF8) {
+        value = first & 0x03; extraBytes = 4;
+    } else if ((first & 0xFE) == 0xFC) {
+        value = first & 0x01; extraBytes = 5;
+    } else if (first == 0xFE) {
+        value = 0; extraBytes = 6;
+    } else {
+        valid = false;
+        return 0;
+    }
+
+    for (int i = 0; i < extraBytes; ++i) {
+        uint32_t byte = readBits(8);
+        if ((byte & 0xC0) != 0x80) {
+            valid = false;
+            return 0;
+        }
+        value = (value << 6) | (byte & 0x3F);
+    }
+
+    valid = true;
+    return value;
+}
+
+// ============================================================================
+// Stream parsing
+// ============================================================================
+
+bool FlacDecoder::readMetadata() {
+    // Skip an ID3v2 tag if one precedes the stream marker
+    uint32_t marker = readBits(32);
+    if ((marker >> 8) == 0x494433) { // "ID3" + major version
+        readBits(8); // Minor version
+        const uint32_t flags = readBits(8);
+        uint32_t tagSize = 0;
+        for (int i = 0; i < 4; ++i) {
+            tagSize = (tagSize << 7) | (readBits(8) & 0x7F); // Sync-safe integer
+        }
+        if (flags & 0x10) {
+            tagSize += 10; // Footer (ID3v2.4), not counted in the size
+        }
+        for (uint32_t i = 0; i < tagSize; ++i) {
+            readBits(8);
+        }
+        marker = readBits(32);
+    }
+
+    if (marker != 0x664C6143) { // "fLaC"
+        return false;
+    }
+
+    bool haveStreamInfo = false;
+    bool lastBlock = false;
+
+    while (!lastBlock) {
+        lastBlock = readBits(1) != 0;
+        const uint32_t type = readBits(7);
+        const uint32_t length = readBits(24);
+
+        if (atEnd()) return false;
+
+        if (type == 0 && length >= 34) {
+            streamInfo_.minBlockSize = static_cast<int>(readBits(16));
+            streamInfo_.maxBlockSize = static_cast<int>(readBits(16));
+            readBits(24); // Min frame size
+            readBits(24); // Max frame size
+            streamInfo_.sampleRate = static_cast<double>(readBits(20));
+            streamInfo_.numChannels = static_cast<int>(readBits(3)) + 1;
+            streamInfo_.bitsPerSample = static_cast<int>(readBits(5)) + 1;
+            streamInfo_.totalSamples = (static_cast<uint64_t>(readBits(4)) << 32) | readBits(32);
+            for (uint32_t i = 0; i < 16 + (length - 34); ++i) {
+                readBits(8); // MD5 signature and any trailing bytes
+            }
+            haveStreamInfo = true;
+        } else {
+            // PADDING, SEEKTABLE, VORBIS_COMMENT, PICTURE, ... are not needed for decoding
+            for (uint32_t i = 0; i < length; ++i) {
+                readBits(8);
+            }
+        }
+    }
+
+    return haveStreamInfo &&
+           streamInfo_.numChannels <= MAX_CHANNELS &&
+           streamInfo_.bitsPerSample >= 4 && streamInfo_.bitsPerSample <= 32 &&
+           streamInfo_.maxBlockSize >= 16;
+}
+
+bool FlacDecoder::findFrameSync() {
+    alignToByte();
+
+    // Sync code: 0xFFF8 (fixed blocksize) or 0xFFF9 (variable blocksize)
+    uint32_t previous = readBits(8);
+    while (!atEnd()) {
+        uint32_t current = readBits(8);
+        if (previous == 0xFF && (current & 0xFE) == 0xF8) {
+            return true;
+        }
+        previous = current;
+    }
+    return false;
+}
+
+int FlacDecoder::decodeFrame() {
+    if (!file_) return -1;
+
+    if (!findFrameSync()) {
+        return 0; // Clean end of stream
+    }
+
+    // Frame header
+    const uint32_t blockSizeCode = readBits(4);
+    const uint32_t sampleRateCode = readBits(4);
+    const uint32_t channelAssignment = readBits(4);
+    const uint32_t sampleSizeCode = readBits(3);
+    readBits(1); // Reserved
+
+    bool validNumber = false;
+    readUTF8Number(validNumber);
+    if (!validNumber) return -1;
+
+    int blockSize = 0;
+    if (blockSizeCode == 1) {
+        blockSize = 192;
+    } else if (blockSizeCode >= 2 && blockSizeCode <= 5) {
+        blockSize = 576 << (blockSizeCode - 2);
+    } else if (blockSizeCode == 6) {
+        blockSize = static_cast<int>(readBits(8)) + 1;
+    } else if (blockSizeCode == 7) {
+        blockSize = static_cast<int>(readBits(16)) + 1;
+    } else if (blockSizeCode >= 8) {
+        blockSize = 256 << (blockSizeCode - 8);
+    } else {
+        return -1;
+    }
+
+    // Per-frame sample rate overrides are informative only (STREAMINFO is authoritative)
+    if (sampleRateCode == 12) {
+        readBits(8);
+    } else if (sampleRateCode == 13 || sampleRateCode == 14) {
+        readBits(16);
+    } else if (sampleRateCode == 15) {
+        return -1;
+    }
+
+    readBits(8); // CRC-8 of header
+
+    int bitsPerSample = streamInfo_.bitsPerSample;
+    if (sampleSizeCode != 0) {
+        bitsPerSample = SAMPLE_SIZE_TABLE[sampleSizeCode];
+        if (bitsPerSample == 0) return -1;
+    }
+
+    const int numChannels = channelAssignment < 8 ? static_cast<int>(channelAssignment) + 1 : 2;
+    if (channelAssignment > CHANNELS_MID_SIDE || numChannels != streamInfo_.numChannels) {
+        return -1;
+    }
+
+    if (blockSize > static_cast<int>(channels_[0].size())) {
+        // Non-conforming stream advertising a smaller max block size
+        if (blockSize > MAX_BLOCK_SIZE) return -1;
+        for (int ch = 0; ch < numChannels; ++ch) {
+            channels_[ch].resize(blockSize);
+        }
+    }
+
+    // Subframes (side channel carries one extra bit)
+    for (int ch = 0; ch < numChannels; ++ch) {
+        int subframeBits = bitsPerSample;
+        if ((channelAssignment == CHANNELS_LEFT_SIDE && ch == 1) ||
+            (channelAssignment == CHANNELS_SIDE_RIGHT && ch == 0) ||
+            (channelAssignment == CHANNELS_MID_SIDE && ch == 1)) {
+            subframeBits += 1;
+        }
+        if (subframeBits > 32 || !decodeSubframe(channels_[ch].data(), blockSize, subframeBits)) {
+            return -1;
+        }
+    }
+
+    alignToByte();
+    readBits(16); // CRC-16 of frame
+
+    if (eof_) {
+        // Truncated final frame (reads past the end return zeros)
+        return -1;
+    }
+
+    // Inter-channel decorrelation
+    int32_t* ch0 = channels_[0].data();
+    int32_t* ch1 = numChannels > 1 ? channels_[1].data() : nullptr;
+
+    switch (channelAssignment) {
+        case CHANNELS_LEFT_SIDE:
+            for (int i = 0; i < blockSize; ++i) {
+                ch1[i] = ch0[i] - ch1[i];
+            }
+            break;
+
+        case CHANNELS_SIDE_RIGHT:
+            for (int i = 0; i < blockSize; ++i) {
+                ch0[i] = ch0[i] + ch1[i];
+            }
+            break;
+
+        case CHANNELS_MID_SIDE:
+            for (int i = 0; i < blockSize; ++i) {
+                const int32_t side = ch1[i];
+                const int32_t mid = static_cast<int32_t>((static_cast<uint32_t>(ch0[i]) << 1) |
+                                                         (static_cast<uint32_t>(side) & 1u));
+                ch0[i] = (mid + side) >> 1;
+                ch1[i] = (mid - side) >> 1;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return blockSize;
+}
+
+bool FlacDecoder::decodeSubframe(int32_t* output, int blockSize, int bitsPerSample) {
+    if (readBits(1) != 0) return false; // Zero padding bit
+
+    const uint32_t type = readBits(6);
+
+    int wastedBits = 0;
+    if (readBits(1) != 0) {
+        wastedBits = static_cast<int>(readUnary()) + 1;
+        if (wastedBits >= bitsPerSample) return false;
+        bitsPerSample -= wastedBits;
+    }
+
+    if (type == 0) {
+        // CONSTANT
+        const int32_t value = readSignedBits(bitsPerSample);
+        std::fill(output, output + blockSize, value);
+    } else if (type == 1) {
+        // VERBATIM
+        for (int i = 0; i < blockSize; ++i) {
+            output[i] = readSignedBits(bitsPerSample);
+        }
+    } else if (type >= 8 && type <= 12) {
+        // FIXED predictor, order 0-4
+        const int order = static_cast<int>(type - 8);
+        if (order > blockSize) return false;
+        for (int i = 0; i < order; ++i) {
+            output[i] = readSignedBits(bitsPerSample);
+        }
+        if (!decodeResidual(output + order, blockSize, order)) return false;
+        restoreFixed(output, blockSize, order);
+    } else if (type >= 32) {
+        // LPC, order 1-32
+        const int order = static_cast<int>(type - 31);
+        if (order > blockSize) return false;
+        for (int i = 0; i < order; ++i) {
+            output[i] = readSignedBits(bitsPerSample);
+        }
+
+        const int precision = static_cast<int>(readBits(4)) + 1;
+        if (precision == 16) return false; // 0b1111 is invalid
+        const int shift = readSignedBits(5);
+        if (shift < 0) return false;
+
+        int32_t coeffs[32];
+        for (int i = 0; i < order; ++i) {
+            coeffs[i] = readSignedBits(precision);
+        }
+
+        if (!decodeResidual(output + order, blockSize, order)) return false;
+        restoreLPC(output, blockSize, coeffs, order, shift);
+    } else {
+        return false; // Reserved subframe type
+    }
+
+    if (wastedBits > 0) {
+        for (int i = 0; i < blockSize; ++i) {
+            output[i] = static_cast<int32_t>(static_cast<uint32_t>(output[i]) << wastedBits);
+        }
+    }
+
+    return !eof_;
+}
+
+bool FlacDecoder::decodeResidual(int32_t* residual, int blockSize, int predictorOrder) {
+    const uint32_t method = readBits(2);
+    if (method > 1) return false;
+
+    const int paramBits = method == 0 ? 4 : 5;
+    const uint32_t escapeCode = method == 0 ? 15u : 31u;
+    const int partitionOrder = static_cast<int>(readBits(4));
+    const int numPartitions = 1 << partitionOrder;
+
+    if ((blockSize >> partitionOrder) < predictorOrder || (blockSize % numPartitions) != 0) {
+        return false;
+    }
+
+    int out = 0;
+    for (int partition = 0; partition < numPartitions; ++partition) {
+        int count = blockSize >> partitionOrder;
+        if (partition == 0) {
+            count -= predictorOrder;
+        }
+
+        const uint32_t param = readBits(paramBits);
+        if (param == escapeCode) {
+            // Unencoded partition
+            const int rawBits = static_cast<int>(readBits(5));
+            for (int i = 0; i < count; ++i) {
+                residual[out++] = readSignedBits(rawBits);
+            }
+        } else {
+            for (int i = 0; i < count; ++i) {
+                const uint32_t quotient = readUnary();
+                const uint32_t folded = (quotient << param) | readBits(static_cast<int>(param));
+                residual[out++] = static_cast<int32_t>(folded >> 1) ^ -static_cast<int32_t>(folded & 1);
+            }
+        }
+
+        if (eof_) return false;
+    }
+
+    return true;
+}
+
+void FlacDecoder::restoreFixed(int32_t* samples, int blockSize, int order) {
+    switch (order) {
+        case 0:
+            break;
+        case 1:
+            for (int i = 1; i < blockSize; ++i) {
+                samples[i] += samples[i - 1];
+            }
+            break;
+        case 2:
+            for (int i = 2; i < blockSize; ++i) {
+                samples[i] += 2 * samples[i - 1] - samples[i - 2];
+            }
+            break;
+        case 3:
+            for (int i = 3; i < blockSize; ++i) {
+                samples[i] += 3 * samples[i - 1] - 3 * samples[i - 2] + samples[i - 3];
+            }
+            break;
+        case 4:
+            for (int i = 4; i < blockSize; ++i) {
+                samples[i] += 4 * samples[i - 1] - 6 * samples[i - 2] + 4 * samples[i - 3] - samples[i - 4];
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void FlacDecoder::restoreLPC(int32_t* samples, int blockSize, const int32_t* coeffs, int order, int shift) {
+    for (int i = order; i < blockSize; ++i) {
+        int64_t prediction = 0;
+        for (int j = 0; j < order; ++j) {
+            prediction += static_cast<int64_t>(coeffs[j]) * samples[i - 1 - j];
+        }
+        samples[i] += static_cast<int32_t>(prediction >> shift);
+    }
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace VoiceMonitor {
+
+/// Streaming FLAC decoder for offline processing
+/// Decodes one frame at a time from disk (constant, verbatim, fixed and LPC subframes,
+/// all stereo decorrelation modes). Intended to run on a read-ahead thread, never on
+/// the audio thread.
+class FlacDecoder {
+public:
+    static constexpr int MAX_CHANNELS = 8;
+    static constexpr int MAX_BLOCK_SIZE = 65535;
+
+    /// Contents of the STREAMINFO metadata block
+    struct StreamInfo {
+        int minBlockSize = 0;
+        int maxBlockSize = 0;
+        double sampleRate = 0.0;
+        int numChannels = 0;
+        int bitsPerSample = 0;
+        uint64_t totalSamples = 0; // Per channel, 0 if unknown
+    };
+
+    FlacDecoder();
+    ~FlacDecoder();
+
+    FlacDecoder(const FlacDecoder&) = delete;
+    FlacDecoder& operator=(const FlacDecoder&) = delete;
+
+    /// Open file and parse metadata (returns false if not a valid FLAC stream)
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file_ != nullptr; }
+
+    /// Seek back to the first frame, so decoding restarts at sample 0
+    bool rewind();
+
+    const StreamInfo& getStreamInfo() const { return streamInfo_; }
+
+    /// Decode the next frame
+    /// @return Number of samples per channel, 0 at end of stream, -1 on corrupt data
+    int decodeFrame();
+
+    /// Decoded samples of the last frame (integer, bitsPerSample wide)
+    const int32_t* getChannelData(int channel) const { return channels_[channel].data(); }
+
+private:
+    // Bit-level reader over a buffered file
+    uint32_t readBits(int numBits);
+    int32_t readSignedBits(int numBits);
+    uint32_t readUnary();
+    uint64_t readUTF8Number(bool& valid);
+    void alignToByte() { cacheBits_ -= cacheBits_ % 8; }
+    bool fillByte(uint8_t& byte);
+    bool atEnd() const { return eof_ && cacheBits_ == 0 && pos_ == end_; }
+
+    // Stream parsing
+    bool readMetadata();
+    bool findFrameSync();
+    bool decodeSubframe(int32_t* output, int blockSize, int bitsPerSample);
+    bool decodeResidual(int32_t* residual, int blockSize, int predictorOrder);
+    void restoreFixed(int32_t* samples, int blockSize, int order);
+    void restoreLPC(int32_t* samples, int blockSize, const int32_t* coeffs, int order, int shift);
+
+    FILE* file_;
+    long firstFrameOffset_;     // File position just past the metadata blocks
+    std::vector<uint8_t> buffer_;
+    size_t pos_;
+    size_t end_;
+    uint64_t cache_;
+    int cacheBits_;
+    bool eof_;
+
+    StreamInfo streamInfo_;
+    std::vector<int32_t> channels_[MAX_CHANNELS];
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,843 @@
+#include "FlacEncoder.hpp"
+#include "FDNReverb.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr int STREAMINFO_OFFSET = 8;        // "fLaC" + metadata block header
+    constexpr int STREAMINFO_BYTES = 34;
+    constexpr size_t STDIO_BUFFER_BYTES = 1 << 20;
+
+    // CRC-8 (poly 0x07) for frame headers, CRC-16 (poly 0x8005) for whole frames
+    struct CrcTables {
+        uint8_t crc8[256];
+        uint16_t crc16[256];
+
+        CrcTables() {
+            for (int i = 0; i < 256; ++i) {
+                uint8_t c8 = static_cast<uint8_t>(i);
+                uint16_t c16 = static_cast<uint16_t>(i << 8);
+                for (int bit = 0; bit < 8; ++bit) {
+                    c8 = static_cast<uint8_t>((c8 & 0x80) ? (c8 << 1) ^ 0x07 : (c8 << 1));
+                    c16 = static_cast<uint16_t>((c16 & 0x8000) ? (c16 << 1) ^ 0x8005 : (c16 << 1));
+                }
+                crc8[i] = c8;
+                crc16[i] = c16;
+            }
+        }
+    };
+
+    const CrcTables& crcTables() {
+        static const CrcTables tables;
+        return tables;
+    }
+
+    uint8_t computeCrc8(const uint8_t* data, size_t size) {
+        const CrcTables& tables = crcTables();
+        uint8_t crc = 0;
+        for (size_t i = 0; i < size; ++i) {
+            crc = tables.crc8[crc ^ data[i]];
+        }
+        return crc;
+    }
+
+    uint16_t computeCrc16(const uint8_t* data, size_t size) {
+        const CrcTables& tables = crcTables();
+        uint16_t crc = 0;
+        for (size_t i = 0; i < size; ++i) {
+            crc = static_cast<uint16_t>((crc << 8) ^ tables.crc16[(crc >> 8) ^ data[i]]);
+        }
+        return crc;
+    }
+
+    inline uint32_t zigzag(int32_t value) {
+        return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+
+    inline int ceilLog2(int value) {
+        int bits = 0;
+        while ((1 << bits) < value) ++bits;
+        return bits;
+    }
+
+    int blockSizeCode(int numSamples) {
+        if (numSamples == 192) return 1;
+        for (int code = 2; code <= 5; ++code) {
+            if (numSamples == (576 << (code - 2))) return code;
+        }
+        for (int code = 8; code <= 15; ++code) {
+            if (numSamples == (256 << (code - 8))) return code;
+        }
+        return numSamples <= 256 ? 6 : 7;   // Explicit 8/16-bit size after the header
+    }
+
+    int sampleRateCode(double sampleRate) {
+        switch (static_cast<int>(sampleRate)) {
+            case 88200: return 1;
+            case 176400: return 2;
+            case 192000: return 3;
+            case 8000: return 4;
+            case 16000: return 5;
+            case 22050: return 6;
+            case 24000: return 7;
+            case 32000: return 8;
+            case 44100: return 9;
+            case 48000: return 10;
+            case 96000: return 11;
+            default: return 0;              // Taken from STREAMINFO
+        }
+    }
+
+    // SSE2 has no 32-bit low multiply; emulate it with two 32x32->64 multiplies
+    #if SIMD_AVAILABLE && !defined(__ARM_NEON__) && defined(__SSE2__)
+    inline __m128i mulLo32(__m128i a, __m128i b) {
+        const __m128i even = _mm_mul_epu32(a, b);
+        const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                  _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+    #endif
+}
+
+FlacEncoder::FlacEncoder()
+    : file_(nullptr)
+    , frameNumber_(0)
+    , samplesEncoded_(0)
+    , bytesWritten_(0)
+    , minFrameBytes_(0)
+    , maxFrameBytes_(0)
+    , frameBytes_(0)
+    , bitCache_(0)
+    , bitCount_(0)
+    , windowLength_(0) {
+}
+
+FlacEncoder::~FlacEncoder() {
+    close();
+}
+
+int32_t FlacEncoder::floatToSample(float value, int bitsPerSample) {
+    const float scale = static_cast<float>(1 << (bitsPerSample - 1));
+    const float scaled = std::nearbyint(value * scale);
+    return static_cast<int32_t>(std::max(-scale, std::min(scaled, scale - 1.0f)));
+}
+
+bool FlacEncoder::open(const std::string& path, const Settings& settings) {
+    close();
+
+    if (settings.numChannels < 1 || settings.numChannels > MAX_CHANNELS ||
+        (settings.bitsPerSample != 16 && settings.bitsPerSample != 24) ||
+        settings.blockSize < 16 || settings.blockSize > 65535 ||
+        settings.sampleRate <= 0.0 || settings.sampleRate >= 1048576.0) {
+        return false;
+    }
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        return false;
+    }
+    std::setvbuf(file_, nullptr, _IOFBF, STDIO_BUFFER_BYTES);
+
+    settings_ = settings;
+    settings_.maxLpcOrder = std::clamp(settings.maxLpcOrder, 0, MAX_LPC_ORDER);
+    settings_.maxPartitionOrder = std::clamp(settings.maxPartitionOrder, 0, MAX_PARTITION_ORDER);
+
+    frameNumber_ = 0;
+    samplesEncoded_ = 0;
+    minFrameBytes_ = 0;
+    maxFrameBytes_ = 0;
+
+    // Worst case is a verbatim frame with side channels at bps + 1
+    const size_t maxFrameBytes = 32 + static_cast<size_t>(settings_.numChannels) *
+                                 (static_cast<size_t>(settings_.blockSize) * (settings_.bitsPerSample + 1) / 8 + 16);
+    frameBuffer_.assign(maxFrameBytes, 0);
+
+    const size_t blockSize = static_cast<size_t>(settings_.blockSize);
+    midSide_[0].resize(blockSize);
+    midSide_[1].resize(blockSize);
+    residual_.resize(blockSize);
+    bestResidual_.resize(blockSize);
+    windowed_.resize(blockSize + 4);
+    window_.resize(blockSize);
+    windowLength_ = 0;
+    partitionSums_.resize(1 << MAX_PARTITION_ORDER);
+
+    // Stream marker + last-metadata-block flag | STREAMINFO, placeholder contents
+    const uint8_t header[4 + 4] = { 'f', 'L', 'a', 'C', 0x80, 0, 0, STREAMINFO_BYTES };
+    bytesWritten_ = std::fwrite(header, 1, sizeof(header), file_);
+    if (bytesWritten_ != sizeof(header) || !writeStreamInfo()) {
+        std::fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    bytesWritten_ += STREAMINFO_BYTES;
+    return true;
+}
+
+bool FlacEncoder::close() {
+    if (!file_) {
+        return true;
+    }
+
+    bool success = std::fflush(file_) == 0;
+    success = std::fseek(file_, STREAMINFO_OFFSET, SEEK_SET) == 0 && writeStreamInfo() && success;
+    success = std::fclose(file_) == 0 && success;
+    file_ = nullptr;
+    return success;
+}
+
+void FlacEncoder::setMaxLpcOrder(int order) {
+    settings_.maxLpcOrder = std::clamp(order, 0, MAX_LPC_ORDER);
+}
+
+bool FlacEncoder::writeStreamInfo() {
+    uint8_t info[STREAMINFO_BYTES] = {};
+    const uint32_t blockSize = static_cast<uint32_t>(settings_.blockSize);
+    const uint32_t sampleRate = static_cast<uint32_t>(settings_.sampleRate);
+    const uint64_t totalSamples = samplesEncoded_ & 0xFFFFFFFFFull;   // 36 bits
+
+    info[0] = static_cast<uint8_t>(blockSize >> 8);
+    info[1] = static_cast<uint8_t>(blockSize);
+    info[2] = static_cast<uint8_t>(blockSize >> 8);
+    info[3] = static_cast<uint8_t>(blockSize);
+    info[4] = static_cast<uint8_t>(minFrameBytes_ >> 16);
+    info[5] = static_cast<uint8_t>(minFrameBytes_ >> 8);
+    info[6] = static_cast<uint8_t>(minFrameBytes_);
+    info[7] = static_cast<uint8_t>(maxFrameBytes_ >> 16);
+    info[8] = static_cast<uint8_t>(maxFrameBytes_ >> 8);
+    info[9] = static_cast<uint8_t>(maxFrameBytes_);
+
+    // sampleRate(20) | channels-1(3) | bitsPerSample-1(5) | totalSamples(36)
+    info[10] = static_cast<uint8_t>(sampleRate >> 12);
+    info[11] = static_cast<uint8_t>(sampleRate >> 4);
+    info[12] = static_cast<uint8_t>(((sampleRate & 0x0F) << 4) | ((settings_.numChannels - 1) << 1) |
+                                    ((settings_.bitsPerSample - 1) >> 4));
+    info[13] = static_cast<uint8_t>((((settings_.bitsPerSample - 1) & 0x0F) << 4) | (totalSamples >> 32));
+    info[14] = static_cast<uint8_t>(totalSamples >> 24);
+    info[15] = static_cast<uint8_t>(totalSamples >> 16);
+    info[16] = static_cast<uint8_t>(totalSamples >> 8);
+    info[17] = static_cast<uint8_t>(totalSamples);
+    // MD5 left zero ("not computed")
+
+    return std::fwrite(info, 1, sizeof(info), file_) == sizeof(info);
+}
+
+// ============================================================================
+// Frame encoding
+// ============================================================================
+
+bool FlacEncoder::encodeFrame(const int32_t* const* channels, int numSamples) {
+    if (!file_ || numSamples <= 0 || numSamples > settings_.blockSize) {
+        return false;
+    }
+
+    const int numChannels = settings_.numChannels;
+    const int bitsPerSample = settings_.bitsPerSample;
+
+    // Stereo decorrelation: pick the pair with the smallest order-2 residual
+    int channelAssignment = numChannels - 1;     // Independent
+    const int32_t* sources[MAX_CHANNELS];
+    int sourceBits[MAX_CHANNELS];
+    for (int ch = 0; ch < numChannels; ++ch) {
+        sources[ch] = channels[ch];
+        sourceBits[ch] = bitsPerSample;
+    }
+
+    if (numChannels == 2) {
+        const int32_t* left = channels[0];
+        const int32_t* right = channels[1];
+        int32_t* mid = midSide_[0].data();
+        int32_t* side = midSide_[1].data();
+        uint64_t cost[4] = { 0, 0, 0, 0 };      // left, right, mid, side
+
+        for (int i = 0; i < numSamples; ++i) {
+            mid[i] = (left[i] + right[i]) >> 1;
+            side[i] = left[i] - right[i];
+        }
+        for (int i = 2; i < numSamples; ++i) {
+            cost[0] += static_cast<uint64_t>(std::abs(left[i] - 2 * left[i - 1] + left[i - 2]));
+            cost[1] += static_cast<uint64_t>(std::abs(right[i] - 2 * right[i - 1] + right[i - 2]));
+            cost[2] += static_cast<uint64_t>(std::abs(mid[i] - 2 * mid[i - 1] + mid[i - 2]));
+            cost[3] += static_cast<uint64_t>(std::abs(side[i] - 2 * side[i - 1] + side[i - 2]));
+        }
+
+        const uint64_t independent = cost[0] + cost[1];
+        const uint64_t leftSide = cost[0] + cost[3];
+        const uint64_t sideRight = cost[3] + cost[1];
+        const uint64_t midSide = cost[2] + cost[3];
+        const uint64_t best = std::min(std::min(independent, leftSide), std::min(sideRight, midSide));
+
+        if (best == midSide && best < independent) {
+            channelAssignment = 10;
+            sources[0] = mid;
+            sources[1] = side;
+            sourceBits[1] = bitsPerSample + 1;
+        } else if (best == leftSide && best < independent) {
+            channelAssignment = 8;
+            sources[1] = side;
+            sourceBits[1] = bitsPerSample + 1;
+        } else if (best == sideRight && best < independent) {
+            channelAssignment = 9;
+            sources[0] = side;
+            sourceBits[0] = bitsPerSample + 1;
+        }
+    }
+
+    // Frame header
+    frameBytes_ = 0;
+    bitCache_ = 0;
+    bitCount_ = 0;
+
+    const int sizeCode = blockSizeCode(numSamples);
+    writeBits(0xFFF8, 16);                       // Sync, reserved, fixed block size
+    writeBits(static_cast<uint32_t>(sizeCode), 4);
+    writeBits(static_cast<uint32_t>(sampleRateCode(settings_.sampleRate)), 4);
+    writeBits(static_cast<uint32_t>(channelAssignment), 4);
+    writeBits(bitsPerSample == 16 ? 4u : 6u, 3);
+    writeBits(0, 1);
+    writeUTF8(frameNumber_);
+    if (sizeCode == 6) {
+        writeBits(static_cast<uint32_t>(numSamples - 1), 8);
+    } else if (sizeCode == 7) {
+        writeBits(static_cast<uint32_t>(numSamples - 1), 16);
+    }
+    writeBits(computeCrc8(frameBuffer_.data(), frameBytes_), 8);
+
+    // Subframes: analyze and write one channel at a time (residual scratch is shared)
+    Subframe subframe;
+    for (int ch = 0; ch < numChannels; ++ch) {
+        analyzeChannel(sources[ch], numSamples, sourceBits[ch], subframe);
+        writeSubframe(sources[ch], numSamples, sourceBits[ch], subframe);
+    }
+
+    alignToByte();
+    const uint16_t crc = computeCrc16(frameBuffer_.data(), frameBytes_);
+    writeBits(crc, 16);
+
+    if (std::fwrite(frameBuffer_.data(), 1, frameBytes_, file_) != frameBytes_) {
+        return false;
+    }
+
+    const uint32_t frameSize = static_cast<uint32_t>(frameBytes_);
+    minFrameBytes_ = (frameNumber_ == 0) ? frameSize : std::min(minFrameBytes_, frameSize);
+    maxFrameBytes_ = std::max(maxFrameBytes_, frameSize);
+    bytesWritten_ += frameBytes_;
+    samplesEncoded_ += static_cast<uint64_t>(numSamples);
+    ++frameNumber_;
+    return true;
+}
+
+// ============================================================================
+// Analysis
+// ============================================================================
+
+void FlacEncoder::analyzeChannel(const int32_t* samples, int numSamples, int bitsPerSample, Subframe& best) {
+    const uint64_t headerBits = 8;
+
+    // Verbatim is the upper bound everything else has to beat
+    best.type = Subframe::Type::Verbatim;
+    best.order = 0;
+    best.bits = headerBits + static_cast<uint64_t>(numSamples) * bitsPerSample;
+
+    bool constant = true;
+    for (int i = 1; i < numSamples && constant; ++i) {
+        constant = samples[i] == samples[0];
+    }
+    if (constant) {
+        best.type = Subframe::Type::Constant;
+        best.bits = headerBits + bitsPerSample;
+        return;
+    }
+
+    if (numSamples <= 4) {
+        return;
+    }
+
+    // Fixed predictors: estimate all orders in one pass, then code the cheapest
+    {
+        uint64_t errors[5] = { 0, 0, 0, 0, 0 };
+        int32_t last0 = samples[3];
+        int32_t last1 = samples[3] - samples[2];
+        int32_t last2 = last1 - (samples[2] - samples[1]);
+        int32_t last3 = last2 - (samples[2] - 2 * samples[1] + samples[0]);
+
+        for (int i = 4; i < numSamples; ++i) {
+            const int32_t e0 = samples[i];
+            const int32_t e1 = e0 - last0;
+            const int32_t e2 = e1 - last1;
+            const int32_t e3 = e2 - last2;
+            const int32_t e4 = e3 - last3;
+            errors[0] += static_cast<uint64_t>(std::abs(e0));
+            errors[1] += static_cast<uint64_t>(std::abs(e1));
+            errors[2] += static_cast<uint64_t>(std::abs(e2));
+            errors[3] += static_cast<uint64_t>(std::abs(e3));
+            errors[4] += static_cast<uint64_t>(std::abs(e4));
+            last0 = e0;
+            last1 = e1;
+            last2 = e2;
+            last3 = e3;
+        }
+
+        const int order = static_cast<int>(std::min_element(errors, errors + 5) - errors);
+        Subframe candidate;
+        candidate.type = Subframe::Type::Fixed;
+        candidate.order = order;
+        computeFixedResidual(samples, numSamples, order, residual_.data());
+        candidate.bits = headerBits + static_cast<uint64_t>(order) * bitsPerSample +
+                         chooseRiceParameters(residual_.data(), numSamples, order, candidate);
+
+        if (candidate.bits < best.bits) {
+            best = candidate;
+            std::swap(residual_, bestResidual_);
+        }
+    }
+
+    // LPC: windowed autocorrelation -> Levinson-Durbin -> quantized coefficients
+    const int maxOrder = std::min(settings_.maxLpcOrder, numSamples - 1);
+    if (maxOrder <= 0) {
+        return;
+    }
+
+    double autoc[MAX_LPC_ORDER + 1];
+    computeAutocorrelation(samples, numSamples, maxOrder, autoc);
+    if (autoc[0] <= 0.0) {
+        return;
+    }
+
+    double lpc[MAX_LPC_ORDER][MAX_LPC_ORDER];
+    double predictionError[MAX_LPC_ORDER];
+    double reflection[MAX_LPC_ORDER];
+    double error = autoc[0] * (1.0 + 1e-9);     // Tiny white-noise floor keeps the recursion stable
+    int usableOrder = maxOrder;
+
+    for (int i = 0; i < maxOrder; ++i) {
+        double r = -autoc[i + 1];
+        for (int j = 0; j < i; ++j) {
+            r -= reflection[j] * autoc[i - j];
+        }
+        r /= error;
+
+        reflection[i] = r;
+        int j = 0;
+        for (; j < (i >> 1); ++j) {
+            const double tmp = reflection[j];
+            reflection[j] += r * reflection[i - 1 - j];
+            reflection[i - 1 - j] += r * tmp;
+        }
+        if (i & 1) {
+            reflection[j] += reflection[j] * r;
+        }
+
+        error *= (1.0 - r * r);
+        for (int k = 0; k <= i; ++k) {
+            lpc[i][k] = -reflection[k];     // Predictor: x[n] ~ sum lpc[k] * x[n-1-k]
+        }
+        predictionError[i] = error;
+
+        if (error <= 0.0) {
+            usableOrder = i + 1;
+            break;
+        }
+    }
+
+    // Expected residual bits per order; refine the best estimate and the full order
+    int estimatedOrder = 1;
+    double estimatedBits = 1e300;
+    for (int order = 1; order <= usableOrder; ++order) {
+        const double perSample = std::max(0.0, 0.5 * std::log2(std::max(predictionError[order - 1], 1e-30) * 0.5 / numSamples));
+        const double bits = perSample * (numSamples - order) + order * (bitsPerSample + 12);
+        if (bits < estimatedBits) {
+            estimatedBits = bits;
+            estimatedOrder = order;
+        }
+    }
+
+    const int candidates[2] = { estimatedOrder, usableOrder };
+    for (int c = 0; c < 2; ++c) {
+        const int order = candidates[c];
+        if (c == 1 && order == candidates[0]) {
+            break;
+        }
+
+        // Keep bps + precision + log2(order) within 32 bits so the SIMD residual can stay in int32
+        const int precision = bitsPerSample <= 17 ? std::min(13, 32 - bitsPerSample - ceilLog2(order)) : 15;
+
+        Subframe candidate;
+        candidate.type = Subframe::Type::Lpc;
+        candidate.order = order;
+        if (!quantizeCoefficients(lpc[order - 1], order, precision, candidate)) {
+            continue;
+        }
+
+        computeLpcResidual(samples, numSamples, candidate, bitsPerSample, residual_.data());
+        candidate.bits = headerBits + static_cast<uint64_t>(order) * bitsPerSample + 4 + 5 +
+                         static_cast<uint64_t>(order) * candidate.precision +
+                         chooseRiceParameters(residual_.data(), numSamples, order, candidate);
+
+        if (candidate.bits < best.bits) {
+            best = candidate;
+            std::swap(residual_, bestResidual_);
+        }
+    }
+}
+
+void FlacEncoder::computeFixedResidual(const int32_t* samples, int numSamples, int order, int32_t* residual) const {
+    const int count = numSamples - order;
+    const int32_t* x = samples + order;
+
+    switch (order) {
+        case 0:
+            std::memcpy(residual, x, count * sizeof(int32_t));
+            break;
+        case 1:
+            for (int i = 0; i < count; ++i) residual[i] = x[i] - x[i - 1];
+            break;
+        case 2:
+            for (int i = 0; i < count; ++i) residual[i] = x[i] - 2 * x[i - 1] + x[i - 2];
+            break;
+        case 3:
+            for (int i = 0; i < count; ++i) residual[i] = x[i] - 3 * x[i - 1] + 3 * x[i - 2] - x[i - 3];
+            break;
+        default:
+            for (int i = 0; i < count; ++i) residual[i] = x[i] - 4 * x[i - 1] + 6 * x[i - 2] - 4 * x[i - 3] + x[i - 4];
+            break;
+    }
+}
+
+void FlacEncoder::computeAutocorrelation(const int32_t* samples, int numSamples, int maxLag, double* autoc) {
+    // Tukey(0.5) window, rebuilt only when the frame length changes
+    if (windowLength_ != numSamples) {
+        const int taper = std::max(1, numSamples / 4);
+        for (int i = 0; i < numSamples; ++i) {
+            float w = 1.0f;
+            if (i < taper) {
+                w = 0.5f - 0.5f * std::cos(static_cast<float>(M_PI) * i / taper);
+            } else if (i >= numSamples - taper) {
+                w = 0.5f - 0.5f * std::cos(static_cast<float>(M_PI) * (numSamples - 1 - i) / taper);
+            }
+            window_[i] = w;
+        }
+        windowLength_ = numSamples;
+    }
+
+    float* x = windowed_.data();
+    for (int i = 0; i < numSamples; ++i) {
+        x[i] = static_cast<float>(samples[i]) * window_[i];
+    }
+
+    for (int lag = 0; lag <= maxLag; ++lag) {
+        const int count = numSamples - lag;
+        const float* a = x + lag;
+        int i = 0;
+        double sum = 0.0;
+
+        #if SIMD_AVAILABLE && defined(__ARM_NEON__)
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        for (; i + 8 <= count; i += 8) {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(x + i));
+            acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(x + i + 4));
+        }
+        float lanes[4];
+        vst1q_f32(lanes, vaddq_f32(acc0, acc1));
+        sum = static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        #elif SIMD_AVAILABLE && defined(__SSE2__)
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        for (; i + 8 <= count; i += 8) {
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(x + i)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(x + i + 4)));
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, _mm_add_ps(acc0, acc1));
+        sum = static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        #endif
+
+        for (; i < count; ++i) {
+            sum += static_cast<double>(a[i]) * x[i];
+        }
+        autoc[lag] = sum;
+    }
+}
+
+bool FlacEncoder::quantizeCoefficients(const double* lpc, int order, int precision, Subframe& subframe) const {
+    double cmax = 0.0;
+    for (int i = 0; i < order; ++i) {
+        cmax = std::max(cmax, std::fabs(lpc[i]));
+    }
+    if (cmax <= 0.0 || !std::isfinite(cmax)) {
+        return false;
+    }
+
+    int log2cmax;
+    std::frexp(cmax, &log2cmax);
+    --log2cmax;
+
+    // FLAC only allows non-negative shifts up to 15
+    const int shift = std::min(15, precision - 2 - log2cmax);
+    if (shift < 0) {
+        return false;
+    }
+
+    const int32_t qmax = (1 << (precision - 1)) - 1;
+    const int32_t qmin = -(1 << (precision - 1));
+    const double scale = static_cast<double>(1 << shift);
+    double error = 0.0;
+
+    // Error feedback keeps the quantized filter's response close to the original
+    for (int i = 0; i < order; ++i) {
+        error += lpc[i] * scale;
+        const int32_t q = std::clamp(static_cast<int32_t>(std::lround(error)), qmin, qmax);
+        error -= q;
+        subframe.coeffs[i] = q;
+    }
+
+    subframe.precision = precision;
+    subframe.shift = shift;
+    return true;
+}
+
+void FlacEncoder::computeLpcResidual(const int32_t* samples, int numSamples, const Subframe& subframe,
+                                     int bitsPerSample, int32_t* residual) const {
+    const int order = subframe.order;
+    const int shift = subframe.shift;
+    const int32_t* coeffs = subframe.coeffs;
+    int i = order;
+
+    if (bitsPerSample + subframe.precision + ceilLog2(order) <= 32) {
+        // Sums fit in int32: four residuals per iteration
+        #if SIMD_AVAILABLE && defined(__ARM_NEON__)
+        const int32x4_t shiftVector = vdupq_n_s32(-shift);
+        for (; i + 4 <= numSamples; i += 4) {
+            int32x4_t sum = vdupq_n_s32(0);
+            for (int j = 0; j < order; ++j) {
+                sum = vmlaq_n_s32(sum, vld1q_s32(samples + i - 1 - j), coeffs[j]);
+            }
+            const int32x4_t prediction = vshlq_s32(sum, shiftVector);
+            vst1q_s32(residual + i - order, vsubq_s32(vld1q_s32(samples + i), prediction));
+        }
+        #elif SIMD_AVAILABLE && defined(__SSE2__)
+        const __m128i shiftCount = _mm_cvtsi32_si128(shift);
+        for (; i + 4 <= numSamples; i += 4) {
+            __m128i sum = _mm_setzero_si128();
+            for (int j = 0; j < order; ++j) {
+                const __m128i history = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i - 1 - j));
+                sum = _mm_add_epi32(sum, mulLo32(history, _mm_set1_epi32(coeffs[j])));
+            }
+            const __m128i prediction = _mm_sra_epi32(sum, shiftCount);
+            const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(residual + i - order), _mm_sub_epi32(current, prediction));
+        }
+        #endif
+
+        for (; i < numSamples; ++i) {
+            int32_t sum = 0;
+            for (int j = 0; j < order; ++j) {
+                sum += coeffs[j] * samples[i - 1 - j];
+            }
+            residual[i - order] = samples[i] - (sum >> shift);
+        }
+        return;
+    }
+
+    // Wide path (24-bit): 64-bit accumulation, matching the decoder
+    for (; i < numSamples; ++i) {
+        int64_t sum = 0;
+        for (int j = 0; j < order; ++j) {
+            sum += static_cast<int64_t>(coeffs[j]) * samples[i - 1 - j];
+        }
+        residual[i - order] = samples[i] - static_cast<int32_t>(sum >> shift);
+    }
+}
+
+uint64_t FlacEncoder::chooseRiceParameters(const int32_t* residual, int numSamples, int order, Subframe& subframe) {
+    // Deepest partition order the block allows
+    int maxPartitionOrder = 0;
+    while (maxPartitionOrder < settings_.maxPartitionOrder &&
+           (numSamples % (2 << maxPartitionOrder)) == 0 &&
+           (numSamples >> (maxPartitionOrder + 1)) > order) {
+        ++maxPartitionOrder;
+    }
+
+    // Per-partition sums of zigzagged residuals at the finest level, merged upward
+    const int finestPartitions = 1 << maxPartitionOrder;
+    const int finestSize = numSamples >> maxPartitionOrder;
+    uint64_t* sums = partitionSums_.data();
+    {
+        int index = 0;
+        for (int p = 0; p < finestPartitions; ++p) {
+            const int count = finestSize - (p == 0 ? order : 0);
+            uint64_t sum = 0;
+            for (int k = 0; k < count; ++k) {
+                sum += zigzag(residual[index++]);
+            }
+            sums[p] = sum;
+        }
+    }
+
+    uint64_t bestBits = UINT64_MAX;
+    int params[1 << MAX_PARTITION_ORDER];
+
+    for (int partitionOrder = maxPartitionOrder; partitionOrder >= 0; --partitionOrder) {
+        const int partitions = 1 << partitionOrder;
+        const int size = numSamples >> partitionOrder;
+        uint64_t bits = 2 + 4;
+        int maxParam = 0;
+
+        for (int p = 0; p < partitions; ++p) {
+            const uint64_t count = static_cast<uint64_t>(size - (p == 0 ? order : 0));
+            const uint64_t sum = sums[p];
+
+            int k = 0;
+            while (k < 30 && (count << (k + 1)) < sum) {
+                ++k;
+            }
+            params[p] = k;
+            maxParam = std::max(maxParam, k);
+            bits += count * (k + 1) + (sum >> k);
+        }
+        bits += static_cast<uint64_t>(partitions) * (maxParam > 14 ? 5 : 4);
+
+        if (bits < bestBits) {
+            bestBits = bits;
+            subframe.partitionOrder = partitionOrder;
+            std::memcpy(subframe.riceParams, params, sizeof(int) * static_cast<size_t>(partitions));
+        }
+
+        // Merge neighbours for the next (coarser) level
+        for (int p = 0; p < partitions / 2; ++p) {
+            sums[p] = sums[2 * p] + sums[2 * p + 1];
+        }
+    }
+
+    return bestBits;
+}
+
+// ============================================================================
+// Bitstream
+// ============================================================================
+
+void FlacEncoder::writeBits(uint32_t value, int numBits) {
+    if (numBits <= 0) {
+        return;
+    }
+
+    const uint64_t mask = (numBits >= 32) ? 0xFFFFFFFFull : ((1ull << numBits) - 1);
+    bitCache_ = (bitCache_ << numBits) | (value & mask);
+    bitCount_ += numBits;
+
+    while (bitCount_ >= 8) {
+        bitCount_ -= 8;
+        if (frameBytes_ == frameBuffer_.size()) {
+            frameBuffer_.resize(frameBuffer_.size() * 2);
+        }
+        frameBuffer_[frameBytes_++] = static_cast<uint8_t>(bitCache_ >> bitCount_);
+    }
+}
+
+void FlacEncoder::writeSignedBits(int32_t value, int numBits) {
+    writeBits(static_cast<uint32_t>(value), numBits);
+}
+
+void FlacEncoder::writeUTF8(uint64_t value) {
+    if (value < 0x80) {
+        writeBits(static_cast<uint32_t>(value), 8);
+        return;
+    }
+
+    // N continuation bytes carry 6 bits each, the lead byte carries 6 - N
+    int continuation = 1;
+    while (continuation < 6 && value >= (1ull << (6 + 5 * continuation))) {
+        ++continuation;
+    }
+
+    const int leadBits = 6 - continuation;
+    const uint32_t leadPrefix = (0xFF00u >> (continuation + 1)) & 0xFFu;
+    const uint32_t leadValue = static_cast<uint32_t>(value >> (6 * continuation)) & ((1u << leadBits) - 1);
+    writeBits(leadPrefix | leadValue, 8);
+    for (int i = continuation - 1; i >= 0; --i) {
+        writeBits(0x80u | static_cast<uint32_t>((value >> (6 * i)) & 0x3F), 8);
+    }
+}
+
+void FlacEncoder::alignToByte() {
+    if (bitCount_ > 0) {
+        writeBits(0, 8 - bitCount_);
+    }
+}
+
+void FlacEncoder::writeSubframe(const int32_t* samples, int numSamples, int bitsPerSample, const Subframe& subframe) {
+    switch (subframe.type) {
+        case Subframe::Type::Constant:
+            writeBits(0x00, 8);
+            writeSignedBits(samples[0], bitsPerSample);
+            break;
+
+        case Subframe::Type::Verbatim:
+            writeBits(0x02, 8);
+            for (int i = 0; i < numSamples; ++i) {
+                writeSignedBits(samples[i], bitsPerSample);
+            }
+            break;
+
+        case Subframe::Type::Fixed:
+            writeBits(static_cast<uint32_t>((8 + subframe.order) << 1), 8);
+            for (int i = 0; i < subframe.order; ++i) {
+                writeSignedBits(samples[i], bitsPerSample);
+            }
+            writeResidual(bestResidual_.data(), numSamples, subframe);
+            break;
+
+        case Subframe::Type::Lpc:
+            writeBits(static_cast<uint32_t>((32 + subframe.order - 1) << 1), 8);
+            for (int i = 0; i < subframe.order; ++i) {
+                writeSignedBits(samples[i], bitsPerSample);
+            }
+            writeBits(static_cast<uint32_t>(subframe.precision - 1), 4);
+            writeSignedBits(subframe.shift, 5);
+            for (int i = 0; i < subframe.order; ++i) {
+                writeSignedBits(subframe.coeffs[i], subframe.precision);
+            }
+            writeResidual(bestResidual_.data(), numSamples, subframe);
+            break;
+    }
+}
+
+void FlacEncoder::writeResidual(const int32_t* residual, int numSamples, const Subframe& subframe) {
+    const int partitions = 1 << subframe.partitionOrder;
+    const int size = numSamples >> subframe.partitionOrder;
+
+    int maxParam = 0;
+    for (int p = 0; p < partitions; ++p) {
+        maxParam = std::max(maxParam, subframe.riceParams[p]);
+    }
+    const bool rice2 = maxParam > 14;
+
+    writeBits(rice2 ? 1u : 0u, 2);
+    writeBits(static_cast<uint32_t>(subframe.partitionOrder), 4);
+
+    int index = 0;
+    for (int p = 0; p < partitions; ++p) {
+        const int k = subframe.riceParams[p];
+        const int count = size - (p == 0 ? subframe.order : 0);
+        writeBits(static_cast<uint32_t>(k), rice2 ? 5 : 4);
+
+        for (int i = 0; i < count; ++i) {
+            const uint32_t value = zigzag(residual[index++]);
+            uint32_t quotient = value >> k;
+
+            // Unary quotient (zeros terminated by a one), then k low bits
+            while (quotient >= 31) {
+                writeBits(0, 31);
+                quotient -= 31;
+            }
+            writeBits(1, static_cast<int>(quotient) + 1);
+            writeBits(value, k);
+        }
+    }
+}
+
+} // namespace VoiceMonitor
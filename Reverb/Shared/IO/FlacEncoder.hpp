@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace VoiceMonitor {
+
+/// Streaming FLAC encoder (fixed block size, 16 or 24-bit)
+/// Per channel it picks the cheapest of constant, fixed (orders 0-4), LPC and
+/// verbatim subframes, chooses the stereo decorrelation mode per frame and codes
+/// residuals with partitioned Rice coding. Autocorrelation and LPC residuals are
+/// SIMD-vectorized (NEON/SSE2). Blocking stdio - run on a worker thread.
+class FlacEncoder {
+public:
+    static constexpr int MAX_CHANNELS = 8;
+    static constexpr int DEFAULT_BLOCK_SIZE = 4096;
+    static constexpr int MAX_LPC_ORDER = 12;
+    static constexpr int MAX_PARTITION_ORDER = 8;
+
+    struct Settings {
+        int numChannels = 2;
+        double sampleRate = 48000.0;
+        int bitsPerSample = 16;         // 16 or 24
+        int blockSize = DEFAULT_BLOCK_SIZE;
+        int maxLpcOrder = 8;            // 0 disables LPC (fixed predictors only)
+        int maxPartitionOrder = 6;
+    };
+
+    FlacEncoder();
+    ~FlacEncoder();
+
+    FlacEncoder(const FlacEncoder&) = delete;
+    FlacEncoder& operator=(const FlacEncoder&) = delete;
+
+    /// Create the file and write the stream header
+    bool open(const std::string& path, const Settings& settings);
+
+    /// Encode one frame; numSamples must equal blockSize except for the last frame
+    /// Samples are integers in the range of bitsPerSample
+    bool encodeFrame(const int32_t* const* channels, int numSamples);
+
+    /// Patch STREAMINFO (total samples, frame sizes) and close
+    bool close();
+
+    /// Lower/raise analysis effort between frames (used by FlacEncoderStage's CPU budget)
+    void setMaxLpcOrder(int order);
+
+    /// Float [-1, 1) to integer sample with rounding and clipping
+    static int32_t floatToSample(float value, int bitsPerSample);
+
+    bool isOpen() const { return file_ != nullptr; }
+    const Settings& getSettings() const { return settings_; }
+    uint64_t getSamplesEncoded() const { return samplesEncoded_; }
+    uint64_t getBytesWritten() const { return bytesWritten_; }
+
+private:
+    // Subframe analysis result
+    struct Subframe {
+        enum class Type { Constant, Verbatim, Fixed, Lpc } type = Type::Verbatim;
+        int order = 0;
+        int precision = 0;
+        int shift = 0;
+        int32_t coeffs[MAX_LPC_ORDER] = {};
+        int partitionOrder = 0;
+        int riceParams[1 << MAX_PARTITION_ORDER] = {};
+        uint64_t bits = 0;
+    };
+
+    // Analysis
+    void analyzeChannel(const int32_t* samples, int numSamples, int bitsPerSample, Subframe& best);
+    uint64_t chooseRiceParameters(const int32_t* residual, int numSamples, int order, Subframe& subframe);
+    void computeFixedResidual(const int32_t* samples, int numSamples, int order, int32_t* residual) const;
+    void computeAutocorrelation(const int32_t* samples, int numSamples, int maxLag, double* autoc);
+    bool quantizeCoefficients(const double* lpc, int order, int precision, Subframe& subframe) const;
+    void computeLpcResidual(const int32_t* samples, int numSamples, const Subframe& subframe,
+                            int bitsPerSample, int32_t* residual) const;
+
+    // Bitstream
+    void writeBits(uint32_t value, int numBits);
+    void writeSignedBits(int32_t value, int numBits);
+    void writeUTF8(uint64_t value);
+    void alignToByte();
+    void writeSubframe(const int32_t* samples, int numSamples, int bitsPerSample, const Subframe& subframe);
+    void writeResidual(const int32_t* residual, int numSamples, const Subframe& subframe);
+    bool writeStreamInfo();
+
+    FILE* file_;
+    Settings settings_;
+    uint64_t frameNumber_;
+    uint64_t samplesEncoded_;
+    uint64_t bytesWritten_;
+    uint32_t minFrameBytes_;
+    uint32_t maxFrameBytes_;
+
+    // Frame bit writer
+    std::vector<uint8_t> frameBuffer_;
+    size_t frameBytes_;
+    uint64_t bitCache_;
+    int bitCount_;
+
+    // Scratch (sized in open, reused every frame)
+    std::vector<int32_t> midSide_[2];          // Stereo decorrelation candidates
+    std::vector<int32_t> residual_;
+    std::vector<int32_t> bestResidual_;
+    std::vector<float> windowed_;
+    std::vector<float> window_;
+    int windowLength_;
+    std::vector<uint64_t> partitionSums_;
+};
+
+} // namespace VoiceMonitor
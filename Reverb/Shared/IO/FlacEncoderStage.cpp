@@ -0,0 +1,251 @@
+#include "FlacEncoderStage.hpp"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr double LOAD_SMOOTHING = 0.1;          // EMA coefficient per frame
+    constexpr int EFFORT_STEP_DOWN = 2;             // LPC orders dropped when over budget
+    constexpr int EFFORT_STEP_UP = 1;
+    constexpr double EFFORT_RECOVERY = 0.5;         // Raise effort again below budget * this
+    constexpr int EFFORT_SETTLE_FRAMES = 16;        // Let the average follow before the next step
+
+    double threadCpuSeconds() {
+        timespec ts;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+    }
+}
+
+FlacEncoderStage::FlacEncoderStage()
+    : lpcOrder_(0)
+    , framesSinceEffortChange_(0)
+    , running_(false)
+    , workerRunning_(false)
+    , encodeError_(false)
+    , cpuBudget_(DEFAULT_CPU_BUDGET)
+    , adaptiveEffort_(true)
+    , framesEncoded_(0)
+    , samplesEncoded_(0)
+    , droppedSamples_(0)
+    , bytesWritten_(0)
+    , averageLoad_(0.0)
+    , peakLoad_(0.0)
+    , workerCpuSeconds_(0.0)
+    , currentLpcOrder_(0) {
+}
+
+FlacEncoderStage::~FlacEncoderStage() {
+    stop();
+}
+
+bool FlacEncoderStage::prepare(const FlacEncoder::Settings& settings, double bufferSeconds) {
+    if (running_.load() || settings.numChannels <= 0 || settings.numChannels > MAX_CHANNELS ||
+        settings.sampleRate <= 0.0 || settings.blockSize <= 0) {
+        return false;
+    }
+
+    settings_ = settings;
+
+    // Ring must hold at least two encoder blocks
+    const size_t capacity = std::max(static_cast<size_t>(std::max(bufferSeconds, 0.1) * settings.sampleRate),
+                                     static_cast<size_t>(settings.blockSize) * 2);
+    for (int ch = 0; ch < settings_.numChannels; ++ch) {
+        rings_[ch].resize(capacity);
+        sampleScratch_[ch].resize(settings_.blockSize);
+    }
+    return true;
+}
+
+bool FlacEncoderStage::start(const std::string& path) {
+    if (running_.load() || sampleScratch_[0].empty()) {
+        return false;
+    }
+
+    if (!encoder_.open(path, settings_)) {
+        return false;
+    }
+
+    for (int ch = 0; ch < settings_.numChannels; ++ch) {
+        rings_[ch].clear();
+    }
+
+    lpcOrder_ = encoder_.getSettings().maxLpcOrder;
+    framesSinceEffortChange_ = 0;
+    framesEncoded_.store(0);
+    samplesEncoded_.store(0);
+    droppedSamples_.store(0);
+    bytesWritten_.store(encoder_.getBytesWritten());
+    averageLoad_.store(0.0);
+    peakLoad_.store(0.0);
+    workerCpuSeconds_.store(0.0);
+    currentLpcOrder_.store(lpcOrder_);
+    encodeError_.store(false);
+
+    workerRunning_.store(true);
+    worker_ = std::thread(&FlacEncoderStage::workerLoop, this);
+
+    running_.store(true, std::memory_order_release);
+    return true;
+}
+
+bool FlacEncoderStage::stop() {
+    if (!running_.exchange(false) && !worker_.joinable()) {
+        return true;
+    }
+
+    workerRunning_.store(false);
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+
+    // Everything pushed before running_ went false, including a short final frame
+    encodeAvailable(true);
+
+    bool success = !encodeError_.load();
+    success = encoder_.close() && success;
+    return success;
+}
+
+void FlacEncoderStage::setCpuBudget(double budget, bool adaptiveEffort) {
+    cpuBudget_.store(std::max(budget, 0.0), std::memory_order_relaxed);
+    adaptiveEffort_.store(adaptiveEffort, std::memory_order_relaxed);
+}
+
+FlacEncoderStage::Statistics FlacEncoderStage::getStatistics() const {
+    Statistics stats;
+    stats.framesEncoded = framesEncoded_.load(std::memory_order_relaxed);
+    stats.samplesEncoded = samplesEncoded_.load(std::memory_order_relaxed);
+    stats.droppedSamples = droppedSamples_.load(std::memory_order_relaxed);
+    stats.bytesWritten = bytesWritten_.load(std::memory_order_relaxed);
+    stats.averageLoad = averageLoad_.load(std::memory_order_relaxed);
+    stats.peakLoad = peakLoad_.load(std::memory_order_relaxed);
+    stats.workerCpuSeconds = workerCpuSeconds_.load(std::memory_order_relaxed);
+    stats.currentLpcOrder = currentLpcOrder_.load(std::memory_order_relaxed);
+
+    const double pcmBytes = static_cast<double>(stats.samplesEncoded) * settings_.numChannels *
+                            (settings_.bitsPerSample / 8);
+    stats.compressionRatio = pcmBytes > 0.0 ? static_cast<double>(stats.bytesWritten) / pcmBytes : 0.0;
+    return stats;
+}
+
+// ============================================================================
+// Audio thread
+// ============================================================================
+
+bool FlacEncoderStage::pushBlock(const float* const* channels, int numChannels, int numSamples) {
+    if (!running_.load(std::memory_order_acquire) || numSamples <= 0 || numChannels <= 0) {
+        return false;
+    }
+
+    // All-or-nothing so the channels stay aligned
+    const size_t required = static_cast<size_t>(numSamples);
+    for (int ch = 0; ch < settings_.numChannels; ++ch) {
+        if (rings_[ch].freeSpace() < required) {
+            droppedSamples_.fetch_add(required, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    for (int ch = 0; ch < settings_.numChannels; ++ch) {
+        rings_[ch].write(channels[std::min(ch, numChannels - 1)], required);
+    }
+    return true;
+}
+
+// ============================================================================
+// Worker thread
+// ============================================================================
+
+void FlacEncoderStage::workerLoop() {
+    // Poll at a quarter block so the ring never fills while the worker sleeps
+    const auto idleWait = std::chrono::microseconds(
+        static_cast<int64_t>(250000.0 * settings_.blockSize / settings_.sampleRate));
+
+    while (workerRunning_.load(std::memory_order_relaxed)) {
+        if (!encodeAvailable(false)) {
+            std::this_thread::sleep_for(idleWait);
+        }
+    }
+}
+
+bool FlacEncoderStage::encodeAvailable(bool flush) {
+    bool encodedAny = false;
+
+    for (;;) {
+        size_t frames = static_cast<size_t>(settings_.blockSize);
+        for (int ch = 0; ch < settings_.numChannels; ++ch) {
+            frames = std::min(frames, rings_[ch].available());
+        }
+
+        // Only whole blocks while running; the final short frame is written at stop
+        if (frames == 0 || (!flush && frames < static_cast<size_t>(settings_.blockSize))) {
+            return encodedAny;
+        }
+
+        const double cpuStart = threadCpuSeconds();
+
+        const int32_t* channelData[MAX_CHANNELS];
+        for (int ch = 0; ch < settings_.numChannels; ++ch) {
+            // Quantize straight out of the ring memory
+            const AudioBuffer<float>::ReadSpan span = rings_[ch].acquireRead(frames);
+            int32_t* samples = sampleScratch_[ch].data();
+            for (size_t i = 0; i < span.firstSize; ++i) {
+                samples[i] = FlacEncoder::floatToSample(span.first[i], settings_.bitsPerSample);
+            }
+            for (size_t i = 0; i < span.secondSize; ++i) {
+                samples[span.firstSize + i] = FlacEncoder::floatToSample(span.second[i], settings_.bitsPerSample);
+            }
+            rings_[ch].commitRead(span.size());
+            channelData[ch] = samples;
+        }
+
+        if (!encoder_.encodeFrame(channelData, static_cast<int>(frames))) {
+            encodeError_.store(true, std::memory_order_relaxed);
+        }
+
+        const double cpuEnd = threadCpuSeconds();
+        updateLoad(cpuEnd - cpuStart, static_cast<int>(frames));
+
+        framesEncoded_.fetch_add(1, std::memory_order_relaxed);
+        samplesEncoded_.store(encoder_.getSamplesEncoded(), std::memory_order_relaxed);
+        bytesWritten_.store(encoder_.getBytesWritten(), std::memory_order_relaxed);
+        workerCpuSeconds_.store(workerCpuSeconds_.load(std::memory_order_relaxed) + (cpuEnd - cpuStart),
+                                std::memory_order_relaxed);
+        encodedAny = true;
+    }
+}
+
+void FlacEncoderStage::updateLoad(double encodeSeconds, int numSamples) {
+    const double audioSeconds = numSamples / settings_.sampleRate;
+    const double load = encodeSeconds / audioSeconds;
+
+    double average = averageLoad_.load(std::memory_order_relaxed);
+    average = (average == 0.0) ? load : average + LOAD_SMOOTHING * (load - average);
+    averageLoad_.store(average, std::memory_order_relaxed);
+    peakLoad_.store(std::max(peakLoad_.load(std::memory_order_relaxed), load), std::memory_order_relaxed);
+
+    if (!adaptiveEffort_.load(std::memory_order_relaxed) || ++framesSinceEffortChange_ < EFFORT_SETTLE_FRAMES) {
+        return;
+    }
+
+    // Trade compression for time: LPC analysis dominates the encode cost
+    const double budget = cpuBudget_.load(std::memory_order_relaxed);
+    int order = lpcOrder_;
+    if (average > budget && order > 0) {
+        order = std::max(0, order - EFFORT_STEP_DOWN);
+    } else if (average < budget * EFFORT_RECOVERY && order < settings_.maxLpcOrder) {
+        order = std::min(settings_.maxLpcOrder, order + EFFORT_STEP_UP);
+    }
+
+    if (order != lpcOrder_) {
+        lpcOrder_ = order;
+        encoder_.setMaxLpcOrder(order);
+        currentLpcOrder_.store(order, std::memory_order_relaxed);
+        framesSinceEffortChange_ = 0;
+    }
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AudioBuffer.hpp"
+#include "FlacEncoder.hpp"
+
+namespace VoiceMonitor {
+
+/// Real-time FLAC recording stage
+///
+/// The audio thread pushes float blocks into per-channel SPSC rings (a copy and
+/// two index updates, nothing else); a worker thread pulls full FLAC blocks,
+/// quantizes them and runs FlacEncoder. The audio thread is never back-pressured:
+/// when the rings cannot take a whole block it is dropped and counted.
+///
+/// The worker measures its own CPU budget - encode time relative to the audio
+/// time it covers - and, when adaptive effort is enabled, lowers the LPC order
+/// while the load stays above the budget and restores it once it recovers.
+class FlacEncoderStage {
+public:
+    static constexpr int MAX_CHANNELS = 2;
+    static constexpr double DEFAULT_BUFFER_SECONDS = 4.0;
+    static constexpr double DEFAULT_CPU_BUDGET = 0.25;     // Fraction of one core
+
+    struct Statistics {
+        uint64_t framesEncoded = 0;         // FLAC frames
+        uint64_t samplesEncoded = 0;        // Per channel
+        uint64_t droppedSamples = 0;        // Per channel, rejected by pushBlock
+        uint64_t bytesWritten = 0;
+        double averageLoad = 0.0;           // Encode time / audio time (smoothed)
+        double peakLoad = 0.0;              // Worst single frame
+        double compressionRatio = 0.0;      // Encoded size / PCM size
+        double workerCpuSeconds = 0.0;      // Thread CPU time of the worker
+        int currentLpcOrder = 0;
+    };
+
+public:
+    FlacEncoderStage();
+    ~FlacEncoderStage();
+
+    FlacEncoderStage(const FlacEncoderStage&) = delete;
+    FlacEncoderStage& operator=(const FlacEncoderStage&) = delete;
+
+    /// Allocate rings and scratch (not real-time safe)
+    bool prepare(const FlacEncoder::Settings& settings, double bufferSeconds = DEFAULT_BUFFER_SECONDS);
+
+    /// Open the output file and start the worker
+    bool start(const std::string& path);
+
+    /// Stop accepting audio, encode everything still buffered and finalize the file
+    bool stop();
+
+    bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+    /// Audio thread: queue one block (wait-free, no allocation)
+    /// Mono input feeds every encoder channel
+    /// @return false if the block was dropped (stage stopped or rings full)
+    bool pushBlock(const float* const* channels, int numChannels, int numSamples);
+
+    /// CPU budget as a fraction of one core; adaptive effort trades compression for time
+    void setCpuBudget(double budget, bool adaptiveEffort = true);
+
+    /// Snapshot of the worker's counters (any thread)
+    Statistics getStatistics() const;
+    bool hasEncodeError() const { return encodeError_.load(std::memory_order_relaxed); }
+
+private:
+    void workerLoop();
+    bool encodeAvailable(bool flush);
+    void updateLoad(double encodeSeconds, int numSamples);
+
+    FlacEncoder encoder_;
+    FlacEncoder::Settings settings_;
+
+    // Audio thread -> worker
+    AudioBuffer<float> rings_[MAX_CHANNELS];
+
+    // Worker-owned
+    std::vector<int32_t> sampleScratch_[MAX_CHANNELS];
+    std::thread worker_;
+    int lpcOrder_;
+    int framesSinceEffortChange_;
+
+    std::atomic<bool> running_;
+    std::atomic<bool> workerRunning_;
+    std::atomic<bool> encodeError_;
+    std::atomic<double> cpuBudget_;
+    std::atomic<bool> adaptiveEffort_;
+
+    // Published by the worker
+    std::atomic<uint64_t> framesEncoded_;
+    std::atomic<uint64_t> samplesEncoded_;
+    std::atomic<uint64_t> droppedSamples_;
+    std::atomic<uint64_t> bytesWritten_;
+    std::atomic<double> averageLoad_;
+    std::atomic<double> peakLoad_;
+    std::atomic<double> workerCpuSeconds_;
+    std::atomic<int> currentLpcOrder_;
+};
+
+} // namespace VoiceMonitor
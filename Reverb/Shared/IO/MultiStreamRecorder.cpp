@@ -0,0 +1,231 @@
+#include "MultiStreamRecorder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace VoiceMonitor {
+
+MultiStreamRecorder::MultiStreamRecorder()
+    : sampleRate_(0.0)
+    , numChannels_(0)
+    , streamMask_(0)
+    , recording_(false)
+    , writerRunning_(false)
+    , writeError_(false)
+    , capturedFrames_(0)
+    , droppedFrames_(0)
+    , writtenFrames_(0) {
+    for (int& fileId : fileIds_) {
+        fileId = -1;
+    }
+}
+
+MultiStreamRecorder::~MultiStreamRecorder() {
+    stop();
+}
+
+const char* MultiStreamRecorder::getStreamName(Stream stream) {
+    switch (stream) {
+        case Stream::Dry: return "dry";
+        case Stream::Wet: return "wet";
+        case Stream::Mix: return "mix";
+    }
+    return "unknown";
+}
+
+bool MultiStreamRecorder::prepare(double sampleRate, int numChannels, double bufferSeconds) {
+    if (recording_.load() || sampleRate <= 0.0 || numChannels <= 0 || numChannels > MAX_CHANNELS) {
+        return false;
+    }
+
+    sampleRate_ = sampleRate;
+    numChannels_ = numChannels;
+
+    const size_t capacity = static_cast<size_t>(std::max(bufferSeconds, 0.1) * sampleRate);
+    for (int stream = 0; stream < NUM_STREAMS; ++stream) {
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            rings_[stream][ch].resize(capacity);
+        }
+    }
+
+    if (!fileWriter_.initialize(NUM_STREAMS, WRITE_QUEUE_DEPTH)) {
+        return false;
+    }
+
+    interleavedScratch_.resize(static_cast<size_t>(DRAIN_FRAMES) * numChannels_);
+    return true;
+}
+
+bool MultiStreamRecorder::start(const std::string& basePath, uint32_t streamMask) {
+    if (recording_.load() || numChannels_ == 0 || (streamMask & AllStreams) == 0) {
+        return false;
+    }
+
+    streamMask_ = streamMask & AllStreams;
+
+    for (int stream = 0; stream < NUM_STREAMS; ++stream) {
+        if (!isEnabled(stream)) {
+            continue;
+        }
+        const std::string path = basePath + "_" + getStreamName(static_cast<Stream>(stream)) + ".wav";
+        fileIds_[stream] = fileWriter_.openFile(path, numChannels_, sampleRate_);
+        if (fileIds_[stream] < 0) {
+            for (int& fileId : fileIds_) {
+                if (fileId >= 0) {
+                    fileWriter_.closeFile(fileId);
+                    fileId = -1;
+                }
+            }
+            return false;
+        }
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            rings_[stream][ch].clear();
+        }
+    }
+
+    capturedFrames_.store(0);
+    droppedFrames_.store(0);
+    writtenFrames_.store(0);
+    writeError_.store(false);
+
+    writerRunning_.store(true);
+    writer_ = std::thread(&MultiStreamRecorder::writerLoop, this);
+
+    recording_.store(true, std::memory_order_release);
+    return true;
+}
+
+bool MultiStreamRecorder::stop() {
+    if (!recording_.exchange(false) && !writer_.joinable()) {
+        return true;
+    }
+
+    writerRunning_.store(false);
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+
+    // Flush whatever the audio thread captured before recording_ went false
+    while (drainOnce() > 0) {
+    }
+
+    bool success = !writeError_.load();
+    for (int& fileId : fileIds_) {
+        if (fileId >= 0) {
+            success = fileWriter_.closeFile(fileId) && success;
+            fileId = -1;
+        }
+    }
+    return success;
+}
+
+// ============================================================================
+// Audio thread
+// ============================================================================
+
+void MultiStreamRecorder::captureBlock(const float* const* dry, const float* const* wet,
+                                       const float* const* mix, int numChannels, int numSamples) {
+    if (!recording_.load(std::memory_order_acquire) || numSamples <= 0 || numChannels <= 0) {
+        return;
+    }
+
+    // All-or-nothing: only capture if every enabled ring can take the whole block
+    const size_t required = static_cast<size_t>(numSamples);
+    for (int stream = 0; stream < NUM_STREAMS; ++stream) {
+        if (!isEnabled(stream)) continue;
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            if (rings_[stream][ch].freeSpace() < required) {
+                droppedFrames_.fetch_add(required, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    const float* const* sources[NUM_STREAMS] = { dry, wet, mix };
+    for (int stream = 0; stream < NUM_STREAMS; ++stream) {
+        if (!isEnabled(stream)) continue;
+
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            AudioBuffer<float>& ring = rings_[stream][ch];
+
+            if (sources[stream]) {
+                // Mono engine output feeds every file channel
+                ring.write(sources[stream][std::min(ch, numChannels - 1)], required);
+            } else {
+                // Zero the ring in place, no silence source buffer needed
+                const AudioBuffer<float>::WriteSpan span = ring.acquireWrite(required);
+                std::memset(span.first, 0, span.firstSize * sizeof(float));
+                if (span.secondSize > 0) {
+                    std::memset(span.second, 0, span.secondSize * sizeof(float));
+                }
+                ring.commitWrite(span.size());
+            }
+        }
+    }
+
+    capturedFrames_.fetch_add(required, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Writer thread
+// ============================================================================
+
+void MultiStreamRecorder::writerLoop() {
+    // Wake roughly every 10ms - well inside the ring headroom
+    const auto idleWait = std::chrono::milliseconds(10);
+
+    while (writerRunning_.load(std::memory_order_relaxed)) {
+        if (drainOnce() == 0) {
+            std::this_thread::sleep_for(idleWait);
+        }
+    }
+}
+
+int MultiStreamRecorder::drainOnce() {
+    // Rings are published independently, so only drain what every enabled ring
+    // already holds - this keeps the streams sample-aligned on disk
+    size_t frames = DRAIN_FRAMES;
+    for (int stream = 0; stream < NUM_STREAMS; ++stream) {
+        if (!isEnabled(stream)) continue;
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            frames = std::min(frames, rings_[stream][ch].available());
+        }
+    }
+
+    if (frames == 0) {
+        return 0;
+    }
+
+    for (int stream = 0; stream < NUM_STREAMS; ++stream) {
+        if (!isEnabled(stream)) continue;
+
+        // Interleave straight out of the ring memory (no planar copy)
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            AudioBuffer<float>& ring = rings_[stream][ch];
+            const AudioBuffer<float>::ReadSpan span = ring.acquireRead(frames);
+
+            float* interleaved = interleavedScratch_.data() + ch;
+            for (size_t i = 0; i < span.firstSize; ++i, interleaved += numChannels_) {
+                *interleaved = span.first[i];
+            }
+            for (size_t i = 0; i < span.secondSize; ++i, interleaved += numChannels_) {
+                *interleaved = span.second[i];
+            }
+            ring.commitRead(span.size());
+        }
+
+        if (!fileWriter_.write(fileIds_[stream], interleavedScratch_.data(), static_cast<int>(frames))) {
+            writeError_.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    // One batched submission for all streams
+    if (!fileWriter_.submit()) {
+        writeError_.store(true, std::memory_order_relaxed);
+    }
+
+    writtenFrames_.fetch_add(frames, std::memory_order_relaxed);
+    return static_cast<int>(frames);
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AudioBuffer.hpp"
+#include "AsyncRecordingWriter.hpp"
+
+namespace VoiceMonitor {
+
+/// Records dry, wet and mix from a single ReverbEngine::processBlock call
+///
+/// The engine hands its own dry/wet/mix buffers to captureBlock() on the audio
+/// thread; samples go straight into per-stream, per-channel SPSC rings (the only
+/// copy on the audio thread) and one writer thread drains every stream to disk
+/// through an AsyncRecordingWriter (io_uring on Linux, pwrite thread elsewhere).
+/// A block is either captured for all enabled streams or dropped for all of them,
+/// so the three files stay sample-aligned even under disk stalls.
+class MultiStreamRecorder {
+public:
+    static constexpr int MAX_CHANNELS = 2;
+    static constexpr int NUM_STREAMS = 3;
+    static constexpr int DRAIN_FRAMES = 4096;       // Frames per writer iteration
+    static constexpr double DEFAULT_BUFFER_SECONDS = 2.0;
+    static constexpr int WRITE_QUEUE_DEPTH = 16;     // 1 MB writes in flight
+
+    enum class Stream {
+        Dry = 0,
+        Wet = 1,
+        Mix = 2
+    };
+
+    /// Stream selection (mirrors WetDryRecordingManager.RecordingMode)
+    enum StreamMask : uint32_t {
+        DryStream = 1u << 0,
+        WetStream = 1u << 1,
+        MixStream = 1u << 2,
+        AllStreams = DryStream | WetStream | MixStream
+    };
+
+public:
+    MultiStreamRecorder();
+    ~MultiStreamRecorder();
+
+    MultiStreamRecorder(const MultiStreamRecorder&) = delete;
+    MultiStreamRecorder& operator=(const MultiStreamRecorder&) = delete;
+
+    /// Allocate rings (not real-time safe)
+    bool prepare(double sampleRate, int numChannels, double bufferSeconds = DEFAULT_BUFFER_SECONDS);
+
+    /// Open <basePath>_dry.wav / _wet.wav / _mix.wav for the selected streams and start the writer
+    bool start(const std::string& basePath, uint32_t streamMask = AllStreams);
+
+    /// Stop capturing, drain everything still buffered and finalize the files
+    bool stop();
+
+    bool isRecording() const { return recording_.load(std::memory_order_acquire); }
+
+    /// Audio thread: capture one block (wait-free, no allocation)
+    /// A null stream pointer records silence for that stream (e.g. wet while bypassed)
+    void captureBlock(const float* const* dry, const float* const* wet, const float* const* mix,
+                      int numChannels, int numSamples);
+
+    // Statistics
+    uint64_t getCapturedFrames() const { return capturedFrames_.load(std::memory_order_relaxed); }
+    uint64_t getDroppedFrames() const { return droppedFrames_.load(std::memory_order_relaxed); }
+    uint64_t getWrittenFrames() const { return writtenFrames_.load(std::memory_order_relaxed); }
+    bool hasWriteError() const { return writeError_.load(std::memory_order_relaxed); }
+    AsyncRecordingWriter::Backend getWriterBackend() const { return fileWriter_.getBackend(); }
+
+    static const char* getStreamName(Stream stream);
+
+private:
+    void writerLoop();
+    int drainOnce();
+    bool isEnabled(int stream) const { return (streamMask_ & (1u << stream)) != 0; }
+
+    double sampleRate_;
+    int numChannels_;
+    uint32_t streamMask_;
+
+    // rings_[stream][channel], written by the audio thread, read by the writer
+    AudioBuffer<float> rings_[NUM_STREAMS][MAX_CHANNELS];
+
+    // Writer-owned
+    AsyncRecordingWriter fileWriter_;
+    int fileIds_[NUM_STREAMS];
+    std::vector<float> interleavedScratch_;
+    std::thread writer_;
+
+    std::atomic<bool> recording_;
+    std::atomic<bool> writerRunning_;
+    std::atomic<bool> writeError_;
+    std::atomic<uint64_t> capturedFrames_;
+    std::atomic<uint64_t> droppedFrames_;
+    std::atomic<uint64_t> writtenFrames_;
+};
+
+} // namespace VoiceMonitor
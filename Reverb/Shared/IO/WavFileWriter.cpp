@@ -0,0 +1,78 @@
+#include "WavFileWriter.hpp"
+#include "WavFormat.hpp"
+
+namespace VoiceMonitor {
+
+WavFileWriter::WavFileWriter()
+    : file_(nullptr)
+    , numChannels_(0)
+    , sampleRate_(0.0)
+    , framesWritten_(0) {
+}
+
+WavFileWriter::~WavFileWriter() {
+    close();
+}
+
+bool WavFileWriter::open(const std::string& path, int numChannels, double sampleRate) {
+    close();
+
+    if (numChannels <= 0 || sampleRate <= 0.0) {
+        return false;
+    }
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        return false;
+    }
+
+    // Large stdio buffer: one write syscall per MB instead of per block
+    std::setvbuf(file_, nullptr, _IOFBF, STDIO_BUFFER_BYTES);
+
+    numChannels_ = numChannels;
+    sampleRate_ = sampleRate;
+    framesWritten_ = 0;
+
+    if (!writeHeader()) {
+        std::fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool WavFileWriter::write(const float* interleaved, int numFrames) {
+    if (!file_ || numFrames <= 0) {
+        return file_ != nullptr;
+    }
+
+    // WAVE is little-endian, as are all supported targets
+    const size_t samples = static_cast<size_t>(numFrames) * numChannels_;
+    if (std::fwrite(interleaved, sizeof(float), samples, file_) != samples) {
+        return false;
+    }
+
+    framesWritten_ += static_cast<uint64_t>(numFrames);
+    return true;
+}
+
+bool WavFileWriter::close() {
+    if (!file_) {
+        return true;
+    }
+
+    bool success = std::fflush(file_) == 0;
+    success = std::fseek(file_, 0, SEEK_SET) == 0 && writeHeader() && success;
+    success = std::fclose(file_) == 0 && success;
+    file_ = nullptr;
+    return success;
+}
+
+bool WavFileWriter::writeHeader() {
+    uint8_t header[WavFormat::FLOAT_HEADER_SIZE];
+    const uint64_t dataBytes = framesWritten_ * static_cast<uint64_t>(numChannels_) * sizeof(float);
+    WavFormat::writeFloatHeader(header, numChannels_, sampleRate_, dataBytes);
+    return std::fwrite(header, 1, sizeof(header), file_) == sizeof(header);
+}
+
+} // namespace VoiceMonitor
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace VoiceMonitor {
+
+/// Buffered 32-bit float WAV writer (RF64 once a file passes 4 GB)
+/// Blocking stdio - use from a writer thread, never from the audio thread.
+class WavFileWriter {
+public:
+    static constexpr size_t STDIO_BUFFER_BYTES = 1 << 20;
+
+    WavFileWriter();
+    ~WavFileWriter();
+
+    WavFileWriter(const WavFileWriter&) = delete;
+    WavFileWriter& operator=(const WavFileWriter&) = delete;
+
+    /// Create the file and write a placeholder header
+    bool open(const std::string& path, int numChannels, double sampleRate);
+
+    /// Append interleaved frames
+    bool write(const float* interleaved, int numFrames);
+
+    /// Patch the header with the final size and close the file
+    bool close();
+
+    bool isOpen() const { return file_ != nullptr; }
+    uint64_t getFramesWritten() const { return framesWritten_; }
+
+private:
+    bool writeHeader();
+
+    FILE* file_;
+    int numChannels_;
+    double sampleRate_;
+    uint64_t framesWritten_;
+};
+
+} // namespace VoiceMonitor
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace VoiceMonitor {
+
+/// RIFF/RF64 WAVE container helpers shared by the file reader and writers
+/// RF64 (EBU Tech 3306) lifts the 4 GB RIFF limit for multi-hour sessions
+namespace WavFormat {
+
+    // Format tags
+    constexpr uint16_t FORMAT_PCM = 0x0001;
+    constexpr uint16_t FORMAT_IEEE_FLOAT = 0x0003;
+    constexpr uint16_t FORMAT_EXTENSIBLE = 0xFFFE;
+
+    /// Sample encodings supported by the reader
+    enum class SampleFormat {
+        Int16,
+        Int24,
+        Int32,
+        Float32,
+        Float64,
+        Unsupported
+    };
+
+    /// Parsed stream description
+    struct Info {
+        bool isRF64 = false;
+        int numChannels = 0;
+        double sampleRate = 0.0;
+        int bitsPerSample = 0;
+        int bytesPerFrame = 0;
+        SampleFormat sampleFormat = SampleFormat::Unsupported;
+        uint64_t dataOffset = 0;    // Byte offset of first sample
+        uint64_t dataBytes = 0;     // Size of sample data in bytes
+        uint64_t numFrames = 0;     // dataBytes / bytesPerFrame
+    };
+
+    /// Little-endian readers (WAVE is always little-endian)
+    inline uint16_t readLE16(const uint8_t* p) {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    inline uint32_t readLE32(const uint8_t* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    inline uint64_t readLE64(const uint8_t* p) {
+        return static_cast<uint64_t>(readLE32(p)) | (static_cast<uint64_t>(readLE32(p + 4)) << 32);
+    }
+
+    /// Parse RIFF/RF64 header chunks from the start of a mapped file
+    /// Returns false if the container is malformed or the encoding is unsupported
+    inline bool parseHeader(const uint8_t* data, size_t size, Info& info) {
+        info = Info();
+        if (size < 12) return false;
+
+        if (std::memcmp(data, "RIFF", 4) == 0) {
+            info.isRF64 = false;
+        } else if (std::memcmp(data, "RF64", 4) == 0) {
+            info.isRF64 = true;
+        } else {
+            return false;
+        }
+        if (std::memcmp(data + 8, "WAVE", 4) != 0) return false;
+
+        uint64_t rf64DataSize = 0;
+        bool haveFormat = false;
+        uint16_t formatTag = 0;
+        size_t pos = 12;
+
+        while (pos + 8 <= size) {
+            const uint8_t* chunk = data + pos;
+            uint64_t chunkSize = readLE32(chunk + 4);
+            const size_t body = pos + 8;
+
+            if (std::memcmp(chunk, "ds64", 4) == 0 && chunkSize >= 16 && body + 16 <= size) {
+                // ds64: riffSize(8), dataSize(8), sampleCount(8), table...
+                rf64DataSize = readLE64(data + body + 8);
+            } else if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16 && body + 16 <= size) {
+                formatTag = readLE16(data + body);
+                info.numChannels = readLE16(data + body + 2);
+                info.sampleRate = static_cast<double>(readLE32(data + body + 4));
+                info.bytesPerFrame = readLE16(data + body + 12);
+                info.bitsPerSample = readLE16(data + body + 14);
+
+                // WAVE_FORMAT_EXTENSIBLE carries the real tag in the sub-format GUID
+                if (formatTag == FORMAT_EXTENSIBLE && chunkSize >= 40 && body + 40 <= size) {
+                    formatTag = readLE16(data + body + 24);
+                }
+                haveFormat = true;
+            } else if (std::memcmp(chunk, "data", 4) == 0) {
+                if (!haveFormat) return false;
+
+                info.dataOffset = body;
+                if (info.isRF64 && chunkSize == 0xFFFFFFFFu) {
+                    chunkSize = rf64DataSize;
+                }
+                // Truncated recordings: clamp to what is actually on disk
+                info.dataBytes = (body + chunkSize <= size) ? chunkSize : size - body;
+                break;
+            }
+
+            // Chunks are word-aligned
+            pos = body + static_cast<size_t>(chunkSize) + (chunkSize & 1);
+        }
+
+        if (!haveFormat || info.dataOffset == 0 || info.numChannels <= 0 || info.bytesPerFrame <= 0) {
+            return false;
+        }
+
+        if (formatTag == FORMAT_PCM) {
+            switch (info.bitsPerSample) {
+                case 16: info.sampleFormat = SampleFormat::Int16; break;
+                case 24: info.sampleFormat = SampleFormat::Int24; break;
+                case 32: info.sampleFormat = SampleFormat::Int32; break;
+                default: info.sampleFormat = SampleFormat::Unsupported; break;
+            }
+        } else if (formatTag == FORMAT_IEEE_FLOAT) {
+            switch (info.bitsPerSample) {
+                case 32: info.sampleFormat = SampleFormat::Float32; break;
+                case 64: info.sampleFormat = SampleFormat::Float64; break;
+                default: info.sampleFormat = SampleFormat::Unsupported; break;
+            }
+        }
+
+        if (info.sampleFormat == SampleFormat::Unsupported) {
+            return false;
+        }
+
+        // Readers step through the data by bytesPerFrame and decode numChannels
+        // samples per frame: any other block align would run past the data chunk
+        if (info.bytesPerFrame != info.numChannels * ((info.bitsPerSample + 7) / 8)) {
+            return false;
+        }
+
+        info.numFrames = info.dataBytes / static_cast<uint64_t>(info.bytesPerFrame);
+        return true;
+    }
+
+    // ========================================================================
+    // Writing
+    // ========================================================================
+
+    /// Minimum header size written by writeFloatHeader()
+    /// RIFF(12) + JUNK/ds64(36) + fmt(24) + data(8): the JUNK chunk is the same
+    /// size as ds64, so a recording can be promoted to RF64 in place
+    constexpr size_t FLOAT_HEADER_SIZE = 80;
+
+    inline void writeLE16(uint8_t* p, uint16_t value) {
+        p[0] = static_cast<uint8_t>(value);
+        p[1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    inline void writeLE32(uint8_t* p, uint32_t value) {
+        for (int i = 0; i < 4; ++i) p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    inline void writeLE64(uint8_t* p, uint64_t value) {
+        writeLE32(p, static_cast<uint32_t>(value));
+        writeLE32(p + 4, static_cast<uint32_t>(value >> 32));
+    }
+
+    /// Build a 32-bit float header describing dataBytes of interleaved samples
+    /// Switches to RF64 automatically once the data no longer fits in RIFF.
+    /// headerSize > FLOAT_HEADER_SIZE (at least 88) inserts a padding chunk so sample
+    /// data starts at an aligned file offset (e.g. 4096 for page-aligned writes).
+    inline void writeFloatHeader(uint8_t* out, int numChannels, double sampleRate, uint64_t dataBytes,
+                                 size_t headerSize = FLOAT_HEADER_SIZE) {
+        const uint32_t bytesPerFrame = static_cast<uint32_t>(numChannels) * 4;
+        const uint64_t riffSize = dataBytes + headerSize - 8;
+        const bool rf64 = riffSize > 0xFFFFFFFFull;
+
+        std::memset(out, 0, headerSize);
+        std::memcpy(out, rf64 ? "RF64" : "RIFF", 4);
+        writeLE32(out + 4, rf64 ? 0xFFFFFFFFu : static_cast<uint32_t>(riffSize));
+        std::memcpy(out + 8, "WAVE", 4);
+
+        // ds64 (or JUNK placeholder of identical size)
+        std::memcpy(out + 12, rf64 ? "ds64" : "JUNK", 4);
+        writeLE32(out + 16, 28);
+        if (rf64) {
+            writeLE64(out + 20, riffSize);
+            writeLE64(out + 28, dataBytes);
+            writeLE64(out + 36, dataBytes / bytesPerFrame);
+            writeLE32(out + 44, 0);  // No table entries
+        }
+
+        std::memcpy(out + 48, "fmt ", 4);
+        writeLE32(out + 52, 16);
+        writeLE16(out + 56, FORMAT_IEEE_FLOAT);
+        writeLE16(out + 58, static_cast<uint16_t>(numChannels));
+        writeLE32(out + 60, static_cast<uint32_t>(sampleRate));
+        writeLE32(out + 64, static_cast<uint32_t>(sampleRate) * bytesPerFrame);
+        writeLE16(out + 68, static_cast<uint16_t>(bytesPerFrame));
+        writeLE16(out + 70, 32);
+
+        // Optional padding chunk up to the aligned data offset
+        size_t dataChunk = 72;
+        if (headerSize >= FLOAT_HEADER_SIZE + 8) {
+            std::memcpy(out + 72, "JUNK", 4);
+            writeLE32(out + 76, static_cast<uint32_t>(headerSize - FLOAT_HEADER_SIZE - 8));
+            dataChunk = headerSize - 8;
+        }
+
+        std::memcpy(out + dataChunk, "data", 4);
+        writeLE32(out + dataChunk + 4, rf64 ? 0xFFFFFFFFu : static_cast<uint32_t>(dataBytes));
+    }
+
+} // namespace WavFormat
+} // namespace VoiceMonitor
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cerrno>
+
+#ifdef __APPLE__
+#include <dispatch/dispatch.h>
+#else
+#include <semaphore.h>
+#endif
+
+namespace VoiceMonitor {
+
+/// Primitives for handing work between the audio thread and helper threads
+namespace ThreadSync {
+
+    /// Spin-wait hint: lets the sibling hyperthread run and saves power
+    inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#endif
+    }
+
+    /// Counting semaphore a helper blocks on once its idle spin runs out.
+    /// post() is a single futex/Mach call and safe from the audio thread.
+    class WakeSignal {
+    public:
+#ifdef __APPLE__
+        WakeSignal() : semaphore_(dispatch_semaphore_create(0)) {}
+        ~WakeSignal() { dispatch_release(semaphore_); }
+        void post() { dispatch_semaphore_signal(semaphore_); }
+        void wait() { dispatch_semaphore_wait(semaphore_, DISPATCH_TIME_FOREVER); }
+    private:
+        dispatch_semaphore_t semaphore_;
+#else
+        WakeSignal() { sem_init(&semaphore_, 0, 0); }
+        ~WakeSignal() { sem_destroy(&semaphore_); }
+        void post() { sem_post(&semaphore_); }
+        void wait() { while (sem_wait(&semaphore_) != 0 && errno == EINTR) {} }
+    private:
+        sem_t semaphore_;
+#endif
+
+    public:
+        WakeSignal(const WakeSignal&) = delete;
+        WakeSignal& operator=(const WakeSignal&) = delete;
+    };
+
+} // namespace ThreadSync
+
+} // namespace VoiceMonitor
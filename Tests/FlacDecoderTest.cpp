@@ -0,0 +1,168 @@
+// FlacDecoder container handling: a short stereo stream is encoded with FlacEncoder,
+// then decoded back plain, behind an ID3v2 tag and behind an ID3v2.4 tag with a
+// footer, and compared sample for sample with the encoder input.
+//
+// Usage: flac_decoder_test [directory]
+// Exit status: 0 when every variant decodes bit-exact, 1 otherwise.
+
+#include "FlacEncoder.hpp"
+#include "FlacDecoder.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr int NUM_CHANNELS = 2;
+    constexpr int NUM_FRAMES = 10000;
+    constexpr int BLOCK_SIZE = 4096;
+
+    bool readFile(const std::string& path, std::vector<uint8_t>& bytes) {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (!file) return false;
+        uint8_t buffer[4096];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            bytes.insert(bytes.end(), buffer, buffer + count);
+        }
+        fclose(file);
+        return true;
+    }
+
+    bool writeFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+        FILE* file = fopen(path.c_str(), "wb");
+        if (!file) return false;
+        const bool ok = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+        return fclose(file) == 0 && ok;
+    }
+
+    // ID3v2 header (sync-safe size, excluding header and footer), a padding-only
+    // body, and a footer ("3DI") when the footer flag is set
+    std::vector<uint8_t> makeId3Tag(uint8_t majorVersion, uint8_t flags, uint32_t bodySize) {
+        std::vector<uint8_t> tag = { 'I', 'D', '3', majorVersion, 0, flags,
+                                     static_cast<uint8_t>((bodySize >> 21) & 0x7F),
+                                     static_cast<uint8_t>((bodySize >> 14) & 0x7F),
+                                     static_cast<uint8_t>((bodySize >> 7) & 0x7F),
+                                     static_cast<uint8_t>(bodySize & 0x7F) };
+        tag.resize(tag.size() + bodySize, 0);
+        if (flags & 0x10) {
+            tag.insert(tag.end(), { '3', 'D', 'I' });
+            tag.insert(tag.end(), tag.begin() + 3, tag.begin() + 10);
+        }
+        return tag;
+    }
+
+    bool decodeAndCompare(const std::string& name, const std::string& path,
+                          const std::vector<int32_t> (&expected)[NUM_CHANNELS]) {
+        FlacDecoder decoder;
+        if (!decoder.open(path)) {
+            printf("FAIL %-16s not recognized as FLAC\n", name.c_str());
+            return false;
+        }
+        const FlacDecoder::StreamInfo& info = decoder.getStreamInfo();
+        if (info.numChannels != NUM_CHANNELS || info.totalSamples != NUM_FRAMES) {
+            printf("FAIL %-16s stream info: %d channels, %llu samples\n", name.c_str(),
+                   info.numChannels, static_cast<unsigned long long>(info.totalSamples));
+            return false;
+        }
+
+        int position = 0;
+        int numSamples;
+        while ((numSamples = decoder.decodeFrame()) > 0) {
+            for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+                const int32_t* samples = decoder.getChannelData(ch);
+                for (int i = 0; i < numSamples; ++i) {
+                    if (position + i >= NUM_FRAMES || samples[i] != expected[ch][position + i]) {
+                        printf("FAIL %-16s mismatch at sample %d, channel %d\n", name.c_str(), position + i, ch);
+                        return false;
+                    }
+                }
+            }
+            position += numSamples;
+        }
+        if (numSamples < 0 || position != NUM_FRAMES) {
+            printf("FAIL %-16s decoded %d of %d samples%s\n", name.c_str(), position, NUM_FRAMES,
+                   numSamples < 0 ? " (corrupt frame)" : "");
+            return false;
+        }
+
+        printf("ok   %-16s %d samples bit-exact\n", name.c_str(), position);
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::string directory = argc > 1 ? argv[1] : "/tmp";
+    const std::string plainPath = directory + "/flac_decoder_test.flac";
+
+    // Deterministic 16-bit stereo signal
+    std::vector<int32_t> samples[NUM_CHANNELS];
+    uint32_t seed = 1;
+    for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+        samples[ch].resize(NUM_FRAMES);
+        for (int i = 0; i < NUM_FRAMES; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const int32_t noise = static_cast<int32_t>(seed >> 24) - 128;
+            samples[ch][i] = static_cast<int32_t>(((i * (ch + 3)) % 2000) * 8 - 8000) + noise;
+        }
+    }
+
+    FlacEncoder::Settings settings;
+    settings.numChannels = NUM_CHANNELS;
+    settings.bitsPerSample = 16;
+    settings.blockSize = BLOCK_SIZE;
+    FlacEncoder encoder;
+    if (!encoder.open(plainPath, settings)) {
+        printf("FAIL cannot create %s\n", plainPath.c_str());
+        return 1;
+    }
+    for (int offset = 0; offset < NUM_FRAMES; offset += BLOCK_SIZE) {
+        const int32_t* channels[NUM_CHANNELS] = { samples[0].data() + offset, samples[1].data() + offset };
+        if (!encoder.encodeFrame(channels, std::min(BLOCK_SIZE, NUM_FRAMES - offset))) {
+            printf("FAIL encoding frame at %d\n", offset);
+            return 1;
+        }
+    }
+    if (!encoder.close()) {
+        printf("FAIL finalizing %s\n", plainPath.c_str());
+        return 1;
+    }
+
+    std::vector<uint8_t> stream;
+    if (!readFile(plainPath, stream)) {
+        printf("FAIL cannot read back %s\n", plainPath.c_str());
+        return 1;
+    }
+
+    struct Variant {
+        const char* name;
+        uint8_t majorVersion;
+        uint8_t flags;
+        uint32_t bodySize;
+    };
+    const Variant variants[] = {
+        { "id3v2.3",        3, 0x00, 1000 },
+        { "id3v2.4-footer", 4, 0x10, 300 },
+    };
+
+    int failures = decodeAndCompare("plain", plainPath, samples) ? 0 : 1;
+    for (const Variant& variant : variants) {
+        std::vector<uint8_t> tagged = makeId3Tag(variant.majorVersion, variant.flags, variant.bodySize);
+        tagged.insert(tagged.end(), stream.begin(), stream.end());
+        const std::string path = directory + "/flac_decoder_test_" + variant.name + ".flac";
+        if (!writeFile(path, tagged)) {
+            printf("FAIL cannot write %s\n", path.c_str());
+            ++failures;
+            continue;
+        }
+        failures += decodeAndCompare(variant.name, path, samples) ? 0 : 1;
+        remove(path.c_str());
+    }
+    remove(plainPath.c_str());
+
+    printf("%s: %d failures\n", failures == 0 ? "PASSED" : "FAILED", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,674 @@
+// Per-component DSP cost: the FDN building blocks (delay lines, all-pass,
+// damping and tone filters, scalar against SIMD feedback matrix, the input
+// cross-feed), the stereo processors from CrossFeed.hpp, the fused output
+// stage, the whole ReverbEngine::processBlock for every preset, block size
+// and sample rate, and the engine under dense sample-accurate automation of
+// each rebuilt parameter against the same engine held static. Each case is timed as the best of several repetitions and
+// reported in ns per sample (per frame for stereo processors); where Linux perf
+// counters are accessible, instructions and cycles per sample come with it.
+// Built with ENABLE_STAGE_PROFILING, engine results also carry the time per
+// signal-path stage (StageProfile.hpp); built with ENABLE_RT_SAFETY_CHECKS, the
+// run counts real-time violations inside processBlock (RealtimeSafety.hpp).
+// Results are written as JSON, a summary table to stdout.
+//
+// Usage: component_benchmark [--output file.json] [--filter substring] [--quick]
+//        --quick runs fewer engine configurations and shorter repetitions
+
+#include "CrossFeed.hpp"
+#include "FDNReverb.hpp"
+#include "OutputStage.hpp"
+#include "ParameterRamp.hpp"
+#include "RealtimeSafety.hpp"
+#include "ReverbEngine.hpp"
+#include "StageProfile.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace VoiceMonitor {
+
+namespace {
+    constexpr int COMPONENT_BLOCK = 512;
+    constexpr double COMPONENT_RATE = 48000.0;
+    constexpr int REPETITIONS = 7;
+
+    const char* simdPath() {
+#if SIMD_AVAILABLE && defined(__ARM_NEON__)
+        return "neon";
+#elif SIMD_AVAILABLE && defined(__AVX__)
+        return "avx";
+#elif SIMD_AVAILABLE && defined(__SSE2__)
+        return "sse2";
+#else
+        return "scalar";
+#endif
+    }
+
+    // Hardware instruction and cycle counters for this thread (user space only).
+    // Unavailable off Linux, in most containers and with perf_event_paranoid > 2.
+    class PerfCounters {
+    public:
+        PerfCounters() : instructionsFd_(-1), cyclesFd_(-1) {
+#if defined(__linux__)
+            instructionsFd_ = open(PERF_COUNT_HW_INSTRUCTIONS, -1);
+            if (instructionsFd_ >= 0) {
+                cyclesFd_ = open(PERF_COUNT_HW_CPU_CYCLES, instructionsFd_);
+            }
+#endif
+        }
+
+        ~PerfCounters() {
+#if defined(__linux__)
+            if (cyclesFd_ >= 0) close(cyclesFd_);
+            if (instructionsFd_ >= 0) close(instructionsFd_);
+#endif
+        }
+
+        bool isAvailable() const { return instructionsFd_ >= 0; }
+
+        void start() {
+#if defined(__linux__)
+            if (isAvailable()) {
+                ioctl(instructionsFd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ioctl(instructionsFd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+#endif
+        }
+
+        // Counts since start(); -1 where a counter is missing
+        void stop(int64_t& instructions, int64_t& cycles) {
+            instructions = -1;
+            cycles = -1;
+#if defined(__linux__)
+            if (isAvailable()) {
+                ioctl(instructionsFd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+                instructions = readCounter(instructionsFd_);
+                cycles = cyclesFd_ >= 0 ? readCounter(cyclesFd_) : -1;
+            }
+#endif
+        }
+
+    private:
+#if defined(__linux__)
+        static int open(uint64_t config, int groupFd) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config;
+            attr.disabled = groupFd < 0 ? 1 : 0;    // The group follows its leader
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+        }
+
+        static int64_t readCounter(int fd) {
+            uint64_t value = 0;
+            return read(fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))
+                ? static_cast<int64_t>(value) : -1;
+        }
+#endif
+
+        int instructionsFd_;
+        int cyclesFd_;
+    };
+
+    struct Result {
+        std::string name;
+        std::string component;
+        std::string params;             // JSON object members, already formatted
+        double sampleRate;
+        int blockSize;
+        int channels;
+        double nsPerSample;             // Best repetition
+        double medianNsPerSample;
+        double instructionsPerSample;   // < 0 without counters
+        double cyclesPerSample;
+        std::string stages;             // Per-stage ns per sample as JSON members, profiling builds only
+    };
+
+    std::vector<float> makeNoise(size_t length, uint32_t seed, float level = 0.1f) {
+        std::vector<float> signal(length);
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> noise(-level, level);
+        for (float& sample : signal) {
+            sample = noise(rng);
+        }
+        return signal;
+    }
+}
+
+/// Runs the cases; a friend of FDNReverb so the private building blocks and
+/// matrix kernels can be timed on their own
+class ComponentBenchmark {
+public:
+    ComponentBenchmark(const std::string& filter, bool quick)
+        : filter_(filter)
+        , quick_(quick)
+        , repetitionSeconds_(quick ? 0.01 : 0.05) {
+    }
+
+    void runAll() {
+        runDelayLines();
+        runAllPass();
+        runDampingFilter();
+        runMatrix();
+        runToneFilter();
+        runFdnCrossFeed();
+        runStereoSpread();
+        runStereoProcessors();
+        runOutputStage();
+        runEngine();
+        runAutomation();
+    }
+
+    const std::vector<Result>& getResults() const { return results_; }
+    bool hasPerfCounters() const { return counters_.isAvailable(); }
+
+private:
+    using Kernel = std::function<void()>;
+
+    // Times `kernel`, which processes samplesPerCall samples (frames) per call
+    void measure(const std::string& name, const std::string& component, const std::string& params,
+                 double sampleRate, int blockSize, int channels, int samplesPerCall, const Kernel& kernel) {
+        if (!filter_.empty() && name.find(filter_) == std::string::npos) {
+            return;
+        }
+
+        // Calibrate the calls per repetition, warming caches and predictors as we go
+        using Clock = std::chrono::steady_clock;
+        int calls = 1;
+        for (;;) {
+            const auto start = Clock::now();
+            for (int i = 0; i < calls; ++i) {
+                kernel();
+            }
+            const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            if (elapsed >= repetitionSeconds_ * 0.25 || calls >= (1 << 24)) {
+                calls = std::max(1, static_cast<int>(calls * repetitionSeconds_ / std::max(elapsed, 1e-9)));
+                break;
+            }
+            calls *= 4;
+        }
+
+        std::vector<double> nsPerSample;
+        int64_t totalInstructions = 0;
+        int64_t totalCycles = 0;
+        bool countersValid = counters_.isAvailable();
+        for (int repetition = 0; repetition < REPETITIONS; ++repetition) {
+            counters_.start();
+            const auto start = Clock::now();
+            for (int i = 0; i < calls; ++i) {
+                kernel();
+            }
+            const auto end = Clock::now();
+            int64_t instructions = 0;
+            int64_t cycles = 0;
+            counters_.stop(instructions, cycles);
+
+            const double samples = static_cast<double>(calls) * samplesPerCall;
+            nsPerSample.push_back(std::chrono::duration<double, std::nano>(end - start).count() / samples);
+            countersValid = countersValid && instructions >= 0 && cycles >= 0;
+            totalInstructions += instructions;
+            totalCycles += cycles;
+        }
+        std::sort(nsPerSample.begin(), nsPerSample.end());
+
+        Result result;
+        result.name = name;
+        result.component = component;
+        result.params = params;
+        result.sampleRate = sampleRate;
+        result.blockSize = blockSize;
+        result.channels = channels;
+        result.nsPerSample = nsPerSample.front();
+        result.medianNsPerSample = nsPerSample[nsPerSample.size() / 2];
+        const double countedSamples = static_cast<double>(calls) * samplesPerCall * REPETITIONS;
+        result.instructionsPerSample = countersValid ? totalInstructions / countedSamples : -1.0;
+        result.cyclesPerSample = countersValid ? totalCycles / countedSamples : -1.0;
+        results_.push_back(result);
+
+        printf("%-44s %9.2f ns", name.c_str(), result.nsPerSample);
+        if (countersValid) {
+            printf(" %9.1f instr %8.1f cycles", result.instructionsPerSample, result.cyclesPerSample);
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+
+    // ========================================================================
+    // FDN building blocks (mono, one sample per process call)
+
+    void runDelayLines() {
+        const std::vector<float> input = makeNoise(COMPONENT_BLOCK, 1);
+        std::vector<float> output(COMPONENT_BLOCK);
+
+        for (bool interpolate : { false, true }) {
+            FDNReverb::DelayLine line(FDNReverb::MAX_DELAY_LENGTH);
+            line.setDelay(1499.37f);
+            line.setInterpolation(interpolate);
+            const std::string params = std::string("\"interpolation\": ") + (interpolate ? "true" : "false");
+            measure(std::string("delay_line/") + (interpolate ? "linear" : "nearest"), "DelayLine", params,
+                    COMPONENT_RATE, COMPONENT_BLOCK, 1, COMPONENT_BLOCK, [&]() {
+                for (int i = 0; i < COMPONENT_BLOCK; ++i) {
+                    output[i] = line.process(input[i]);
+                }
+            });
+        }
+
+        // The loop's own line: LFO-modulated read, then write
+        FDNReverb::ModulatedDelay modulated(FDNReverb::MAX_DELAY_LENGTH);
+        modulated.updateSampleRate(COMPONENT_RATE);
+        modulated.setBaseDelay(1499.0f);
+        modulated.setModulation(4.0f, 0.2f);
+        modulated.setEnabled(true);
+        measure("modulated_delay", "ModulatedDelay", "\"depth\": 4.0, \"rate_hz\": 0.2",
+                COMPONENT_RATE, COMPONENT_BLOCK, 1, COMPONENT_BLOCK, [&]() {
+            for (int i = 0; i < COMPONENT_BLOCK; ++i) {
+                output[i] = modulated.read();
+                modulated.write(input[i] + 0.5f * output[i]);
+            }
+        });
+    }
+
+    void runAllPass() {
+        const std::vector<float> input = makeNoise(COMPONENT_BLOCK, 2);
+        std::vector<float> output(COMPONENT_BLOCK);
+        FDNReverb::AllPassFilter allPass(556, 0.7f);
+        measure("all_pass", "AllPassFilter", "\"delay\": 556, \"gain\": 0.7",
+                COMPONENT_RATE, COMPONENT_BLOCK, 1, COMPONENT_BLOCK, [&]() {
+            for (int i = 0; i < COMPONENT_BLOCK; ++i) {
+                output[i] = allPass.process(input[i]);
+            }
+        });
+    }
+
+    void runDampingFilter() {
+        const std::vector<float> input = makeNoise(COMPONENT_BLOCK, 3);
+        std::vector<float> output(COMPONENT_BLOCK);
+        FDNReverb::DampingFilter damping(COMPONENT_RATE);
+        damping.setHFDamping(50.0f);
+        damping.setLFDamping(30.0f);
+        measure("damping_filter", "DampingFilter", "\"hf_damping\": 50, \"lf_damping\": 30",
+                COMPONENT_RATE, COMPONENT_BLOCK, 1, COMPONENT_BLOCK, [&]() {
+            for (int i = 0; i < COMPONENT_BLOCK; ++i) {
+                output[i] = damping.process(input[i]);
+            }
+        });
+    }
+
+    // One matrix product per loop sample, as in the FDN loop
+    void runMatrix() {
+        for (int lines : { 4, 6, 8 }) {
+            FDNReverb fdn(COMPONENT_RATE, ReverbEngine::MAX_DELAY_LINES);
+            fdn.setActiveDelayLines(lines);
+            const std::vector<float> input = makeNoise(static_cast<size_t>(lines), 4);
+            std::copy(input.begin(), input.end(), fdn.delayOutputs_.begin());
+
+            const std::string params = "\"delay_lines\": " + std::to_string(lines);
+            const std::string suffix = "/" + std::to_string(lines);
+            measure("matrix_scalar" + suffix, "processMatrix", params,
+                    COMPONENT_RATE, COMPONENT_BLOCK, 1, COMPONENT_BLOCK, [&]() {
+                for (int i = 0; i < COMPONENT_BLOCK; ++i) {
+                    fdn.processMatrix();
+                    fdn.delayOutputs_[i % lines] = fdn.matrixOutputs_[0];   // Keep a dependency chain
+                }
+            });
+            measure("matrix_simd" + suffix, "processMatrixSIMD", params,
+                    COMPONENT_RATE, COMPONENT_BLOCK, 1, COMPONENT_BLOCK, [&]() {
+                for (int i = 0; i < COMPONENT_BLOCK; ++i) {
+                    fdn.processMatrixSIMD();
+                    fdn.delayOutputs_[i % lines] = fdn.matrixOutputs_[0];
+                }
+            });
+        }
+    }
+
+    // ========================================================================
+    // Stereo processors (block calls, ns per frame)
+
+    void runToneFilter() {
+        std::vector<float> left = makeNoise(COMPONENT_BLOCK, 5);
+        std::vector<float> right = makeNoise(COMPONENT_BLOCK, 6);
+        FDNReverb::ToneFilter tone(COMPONENT_RATE);
+        tone.setHighCutFreq(8000.0f);
+        tone.setLowCutFreq(100.0f);
+        tone.setHighCutEnabled(true);
+        tone.setLowCutEnabled(true);
+        measure("tone_filter", "ToneFilter", "\"high_cut_hz\": 8000, \"low_cut_hz\": 100",
+                COMPONENT_RATE, COMPONENT_BLOCK, 2, COMPONENT_BLOCK, [&]() {
+            tone.processStereo(left.data(), right.data(), COMPONENT_BLOCK);
+        });
+    }
+
+    void runFdnCrossFeed() {
+        std::vector<float> left = makeNoise(COMPONENT_BLOCK, 7);
+        std::vector<float> right = makeNoise(COMPONENT_BLOCK, 8);
+        FDNReverb::CrossFeedProcessor crossFeed(COMPONENT_RATE);
+        crossFeed.setCrossFeedAmount(0.5f);
+        crossFeed.setCrossDelayMs(5.0f);
+        measure("fdn_cross_feed", "FDNReverb::CrossFeedProcessor", "\"amount\": 0.5, \"delay_ms\": 5",
+                COMPONENT_RATE, COMPONENT_BLOCK, 2, COMPONENT_BLOCK, [&]() {
+            crossFeed.processStereo(left.data(), right.data(), COMPONENT_BLOCK);
+        });
+    }
+
+    void runStereoSpread() {
+        std::vector<float> left = makeNoise(COMPONENT_BLOCK, 9);
+        std::vector<float> right = makeNoise(COMPONENT_BLOCK, 10);
+        FDNReverb::StereoSpreadProcessor spread;
+        spread.setStereoWidth(1.5f);
+        measure("stereo_spread", "StereoSpreadProcessor", "\"width\": 1.5",
+                COMPONENT_RATE, COMPONENT_BLOCK, 2, COMPONENT_BLOCK, [&]() {
+            spread.processStereo(left.data(), right.data(), COMPONENT_BLOCK);
+        });
+    }
+
+    void runStereoProcessors() {
+        std::vector<float> left = makeNoise(COMPONENT_BLOCK, 11);
+        std::vector<float> right = makeNoise(COMPONENT_BLOCK, 12);
+
+        CrossFeedProcessor crossFeed;
+        crossFeed.initialize(COMPONENT_RATE);
+        crossFeed.setCrossFeedAmount(0.5f);
+        crossFeed.setStereoWidth(1.2f);
+        measure("cross_feed", "CrossFeedProcessor", "\"amount\": 0.5, \"width\": 1.2",
+                COMPONENT_RATE, COMPONENT_BLOCK, 2, COMPONENT_BLOCK, [&]() {
+            crossFeed.processBlock(left.data(), right.data(), COMPONENT_BLOCK);
+        });
+
+        StereoChorus chorus;
+        chorus.initialize(COMPONENT_RATE);
+        chorus.setRate(0.8f);
+        chorus.setDepth(0.5f);
+        measure("stereo_chorus", "StereoChorus", "\"rate_hz\": 0.8, \"depth\": 0.5",
+                COMPONENT_RATE, COMPONENT_BLOCK, 2, COMPONENT_BLOCK, [&]() {
+            chorus.processBlock(left.data(), right.data(), COMPONENT_BLOCK);
+        });
+
+        HaasProcessor haas;
+        haas.initialize(COMPONENT_RATE);
+        haas.setDelayTime(15.0f);
+        measure("haas", "HaasProcessor", "\"delay_ms\": 15",
+                COMPONENT_RATE, COMPONENT_BLOCK, 2, COMPONENT_BLOCK, [&]() {
+            haas.processBlock(left.data(), right.data(), COMPONENT_BLOCK);
+        });
+    }
+
+    void runOutputStage() {
+        std::vector<float> wetL = makeNoise(COMPONENT_BLOCK, 13);
+        std::vector<float> wetR = makeNoise(COMPONENT_BLOCK, 14);
+        const std::vector<float> dryL = makeNoise(COMPONENT_BLOCK, 15);
+        const std::vector<float> dryR = makeNoise(COMPONENT_BLOCK, 16);
+        std::vector<float> outL(COMPONENT_BLOCK);
+        std::vector<float> outR(COMPONENT_BLOCK);
+
+        OutputStage stage;
+        stage.prepare(COMPONENT_RATE, COMPONENT_BLOCK);
+        OutputStage::Settings settings;
+        settings.spreadWidth = 1.5f;
+        settings.highCutEnabled = true;
+        settings.highCutHz = 8000.0f;
+        settings.lowCutEnabled = true;
+        settings.lowCutHz = 100.0f;
+        stage.configure(settings);
+        stage.setCrossFeed(0.5f);
+        stage.reset();
+
+        ParameterRamp mix;
+        ParameterRamp gain;
+        mix.prepare(COMPONENT_RATE, 0.03, COMPONENT_BLOCK);
+        gain.prepare(COMPONENT_RATE, 0.04, COMPONENT_BLOCK);
+        mix.snapTo(0.5f);
+        gain.snapTo(1.0f);
+        measure("output_stage", "OutputStage",
+                "\"width\": 1.5, \"high_cut_hz\": 8000, \"low_cut_hz\": 100, \"cross_feed\": 0.5",
+                COMPONENT_RATE, COMPONENT_BLOCK, 2, COMPONENT_BLOCK, [&]() {
+            mix.process(COMPONENT_BLOCK);
+            gain.process(COMPONENT_BLOCK);
+            stage.process(wetL.data(), wetR.data(), dryL.data(), dryR.data(), outL.data(), outR.data(),
+                          COMPONENT_BLOCK, &mix, &gain, false);
+        });
+    }
+
+    // ========================================================================
+    // Whole engine, stereo, fixed quality tier
+
+    void runEngine() {
+        struct PresetInfo {
+            ReverbEngine::Preset preset;
+            const char* name;
+        };
+        const PresetInfo presets[] = {
+            { ReverbEngine::Preset::Clean, "clean" },
+            { ReverbEngine::Preset::VocalBooth, "vocal_booth" },
+            { ReverbEngine::Preset::Studio, "studio" },
+            { ReverbEngine::Preset::Cathedral, "cathedral" }
+        };
+        const std::vector<int> blockSizes = quick_ ? std::vector<int>{ 64, 512 }
+                                                   : std::vector<int>{ 32, 64, 128, 256, 512, 1024 };
+        const std::vector<double> sampleRates = quick_ ? std::vector<double>{ 48000.0 }
+                                                       : std::vector<double>{ 44100.0, 48000.0, 96000.0, 192000.0 };
+
+        for (const PresetInfo& info : presets) {
+            for (double sampleRate : sampleRates) {
+                for (int blockSize : blockSizes) {
+                    ReverbEngine engine;
+                    if (!engine.initialize(sampleRate, blockSize)) {
+                        continue;
+                    }
+                    engine.setAdaptiveQuality(false);
+                    engine.setPreset(info.preset);
+
+                    const std::vector<float> left = makeNoise(static_cast<size_t>(blockSize), 17);
+                    const std::vector<float> right = makeNoise(static_cast<size_t>(blockSize), 18);
+                    std::vector<float> outL(static_cast<size_t>(blockSize));
+                    std::vector<float> outR(static_cast<size_t>(blockSize));
+                    const float* inputs[2] = { left.data(), right.data() };
+                    float* outputs[2] = { outL.data(), outR.data() };
+
+                    char name[96];
+                    snprintf(name, sizeof(name), "engine/%s/%.0f/%d", info.name, sampleRate, blockSize);
+                    const std::string params = std::string("\"preset\": \"") + info.name + "\"";
+                    const size_t count = results_.size();
+                    const StageProfile::Snapshot before = engine.getStageProfile();
+                    measure(name, "ReverbEngine::processBlock", params, sampleRate, blockSize, 2, blockSize,
+                            [&]() { engine.processBlock(inputs, outputs, 2, blockSize); });
+                    if (StageProfile::ENABLED && results_.size() > count) {
+                        results_.back().stages = formatStages(engine.getStageProfile() - before);
+                    }
+                }
+            }
+        }
+    }
+
+    // ========================================================================
+    // Whole engine under scheduleParameter() automation, one event every
+    // AUTOMATION_SPACING samples, against the same engine without events
+
+    void runAutomation() {
+        constexpr int AUTOMATION_SPACING = 32;
+
+        struct AutomatedParameter {
+            const char* name;
+            ParameterId id;
+            float low;          // Swept as a triangle between low and high
+            float high;
+        };
+        const AutomatedParameter parameters[] = {
+            { "static", ParameterId::WetDryMix, 0.0f, 0.0f },    // No events
+            { "wet_dry", ParameterId::WetDryMix, 20.0f, 80.0f },
+            { "decay", ParameterId::DecayTime, 1.0f, 4.0f },
+            { "hf_damping", ParameterId::HighFreqDamping, 20.0f, 80.0f },
+            { "room_size", ParameterId::RoomSize, 0.4f, 0.8f },
+            { "pre_delay", ParameterId::PreDelay, 10.0f, 60.0f }
+        };
+
+        const std::vector<float> left = makeNoise(COMPONENT_BLOCK, 19);
+        const std::vector<float> right = makeNoise(COMPONENT_BLOCK, 20);
+        std::vector<float> outL(COMPONENT_BLOCK);
+        std::vector<float> outR(COMPONENT_BLOCK);
+        const float* inputs[2] = { left.data(), right.data() };
+        float* outputs[2] = { outL.data(), outR.data() };
+
+        for (const AutomatedParameter& parameter : parameters) {
+            ReverbEngine engine;
+            if (!engine.initialize(COMPONENT_RATE, COMPONENT_BLOCK)) {
+                continue;
+            }
+            engine.setAdaptiveQuality(false);
+            engine.setPreset(ReverbEngine::Preset::Studio);
+
+            // A full sweep takes 4 s, so each event moves the value by a small step
+            const bool automated = parameter.high > parameter.low;
+            const int sweepEvents = static_cast<int>(4.0 * COMPONENT_RATE) / AUTOMATION_SPACING;
+            int event = 0;
+
+            char name[96];
+            snprintf(name, sizeof(name), "automation/%s/%.0f/%d", parameter.name, COMPONENT_RATE, COMPONENT_BLOCK);
+            char params[128];
+            snprintf(params, sizeof(params), "\"parameter\": \"%s\", \"event_spacing\": %d",
+                     parameter.name, automated ? AUTOMATION_SPACING : 0);
+            measure(name, "ReverbEngine::scheduleParameter", params, COMPONENT_RATE, COMPONENT_BLOCK, 2,
+                    COMPONENT_BLOCK, [&]() {
+                if (automated) {
+                    for (int offset = 0; offset < COMPONENT_BLOCK; offset += AUTOMATION_SPACING) {
+                        const float position = static_cast<float>(event++ % sweepEvents) / sweepEvents;
+                        const float triangle = 1.0f - std::fabs(2.0f * position - 1.0f);
+                        engine.scheduleParameter(parameter.id,
+                                                 parameter.low + triangle * (parameter.high - parameter.low),
+                                                 offset);
+                    }
+                }
+                engine.processBlock(inputs, outputs, 2, COMPONENT_BLOCK);
+            });
+        }
+    }
+
+    // Stages that saw any time, in ns per FDN input sample; also printed
+    std::string formatStages(const StageProfile::Snapshot& profile) {
+        std::string members;
+        for (int stage = 0; stage < StageProfile::NUM_STAGES; ++stage) {
+            if (profile.laps[stage] == 0 || profile.samples == 0) {
+                continue;
+            }
+            const double ns = profile.getSeconds(stage) * 1e9 / static_cast<double>(profile.samples);
+            char member[64];
+            snprintf(member, sizeof(member), "%s\"%s\": %.4f", members.empty() ? "" : ", ",
+                     StageProfile::getStageName(stage), ns);
+            members += member;
+            printf("    %-40s %9.2f ns\n", StageProfile::getStageName(stage), ns);
+        }
+        return members;
+    }
+
+    std::string filter_;
+    bool quick_;
+    double repetitionSeconds_;
+    PerfCounters counters_;
+    std::vector<Result> results_;
+};
+
+namespace {
+    bool writeJson(const char* path, const std::vector<Result>& results, bool perfCounters) {
+        FILE* file = fopen(path, "w");
+        if (!file) {
+            return false;
+        }
+
+        auto number = [](double value) {
+            char text[32];
+            if (value < 0.0) {
+                return std::string("null");
+            }
+            snprintf(text, sizeof(text), "%.4f", value);
+            return std::string(text);
+        };
+
+        fprintf(file, "{\n");
+        fprintf(file, "  \"benchmark\": \"component_benchmark\",\n");
+        fprintf(file, "  \"simd\": \"%s\",\n", simdPath());
+        fprintf(file, "  \"compiler\": \"%s\",\n", __VERSION__);
+#if defined(__OPTIMIZE__)
+        fprintf(file, "  \"optimized\": true,\n");
+#else
+        fprintf(file, "  \"optimized\": false,\n");    // Numbers from a debug build
+#endif
+        fprintf(file, "  \"perf_counters\": %s,\n", perfCounters ? "true" : "false");
+        fprintf(file, "  \"repetitions\": %d,\n", REPETITIONS);
+        if (RealtimeSafety::ENABLED) {
+            fprintf(file, "  \"realtime_violations\": %llu,\n",
+                    static_cast<unsigned long long>(RealtimeSafety::getViolationCount()));
+        }
+        fprintf(file, "  \"results\": [\n");
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            fprintf(file, "    {\"name\": \"%s\", \"component\": \"%s\", \"params\": {%s}, "
+                          "\"sample_rate\": %.0f, \"block_size\": %d, \"channels\": %d, "
+                          "\"ns_per_sample\": %s, \"median_ns_per_sample\": %s, "
+                          "\"instructions_per_sample\": %s, \"cycles_per_sample\": %s%s%s%s}%s\n",
+                    r.name.c_str(), r.component.c_str(), r.params.c_str(),
+                    r.sampleRate, r.blockSize, r.channels,
+                    number(r.nsPerSample).c_str(), number(r.medianNsPerSample).c_str(),
+                    number(r.instructionsPerSample).c_str(), number(r.cyclesPerSample).c_str(),
+                    r.stages.empty() ? "" : ", \"stage_ns_per_sample\": {", r.stages.c_str(),
+                    r.stages.empty() ? "" : "}", i + 1 < results.size() ? "," : "");
+        }
+        fprintf(file, "  ]\n}\n");
+        return fclose(file) == 0;
+    }
+}
+
+} // namespace VoiceMonitor
+
+using namespace VoiceMonitor;
+
+int main(int argc, char** argv) {
+    const char* outputPath = "component_benchmark.json";
+    std::string filter;
+    bool quick = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            quick = true;
+        } else {
+            printf("Usage: %s [--output file.json] [--filter substring] [--quick]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    ComponentBenchmark benchmark(filter, quick);
+    printf("\nComponent benchmark (%s, perf counters %s), ns per sample or stereo frame\n",
+           simdPath(), benchmark.hasPerfCounters() ? "on" : "unavailable");
+    benchmark.runAll();
+
+    if (!writeJson(outputPath, benchmark.getResults(), benchmark.hasPerfCounters())) {
+        printf("Failed to write %s\n", outputPath);
+        return 1;
+    }
+    printf("\n%zu results written to %s\n", benchmark.getResults().size(), outputPath);
+    if (RealtimeSafety::ENABLED) {
+        printf("Real-time safety: %llu violations inside processBlock\n",
+               static_cast<unsigned long long>(RealtimeSafety::getViolationCount()));
+    }
+    return 0;
+}
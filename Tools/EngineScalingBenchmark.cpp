@@ -0,0 +1,195 @@
+// Multi-instance scaling: a simulated audio callback runs 1-256 ReverbEngine
+// instances per period through MultiEngineHost on 1-N worker threads and reports,
+// for every combination, the cycle load (processing time / period), its 99th
+// percentile and peak, the deadline-miss rate, how much work was stolen and how
+// busy the workers were.
+//
+// Usage: engine_scaling_benchmark [max_workers] [seconds] [max_instances] [--no-pin] [--unpaced]
+//        --unpaced runs cycles back to back (no idle time for workers to fall asleep)
+
+#include "MultiEngineHost.hpp"
+#include "ReverbEngine.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr double SAMPLE_RATE = 48000.0;
+    constexpr int BLOCK_SIZE = 256;
+    constexpr int NUM_CHANNELS = 2;
+    constexpr int WARMUP_CYCLES = 20;
+
+    struct ChannelBuffers {
+        std::vector<float> output[NUM_CHANNELS];
+        float* outputs[NUM_CHANNELS];
+    };
+
+    struct Result {
+        double averageLoad = 0.0;
+        double p99Load = 0.0;
+        double peakLoad = 0.0;
+        double missRate = 0.0;
+        double stolenFraction = 0.0;
+        double workerUtilization = 0.0;     // Thread CPU inside cycles / (workers * wall time)
+    };
+
+    Result runConfiguration(MultiEngineHost& host, const std::vector<MultiEngineHost::Instance>& instances,
+                            int numInstances, double seconds, bool paced) {
+        const int numCycles = std::max(1, static_cast<int>(seconds * SAMPLE_RATE / BLOCK_SIZE));
+        const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(BLOCK_SIZE / SAMPLE_RATE));
+
+        for (int i = 0; i < WARMUP_CYCLES; ++i) {
+            host.processCycle(instances.data(), numInstances, BLOCK_SIZE);
+        }
+        host.resetStatistics();
+
+        std::vector<MultiEngineHost::WorkerStatistics> before(host.getNumWorkers());
+        for (int w = 0; w < host.getNumWorkers(); ++w) {
+            before[w] = host.getWorkerStatistics(w);
+        }
+
+        std::vector<double> loads;
+        loads.reserve(numCycles);
+
+        const auto start = std::chrono::steady_clock::now();
+        auto nextCallback = start;
+        for (int cycle = 0; cycle < numCycles; ++cycle) {
+            host.processCycle(instances.data(), numInstances, BLOCK_SIZE);
+            loads.push_back(host.getStatistics().lastLoad);
+
+            if (paced) {
+                // A late cycle starts the next one immediately, like a driver catching up
+                nextCallback = std::max(nextCallback + period, std::chrono::steady_clock::now());
+                std::this_thread::sleep_until(nextCallback);
+            }
+        }
+        const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const MultiEngineHost::Statistics stats = host.getStatistics();
+        Result result;
+        result.averageLoad = 0.0;
+        for (double load : loads) {
+            result.averageLoad += load;
+        }
+        result.averageLoad /= loads.size();
+        std::sort(loads.begin(), loads.end());
+        result.p99Load = loads[std::min(loads.size() - 1, loads.size() * 99 / 100)];
+        result.peakLoad = stats.peakLoad;
+        result.missRate = static_cast<double>(stats.deadlineMisses) / stats.cycles;
+
+        uint64_t processed = 0;
+        uint64_t stolen = 0;
+        double cpuSeconds = 0.0;
+        for (int w = 0; w < host.getNumWorkers(); ++w) {
+            const MultiEngineHost::WorkerStatistics after = host.getWorkerStatistics(w);
+            processed += after.instancesProcessed - before[w].instancesProcessed;
+            stolen += after.instancesStolen - before[w].instancesStolen;
+            cpuSeconds += after.cpuSeconds - before[w].cpuSeconds;
+        }
+        result.stolenFraction = processed > 0 ? static_cast<double>(stolen) / processed : 0.0;
+        result.workerUtilization = cpuSeconds / (host.getNumWorkers() * wallSeconds);
+        return result;
+    }
+}
+
+int main(int argc, char** argv) {
+    int maxWorkers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    double seconds = 2.0;
+    int maxInstances = 256;
+    bool pin = true;
+    bool paced = true;
+
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-pin") == 0) {
+            pin = false;
+        } else if (std::strcmp(argv[i], "--unpaced") == 0) {
+            paced = false;
+        } else if (positional == 0) {
+            maxWorkers = std::clamp(std::atoi(argv[i]), 1, MultiEngineHost::MAX_WORKERS);
+            ++positional;
+        } else if (positional == 1) {
+            seconds = std::atof(argv[i]);
+            ++positional;
+        } else {
+            maxInstances = std::max(1, std::atoi(argv[i]));
+        }
+    }
+
+    // Engines at a fixed tier so the comparison measures the scheduler, not the governor
+    std::vector<std::unique_ptr<ReverbEngine>> engines;
+    std::vector<ChannelBuffers> buffers(maxInstances);
+    for (int i = 0; i < maxInstances; ++i) {
+        auto engine = std::make_unique<ReverbEngine>();
+        if (!engine->initialize(SAMPLE_RATE, BLOCK_SIZE)) {
+            printf("Failed to initialize engine %d\n", i);
+            return 1;
+        }
+        engine->setAdaptiveQuality(false);
+        engine->setPreset(ReverbEngine::Preset::Studio);
+        engines.push_back(std::move(engine));
+
+        for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+            buffers[i].output[ch].assign(BLOCK_SIZE, 0.0f);
+            buffers[i].outputs[ch] = buffers[i].output[ch].data();
+        }
+    }
+
+    // Shared low-level noise input keeps every tail busy
+    std::vector<float> input[NUM_CHANNELS];
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> noise(-0.1f, 0.1f);
+    for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+        input[ch].resize(BLOCK_SIZE);
+        for (float& sample : input[ch]) {
+            sample = noise(rng);
+        }
+    }
+    const float* inputs[NUM_CHANNELS] = { input[0].data(), input[1].data() };
+
+    std::vector<MultiEngineHost::Instance> instances(maxInstances);
+    for (int i = 0; i < maxInstances; ++i) {
+        instances[i].engine = engines[i].get();
+        instances[i].inputs = inputs;
+        instances[i].outputs = buffers[i].outputs;
+        instances[i].numChannels = NUM_CHANNELS;
+    }
+
+    printf("\nEngine scaling benchmark: %d-frame periods at %.0f Hz (%.2f ms), %.1f s per run, %s, %s\n",
+           BLOCK_SIZE, SAMPLE_RATE, 1000.0 * BLOCK_SIZE / SAMPLE_RATE, seconds,
+           paced ? "paced" : "unpaced", pin ? "pinned workers" : "unpinned workers");
+    printf("%9s %7s %8s %8s %8s %8s %8s %8s\n",
+           "instances", "workers", "avg%", "p99%", "peak%", "miss%", "stolen%", "util%");
+
+    for (int workers = 1; workers <= maxWorkers; ++workers) {
+        MultiEngineHost host;
+        if (!host.prepare(SAMPLE_RATE, maxInstances, workers, pin)) {
+            printf("Failed to start host with %d workers\n", workers);
+            return 1;
+        }
+
+        for (int count = 1; count <= maxInstances; count = (count == maxInstances) ? count + 1
+                                                                 : std::min(count * 2, maxInstances)) {
+            if (workers > count) {
+                continue;                               // Idle workers add nothing
+            }
+            const Result result = runConfiguration(host, instances, count, seconds, paced);
+            printf("%9d %7d %8.1f %8.1f %8.1f %8.2f %8.1f %8.1f\n",
+                   count, workers, result.averageLoad * 100.0, result.p99Load * 100.0,
+                   result.peakLoad * 100.0, result.missRate * 100.0,
+                   result.stolenFraction * 100.0, result.workerUtilization * 100.0);
+        }
+        host.shutdown();
+    }
+
+    return 0;
+}
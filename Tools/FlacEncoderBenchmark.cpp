@@ -0,0 +1,181 @@
+// Real-time FLAC encoding: a simulated audio callback pushes 256-frame blocks into
+// FlacEncoderStage at a configurable multiple of real time, then the file is decoded
+// back through AudioFileReader and compared bit-for-bit with the quantized input.
+// Reports compression ratio, encoder load against its CPU budget and dropped blocks.
+//
+// Usage: flac_encoder_benchmark [output.flac] [seconds] [speed] [bits] [cpu_budget]
+//        speed 0 pushes as fast as possible (drops are expected and reported)
+
+#include "FlacEncoderStage.hpp"
+#include "AudioFileReader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr double SAMPLE_RATE = 48000.0;
+    constexpr int BLOCK_SIZE = 256;
+    constexpr int NUM_CHANNELS = 2;
+
+    // Voice-like test signal: harmonic stack with vibrato, syllable envelope,
+    // a little breath noise and decorrelated stereo room
+    void synthesize(std::vector<float> (&channels)[NUM_CHANNELS], int64_t numFrames) {
+        std::mt19937 rng(42);
+        std::normal_distribution<float> noise(0.0f, 1.0f);
+        double phase = 0.0;
+
+        for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+            channels[ch].resize(static_cast<size_t>(numFrames));
+        }
+
+        for (int64_t i = 0; i < numFrames; ++i) {
+            const double t = i / SAMPLE_RATE;
+            const double f0 = 140.0 + 20.0 * std::sin(2.0 * M_PI * 0.3 * t) + 3.0 * std::sin(2.0 * M_PI * 5.5 * t);
+            phase += 2.0 * M_PI * f0 / SAMPLE_RATE;
+
+            double voice = 0.0;
+            for (int h = 1; h <= 12; ++h) {
+                voice += std::sin(h * phase) / (h * h * 0.5 + 1.0);
+            }
+
+            const double syllable = 0.5 - 0.5 * std::cos(2.0 * M_PI * 2.5 * t);
+            const float breath = 0.003f * noise(rng);
+            const float mono = static_cast<float>(0.3 * syllable * voice) + breath;
+
+            channels[0][i] = mono + 0.002f * noise(rng);
+            channels[1][i] = 0.9f * mono + 0.002f * noise(rng);
+        }
+    }
+
+    bool readWholeFile(const std::string& path, std::vector<float> (&channels)[NUM_CHANNELS]) {
+        AudioFileReader reader;
+        if (!reader.open(path) || reader.getNumChannels() != NUM_CHANNELS || !reader.start()) {
+            return false;
+        }
+
+        AudioFileReader::Block block;
+        while (!reader.isFinished()) {
+            if (!reader.acquireBlock(block)) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                continue;
+            }
+            for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+                channels[ch].insert(channels[ch].end(), block.channels[ch], block.channels[ch] + block.numFrames);
+            }
+            reader.releaseBlock();
+        }
+        return !reader.hasDecodeError();
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::string path = argc > 1 ? argv[1] : "/tmp/flac_encoder_benchmark.flac";
+    const double seconds = argc > 2 ? std::atof(argv[2]) : 60.0;
+    const double speed = argc > 3 ? std::atof(argv[3]) : 8.0;
+    const int bitsPerSample = argc > 4 ? std::atoi(argv[4]) : 24;
+    const double cpuBudget = argc > 5 ? std::atof(argv[5]) : FlacEncoderStage::DEFAULT_CPU_BUDGET;
+
+    const int64_t totalFrames = static_cast<int64_t>(seconds * SAMPLE_RATE);
+    std::vector<float> input[NUM_CHANNELS];
+    synthesize(input, totalFrames);
+
+    FlacEncoder::Settings settings;
+    settings.numChannels = NUM_CHANNELS;
+    settings.sampleRate = SAMPLE_RATE;
+    settings.bitsPerSample = bitsPerSample;
+
+    FlacEncoderStage stage;
+    // The budget is relative to real time; at N x speed the encoder gets 1/N of it
+    stage.setCpuBudget(speed > 0.0 ? cpuBudget * speed : cpuBudget, true);
+    if (!stage.prepare(settings) || !stage.start(path)) {
+        printf("Failed to start FLAC stage (%s)\n", path.c_str());
+        return 1;
+    }
+
+    char pacing[32] = "unthrottled";
+    if (speed > 0.0) {
+        snprintf(pacing, sizeof(pacing), "%.1fx real time", speed);
+    }
+    printf("FLAC encoder benchmark: %.0f s stereo %d-bit at %.0f Hz, %s, budget %.0f%% of a core\n",
+           seconds, bitsPerSample, SAMPLE_RATE, pacing, cpuBudget * 100.0);
+
+    // Remember which blocks the stage accepted so the comparison can skip drops
+    std::vector<bool> accepted;
+    accepted.reserve(static_cast<size_t>(totalFrames / BLOCK_SIZE + 1));
+
+    const auto blockPeriod = std::chrono::duration<double>(speed > 0.0 ? BLOCK_SIZE / SAMPLE_RATE / speed : 0.0);
+    const auto start = std::chrono::steady_clock::now();
+    auto nextCallback = start;
+
+    for (int64_t offset = 0; offset < totalFrames; offset += BLOCK_SIZE) {
+        const int numSamples = static_cast<int>(std::min<int64_t>(BLOCK_SIZE, totalFrames - offset));
+        const float* channels[NUM_CHANNELS] = { input[0].data() + offset, input[1].data() + offset };
+        accepted.push_back(stage.pushBlock(channels, NUM_CHANNELS, numSamples));
+
+        if (speed > 0.0) {
+            nextCallback += std::chrono::duration_cast<std::chrono::steady_clock::duration>(blockPeriod);
+            std::this_thread::sleep_until(nextCallback);
+        }
+    }
+
+    const bool stopped = stage.stop();
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const FlacEncoderStage::Statistics stats = stage.getStatistics();
+
+    printf("Encoded %llu frames, %llu samples/ch, %.2f MB in %.2f s\n",
+           static_cast<unsigned long long>(stats.framesEncoded),
+           static_cast<unsigned long long>(stats.samplesEncoded),
+           stats.bytesWritten / (1024.0 * 1024.0), elapsed);
+    printf("Compression ratio: %.3f   load avg %.2f%% peak %.2f%% of real time   worker CPU %.2f s   LPC order %d\n",
+           stats.compressionRatio, stats.averageLoad * 100.0, stats.peakLoad * 100.0,
+           stats.workerCpuSeconds, stats.currentLpcOrder);
+    printf("Dropped: %llu samples/ch\n", static_cast<unsigned long long>(stats.droppedSamples));
+
+    if (!stopped || stage.hasEncodeError()) {
+        printf("FAIL: encoder reported an error\n");
+        return 1;
+    }
+
+    // Decode and compare against the quantized accepted input
+    std::vector<float> decoded[NUM_CHANNELS];
+    if (!readWholeFile(path, decoded)) {
+        printf("FAIL: could not decode %s\n", path.c_str());
+        return 1;
+    }
+
+    const float scale = static_cast<float>(1 << (bitsPerSample - 1));
+    size_t position = 0;
+    uint64_t mismatches = 0;
+    for (size_t block = 0; block < accepted.size(); ++block) {
+        if (!accepted[block]) continue;
+
+        const int64_t offset = static_cast<int64_t>(block) * BLOCK_SIZE;
+        const int numSamples = static_cast<int>(std::min<int64_t>(BLOCK_SIZE, totalFrames - offset));
+        for (int i = 0; i < numSamples; ++i, ++position) {
+            for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+                if (position >= decoded[ch].size() ||
+                    static_cast<int32_t>(decoded[ch][position] * scale) !=
+                    FlacEncoder::floatToSample(input[ch][offset + i], bitsPerSample)) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+
+    if (mismatches > 0 || position != decoded[0].size()) {
+        printf("FAIL: %llu mismatching samples (%zu expected, %zu decoded)\n",
+               static_cast<unsigned long long>(mismatches), position, decoded[0].size());
+        return 1;
+    }
+
+    printf("PASS: %zu frames decode bit-exact\n", position);
+    return 0;
+}
@@ -0,0 +1,498 @@
+// Offline RT60 calibration sweep for the FDN loop gain (DecayCalibration.hpp).
+// For every decay x size x HF damping x LF damping x sample rate grid point,
+// an 8-line FDNReverb renders impulse responses with its loop gain set
+// directly, the broadband RT60 is measured (Schroeder backward integration,
+// T30 fit from -5 to -35 dB), and the loop-delay correction is iterated until
+// the measured RT60 is within 1% of the target. Cells of the grid run on all
+// cores. The result is written as Reverb/Shared/DSP/DecayCalibrationTable.cpp,
+// which is compiled into the library.
+//
+// Some points are out of reach; the table stays monotone across the boundary
+// (a shorter decay never gets a slower loop). Decays longer than the stability
+// limit allows (heavy damping) store the limit. Decays under the floor of the
+// network keep the uncalibrated gain, clamped to be no slower than the loop at
+// the shortest decay reached: a component independent of the loop gain (about
+// -25 dB, 0.2-0.3 s after the impulse) holds the measured RT60 above 0.1-0.9 s
+// depending on size and damping. Below the floor the measurement still follows
+// the gain a little, so the -60 dB per pass end of the range would overshoot
+// once interpolated toward reachable neighbours.
+//
+// --verify skips the sweep and measures the compiled-in table instead, on
+// points between the grid nodes, through the normal setter path, next to the
+// uncalibrated formula. What remains is mostly decays of a few loop passes
+// and the extremes of HF plus LF damping.
+//
+// Usage: rt60_calibration [--threads N] [--output DecayCalibrationTable.cpp]
+//        rt60_calibration --verify [--threads N] [--tolerance 0.1]
+// Exit status: 0 done (verify: p95 error within tolerance), 1 verify failed,
+// 2 usage or output error.
+
+#include "DecayCalibration.hpp"
+#include "FDNReverb.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace VoiceMonitor {
+
+// Drives one FDNReverb with a forced loop gain (friend of FDNReverb)
+class RT60Calibration {
+public:
+    static constexpr int BLOCK_SIZE = SIMDOptimizer::BLOCK_SIZE;  // Most processStereo() takes per call
+    static constexpr float DENSITY = 0.7f;          // ReverbEngine default (70%)
+    static constexpr double MAX_IR_SECONDS = 14.0;
+    static constexpr double MIN_FIT_SPAN_DB = 10.0;
+
+    RT60Calibration(double sampleRate, float roomSize, float hfDamping, float lfDamping)
+        : fdn_(sampleRate, FDNReverb::DEFAULT_DELAY_LINES)
+        , sampleRate_(sampleRate) {
+        // As configured by ReverbEngine: spread and tone are applied after the FDN
+        fdn_.setOutputStageEnabled(false);
+        fdn_.setDensity(DENSITY);
+        fdn_.setRoomSize(roomSize);
+        fdn_.setHighFreqDamping(hfDamping);
+        fdn_.setLowFreqDamping(lfDamping);
+    }
+
+    void setDecayTime(float seconds) { fdn_.setDecayTime(seconds); }
+
+    // Decay setupFeedbackMatrix() actually targets for a requested one
+    float getTargetDecay(float seconds) const {
+        const float decay = std::clamp(seconds, 0.1f, 10.0f);
+        return std::max(std::min(decay, const_cast<FDNReverb&>(fdn_).calculateMaxDecayForSize(fdn_.roomSize_)), 0.05f);
+    }
+
+    // Mean loop delay in seconds, as setupFeedbackMatrix() uses it
+    double getLoopDelaySeconds() const {
+        return const_cast<FDNReverb&>(fdn_).calculateAverageDelayTime() / fdn_.loopSampleRate_;
+    }
+
+    // Broadband RT60 with the loop gain (matrix and damping filters) forced to `gain`
+    double measureWithGain(float gain, double seconds) {
+        fdn_.reset();
+        fdn_.applyLoopGain(gain);
+        return measureImpulse(seconds);
+    }
+
+    // Broadband RT60 of the network as its setters configured it
+    double measure(double seconds) {
+        fdn_.reset();
+        return measureImpulse(seconds);
+    }
+
+private:
+    double measureImpulse(double seconds) {
+        const int length = static_cast<int>(std::min(seconds, MAX_IR_SECONDS) * sampleRate_);
+        float inputL[BLOCK_SIZE] = {};
+        float inputR[BLOCK_SIZE] = {};
+        float outputL[BLOCK_SIZE];
+        float outputR[BLOCK_SIZE];
+        energy_.clear();
+        for (int position = 0; position < length; position += BLOCK_SIZE) {
+            inputL[0] = inputR[0] = position == 0 ? 1.0f : 0.0f;
+            fdn_.processStereo(inputL, inputR, outputL, outputR, BLOCK_SIZE);
+            for (int i = 0; i < BLOCK_SIZE; ++i) {
+                energy_.push_back(static_cast<double>(outputL[i]) * outputL[i] +
+                                  static_cast<double>(outputR[i]) * outputR[i]);
+            }
+        }
+        return schroederRT60(seconds);
+    }
+
+    // T30 from the backward-integrated energy decay curve (T20 when the
+    // response does not get to -35 dB); 6x the length when it hardly decays
+    double schroederRT60(double seconds) {
+        double remaining = 0.0;
+        for (size_t i = energy_.size(); i-- > 0;) {
+            remaining += energy_[i];
+            energy_[i] = remaining;
+        }
+        const double total = energy_.empty() ? 0.0 : energy_[0];
+        if (!(total > 0.0) || !std::isfinite(total)) {
+            return 0.0;
+        }
+
+        double sumX = 0.0, sumY = 0.0, sumXX = 0.0, sumXY = 0.0;
+        double lowest = 0.0;
+        int count = 0;
+        for (size_t i = 0; i < energy_.size(); ++i) {
+            const double decibels = 10.0 * std::log10(energy_[i] / total + 1e-300);
+            if (decibels < -35.0) {
+                break;
+            }
+            if (decibels <= -5.0) {
+                const double x = static_cast<double>(i) / sampleRate_;
+                sumX += x;
+                sumY += decibels;
+                sumXX += x * x;
+                sumXY += x * decibels;
+                ++count;
+                lowest = decibels;
+            }
+        }
+        if (count < 16 || lowest > -5.0 - MIN_FIT_SPAN_DB) {
+            return 6.0 * seconds;
+        }
+        const double slope = (count * sumXY - sumX * sumY) / (count * sumXX - sumX * sumX);
+        return slope < 0.0 ? -60.0 / slope : 6.0 * seconds;
+    }
+
+    FDNReverb fdn_;
+    double sampleRate_;
+    std::vector<double> energy_;
+};
+
+} // namespace VoiceMonitor
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr int MAX_ITERATIONS = 8;
+    constexpr double TOLERANCE = 0.01;              // Relative RT60 error to stop at
+    constexpr float MIN_LOOP_GAIN = 0.001f;         // -60 dB per pass
+    constexpr int NUM_CELLS = DecayCalibration::NUM_POINTS / DecayCalibration::NUM_DECAYS;
+    constexpr int VERIFY_POINTS = 240;
+
+    struct Cell {
+        int rate, lf, hf, size;
+    };
+
+    Cell getCell(int index) {
+        Cell cell;
+        cell.size = index % DecayCalibration::NUM_SIZES;
+        index /= DecayCalibration::NUM_SIZES;
+        cell.hf = index % DecayCalibration::NUM_HF_DAMPINGS;
+        index /= DecayCalibration::NUM_HF_DAMPINGS;
+        cell.lf = index % DecayCalibration::NUM_LF_DAMPINGS;
+        cell.rate = index / DecayCalibration::NUM_LF_DAMPINGS;
+        return cell;
+    }
+
+    struct PointResult {
+        float correction = 1.0f;
+        double measured = 0.0;
+        double error = 0.0;                         // measured / target - 1
+        bool reachable = true;
+    };
+
+    double irSeconds(double target, double longest) {
+        return std::max(target, longest) * 1.5 + 0.5;
+    }
+
+    // Correction range at a decay: from the stability limit down to -60 dB per
+    // loop pass (a decay shorter than about one pass is not the loop gain's)
+    void getCorrectionRange(RT60Calibration& calibration, double target, float& lowest, float& highest) {
+        const double loopDelay = calibration.getLoopDelaySeconds();
+        lowest = static_cast<float>(-target * std::log10(FDNReverb::MAX_LOOP_GAIN) / (3.0 * loopDelay));
+        highest = static_cast<float>(-target * std::log10(MIN_LOOP_GAIN) / (3.0 * loopDelay));
+    }
+
+    // Iterate the correction until the measured RT60 hits the target. 1/RT60
+    // is close to linear in the correction with slope 1/target, which gives the
+    // step c += 1 - target / measured; once the target is bracketed, a step out
+    // of the bracket bisects instead.
+    PointResult calibratePoint(RT60Calibration& calibration, double target, float start) {
+        const double loopDelay = calibration.getLoopDelaySeconds();
+        float lowest, highest;
+        getCorrectionRange(calibration, target, lowest, highest);
+
+        PointResult best;
+        best.error = 1e9;
+        float tooLong = lowest;         // Largest correction measured too long
+        float tooShort = highest;       // Smallest correction measured too short
+        bool haveLong = false;
+        bool haveShort = false;
+        float correction = std::clamp(start, lowest, highest);
+        double longest = target;
+        for (int iteration = 0; iteration < MAX_ITERATIONS; ++iteration) {
+            const float gain = static_cast<float>(std::pow(10.0, -3.0 * loopDelay * correction / target));
+            const double measured = calibration.measureWithGain(gain, irSeconds(target, longest));
+            longest = std::max(longest, std::min(measured, 2.0 * target));
+            const double error = measured / target - 1.0;
+            if (std::abs(error) < std::abs(best.error)) {
+                best.correction = correction;
+                best.measured = measured;
+                best.error = error;
+            }
+            if (std::abs(error) < TOLERANCE) {
+                break;
+            }
+
+            if (measured > target) {
+                tooLong = correction;
+                haveLong = true;
+            } else {
+                tooShort = correction;
+                haveShort = true;
+            }
+            float next = correction + static_cast<float>(1.0 - target / std::max(measured, 1e-3));
+            if (haveLong && haveShort && !(next > tooLong && next < tooShort)) {
+                next = 0.5f * (tooLong + tooShort);
+            }
+            next = std::clamp(next, lowest, highest);
+            if (std::abs(next - correction) < 1e-4f) {
+                break;      // Pinned at a limit, or the bracket has closed
+            }
+            correction = next;
+        }
+        best.reachable = std::abs(best.error) < 5.0 * TOLERANCE;
+        return best;
+    }
+
+    int runSweep(int threads, const char* outputPath) {
+        std::vector<PointResult> results(DecayCalibration::NUM_POINTS);
+        std::vector<double> floors(NUM_CELLS);      // Shortest RT60 measured, 0 when all decays reached
+        std::atomic<int> nextCell{0};
+        std::atomic<int> doneCells{0};
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&] {
+                for (int c = nextCell.fetch_add(1); c < NUM_CELLS; c = nextCell.fetch_add(1)) {
+                    const Cell cell = getCell(c);
+                    RT60Calibration calibration(DecayCalibration::RATES[cell.rate], DecayCalibration::SIZES[cell.size],
+                                                DecayCalibration::HF_DAMPINGS[cell.hf],
+                                                DecayCalibration::LF_DAMPINGS[cell.lf]);
+                    // Longest decay first: the shortest decays hit the floor, where
+                    // the measured RT60 stops following the correction; those keep
+                    // the uncalibrated gain, clamped (see the header)
+                    float previous = 1.0f;
+                    float reachedCorrection = 0.0f;     // At the shortest decay reached so far
+                    float reachedDecay = 0.0f;
+                    double floor = 0.0;
+                    for (int d = DecayCalibration::NUM_DECAYS - 1; d >= 0; --d) {
+                        const float decay = DecayCalibration::DECAYS[d];
+                        PointResult& result =
+                            results[DecayCalibration::getIndex(cell.rate, cell.lf, cell.hf, cell.size, d)];
+                        float lowest, highest;
+                        getCorrectionRange(calibration, decay, lowest, highest);
+                        // The loop gain only depends on correction / decay
+                        const float atReachedGain = reachedDecay > 0.0f ? reachedCorrection * decay / reachedDecay : 1.0f;
+                        const float belowFloor = std::min(std::max(1.0f, atReachedGain), highest);
+                        if (floor > 0.0) {
+                            result.correction = belowFloor;
+                            result.measured = floor;
+                            result.reachable = false;
+                            continue;
+                        }
+                        result = calibratePoint(calibration, decay, previous);
+                        previous = result.correction;
+                        if (result.reachable) {
+                            reachedCorrection = result.correction;
+                            reachedDecay = decay;
+                        } else if (result.measured > decay) {
+                            floor = result.measured;
+                            result.correction = belowFloor;
+                        } else {
+                            result.correction = lowest;
+                        }
+                    }
+                    floors[c] = floor;
+                    doneCells.fetch_add(1);
+                }
+            });
+        }
+        for (int seconds = 1; doneCells.load() < NUM_CELLS; ++seconds) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            if (seconds % 60 == 0) {
+                printf("  %3d/%d cells, %d s\n", doneCells.load(), NUM_CELLS, seconds);
+                fflush(stdout);
+            }
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        // Residual error over reachable points
+        std::vector<double> errors;
+        int tooShort = 0;
+        int tooLong = 0;
+        double lowestFloor = 1e9;
+        double highestFloor = 0.0;
+        for (int c = 0; c < NUM_CELLS; ++c) {
+            const Cell cell = getCell(c);
+            for (int d = 0; d < DecayCalibration::NUM_DECAYS; ++d) {
+                const PointResult& result = results[DecayCalibration::getIndex(cell.rate, cell.lf, cell.hf, cell.size, d)];
+                if (result.reachable) {
+                    errors.push_back(std::abs(result.error));
+                } else if (result.measured > DecayCalibration::DECAYS[d]) {
+                    ++tooShort;
+                } else {
+                    ++tooLong;
+                }
+            }
+            if (floors[c] > 0.0) {
+                lowestFloor = std::min(lowestFloor, floors[c]);
+                highestFloor = std::max(highestFloor, floors[c]);
+            }
+        }
+        std::sort(errors.begin(), errors.end());
+        const double meanError = errors.empty() ? 0.0 :
+            std::accumulate(errors.begin(), errors.end(), 0.0) / static_cast<double>(errors.size());
+        printf("\n  %zu/%d points reached, residual error mean %.2f%%, max %.2f%%\n", errors.size(),
+               DecayCalibration::NUM_POINTS, meanError * 100.0, errors.empty() ? 0.0 : errors.back() * 100.0);
+        if (tooShort > 0) {
+            printf("  %d points below the shortest decay the network measures (%.2f - %.2f s)\n", tooShort,
+                   lowestFloor, highestFloor);
+        }
+        if (tooLong > 0) {
+            printf("  %d points beyond the stability limit\n", tooLong);
+        }
+
+        FILE* file = fopen(outputPath, "w");
+        if (!file) {
+            printf("Cannot write %s\n", outputPath);
+            return 2;
+        }
+        fprintf(file, "// Generated by Tools/RT60Calibration.cpp - do not edit by hand\n\n");
+        fprintf(file, "#include \"DecayCalibration.hpp\"\n\nnamespace VoiceMonitor {\n\n");
+        fprintf(file, "const float DecayCalibration::TABLE[DecayCalibration::NUM_POINTS] = {\n");
+        for (int c = 0; c < NUM_CELLS; ++c) {
+            const Cell cell = getCell(c);
+            fprintf(file, "    // %.0f Hz, LF %g, HF %g, size %g\n   ", DecayCalibration::RATES[cell.rate],
+                    DecayCalibration::LF_DAMPINGS[cell.lf], DecayCalibration::HF_DAMPINGS[cell.hf],
+                    DecayCalibration::SIZES[cell.size]);
+            for (int d = 0; d < DecayCalibration::NUM_DECAYS; ++d) {
+                fprintf(file, " %.4ff,",
+                        results[DecayCalibration::getIndex(cell.rate, cell.lf, cell.hf, cell.size, d)].correction);
+            }
+            fprintf(file, "\n");
+        }
+        fprintf(file, "};\n\n} // namespace VoiceMonitor\n");
+        const bool written = fclose(file) == 0;
+        printf("  Wrote %s\n", outputPath);
+        return written ? 0 : 2;
+    }
+
+    // Compiled-in table against the uncalibrated formula, on random points off
+    // the grid. Points whose correction sits at either end of its range, or
+    // under the floor, are counted apart: no correction can move them.
+    int runVerify(int threads, double tolerance) {
+        struct VerifyPoint {
+            float rate, size, hf, lf, decay;
+            double target = 0.0;
+            double calibrated = 0.0;
+            double uncalibrated = 0.0;
+            bool limited = false;
+        };
+        const float rates[] = { 44100.0f, 48000.0f, 64000.0f, 96000.0f };
+        std::mt19937 random(50);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::vector<VerifyPoint> points(VERIFY_POINTS);
+        for (VerifyPoint& point : points) {
+            point.rate = rates[random() % 4];
+            point.size = unit(random);
+            point.hf = unit(random);
+            point.lf = unit(random);
+            point.decay = 0.15f * std::pow(6.0f / 0.15f, unit(random));     // Log-spaced 0.15 - 6 s
+        }
+
+        std::atomic<int> next{0};
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&] {
+                for (int i = next.fetch_add(1); i < VERIFY_POINTS; i = next.fetch_add(1)) {
+                    VerifyPoint& point = points[i];
+                    RT60Calibration calibration(point.rate, point.size, point.hf, point.lf);
+                    calibration.setDecayTime(point.decay);
+                    point.target = calibration.getTargetDecay(point.decay);
+
+                    const double loopDelay = calibration.getLoopDelaySeconds();
+                    float lowest, highest;
+                    getCorrectionRange(calibration, point.target, lowest, highest);
+                    const float correction = DecayCalibration::getCorrection(static_cast<float>(point.target),
+                                                                             point.size, point.hf, point.lf, point.rate);
+                    point.limited = correction <= lowest + 0.01f || correction >= highest - 0.01f;
+
+                    const double seconds = irSeconds(point.target, point.target);
+                    point.calibrated = calibration.measure(seconds);
+                    // Out of reach when no faster (slower) loop gets there either
+                    if (point.calibrated > point.target * (1.0 + 5.0 * TOLERANCE)) {
+                        point.limited = calibration.measureWithGain(MIN_LOOP_GAIN, seconds) > point.target;
+                    } else if (point.calibrated < point.target * (1.0 - 5.0 * TOLERANCE)) {
+                        point.limited = calibration.measureWithGain(FDNReverb::MAX_LOOP_GAIN, seconds) < point.target;
+                    }
+                    const float gain = std::min(static_cast<float>(std::pow(10.0, -3.0 * loopDelay / point.target)),
+                                                FDNReverb::MAX_LOOP_GAIN);
+                    point.uncalibrated = calibration.measureWithGain(gain, seconds);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        std::vector<double> calibratedErrors;
+        std::vector<double> uncalibratedErrors;
+        int limited = 0;
+        for (const VerifyPoint& point : points) {
+            if (point.limited) {
+                ++limited;
+                continue;
+            }
+            calibratedErrors.push_back(std::abs(point.calibrated / point.target - 1.0));
+            uncalibratedErrors.push_back(std::abs(point.uncalibrated / point.target - 1.0));
+        }
+        if (calibratedErrors.empty()) {
+            printf("No verifiable points\n");
+            return 1;
+        }
+        const auto summarize = [](const char* name, std::vector<double>& errors) {
+            std::sort(errors.begin(), errors.end());
+            const double mean = std::accumulate(errors.begin(), errors.end(), 0.0) / static_cast<double>(errors.size());
+            const double p95 = errors[std::min(errors.size() - 1, errors.size() * 95 / 100)];
+            printf("  %-14s mean %6.2f%%   p95 %6.2f%%   max %6.2f%%\n", name, mean * 100.0, p95 * 100.0,
+                   errors.back() * 100.0);
+            return p95;
+        };
+        printf("\n  RT60 error over %zu points (%d more out of reach):\n", calibratedErrors.size(), limited);
+        summarize("uncalibrated", uncalibratedErrors);
+        const double p95 = summarize("calibrated", calibratedErrors);
+        const bool passed = p95 <= tolerance;
+        printf("\n  %s (p95 tolerance %.1f%%)\n", passed ? "PASSED" : "FAILED", tolerance * 100.0);
+        return passed ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    int threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const char* outputPath = "DecayCalibrationTable.cpp";
+    bool verify = false;
+    double tolerance = 0.1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--verify") == 0) {
+            verify = true;
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = std::atof(argv[++i]);
+        } else {
+            printf("Usage: %s [--threads n] [--output DecayCalibrationTable.cpp]\n"
+                   "       %s --verify [--threads n] [--tolerance 0.1]\n", argv[0], argv[0]);
+            return 2;
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    int status;
+    if (verify) {
+        printf("\nRT60 calibration check: %d points, %d threads\n", VERIFY_POINTS, threads);
+        status = runVerify(threads, tolerance);
+    } else {
+        printf("\nRT60 calibration sweep: %d points (%d cells), %d threads\n", DecayCalibration::NUM_POINTS,
+               NUM_CELLS, threads);
+        status = runSweep(threads, outputPath);
+    }
+    printf("  %.0f s\n", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    return status;
+}
@@ -0,0 +1,315 @@
+// Simulated real-time audio driver (Linux): a SCHED_FIFO thread woken by an
+// absolute clock_nanosleep() period timer calls ReverbEngine::processBlock(),
+// like the iOS render thread does, for every buffer size and sample rate given.
+// Each run reports the wake-up jitter (how late the timer woke the thread), the
+// processing time against the period and the deadline misses, optionally with
+// co-running noise threads thrashing the caches.
+//
+// Usage: realtime_driver_simulation [--rates 44100,48000] [--buffers 64,128,256]
+//            [--seconds 5] [--priority 80] [--cpu N] [--noise N] [--max-misses N]
+//        --priority 0 runs at SCHED_OTHER; without permission for SCHED_FIFO
+//        (CAP_SYS_NICE / rtprio limit) the thread falls back to it and says so.
+//        --max-misses makes the exit status fail when any run misses more
+//        deadlines than that (for CI).
+// Exit status: 0 pass, 1 too many misses or a run that could not start,
+// 2 usage error.
+
+#include "ReverbEngine.hpp"
+#include "BlockTimeHistogram.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr int NUM_CHANNELS = 2;
+    constexpr int WARMUP_PERIODS = 50;
+    constexpr size_t NOISE_BUFFER_BYTES = 16 << 20;     // Well past the last-level cache
+    constexpr int NOISE_STRIDE = 64;                    // One cache line per touch
+
+    struct Config {
+        double sampleRate = 48000.0;
+        int bufferSize = 256;
+        double seconds = 5.0;
+        int priority = 80;
+        int cpu = -1;
+    };
+
+    struct Result {
+        bool realtime = false;                  // Got SCHED_FIFO
+        uint64_t periods = 0;
+        uint64_t periodNanoseconds = 0;
+        uint64_t deadlineMisses = 0;            // Callback finished after the next wake-up was due
+        uint64_t skippedPeriods = 0;            // Whole periods lost to late callbacks
+        BlockTimeHistogram::Snapshot wakeJitter;    // Wake-up time - scheduled time
+        BlockTimeHistogram::Snapshot processing;    // processBlock() time
+    };
+
+    uint64_t toNanoseconds(const timespec& ts) {
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    timespec toTimespec(uint64_t nanoseconds) {
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(nanoseconds / 1000000000ull);
+        ts.tv_nsec = static_cast<long>(nanoseconds % 1000000000ull);
+        return ts;
+    }
+
+    uint64_t monotonicNow() {
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return toNanoseconds(ts);
+    }
+
+    std::vector<double> parseList(const char* text) {
+        std::vector<double> values;
+        std::string item;
+        for (const char* p = text;; ++p) {
+            if (*p == ',' || *p == '\0') {
+                if (!item.empty()) {
+                    values.push_back(std::atof(item.c_str()));
+                    item.clear();
+                }
+                if (*p == '\0') {
+                    break;
+                }
+            } else {
+                item.push_back(*p);
+            }
+        }
+        return values;
+    }
+
+    // Co-running load: streams through a buffer larger than the caches so the
+    // audio thread finds its working set evicted, with a syscall now and then
+    void noiseLoop(const std::atomic<bool>& running, uint32_t seed) {
+        std::vector<uint8_t> buffer(NOISE_BUFFER_BYTES, 1);
+        uint32_t state = seed;
+        while (running.load(std::memory_order_relaxed)) {
+            for (size_t i = 0; i < buffer.size(); i += NOISE_STRIDE) {
+                state = state * 1664525u + 1013904223u;
+                buffer[i] = static_cast<uint8_t>(buffer[i] + (state >> 24));
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // The callback thread: wait for the period boundary, render, repeat
+    void driverLoop(ReverbEngine& engine, const Config& config, Result& result) {
+        const int blockSize = config.bufferSize;
+        std::vector<float> input[NUM_CHANNELS];
+        std::vector<float> output[NUM_CHANNELS];
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> noise(-0.2f, 0.2f);
+        for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+            input[ch].resize(blockSize);
+            output[ch].assign(blockSize, 0.0f);
+            for (float& sample : input[ch]) {
+                sample = noise(rng);
+            }
+        }
+        const float* inputs[NUM_CHANNELS] = { input[0].data(), input[1].data() };
+        float* outputs[NUM_CHANNELS] = { output[0].data(), output[1].data() };
+
+        const uint64_t period = static_cast<uint64_t>(1e9 * blockSize / config.sampleRate);
+        const uint64_t numPeriods = static_cast<uint64_t>(config.seconds * config.sampleRate / blockSize);
+        BlockTimeHistogram wakeJitter;
+        BlockTimeHistogram processing;
+
+        uint64_t next = monotonicNow() + period;
+        for (uint64_t i = 0; i < WARMUP_PERIODS + numPeriods; ++i) {
+            const timespec deadline = toTimespec(next);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+            }
+            const uint64_t wake = monotonicNow();
+            engine.processBlock(inputs, outputs, NUM_CHANNELS, blockSize);
+            const uint64_t done = monotonicNow();
+
+            if (i >= WARMUP_PERIODS) {
+                wakeJitter.record(wake - std::min(wake, next), period);
+                processing.record(done - wake, period);
+                ++result.periods;
+                if (done > next + period) {
+                    ++result.deadlineMisses;
+                }
+            }
+
+            // Like a device: the period clock keeps running, periods that
+            // passed while we were late are lost rather than rendered in a burst
+            next += period;
+            if (done > next) {
+                const uint64_t lost = (done - next) / period + 1;
+                next += lost * period;
+                if (i >= WARMUP_PERIODS) {
+                    result.skippedPeriods += lost;
+                }
+            }
+        }
+
+        result.periodNanoseconds = period;
+        result.wakeJitter = wakeJitter.snapshot();
+        result.processing = processing.snapshot();
+    }
+
+    struct DriverArguments {
+        ReverbEngine* engine;
+        const Config* config;
+        Result* result;
+    };
+
+    void* driverThread(void* argument) {
+        auto* arguments = static_cast<DriverArguments*>(argument);
+        driverLoop(*arguments->engine, *arguments->config, *arguments->result);
+        return nullptr;
+    }
+
+    bool runDriver(ReverbEngine& engine, const Config& config, Result& result) {
+        DriverArguments arguments = { &engine, &config, &result };
+        pthread_attr_t attributes;
+        pthread_attr_init(&attributes);
+
+        if (config.cpu >= 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(config.cpu, &set);
+            pthread_attr_setaffinity_np(&attributes, sizeof(set), &set);
+        }
+
+        pthread_t thread;
+        int error = EPERM;
+        if (config.priority > 0) {
+            sched_param param;
+            param.sched_priority = std::clamp(config.priority, sched_get_priority_min(SCHED_FIFO),
+                                              sched_get_priority_max(SCHED_FIFO));
+            pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED);
+            pthread_attr_setschedpolicy(&attributes, SCHED_FIFO);
+            pthread_attr_setschedparam(&attributes, &param);
+            error = pthread_create(&thread, &attributes, driverThread, &arguments);
+            result.realtime = error == 0;
+        }
+        if (error != 0) {
+            // No real-time permission (or not asked for): same loop at normal priority
+            pthread_attr_setinheritsched(&attributes, PTHREAD_INHERIT_SCHED);
+            error = pthread_create(&thread, &attributes, driverThread, &arguments);
+        }
+        pthread_attr_destroy(&attributes);
+
+        if (error != 0) {
+            printf("Failed to start driver thread: %s\n", strerror(error));
+            return false;
+        }
+        pthread_join(thread, nullptr);
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<double> sampleRates = { 48000.0 };
+    std::vector<double> bufferSizes = { 64.0, 128.0, 256.0 };
+    Config config;
+    int noiseThreads = 0;
+    long maxMisses = -1;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--rates") == 0 && i + 1 < argc) {
+            sampleRates = parseList(argv[++i]);
+        } else if (std::strcmp(argv[i], "--buffers") == 0 && i + 1 < argc) {
+            bufferSizes = parseList(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            config.seconds = std::max(0.1, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--priority") == 0 && i + 1 < argc) {
+            config.priority = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--cpu") == 0 && i + 1 < argc) {
+            config.cpu = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--noise") == 0 && i + 1 < argc) {
+            noiseThreads = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--max-misses") == 0 && i + 1 < argc) {
+            maxMisses = std::atol(argv[++i]);
+        } else {
+            printf("Usage: %s [--rates 44100,48000] [--buffers 64,128,256] [--seconds s] [--priority p] "
+                   "[--cpu n] [--noise n] [--max-misses n]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::atomic<bool> noiseRunning{true};
+    std::vector<std::thread> noise;
+    for (int i = 0; i < noiseThreads; ++i) {
+        noise.emplace_back(noiseLoop, std::cref(noiseRunning), 1234u + static_cast<uint32_t>(i));
+    }
+
+    printf("\nReal-time driver simulation: %.1f s per run, priority %d%s, %d noise thread%s\n",
+           config.seconds, config.priority, config.cpu >= 0 ? (" on cpu " + std::to_string(config.cpu)).c_str() : "",
+           noiseThreads, noiseThreads == 1 ? "" : "s");
+    printf("%7s %6s %8s %6s | %8s %8s %8s | %8s %8s %8s %6s | %6s %6s\n",
+           "rate", "frames", "period", "sched", "wake p50", "wake p99", "wake max",
+           "proc avg", "proc p99", "proc max", "load", "misses", "lost");
+    printf("%7s %6s %8s %6s | %8s %8s %8s | %8s %8s %8s %6s | %6s %6s\n",
+           "Hz", "", "us", "", "us", "us", "us", "us", "us", "us", "p99%", "", "");
+
+    bool passed = true;
+    for (double sampleRate : sampleRates) {
+        for (double bufferSize : bufferSizes) {
+            Config run = config;
+            run.sampleRate = sampleRate;
+            run.bufferSize = static_cast<int>(bufferSize);
+
+            // A fresh engine per run, at a fixed tier so runs compare the scheduling
+            auto engine = std::make_unique<ReverbEngine>();
+            if (!engine->initialize(run.sampleRate, run.bufferSize)) {
+                printf("%7.0f %6d   engine initialization failed\n", run.sampleRate, run.bufferSize);
+                passed = false;
+                continue;
+            }
+            engine->setAdaptiveQuality(false);
+            engine->setPreset(ReverbEngine::Preset::Studio);
+
+            // Page faults on the callback thread would show up as jitter; lock
+            // what is mapped now (fails quietly without the memlock limit)
+            mlockall(MCL_CURRENT);
+
+            Result result;
+            if (!runDriver(*engine, run, result)) {
+                return 1;
+            }
+
+            const double period = static_cast<double>(result.periodNanoseconds);
+            printf("%7.0f %6d %8.1f %6s | %8.1f %8.1f %8.1f | %8.1f %8.1f %8.1f %6.1f | %6llu %6llu\n",
+                   run.sampleRate, run.bufferSize, period * 1e-3, result.realtime ? "fifo" : "other",
+                   result.wakeJitter.getPercentile(50.0) * 1e-3, result.wakeJitter.getPercentile(99.0) * 1e-3,
+                   result.wakeJitter.maxNanoseconds * 1e-3, result.processing.getMeanNanoseconds() * 1e-3,
+                   result.processing.getPercentile(99.0) * 1e-3, result.processing.maxNanoseconds * 1e-3,
+                   100.0 * result.processing.getPercentile(99.0) / period,
+                   static_cast<unsigned long long>(result.deadlineMisses),
+                   static_cast<unsigned long long>(result.skippedPeriods));
+
+            if (maxMisses >= 0 && result.deadlineMisses > static_cast<uint64_t>(maxMisses)) {
+                passed = false;
+            }
+        }
+    }
+
+    noiseRunning.store(false, std::memory_order_relaxed);
+    for (auto& thread : noise) {
+        thread.join();
+    }
+
+    if (maxMisses >= 0) {
+        printf("\n%s (at most %ld deadline misses per run)\n", passed ? "PASSED" : "FAILED", maxMisses);
+    }
+    return passed ? 0 : 1;
+}
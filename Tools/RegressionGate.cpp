@@ -0,0 +1,582 @@
+// Sound and speed regression gate for the DSP core. Fixed stimuli (impulse,
+// log sweep, noise burst, speech-like bursts) are rendered through every preset
+// at a fixed quality tier and reduced to a signature: per-channel level and
+// first-difference (high-frequency) level in 20 ms windows, in dB. The gate
+// fails when
+//   - a signature drifts from the stored golden one by more than the tolerance
+//     (windows below the noise floor in both are ignored),
+//   - the scalar FDN kernels (setSIMDEnabled(false)) disagree with the SIMD ones,
+//   - a preset renders significantly slower than the stored timing baseline:
+//     one-sided Mann-Whitney U test over repeated timings, p < 0.01, with the
+//     median at least 5% slower,
+//   - in a real-time safety checked build (ENABLE_RT_SAFETY_CHECKS), anything
+//     inside processBlock allocated, locked or blocked, in the renders or under
+//     mid-block automation, tier switches and tail decimation changes.
+// Golden signatures live in the source tree; timing baselines are machine
+// specific and kept wherever --timing points (skipped when the file is absent).
+//
+// Usage: regression_gate [--golden file] [--timing file] [--update-golden]
+//                        [--update-timing] [--skip-timing] [--tolerance-db x]
+// Exit status: 0 pass, 1 regression, 2 usage or file error.
+
+#include "FDNReverb.hpp"
+#include "RealtimeSafety.hpp"
+#include "ReverbEngine.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef REGRESSION_DATA_DIR
+#define REGRESSION_DATA_DIR "Tools/RegressionData"
+#endif
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr double SAMPLE_RATE = 48000.0;
+    constexpr int BLOCK_SIZE = 256;
+    constexpr int RENDER_FRAMES = 96000;            // 2 s: onset and most of each tail
+    constexpr int WINDOW_FRAMES = 960;              // 20 ms
+    constexpr float FLOOR_DB = -120.0f;
+    constexpr float IGNORE_BELOW_DB = -90.0f;       // Both below: not compared
+    constexpr float DEFAULT_TOLERANCE_DB = 0.5f;    // Rounding and -ffast-math stay well inside
+    constexpr float SIMD_TOLERANCE_DB = 0.05f;
+    constexpr double SIMD_MAX_DIFFERENCE = 1e-4;    // Sample difference relative to peak
+    constexpr int TIMING_REPETITIONS = 21;
+    constexpr int TIMING_FRAMES = 48000;            // 1 s of audio per repetition
+    constexpr double TIMING_P_VALUE = 0.01;
+    constexpr double TIMING_SLOWDOWN = 1.05;
+
+    struct PresetInfo {
+        ReverbEngine::Preset preset;
+        const char* name;
+    };
+
+    const PresetInfo PRESETS[] = {
+        { ReverbEngine::Preset::Clean, "clean" },
+        { ReverbEngine::Preset::VocalBooth, "vocal_booth" },
+        { ReverbEngine::Preset::Studio, "studio" },
+        { ReverbEngine::Preset::Cathedral, "cathedral" }
+    };
+
+    // Deterministic on every platform (standard distributions are not)
+    class Noise {
+    public:
+        explicit Noise(uint32_t seed) : state_(seed) {}
+        float next() {
+            state_ = state_ * 1664525u + 1013904223u;
+            return static_cast<float>(state_ >> 8) / 8388608.0f - 1.0f;
+        }
+    private:
+        uint32_t state_;
+    };
+
+    struct Stimulus {
+        std::string name;
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+
+    std::vector<Stimulus> makeStimuli() {
+        std::vector<Stimulus> stimuli;
+        auto add = [&](const char* name) -> Stimulus& {
+            stimuli.push_back({ name, std::vector<float>(RENDER_FRAMES, 0.0f), std::vector<float>(RENDER_FRAMES, 0.0f) });
+            return stimuli.back();
+        };
+
+        Stimulus& impulse = add("impulse");
+        impulse.left[0] = 0.5f;
+        impulse.right[480] = 0.5f;      // 10 ms later, so the channels differ
+
+        // Exponential sweep 20 Hz - 20 kHz over 1.5 s, then the tail
+        Stimulus& sweep = add("sweep");
+        const double sweepSeconds = 1.5;
+        const double rate = std::log(20000.0 / 20.0);
+        for (int i = 0; i < static_cast<int>(sweepSeconds * SAMPLE_RATE); ++i) {
+            const double t = i / SAMPLE_RATE;
+            const double phase = 2.0 * M_PI * 20.0 * sweepSeconds / rate * (std::exp(t * rate / sweepSeconds) - 1.0);
+            sweep.left[i] = sweep.right[i] = 0.25f * static_cast<float>(std::sin(phase));
+        }
+
+        // Independent white noise per channel for 1 s
+        Stimulus& noise = add("noise");
+        Noise noiseL(11);
+        Noise noiseR(23);
+        for (int i = 0; i < static_cast<int>(SAMPLE_RATE); ++i) {
+            noise.left[i] = 0.1f * noiseL.next();
+            noise.right[i] = 0.1f * noiseR.next();
+        }
+
+        // Syllable-like bursts: noise through two formant resonators, 250 ms on
+        // with a raised-cosine envelope, 150 ms off, mono-ish source
+        Stimulus& speech = add("speech");
+        Noise source(37);
+        auto resonator = [](double frequency, double bandwidth) {
+            const double r = std::exp(-M_PI * bandwidth / SAMPLE_RATE);
+            return std::make_pair(2.0 * r * std::cos(2.0 * M_PI * frequency / SAMPLE_RATE), -r * r);
+        };
+        const auto formant1 = resonator(500.0, 120.0);
+        const auto formant2 = resonator(1500.0, 200.0);
+        double y1[2] = { 0.0, 0.0 };
+        double y2[2] = { 0.0, 0.0 };
+        const int burstFrames = 12000;
+        const int periodFrames = 19200;
+        for (int i = 0; i < static_cast<int>(1.6 * SAMPLE_RATE); ++i) {
+            const double x = source.next();
+            const double a = formant1.first * y1[0] + formant1.second * y1[1] + x;
+            const double b = formant2.first * y2[0] + formant2.second * y2[1] + x;
+            y1[1] = y1[0];
+            y1[0] = a;
+            y2[1] = y2[0];
+            y2[0] = b;
+
+            const int position = i % periodFrames;
+            const double envelope = position < burstFrames
+                ? 0.5 - 0.5 * std::cos(2.0 * M_PI * position / burstFrames) : 0.0;
+            const float sample = static_cast<float>(envelope * (0.01 * a + 0.006 * b));
+            speech.left[i] = sample;
+            speech.right[i] = 0.9f * sample;
+        }
+        return stimuli;
+    }
+
+    struct Render {
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+
+    Render render(const Stimulus& stimulus, ReverbEngine::Preset preset, bool simd) {
+        ReverbEngine engine;
+        engine.initialize(SAMPLE_RATE, BLOCK_SIZE);
+        engine.setAdaptiveQuality(false);       // Timing must not change the sound
+        engine.setSIMDEnabled(simd);
+        engine.setPreset(preset);
+
+        Render result;
+        result.left.resize(RENDER_FRAMES);
+        result.right.resize(RENDER_FRAMES);
+        for (int offset = 0; offset < RENDER_FRAMES; offset += BLOCK_SIZE) {
+            const int frames = std::min(BLOCK_SIZE, RENDER_FRAMES - offset);
+            const float* inputs[2] = { stimulus.left.data() + offset, stimulus.right.data() + offset };
+            float* outputs[2] = { result.left.data() + offset, result.right.data() + offset };
+            engine.processBlock(inputs, outputs, 2, frames);
+        }
+        return result;
+    }
+
+    // Control paths the fixed-preset renders never reach, for the real-time
+    // safety check: sample-accurate size and decay automation landing mid-block,
+    // quality tier switches (with their crossfades) and tail decimation changes
+    void exerciseControlPaths(const Stimulus& stimulus) {
+        ReverbEngine engine;
+        engine.initialize(SAMPLE_RATE, BLOCK_SIZE);
+        engine.setAdaptiveQuality(false);
+        engine.setPreset(ReverbEngine::Preset::Studio);
+
+        std::vector<float> left(BLOCK_SIZE);
+        std::vector<float> right(BLOCK_SIZE);
+        int offset = 0;
+        auto run = [&](int blocks) {
+            for (int b = 0; b < blocks; ++b, offset = (offset + BLOCK_SIZE) % (RENDER_FRAMES - BLOCK_SIZE)) {
+                const float* inputs[2] = { stimulus.left.data() + offset, stimulus.right.data() + offset };
+                float* outputs[2] = { left.data(), right.data() };
+                engine.processBlock(inputs, outputs, 2, BLOCK_SIZE);
+            }
+        };
+
+        run(8);
+        for (int step = 0; step < 8; ++step) {
+            engine.scheduleParameter(ParameterId::RoomSize, (step % 2) ? 0.9f : 0.1f + 0.02f * step, 100);
+            engine.scheduleParameter(ParameterId::DecayTime, 0.5f + 0.5f * step, 37);
+            run(2);
+        }
+        for (int tier = 1; tier < QualityGovernor::NUM_TIERS; ++tier) {
+            engine.setQualityCeiling(static_cast<QualityTier>(tier));
+            run(16);
+        }
+        engine.setQualityCeiling(QualityTier::Maximum);
+        run(16);
+        for (int factor : { 2, 4, 1 }) {
+            engine.setTailDecimation(factor);
+            run(4);
+        }
+    }
+
+    // ========================================================================
+    // Signatures: "<stimulus>/<preset> <L|R> <rms|hf>" -> dB per window
+
+    using Signature = std::map<std::string, std::vector<float>>;
+
+    std::vector<float> windowLevels(const std::vector<float>& signal, bool difference) {
+        std::vector<float> levels;
+        for (size_t start = 0; start + WINDOW_FRAMES <= signal.size(); start += WINDOW_FRAMES) {
+            double energy = 0.0;
+            for (size_t i = start; i < start + WINDOW_FRAMES; ++i) {
+                const double x = difference ? signal[i] - (i > 0 ? signal[i - 1] : 0.0f) : signal[i];
+                energy += x * x;
+            }
+            const double db = 10.0 * std::log10(energy / WINDOW_FRAMES + 1e-30);
+            levels.push_back(std::max(FLOOR_DB, static_cast<float>(db)));
+        }
+        return levels;
+    }
+
+    void addSignature(Signature& signature, const std::string& caseName, const Render& output) {
+        signature[caseName + " L rms"] = windowLevels(output.left, false);
+        signature[caseName + " L hf"] = windowLevels(output.left, true);
+        signature[caseName + " R rms"] = windowLevels(output.right, false);
+        signature[caseName + " R hf"] = windowLevels(output.right, true);
+    }
+
+    bool readSignature(const std::string& path, Signature& signature) {
+        std::ifstream file(path);
+        if (!file) {
+            return false;
+        }
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream fields(line);
+            std::string caseName, channel, kind;
+            fields >> caseName >> channel >> kind;
+            std::vector<float>& values = signature[caseName + " " + channel + " " + kind];
+            float value = 0.0f;
+            while (fields >> value) {
+                values.push_back(value);
+            }
+        }
+        return true;
+    }
+
+    bool writeSignature(const std::string& path, const Signature& signature) {
+        FILE* file = fopen(path.c_str(), "w");
+        if (!file) {
+            return false;
+        }
+        fprintf(file, "# Golden output signatures: regression_gate --update-golden\n");
+        fprintf(file, "# <stimulus>/<preset> <channel> <rms|hf> dB per %d-frame window at %.0f Hz\n",
+                WINDOW_FRAMES, SAMPLE_RATE);
+        for (const auto& entry : signature) {
+            fprintf(file, "%s", entry.first.c_str());
+            for (float value : entry.second) {
+                fprintf(file, " %.2f", value);
+            }
+            fprintf(file, "\n");
+        }
+        return fclose(file) == 0;
+    }
+
+    // Largest difference over windows where either side is above the floor
+    float signatureDifference(const std::vector<float>& expected, const std::vector<float>& actual) {
+        if (expected.size() != actual.size()) {
+            return INFINITY;
+        }
+        float worst = 0.0f;
+        for (size_t i = 0; i < expected.size(); ++i) {
+            if (expected[i] > IGNORE_BELOW_DB || actual[i] > IGNORE_BELOW_DB) {
+                worst = std::max(worst, std::fabs(expected[i] - actual[i]));
+            }
+        }
+        return worst;
+    }
+
+    double relativeDifference(const Render& a, const Render& b) {
+        double peak = 1e-12;
+        double difference = 0.0;
+        for (size_t i = 0; i < a.left.size(); ++i) {
+            peak = std::max({ peak, static_cast<double>(std::fabs(a.left[i])), static_cast<double>(std::fabs(a.right[i])) });
+            difference = std::max({ difference, static_cast<double>(std::fabs(a.left[i] - b.left[i])),
+                                    static_cast<double>(std::fabs(a.right[i] - b.right[i])) });
+        }
+        return difference / peak;
+    }
+
+    // ========================================================================
+    // Timing: ns per frame for 1 s of stereo noise, per repetition
+
+    using Timings = std::map<std::string, std::vector<double>>;
+
+    std::vector<double> measureTimings(ReverbEngine::Preset preset) {
+        ReverbEngine engine;
+        engine.initialize(SAMPLE_RATE, BLOCK_SIZE);
+        engine.setAdaptiveQuality(false);
+        engine.setPreset(preset);
+
+        Noise noise(5);
+        std::vector<float> left(BLOCK_SIZE);
+        std::vector<float> right(BLOCK_SIZE);
+        for (int i = 0; i < BLOCK_SIZE; ++i) {
+            left[i] = 0.1f * noise.next();
+            right[i] = 0.1f * noise.next();
+        }
+        std::vector<float> outL(BLOCK_SIZE);
+        std::vector<float> outR(BLOCK_SIZE);
+        const float* inputs[2] = { left.data(), right.data() };
+        float* outputs[2] = { outL.data(), outR.data() };
+
+        const int blocks = TIMING_FRAMES / BLOCK_SIZE;
+        for (int b = 0; b < blocks; ++b) {
+            engine.processBlock(inputs, outputs, 2, BLOCK_SIZE);    // Warm-up: tail and caches
+        }
+
+        std::vector<double> timings;
+        for (int repetition = 0; repetition < TIMING_REPETITIONS; ++repetition) {
+            const auto start = std::chrono::steady_clock::now();
+            for (int b = 0; b < blocks; ++b) {
+                engine.processBlock(inputs, outputs, 2, BLOCK_SIZE);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            timings.push_back(std::chrono::duration<double, std::nano>(end - start).count() / (blocks * BLOCK_SIZE));
+        }
+        return timings;
+    }
+
+    bool readTimings(const std::string& path, Timings& timings) {
+        std::ifstream file(path);
+        if (!file) {
+            return false;
+        }
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream fields(line);
+            std::string name;
+            fields >> name;
+            double value = 0.0;
+            while (fields >> value) {
+                timings[name].push_back(value);
+            }
+        }
+        return true;
+    }
+
+    bool writeTimings(const std::string& path, const Timings& timings) {
+        FILE* file = fopen(path.c_str(), "w");
+        if (!file) {
+            return false;
+        }
+        fprintf(file, "# Timing baseline: regression_gate --update-timing (ns per frame, this machine only)\n");
+        for (const auto& entry : timings) {
+            fprintf(file, "%s", entry.first.c_str());
+            for (double value : entry.second) {
+                fprintf(file, " %.3f", value);
+            }
+            fprintf(file, "\n");
+        }
+        return fclose(file) == 0;
+    }
+
+    double median(std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        const size_t n = values.size();
+        return n % 2 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+    }
+
+    // One-sided Mann-Whitney U: p-value for "current tends to be larger than
+    // baseline" (normal approximation, midranks for ties)
+    double slowerPValue(const std::vector<double>& baseline, const std::vector<double>& current) {
+        struct Ranked { double value; bool isCurrent; };
+        std::vector<Ranked> all;
+        for (double v : baseline) all.push_back({ v, false });
+        for (double v : current) all.push_back({ v, true });
+        std::sort(all.begin(), all.end(), [](const Ranked& a, const Ranked& b) { return a.value < b.value; });
+
+        double rankSum = 0.0;
+        for (size_t i = 0; i < all.size();) {
+            size_t j = i;
+            while (j < all.size() && all[j].value == all[i].value) {
+                ++j;
+            }
+            const double midrank = 0.5 * (i + 1 + j);
+            for (size_t k = i; k < j; ++k) {
+                if (all[k].isCurrent) {
+                    rankSum += midrank;
+                }
+            }
+            i = j;
+        }
+
+        const double n1 = static_cast<double>(current.size());
+        const double n2 = static_cast<double>(baseline.size());
+        const double u = rankSum - n1 * (n1 + 1.0) * 0.5;
+        const double mean = n1 * n2 * 0.5;
+        const double sigma = std::sqrt(n1 * n2 * (n1 + n2 + 1.0) / 12.0);
+        const double z = (u - mean) / sigma;
+        return 0.5 * std::erfc(z / std::sqrt(2.0));
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string goldenPath = std::string(REGRESSION_DATA_DIR) + "/golden_signatures.txt";
+    std::string timingPath = "regression_timing.txt";
+    bool updateGolden = false;
+    bool updateTiming = false;
+    bool skipTiming = false;
+    float tolerance = DEFAULT_TOLERANCE_DB;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--golden") == 0 && i + 1 < argc) {
+            goldenPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--timing") == 0 && i + 1 < argc) {
+            timingPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--update-golden") == 0) {
+            updateGolden = true;
+        } else if (std::strcmp(argv[i], "--update-timing") == 0) {
+            updateTiming = true;
+        } else if (std::strcmp(argv[i], "--skip-timing") == 0) {
+            skipTiming = true;
+        } else if (std::strcmp(argv[i], "--tolerance-db") == 0 && i + 1 < argc) {
+            tolerance = static_cast<float>(std::atof(argv[++i]));
+        } else {
+            printf("Usage: %s [--golden file] [--timing file] [--update-golden] [--update-timing] "
+                   "[--skip-timing] [--tolerance-db x]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    int failures = 0;
+    std::vector<std::string> report;
+    auto fail = [&](const std::string& message) {
+        report.push_back("FAIL " + message);
+        ++failures;
+    };
+
+    // ------------------------------------------------------------------------
+    // Output: golden signatures, then scalar against SIMD
+
+    Signature golden;
+    const bool haveGolden = !updateGolden && readSignature(goldenPath, golden);
+    if (!updateGolden && !haveGolden) {
+        printf("Cannot read golden signatures %s (create them with --update-golden)\n", goldenPath.c_str());
+        return 2;
+    }
+
+    Signature current;
+    for (const Stimulus& stimulus : makeStimuli()) {
+        for (const PresetInfo& info : PRESETS) {
+            const std::string caseName = stimulus.name + "/" + info.name;
+            const Render simd = render(stimulus, info.preset, true);
+            const Render scalar = render(stimulus, info.preset, false);
+            addSignature(current, caseName, simd);
+
+            Signature scalarSignature;
+            addSignature(scalarSignature, caseName, scalar);
+            float simdDrift = 0.0f;
+            for (const auto& entry : scalarSignature) {
+                simdDrift = std::max(simdDrift, signatureDifference(current[entry.first], entry.second));
+            }
+            const double sampleDrift = relativeDifference(simd, scalar);
+            char line[160];
+            snprintf(line, sizeof(line), "%-24s scalar/SIMD %.3f dB, %.2e of peak", caseName.c_str(), simdDrift, sampleDrift);
+            if (simdDrift > SIMD_TOLERANCE_DB || sampleDrift > SIMD_MAX_DIFFERENCE) {
+                fail(line);
+            } else {
+                report.push_back(std::string("ok   ") + line);
+            }
+        }
+    }
+
+    if (updateGolden) {
+        if (!writeSignature(goldenPath, current)) {
+            printf("Cannot write %s\n", goldenPath.c_str());
+            return 2;
+        }
+        report.push_back("Golden signatures written to " + goldenPath);
+    } else {
+        for (const auto& entry : current) {
+            const auto expected = golden.find(entry.first);
+            if (expected == golden.end()) {
+                fail(entry.first + ": no golden signature");
+                continue;
+            }
+            const float drift = signatureDifference(expected->second, entry.second);
+            if (drift > tolerance) {
+                char line[160];
+                snprintf(line, sizeof(line), "%s drifted %.2f dB from golden (tolerance %.2f)",
+                         entry.first.c_str(), drift, tolerance);
+                fail(line);
+            }
+        }
+        report.push_back("Golden signatures compared: " + std::to_string(current.size()));
+    }
+
+    // ------------------------------------------------------------------------
+    // Timing against the baseline (the bypassed clean preset is not timed)
+
+    if (!skipTiming) {
+        Timings baseline;
+        const bool haveBaseline = !updateTiming && readTimings(timingPath, baseline);
+        if (!updateTiming && !haveBaseline) {
+            report.push_back("No timing baseline at " + timingPath + " (create one with --update-timing); timing skipped");
+        } else {
+            Timings measured;
+            for (const PresetInfo& info : PRESETS) {
+                if (info.preset == ReverbEngine::Preset::Clean) {
+                    continue;
+                }
+                measured[info.name] = measureTimings(info.preset);
+            }
+
+            if (updateTiming) {
+                if (!writeTimings(timingPath, measured)) {
+                    printf("Cannot write %s\n", timingPath.c_str());
+                    return 2;
+                }
+                report.push_back("Timing baseline written to " + timingPath);
+            } else {
+                for (const auto& entry : measured) {
+                    const auto expected = baseline.find(entry.first);
+                    if (expected == baseline.end() || expected->second.size() < 5) {
+                        fail(entry.first + ": no timing baseline");
+                        continue;
+                    }
+                    const double before = median(expected->second);
+                    const double after = median(entry.second);
+                    const double p = slowerPValue(expected->second, entry.second);
+                    char line[160];
+                    snprintf(line, sizeof(line), "%-12s timing %.1f -> %.1f ns/frame (%+.1f%%, p = %.4f)",
+                             entry.first.c_str(), before, after, 100.0 * (after / before - 1.0), p);
+                    if (p < TIMING_P_VALUE && after > before * TIMING_SLOWDOWN) {
+                        fail(line);
+                    } else {
+                        report.push_back(std::string("ok   ") + line);
+                    }
+                }
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Real-time safety: everything above ran processBlock under the checker,
+    // plus the automation and quality-switching paths
+
+    if (RealtimeSafety::ENABLED) {
+        exerciseControlPaths(makeStimuli().back());     // Speech-like bursts
+        const uint64_t violations = RealtimeSafety::getViolationCount();
+        if (violations > 0) {
+            fail("real-time safety: " + std::to_string(violations) +
+                 " allocations, locks or blocking calls inside processBlock (stack traces on stderr)");
+        } else {
+            report.push_back("ok   real-time safety: no violations inside processBlock");
+        }
+    }
+
+    printf("\nRegression gate (%s)\n", SIMD_AVAILABLE ? "SIMD available" : "scalar build");
+    for (const std::string& line : report) {
+        printf("%s\n", line.c_str());
+    }
+    printf("%s: %d failure%s\n", failures ? "FAILED" : "PASSED", failures, failures == 1 ? "" : "s");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,209 @@
+// Sample-rate converter throughput against stopband attenuation: for each rate
+// pair the host and offline paths meet (8-192 kHz, plus an arbitrary ratio) and
+// each quality, converts stereo noise in 512-frame blocks and times it, then
+// measures the filter with test tones: worst-case rejection of images and
+// aliases (residual after a least-squares fit at the tone, or the whole output
+// for tones above the output Nyquist) and passband ripple.
+//
+// Usage: resampler_benchmark [seconds]
+
+#include "PolyphaseResampler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr int BLOCK_SIZE = 512;
+    constexpr int NUM_CHANNELS = 2;
+    constexpr int TONES_PER_BAND = 12;
+    constexpr double TONE_SECONDS = 0.5;
+
+    struct RatePair {
+        double input;
+        double output;
+    };
+
+    constexpr RatePair RATE_PAIRS[] = {
+        { 44100.0, 48000.0 },
+        { 48000.0, 44100.0 },
+        { 8000.0, 48000.0 },
+        { 16000.0, 48000.0 },
+        { 22050.0, 44100.0 },
+        { 176400.0, 88200.0 },
+        { 192000.0, 96000.0 },
+        { 44100.0, 47999.5 }        // Arbitrary (drifting clock)
+    };
+
+    const char* qualityName(PolyphaseResampler::Quality quality) {
+        switch (quality) {
+            case PolyphaseResampler::Quality::Draft: return "draft";
+            case PolyphaseResampler::Quality::Standard: return "standard";
+            case PolyphaseResampler::Quality::High: return "high";
+            case PolyphaseResampler::Quality::Mastering: return "mastering";
+        }
+        return "?";
+    }
+
+    // Convert a whole signal (one channel) in blocks
+    std::vector<float> convert(PolyphaseResampler& resampler, const std::vector<float>& input) {
+        std::vector<float> output;
+        std::vector<float> block(resampler.getMaxOutputFrames(BLOCK_SIZE));
+        for (size_t offset = 0; offset < input.size(); offset += BLOCK_SIZE) {
+            const int frames = static_cast<int>(std::min<size_t>(BLOCK_SIZE, input.size() - offset));
+            const float* in[1] = { input.data() + offset };
+            float* out[1] = { block.data() };
+            const int produced = resampler.process(in, frames, out);
+            output.insert(output.end(), block.begin(), block.begin() + produced);
+        }
+        return output;
+    }
+
+    struct ToneResult {
+        double residualDb;      // Residual power relative to the tone
+        double gainDb;          // Fitted gain (passband tones)
+    };
+
+    // Unit-amplitude tone at `frequency`; output frame n lines up with input time n / outputRate
+    ToneResult measureTone(PolyphaseResampler& resampler, const RatePair& rates, double frequency) {
+        resampler.reset();
+        const int numInput = static_cast<int>(TONE_SECONDS * rates.input);
+        std::vector<float> input(numInput);
+        for (int i = 0; i < numInput; ++i) {
+            input[i] = static_cast<float>(std::sin(2.0 * M_PI * frequency * i / rates.input));
+        }
+        const std::vector<float> output = convert(resampler, input);
+
+        // Skip the start-up transient and the end the lookahead has not reached
+        const size_t margin = static_cast<size_t>(resampler.getNumTaps() * resampler.getRatio()) + 16;
+        if (output.size() <= 2 * margin) {
+            return { 0.0, 0.0 };
+        }
+        const size_t begin = margin;
+        const size_t end = output.size() - margin;
+        const double count = static_cast<double>(end - begin);
+
+        // Above the output Nyquist the ideal output is silence
+        if (frequency >= 0.5 * rates.output) {
+            double power = 0.0;
+            for (size_t n = begin; n < end; ++n) {
+                power += static_cast<double>(output[n]) * output[n];
+            }
+            return { 10.0 * std::log10(power / count / 0.5 + 1e-30), -300.0 };
+        }
+
+        // Least-squares fit of a sin + b cos, then the residual
+        double ss = 0.0, cc = 0.0, sc = 0.0, ys = 0.0, yc = 0.0;
+        for (size_t n = begin; n < end; ++n) {
+            const double phase = 2.0 * M_PI * frequency * n / rates.output;
+            const double s = std::sin(phase);
+            const double c = std::cos(phase);
+            ss += s * s;
+            cc += c * c;
+            sc += s * c;
+            ys += output[n] * s;
+            yc += output[n] * c;
+        }
+        const double determinant = ss * cc - sc * sc;
+        const double a = (ys * cc - yc * sc) / determinant;
+        const double b = (yc * ss - ys * sc) / determinant;
+
+        double residual = 0.0;
+        for (size_t n = begin; n < end; ++n) {
+            const double phase = 2.0 * M_PI * frequency * n / rates.output;
+            const double error = output[n] - (a * std::sin(phase) + b * std::cos(phase));
+            residual += error * error;
+        }
+
+        const double gain = std::sqrt(a * a + b * b);
+        return { 10.0 * std::log10(residual / count / 0.5 + 1e-30), 20.0 * std::log10(gain) };
+    }
+}
+
+int main(int argc, char** argv) {
+    const double seconds = (argc > 1) ? std::max(0.1, std::atof(argv[1])) : 4.0;
+
+    printf("Polyphase resampler benchmark: %.1f s stereo noise per case, %d-frame blocks\n\n", seconds, BLOCK_SIZE);
+    printf("%-18s %-10s %5s %5s %9s %8s %8s %10s %9s %8s\n",
+           "rates", "quality", "taps", "mode", "Msmp/s", "x rt", "design", "rejection", "passband", "ripple");
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+
+    for (const RatePair& rates : RATE_PAIRS) {
+        const int numInput = static_cast<int>(seconds * rates.input);
+        std::vector<float> channels[NUM_CHANNELS];
+        for (auto& channel : channels) {
+            channel.resize(numInput);
+            for (float& sample : channel) {
+                sample = noise(rng);
+            }
+        }
+
+        for (int q = 0; q <= static_cast<int>(PolyphaseResampler::Quality::Mastering); ++q) {
+            const auto quality = static_cast<PolyphaseResampler::Quality>(q);
+
+            // Throughput
+            PolyphaseResampler stereo;
+            if (!stereo.prepare(rates.input, rates.output, NUM_CHANNELS, quality)) {
+                printf("Failed to prepare %.0f -> %.1f Hz\n", rates.input, rates.output);
+                return 1;
+            }
+            std::vector<float> outputs[NUM_CHANNELS];
+            for (auto& output : outputs) {
+                output.resize(stereo.getMaxOutputFrames(BLOCK_SIZE));
+            }
+
+            int64_t produced = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (int offset = 0; offset < numInput; offset += BLOCK_SIZE) {
+                const int frames = std::min(BLOCK_SIZE, numInput - offset);
+                const float* in[NUM_CHANNELS] = { channels[0].data() + offset, channels[1].data() + offset };
+                float* out[NUM_CHANNELS] = { outputs[0].data(), outputs[1].data() };
+                produced += stereo.process(in, frames, out);
+            }
+            const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            const double samplesPerSecond = produced * NUM_CHANNELS / elapsed;
+            const double realtime = seconds / elapsed;
+
+            // Filter measurements: tones across the passband, and (downsampling)
+            // tones between the two Nyquist frequencies that must not alias back
+            PolyphaseResampler mono;
+            mono.prepare(rates.input, rates.output, 1, quality);
+            const double lowerNyquist = 0.5 * std::min(rates.input, rates.output);
+            const double passbandEdge = mono.getPassbandEdge() * lowerNyquist;
+
+            double worstRejection = -300.0;
+            double ripple = 0.0;
+            for (int t = 0; t < TONES_PER_BAND; ++t) {
+                const double frequency = passbandEdge * (0.02 + 0.98 * t / (TONES_PER_BAND - 1));
+                const ToneResult result = measureTone(mono, rates, frequency);
+                worstRejection = std::max(worstRejection, result.residualDb);
+                ripple = std::max(ripple, std::fabs(result.gainDb));
+            }
+            if (rates.output < rates.input) {
+                const double upper = 0.5 * rates.input * 0.99;
+                for (int t = 0; t < TONES_PER_BAND; ++t) {
+                    const double frequency = lowerNyquist + (upper - lowerNyquist) * (t + 0.5) / TONES_PER_BAND;
+                    const ToneResult result = measureTone(mono, rates, frequency);
+                    worstRejection = std::max(worstRejection, result.residualDb);
+                }
+            }
+
+            char label[32];
+            snprintf(label, sizeof(label), "%.0f->%.1f", rates.input, rates.output);
+            printf("%-18s %-10s %5d %5s %9.1f %8.0f %6.0fdB %8.1fdB %7.0fHz %6.4fdB\n",
+                   label, qualityName(quality), stereo.getNumTaps(), stereo.isRational() ? "rat" : "arb",
+                   samplesPerSecond * 1e-6, realtime, PolyphaseResampler::getStopbandAttenuation(quality),
+                   -worstRejection, passbandEdge, ripple);
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,328 @@
+// Offline replay of a captured session (ReverbEngine::startSessionCapture):
+// a fresh engine gets the captured configuration, then every block is re-run
+// with its recorded input, the parameter values set before it and the
+// scheduled events at the sample offsets they applied live, so a glitch heard
+// in a session can be reproduced and profiled at the desk. Quality tiers and
+// pipelined mode follow the recording block by block (--adaptive lets the
+// governor decide again instead). Only processBlock() is timed.
+//
+// Reports the distribution of replay block times next to the live ones, and
+// the slowest blocks with what changed in them. With --repeat, each block
+// keeps its fastest pass (less scheduler noise) and the passes' output must
+// be bit-identical. The replay starts from a cleared engine: a tail still
+// ringing when the capture started is not part of it.
+//
+// Usage: session_replay <session.vmsc> [--repeat 1] [--top 10]
+//                       [--render output.wav] [--json replay.json] [--adaptive]
+// Exit status: 0 replayed, 1 passes rendered different output, 2 usage or setup error.
+
+#include "BlockTimeHistogram.hpp"
+#include "ReverbEngine.hpp"
+#include "SessionReader.hpp"
+#include "WavFileWriter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr int NUM_CHANNELS = 2;
+
+    // In ParameterId order
+    const char* const PARAMETER_NAMES[SessionCapture::NUM_PARAMETERS] = {
+        "mix", "decay", "pre_delay", "cross_feed", "room_size", "density", "hf_damping",
+        "lf_damping", "width", "phase_invert", "bypass", "input_gain", "output_gain"
+    };
+
+    struct Config {
+        const char* sessionPath = nullptr;
+        int repeat = 1;
+        int top = 10;
+        const char* renderPath = nullptr;
+        const char* jsonPath = nullptr;
+        bool adaptive = false;
+    };
+
+    struct BlockResult {
+        uint64_t startFrame = 0;
+        uint32_t numSamples = 0;
+        uint32_t liveNanoseconds = 0;
+        uint64_t replayNanoseconds = UINT64_MAX;    // Fastest pass
+        uint16_t changedMask = 0;                   // Parameters set or scheduled in the block
+        uint8_t tier = 0;
+    };
+
+    struct Pass {
+        bool ok = false;
+        bool truncated = false;
+        uint64_t outputHash = 1469598103934665603ull;
+    };
+
+    // FNV-1a over the output bits: passes must agree exactly
+    void hashSamples(uint64_t& hash, const float* samples, int numSamples) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(samples);
+        for (size_t i = 0; i < static_cast<size_t>(numSamples) * sizeof(float); ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    }
+
+    Pass replay(const Config& config, int passIndex, std::vector<BlockResult>& results) {
+        Pass pass;
+        SessionReader reader;
+        if (!reader.open(config.sessionPath)) {
+            return pass;
+        }
+        const SessionCapture::Header& header = reader.getHeader();
+
+        ReverbEngine engine;
+        if (!engine.initialize(header.sampleRate, static_cast<int>(header.maxBlockSize))) {
+            printf("Engine rejected %.0f Hz / %u frames\n", header.sampleRate, header.maxBlockSize);
+            return pass;
+        }
+        engine.setTailDecimation(header.tailDecimation);
+        engine.setSIMDEnabled(header.simdEnabled != 0);
+        if (config.adaptive) {
+            engine.setAdaptiveQuality(header.adaptiveQuality != 0);
+            engine.setQualityCeiling(static_cast<QualityTier>(header.qualityCeiling));
+        } else {
+            engine.setAdaptiveQuality(false);
+        }
+
+        WavFileWriter render;
+        if (config.renderPath && passIndex == 0 &&
+            !render.open(config.renderPath, NUM_CHANNELS, header.sampleRate)) {
+            printf("Cannot create %s\n", config.renderPath);
+            return pass;
+        }
+
+        std::vector<float> outputs[NUM_CHANNELS];
+        for (auto& output : outputs) {
+            output.resize(header.maxBlockSize);
+        }
+        std::vector<float> interleaved(static_cast<size_t>(header.maxBlockSize) * NUM_CHANNELS);
+
+        SessionReader::Block block;
+        while (reader.readBlock(block)) {
+            // Values set between blocks, then the block's own automation
+            for (const ParameterEvent& set : block.sets) {
+                engine.setParameter(set.id, set.value);
+            }
+            if (block.index == 0) {
+                engine.reset();     // Ramps start at the captured values
+            }
+            for (const ParameterEvent& event : block.events) {
+                engine.scheduleParameter(event.id, event.value, event.sampleOffset);
+            }
+            if (!config.adaptive) {
+                engine.setQualityCeiling(static_cast<QualityTier>(block.tier));
+            }
+            if (block.pipelined != engine.isPipelined()) {
+                engine.setPipelinedMode(block.pipelined);
+            }
+
+            float* outputPointers[NUM_CHANNELS] = { outputs[0].data(), outputs[1].data() };
+            const auto start = std::chrono::steady_clock::now();
+            engine.processBlock(block.channels, outputPointers, block.numChannels, block.numSamples);
+            const uint64_t nanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+
+            if (block.index >= results.size()) {
+                BlockResult result;
+                result.startFrame = block.startFrame;
+                result.numSamples = static_cast<uint32_t>(block.numSamples);
+                result.liveNanoseconds = block.liveNanoseconds;
+                result.tier = static_cast<uint8_t>(block.tier);
+                for (const ParameterEvent& set : block.sets) {
+                    result.changedMask |= static_cast<uint16_t>(1u << static_cast<int>(set.id));
+                }
+                for (const ParameterEvent& event : block.events) {
+                    result.changedMask |= static_cast<uint16_t>(1u << static_cast<int>(event.id));
+                }
+                results.push_back(result);
+            }
+            BlockResult& result = results[block.index];
+            result.replayNanoseconds = std::min(result.replayNanoseconds, nanoseconds);
+
+            for (int ch = 0; ch < block.numChannels; ++ch) {
+                hashSamples(pass.outputHash, outputs[ch].data(), block.numSamples);
+            }
+            if (render.isOpen()) {
+                for (int i = 0; i < block.numSamples; ++i) {
+                    interleaved[i * NUM_CHANNELS] = outputs[0][i];
+                    interleaved[i * NUM_CHANNELS + 1] = outputs[block.numChannels - 1][i];
+                }
+                render.write(interleaved.data(), block.numSamples);
+            }
+        }
+
+        if (render.isOpen()) {
+            render.close();
+        }
+        pass.truncated = reader.isTruncated();
+        pass.ok = true;
+        return pass;
+    }
+
+    std::string describeChanges(uint16_t mask) {
+        std::string text;
+        for (int p = 0; p < SessionCapture::NUM_PARAMETERS; ++p) {
+            if (mask & (1u << p)) {
+                text += text.empty() ? "" : ",";
+                text += PARAMETER_NAMES[p];
+            }
+        }
+        return text.empty() ? "-" : text;
+    }
+
+    void printDistribution(const char* label, const BlockTimeHistogram::Snapshot& times) {
+        printf("  %-7s mean %8.1f us  p50 %8.1f  p99 %8.1f  p99.9 %8.1f  max %8.1f   over 80%% %llu, misses %llu\n",
+               label, times.getMeanNanoseconds() * 1e-3, times.getPercentile(50.0) * 1e-3,
+               times.getPercentile(99.0) * 1e-3, times.getPercentile(99.9) * 1e-3, times.maxNanoseconds * 1e-3,
+               static_cast<unsigned long long>(times.overThreshold[BlockTimeHistogram::Over80Percent]),
+               static_cast<unsigned long long>(times.getDeadlineMisses()));
+    }
+
+    void writeDistribution(FILE* file, const char* name, const BlockTimeHistogram::Snapshot& times) {
+        fprintf(file, "  \"%s\": {\"mean_us\": %.2f, \"p50_us\": %.2f, \"p99_us\": %.2f, \"p999_us\": %.2f, "
+                      "\"max_us\": %.2f, \"misses\": %llu},\n",
+                name, times.getMeanNanoseconds() * 1e-3, times.getPercentile(50.0) * 1e-3,
+                times.getPercentile(99.0) * 1e-3, times.getPercentile(99.9) * 1e-3, times.maxNanoseconds * 1e-3,
+                static_cast<unsigned long long>(times.getDeadlineMisses()));
+    }
+}
+
+int main(int argc, char** argv) {
+    Config config;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            config.repeat = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            config.top = std::max(0, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--render") == 0 && i + 1 < argc) {
+            config.renderPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            config.jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--adaptive") == 0) {
+            config.adaptive = true;
+        } else if (argv[i][0] != '-' && !config.sessionPath) {
+            config.sessionPath = argv[i];
+        } else {
+            config.sessionPath = nullptr;
+            break;
+        }
+    }
+    if (!config.sessionPath) {
+        printf("Usage: %s <session.vmsc> [--repeat n] [--top n] [--render output.wav] [--json replay.json] "
+               "[--adaptive]\n", argv[0]);
+        return 2;
+    }
+
+    SessionReader probe;
+    if (!probe.open(config.sessionPath)) {
+        return 2;
+    }
+    const SessionCapture::Header header = probe.getHeader();
+    probe.close();
+    printf("\nSession replay: %s, %.0f Hz, max %u frames, tail 1/%d, %s, quality %s\n", config.sessionPath,
+           header.sampleRate, header.maxBlockSize, header.tailDecimation, header.simdEnabled ? "SIMD" : "scalar",
+           config.adaptive ? "adaptive" : "as captured");
+
+    std::vector<BlockResult> results;
+    std::vector<Pass> passes;
+    for (int p = 0; p < config.repeat; ++p) {
+        passes.push_back(replay(config, p, results));
+        if (!passes.back().ok) {
+            return 2;
+        }
+    }
+    if (passes.front().truncated) {
+        printf("  Session ends with an incomplete block (capture overflow or crash); replayed up to it\n");
+    }
+
+    // Distributions: each block against its own period
+    BlockTimeHistogram replayTimes;
+    BlockTimeHistogram liveTimes;
+    uint64_t frames = 0;
+    int changedBlocks = 0;
+    for (const BlockResult& result : results) {
+        const uint64_t periodNanoseconds = static_cast<uint64_t>(result.numSamples * 1e9 / header.sampleRate);
+        replayTimes.record(result.replayNanoseconds, periodNanoseconds);
+        liveTimes.record(result.liveNanoseconds, periodNanoseconds);
+        frames += result.numSamples;
+        changedBlocks += result.changedMask != 0 ? 1 : 0;
+    }
+    printf("  %zu blocks, %.1f s of audio, %d with parameter changes, %d pass%s\n\n", results.size(),
+           frames / header.sampleRate, changedBlocks, config.repeat, config.repeat == 1 ? "" : "es (fastest kept)");
+    const BlockTimeHistogram::Snapshot replaySnapshot = replayTimes.snapshot();
+    const BlockTimeHistogram::Snapshot liveSnapshot = liveTimes.snapshot();
+    printDistribution("replay", replaySnapshot);
+    printDistribution("live", liveSnapshot);
+
+    // Slowest replayed blocks
+    std::vector<size_t> order(results.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    const size_t top = std::min(order.size(), static_cast<size_t>(config.top));
+    std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(top), order.end(),
+                      [&](size_t a, size_t b) { return results[a].replayNanoseconds > results[b].replayNanoseconds; });
+    if (top > 0) {
+        printf("\n  %8s %10s %10s %10s %6s %5s  %s\n", "block", "time s", "replay us", "live us", "load", "tier",
+               "changed");
+        for (size_t i = 0; i < top; ++i) {
+            const BlockResult& result = results[order[i]];
+            const double periodNanoseconds = result.numSamples * 1e9 / header.sampleRate;
+            printf("  %8zu %10.3f %10.1f %10.1f %5.0f%% %5d  %s\n", order[i], result.startFrame / header.sampleRate,
+                   result.replayNanoseconds * 1e-3, result.liveNanoseconds * 1e-3,
+                   100.0 * result.replayNanoseconds / periodNanoseconds, result.tier,
+                   describeChanges(result.changedMask).c_str());
+        }
+    }
+
+    bool deterministic = true;
+    for (const Pass& pass : passes) {
+        deterministic = deterministic && pass.outputHash == passes.front().outputHash;
+    }
+    printf("\n  Output hash %016llx%s\n", static_cast<unsigned long long>(passes.front().outputHash),
+           config.repeat == 1 ? "" : (deterministic ? " (identical in every pass)" : " (PASSES DIFFER)"));
+    if (config.renderPath) {
+        printf("  Rendered %s\n", config.renderPath);
+    }
+
+    if (config.jsonPath) {
+        FILE* file = fopen(config.jsonPath, "w");
+        if (!file) {
+            printf("Cannot create %s\n", config.jsonPath);
+            return 2;
+        }
+        fprintf(file, "{\n");
+        fprintf(file, "  \"session\": \"%s\",\n", config.sessionPath);
+        fprintf(file, "  \"sample_rate\": %.0f,\n", header.sampleRate);
+        fprintf(file, "  \"blocks\": %zu,\n", results.size());
+        fprintf(file, "  \"repeat\": %d,\n", config.repeat);
+        fprintf(file, "  \"deterministic\": %s,\n", deterministic ? "true" : "false");
+        writeDistribution(file, "replay", replaySnapshot);
+        writeDistribution(file, "live", liveSnapshot);
+        fprintf(file, "  \"per_block\": [\n");
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BlockResult& result = results[i];
+            fprintf(file, "    {\"frame\": %llu, \"frames\": %u, \"replay_us\": %.2f, \"live_us\": %.2f, "
+                          "\"tier\": %d, \"changed\": \"%s\"}%s\n",
+                    static_cast<unsigned long long>(result.startFrame), result.numSamples,
+                    result.replayNanoseconds * 1e-3, result.liveNanoseconds * 1e-3, result.tier,
+                    result.changedMask ? describeChanges(result.changedMask).c_str() : "",
+                    i + 1 < results.size() ? "," : "");
+        }
+        fprintf(file, "  ]\n}\n");
+        fclose(file);
+        printf("  Per-block timing written to %s\n", config.jsonPath);
+    }
+
+    return deterministic ? 0 : 1;
+}
@@ -0,0 +1,532 @@
+// Accelerated soak test: one ReverbEngine per core runs back to back (no
+// pacing) through hours of simulated audio - programme material alternating
+// with long silences, random parameter automation every couple of seconds.
+// Every engine simulates the whole --hours span (extra engines add coverage,
+// not speed), so with a core per thread the wall time is --hours divided by
+// one engine's speed: about 50x realtime in a Release build, roughly half an
+// hour for 24 hours. Every interval of simulated time it records, per engine:
+//   - block time (mean, p99, max from the engine's BlockTimeHistogram) and,
+//     separately, the mean for silent input, where decaying tails fall into
+//     denormal range,
+//   - NaN/Inf and subnormal output samples,
+//   - a reference probe: fixed parameters and 2 s of fixed-seed noise on the
+//     soaked engine itself (no reset; a 4 s settle lets its tail wash out),
+//     whose output level and block time should not move over the session.
+// One more thread follows a ModulatedDelay LFO for the whole session and
+// compares its float phase with the exact phase.
+//
+// The run fails on any NaN/Inf, on probe level drift beyond the tolerance, or
+// when the probe's block time grows by more than the limit between the first
+// and last quarter of the session.
+//
+// Usage: soak_test [--hours 24] [--engines N] [--intervals 48] [--block 256]
+//                  [--rate 48000] [--output soak_test.json]
+// Exit status: 0 pass, 1 instability found, 2 usage or setup error.
+
+#include "BlockTimeHistogram.hpp"
+#include "FDNReverb.hpp"
+#include "ReverbEngine.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace VoiceMonitor;
+
+namespace {
+    constexpr int NUM_CHANNELS = 2;
+    constexpr double AUTOMATION_SECONDS = 2.0;          // Mean time between parameter moves
+    constexpr double MIN_SEGMENT_SECONDS = 1.0;         // Input programme segments
+    constexpr double MAX_SEGMENT_SECONDS = 30.0;
+    constexpr double PROBE_SETTLE_SECONDS = 4.0;        // Two reference RT60s: the soaked tail washes out
+    constexpr double PROBE_SECONDS = 2.0;
+    constexpr float ROOM_SIZE_STEP = 0.04f;             // Below the FDN's flush threshold
+    constexpr double LEVEL_DRIFT_TOLERANCE_DB = 0.5;
+    constexpr double CPU_GROWTH_LIMIT = 1.5;            // Last/first quarter probe block time
+    constexpr float LFO_RATE_HZ = 0.47f;                // Fastest loop LFO
+    constexpr float LFO_DEPTH = 4.0f;
+    constexpr double TWO_PI = 6.283185307179586;
+
+    struct Config {
+        double hours = 24.0;
+        int engines = 1;
+        int intervals = 48;
+        int blockSize = 256;
+        double sampleRate = 48000.0;
+    };
+
+    struct Interval {
+        double endHours = 0.0;
+        double meanNanoseconds = 0.0;
+        uint64_t p99Nanoseconds = 0;
+        uint64_t maxNanoseconds = 0;
+        double silentMeanNanoseconds = 0.0;
+        uint64_t nonFinite = 0;
+        uint64_t subnormal = 0;
+        double probeLevelDb = 0.0;
+        double probeNanoseconds = 0.0;
+    };
+
+    struct EngineRun {
+        std::vector<Interval> intervals;
+        bool ok = true;
+    };
+
+    struct LfoRun {
+        double phaseErrorRadians = 0.0;     // Float accumulator - exact, at the end
+        double frequencyErrorPpm = 0.0;
+        bool bounded = true;                // Phase always within [0, 2 pi] (+ offset)
+    };
+
+    double toDecibels(double rms) {
+        return rms > 1e-12 ? 20.0 * std::log10(rms) : -240.0;
+    }
+
+    // Random programme material: the kinds of input a monitoring session sees
+    class InputProgramme {
+    public:
+        explicit InputProgramme(uint32_t seed, double sampleRate)
+            : rng_(seed)
+            , sampleRate_(sampleRate) {
+            nextSegment();
+        }
+
+        // Fills one block; returns true when it is all silence
+        bool render(float* left, float* right, int numSamples) {
+            std::uniform_real_distribution<float> white(-1.0f, 1.0f);
+            bool silent = true;
+            for (int i = 0; i < numSamples; ++i) {
+                if (remaining_ <= 0) {
+                    nextSegment();
+                }
+                --remaining_;
+                float sample = 0.0f;
+                switch (kind_) {
+                    case Kind::Silence:
+                        break;
+                    case Kind::Noise:
+                        sample = amplitude_ * white(rng_);
+                        break;
+                    case Kind::Speech: {
+                        // Noise gated by a ~4 Hz syllable envelope
+                        phase_ += TWO_PI * 4.0 / sampleRate_;
+                        const float envelope = static_cast<float>(std::max(0.0, std::sin(phase_)));
+                        sample = amplitude_ * envelope * envelope * white(rng_);
+                        break;
+                    }
+                    case Kind::Tone:
+                        phase_ += TWO_PI * frequency_ / sampleRate_;
+                        sample = amplitude_ * static_cast<float>(std::sin(phase_));
+                        break;
+                }
+                if (phase_ > TWO_PI) {
+                    phase_ -= TWO_PI;
+                }
+                left[i] = sample;
+                right[i] = (kind_ == Kind::Noise) ? amplitude_ * white(rng_) : sample;
+                silent = silent && kind_ == Kind::Silence;
+            }
+            return silent;
+        }
+
+    private:
+        enum class Kind { Silence, Noise, Speech, Tone };
+
+        void nextSegment() {
+            std::uniform_int_distribution<int> kind(0, 3);
+            std::uniform_real_distribution<double> seconds(MIN_SEGMENT_SECONDS, MAX_SEGMENT_SECONDS);
+            std::uniform_real_distribution<float> level(0.01f, 0.5f);
+            std::uniform_real_distribution<double> frequency(60.0, 4000.0);
+            kind_ = static_cast<Kind>(kind(rng_));
+            remaining_ = static_cast<int64_t>(seconds(rng_) * sampleRate_);
+            amplitude_ = level(rng_);
+            frequency_ = frequency(rng_);
+        }
+
+        std::mt19937 rng_;
+        double sampleRate_;
+        Kind kind_ = Kind::Silence;
+        int64_t remaining_ = 0;
+        float amplitude_ = 0.0f;
+        double frequency_ = 0.0;
+        double phase_ = 0.0;
+    };
+
+    // One random parameter move, in the ranges the UI allows
+    void automate(ReverbEngine& engine, std::mt19937& rng) {
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        switch (std::uniform_int_distribution<int>(0, 9)(rng)) {
+            case 0: engine.setWetDryMix(100.0f * unit(rng)); break;
+            case 1: engine.setDecayTime(0.1f + 7.9f * unit(rng)); break;
+            case 2: engine.setPreDelay(200.0f * unit(rng)); break;
+            case 3: engine.setCrossFeed(unit(rng)); break;
+            case 4: engine.setRoomSize(std::clamp(engine.getRoomSize() + ROOM_SIZE_STEP * (2.0f * unit(rng) - 1.0f),
+                                                  0.0f, 1.0f)); break;
+            case 5: engine.setDensity(100.0f * unit(rng)); break;
+            case 6: engine.setHighFreqDamping(100.0f * unit(rng)); break;
+            case 7: engine.setLowFreqDamping(100.0f * unit(rng)); break;
+            case 8: engine.setStereoWidth(2.0f * unit(rng)); break;
+            default: engine.setInputGain(-12.0f + 18.0f * unit(rng)); break;
+        }
+    }
+
+    void setReferenceParameters(ReverbEngine& engine) {
+        engine.setWetDryMix(50.0f);
+        engine.setDecayTime(2.0f);
+        engine.setPreDelay(20.0f);
+        engine.setCrossFeed(0.5f);
+        engine.setRoomSize(0.6f);
+        engine.setDensity(70.0f);
+        engine.setHighFreqDamping(50.0f);
+        engine.setLowFreqDamping(20.0f);
+        engine.setStereoWidth(1.0f);
+        engine.setInputGain(0.0f);
+        engine.setOutputGain(0.0f);
+    }
+
+    class EngineSoak {
+    public:
+        EngineSoak(const Config& config, int index, std::atomic<uint64_t>& progress)
+            : config_(config)
+            , index_(index)
+            , progress_(progress) {
+            for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+                input_[ch].assign(config.blockSize, 0.0f);
+                output_[ch].assign(config.blockSize, 0.0f);
+            }
+        }
+
+        void run(EngineRun& result) {
+            ReverbEngine engine;
+            if (!engine.initialize(config_.sampleRate, config_.blockSize)) {
+                result.ok = false;
+                return;
+            }
+            engine.setAdaptiveQuality(false);           // Fixed tier: block time trends are the engine's own
+            engine.setPreset(ReverbEngine::Preset::Studio);
+
+            std::mt19937 rng(1000u + static_cast<uint32_t>(index_));
+            InputProgramme programme(2000u + static_cast<uint32_t>(index_), config_.sampleRate);
+            std::exponential_distribution<double> automationGap(1.0 / AUTOMATION_SECONDS);
+
+            const double blockSeconds = config_.blockSize / config_.sampleRate;
+            const uint64_t totalBlocks = static_cast<uint64_t>(config_.hours * 3600.0 / blockSeconds);
+            uint64_t block = 0;
+            double nextAutomation = automationGap(rng);
+
+            for (int i = 0; i < config_.intervals; ++i) {
+                const uint64_t intervalEnd = totalBlocks * static_cast<uint64_t>(i + 1) /
+                                             static_cast<uint64_t>(config_.intervals);
+                Interval interval;
+                const BlockTimeHistogram::Snapshot before = engine.getBlockTimeStatistics();
+                double silentNanoseconds = 0.0;
+                uint64_t silentBlocks = 0;
+
+                for (; block < intervalEnd; ++block) {
+                    if (block * blockSeconds >= nextAutomation) {
+                        automate(engine, rng);
+                        nextAutomation += automationGap(rng);
+                    }
+                    const bool silent = programme.render(input_[0].data(), input_[1].data(), config_.blockSize);
+                    const double nanoseconds = processTimed(engine);
+                    if (silent) {
+                        silentNanoseconds += nanoseconds;
+                        ++silentBlocks;
+                    }
+                    scanOutput(interval);
+                    if ((block & 255) == 0) {
+                        progress_.fetch_add(256, std::memory_order_relaxed);
+                    }
+                }
+
+                const BlockTimeHistogram::Snapshot times = engine.getBlockTimeStatistics() - before;
+                interval.endHours = block * blockSeconds / 3600.0;
+                interval.meanNanoseconds = times.getMeanNanoseconds();
+                interval.p99Nanoseconds = times.getPercentile(99.0);
+                interval.maxNanoseconds = times.maxNanoseconds;
+                interval.silentMeanNanoseconds = silentBlocks ? silentNanoseconds / silentBlocks : 0.0;
+                runProbe(engine, interval);
+                result.intervals.push_back(interval);
+            }
+        }
+
+    private:
+        double processTimed(ReverbEngine& engine) {
+            const float* inputs[NUM_CHANNELS] = { input_[0].data(), input_[1].data() };
+            float* outputs[NUM_CHANNELS] = { output_[0].data(), output_[1].data() };
+            const auto start = std::chrono::steady_clock::now();
+            engine.processBlock(inputs, outputs, NUM_CHANNELS, config_.blockSize);
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        void scanOutput(Interval& interval) {
+            for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+                for (float sample : output_[ch]) {
+                    const int kind = std::fpclassify(sample);
+                    interval.nonFinite += (kind == FP_NAN || kind == FP_INFINITE);
+                    interval.subnormal += (kind == FP_SUBNORMAL);
+                }
+            }
+        }
+
+        // Same parameters, same noise every time: level and cost must repeat. The
+        // engine keeps its soaked state (delay lines, filters, LFO phases), so
+        // anything that accumulates shows up here; only the tail of the
+        // programme before the probe is left to decay during the settle period.
+        void runProbe(ReverbEngine& engine, Interval& interval) {
+            const float wetDry = engine.getWetDryMix();
+            const float decay = engine.getDecayTime();
+            const float roomSize = engine.getRoomSize();
+            setReferenceParameters(engine);
+
+            std::mt19937 noise(7);
+            std::uniform_real_distribution<float> white(-0.25f, 0.25f);
+            const int settleBlocks = static_cast<int>(PROBE_SETTLE_SECONDS * config_.sampleRate / config_.blockSize);
+            const int probeBlocks = static_cast<int>(PROBE_SECONDS * config_.sampleRate / config_.blockSize);
+            double energy = 0.0;
+            double nanoseconds = 0.0;
+            for (int b = 0; b < settleBlocks + probeBlocks; ++b) {
+                for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+                    for (float& sample : input_[ch]) {
+                        sample = white(noise);
+                    }
+                }
+                const double blockNanoseconds = processTimed(engine);
+                scanOutput(interval);
+                if (b < settleBlocks) {
+                    continue;           // Ramps settle, the previous tail decays
+                }
+                nanoseconds += blockNanoseconds;
+                for (int ch = 0; ch < NUM_CHANNELS; ++ch) {
+                    for (float sample : output_[ch]) {
+                        energy += static_cast<double>(sample) * sample;
+                    }
+                }
+            }
+            interval.probeLevelDb = toDecibels(std::sqrt(energy / (static_cast<double>(probeBlocks) *
+                                                                  config_.blockSize * NUM_CHANNELS)));
+            interval.probeNanoseconds = nanoseconds / probeBlocks;
+
+            // Back to where the automation was (the rest follows with later moves)
+            engine.setWetDryMix(wetDry);
+            engine.setDecayTime(decay);
+            engine.setRoomSize(roomSize);
+        }
+
+        const Config& config_;
+        int index_;
+        std::atomic<uint64_t>& progress_;
+        std::vector<float> input_[NUM_CHANNELS];
+        std::vector<float> output_[NUM_CHANNELS];
+    };
+
+    double median(std::vector<double> values) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+
+    bool writeJson(const char* path, const Config& config, const std::vector<EngineRun>& runs,
+                   const LfoRun& lfo, double wallSeconds) {
+        FILE* file = fopen(path, "w");
+        if (!file) {
+            return false;
+        }
+        fprintf(file, "{\n");
+        fprintf(file, "  \"benchmark\": \"soak_test\",\n");
+        fprintf(file, "  \"simulated_hours\": %.3f,\n", config.hours);
+        fprintf(file, "  \"sample_rate\": %.0f,\n", config.sampleRate);
+        fprintf(file, "  \"block_size\": %d,\n", config.blockSize);
+        fprintf(file, "  \"wall_seconds\": %.1f,\n", wallSeconds);
+        fprintf(file, "  \"lfo\": {\"rate_hz\": %.3f, \"phase_error_degrees\": %.4f, \"frequency_error_ppm\": %.3f, "
+                      "\"bounded\": %s},\n",
+                LFO_RATE_HZ, lfo.phaseErrorRadians * 360.0 / TWO_PI, lfo.frequencyErrorPpm,
+                lfo.bounded ? "true" : "false");
+        fprintf(file, "  \"engines\": [\n");
+        for (size_t e = 0; e < runs.size(); ++e) {
+            fprintf(file, "    [\n");
+            const std::vector<Interval>& intervals = runs[e].intervals;
+            for (size_t i = 0; i < intervals.size(); ++i) {
+                const Interval& r = intervals[i];
+                fprintf(file, "      {\"hours\": %.3f, \"mean_ns\": %.0f, \"p99_ns\": %llu, \"max_ns\": %llu, "
+                              "\"silent_mean_ns\": %.0f, \"non_finite\": %llu, \"subnormal\": %llu, "
+                              "\"probe_level_db\": %.3f, \"probe_ns\": %.0f}%s\n",
+                        r.endHours, r.meanNanoseconds, static_cast<unsigned long long>(r.p99Nanoseconds),
+                        static_cast<unsigned long long>(r.maxNanoseconds), r.silentMeanNanoseconds,
+                        static_cast<unsigned long long>(r.nonFinite), static_cast<unsigned long long>(r.subnormal),
+                        r.probeLevelDb, r.probeNanoseconds, i + 1 < intervals.size() ? "," : "");
+            }
+            fprintf(file, "    ]%s\n", e + 1 < runs.size() ? "," : "");
+        }
+        fprintf(file, "  ]\n}\n");
+        return fclose(file) == 0;
+    }
+}
+
+namespace VoiceMonitor {
+
+// A loop LFO over the whole session, its float phase against the exact one
+// (a class, as FDNReverb's friend, for the nested ModulatedDelay)
+class LfoSoak {
+public:
+    static void run(const Config& config, LfoRun& result) {
+        FDNReverb::ModulatedDelay delay(FDNReverb::MAX_DELAY_LENGTH);
+        delay.updateSampleRate(config.sampleRate);
+        delay.setBaseDelay(1499.0f);
+        delay.setModulation(LFO_DEPTH, LFO_RATE_HZ);
+        delay.setEnabled(true);
+        delay.clear();
+
+        const uint64_t totalSamples = static_cast<uint64_t>(config.hours * 3600.0 * config.sampleRate);
+        const double start = delay.getModPhase();
+        double previous = start;
+        uint64_t wraps = 0;
+        for (uint64_t n = 0; n < totalSamples; ++n) {
+            delay.write(0.0f);
+            const double phase = delay.getModPhase();
+            if (phase < previous) {
+                ++wraps;
+            }
+            if (!(phase >= 0.0 && phase <= TWO_PI + 1e-3)) {
+                result.bounded = false;
+            }
+            previous = phase;
+        }
+
+        const double accumulated = wraps * TWO_PI + previous - start;
+        const double exact = TWO_PI * static_cast<double>(LFO_RATE_HZ) * totalSamples / config.sampleRate;
+        result.phaseErrorRadians = accumulated - exact;
+        result.frequencyErrorPpm = exact > 0.0 ? 1e6 * (accumulated / exact - 1.0) : 0.0;
+    }
+};
+
+} // namespace VoiceMonitor
+
+int main(int argc, char** argv) {
+    Config config;
+    config.engines = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    const char* outputPath = "soak_test.json";
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--hours") == 0 && i + 1 < argc) {
+            config.hours = std::max(0.01, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--engines") == 0 && i + 1 < argc) {
+            config.engines = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--intervals") == 0 && i + 1 < argc) {
+            config.intervals = std::max(4, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--block") == 0 && i + 1 < argc) {
+            config.blockSize = std::clamp(std::atoi(argv[++i]), 16, 4096);
+        } else if (std::strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+            config.sampleRate = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            printf("Usage: %s [--hours h] [--engines n] [--intervals n] [--block frames] [--rate hz] "
+                   "[--output file.json]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("\nSoak test: %d engine%s x %g simulated hours at %.0f Hz / %d frames, %d intervals (+1 LFO thread)\n",
+           config.engines, config.engines == 1 ? "" : "s", config.hours, config.sampleRate, config.blockSize,
+           config.intervals);
+
+    // All engines and the LFO follower run at once; this thread reports progress
+    std::vector<EngineRun> runs(config.engines);
+    LfoRun lfo;
+    std::atomic<uint64_t> progress{0};
+    std::atomic<int> finished{0};
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (int e = 0; e < config.engines; ++e) {
+        threads.emplace_back([&, e] {
+            EngineSoak(config, e, progress).run(runs[e]);
+            finished.fetch_add(1);
+        });
+    }
+    threads.emplace_back([&] {
+        LfoSoak::run(config, lfo);
+        finished.fetch_add(1);
+    });
+
+    const double blockSeconds = config.blockSize / config.sampleRate;
+    const double totalBlocks = config.hours * 3600.0 / blockSeconds * config.engines;
+    while (finished.load() < static_cast<int>(threads.size())) {
+        std::this_thread::sleep_for(std::chrono::seconds(10));
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const double done = static_cast<double>(progress.load(std::memory_order_relaxed));
+        printf("  %5.1f%%  %.0f x realtime per engine, %.0f s elapsed\n", 100.0 * std::min(1.0, done / totalBlocks),
+               done * blockSeconds / config.engines / elapsed, elapsed);
+        fflush(stdout);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Verdict per engine: NaN/Inf, probe level drift, probe block time growth
+    int failures = 0;
+    printf("\n%6s %10s %10s %10s %10s %9s %11s %12s\n",
+           "engine", "mean us", "p99 us", "max us", "silent us", "non-fin", "level drift", "cpu growth");
+    for (int e = 0; e < config.engines; ++e) {
+        const EngineRun& run = runs[e];
+        if (!run.ok || run.intervals.empty()) {
+            printf("%6d   engine initialization failed\n", e);
+            ++failures;
+            continue;
+        }
+
+        uint64_t nonFinite = 0;
+        uint64_t maxNanoseconds = 0;
+        double drift = 0.0;
+        std::vector<double> means, p99s, silent, firstQuarter, lastQuarter;
+        const size_t quarter = std::max<size_t>(1, run.intervals.size() / 4);
+        for (size_t i = 0; i < run.intervals.size(); ++i) {
+            const Interval& r = run.intervals[i];
+            nonFinite += r.nonFinite;
+            maxNanoseconds = std::max(maxNanoseconds, r.maxNanoseconds);
+            drift = std::max(drift, std::fabs(r.probeLevelDb - run.intervals.front().probeLevelDb));
+            means.push_back(r.meanNanoseconds);
+            p99s.push_back(static_cast<double>(r.p99Nanoseconds));
+            silent.push_back(r.silentMeanNanoseconds);
+            if (i < quarter) {
+                firstQuarter.push_back(r.probeNanoseconds);
+            }
+            if (i >= run.intervals.size() - quarter) {
+                lastQuarter.push_back(r.probeNanoseconds);
+            }
+        }
+        const double growth = median(lastQuarter) / std::max(1.0, median(firstQuarter));
+        const bool failed = nonFinite > 0 || drift > LEVEL_DRIFT_TOLERANCE_DB || growth > CPU_GROWTH_LIMIT;
+        failures += failed;
+        printf("%6d %10.1f %10.1f %10.1f %10.1f %9llu %8.3f dB %11.2fx%s\n",
+               e, median(means) * 1e-3, median(p99s) * 1e-3, maxNanoseconds * 1e-3, median(silent) * 1e-3,
+               static_cast<unsigned long long>(nonFinite), drift, growth, failed ? "  FAIL" : "");
+    }
+
+    printf("\nLFO (%.2f Hz) after %g h: phase error %.3f degrees, frequency error %.2f ppm%s\n",
+           LFO_RATE_HZ, config.hours, lfo.phaseErrorRadians * 360.0 / TWO_PI, lfo.frequencyErrorPpm,
+           lfo.bounded ? "" : ", phase left [0, 2 pi]  FAIL");
+    failures += !lfo.bounded;
+
+    if (!writeJson(outputPath, config, runs, lfo, wallSeconds)) {
+        printf("Failed to write %s\n", outputPath);
+        return 2;
+    }
+    printf("Intervals written to %s (%.0f s wall)\n", outputPath, wallSeconds);
+    printf("%s: %d failure%s (level drift tolerance %.1f dB, block time growth limit %.1fx)\n",
+           failures ? "FAILED" : "PASSED", failures, failures == 1 ? "" : "s", LEVEL_DRIFT_TOLERANCE_DB,
+           CPU_GROWTH_LIMIT);
+    return failures ? 1 : 0;
+}